@@ -18,6 +18,22 @@ namespace demoproject {
 ////////////////////////////////////////////////////////////////
 namespace EEffectCenter
 {
+    static constexpr std::string_view enumNames[] =
+    {
+        "Caster",
+        "Target",
+        "Affected",
+    };
+
+    static constexpr int enumSortedValues[] =
+    {
+        2,    // Affected
+        0,    // Caster
+        1,    // Target
+    };
+
+    static constexpr gugu::DataEnumTable enumTable = { enumNames, enumSortedValues, 3 };
+
     void Register()
     {
         gugu::DataEnumInfos* enumInfos = new gugu::DataEnumInfos;
@@ -34,6 +50,11 @@ namespace EEffectCenter
         return gugu::GetResources()->GetDataEnumInfos("effectCenter");
     }
 
+    const gugu::DataEnumTable& GetDataEnumTable()
+    {
+        return enumTable;
+    }
+
     void GetEnumValues(std::vector<EEffectCenter::Type>& enumValues)
     {
         enumValues.reserve(3);
@@ -54,6 +75,20 @@ namespace EEffectCenter
 ////////////////////////////////////////////////////////////////
 namespace EProjectileAim
 {
+    static constexpr std::string_view enumNames[] =
+    {
+        "Direction",
+        "Cursor",
+    };
+
+    static constexpr int enumSortedValues[] =
+    {
+        1,    // Cursor
+        0,    // Direction
+    };
+
+    static constexpr gugu::DataEnumTable enumTable = { enumNames, enumSortedValues, 2 };
+
     void Register()
     {
         gugu::DataEnumInfos* enumInfos = new gugu::DataEnumInfos;
@@ -69,6 +104,11 @@ namespace EProjectileAim
         return gugu::GetResources()->GetDataEnumInfos("projectileAim");
     }
 
+    const gugu::DataEnumTable& GetDataEnumTable()
+    {
+        return enumTable;
+    }
+
     void GetEnumValues(std::vector<EProjectileAim::Type>& enumValues)
     {
         enumValues.reserve(2);
@@ -209,7 +249,7 @@ void DS_Effect::ParseMembers(gugu::DataParseContext& context)
 {
     //gugu::DatasheetObject::ParseMembers(context);
 
-    gugu::binding::ReadEnum(context, "center", "effectCenter", center);
+    gugu::binding::ReadEnum(context, "center", EEffectCenter::GetDataEnumTable(), center);
 }
 
 ////////////////////////////////////////////////////////////////
@@ -256,7 +296,7 @@ void DS_EffectProjectile::ParseMembers(gugu::DataParseContext& context)
 {
     DS_Effect::ParseMembers(context);
 
-    gugu::binding::ReadEnum(context, "aim", "projectileAim", aim);
+    gugu::binding::ReadEnum(context, "aim", EProjectileAim::GetDataEnumTable(), aim);
     gugu::binding::ReadFloat(context, "speed", speed);
     gugu::binding::ReadFloat(context, "lifetime", lifetime);
     gugu::binding::ReadInt(context, "maximumHits", maximumHits);
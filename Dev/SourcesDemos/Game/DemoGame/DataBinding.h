@@ -34,6 +34,7 @@ namespace EEffectCenter {
     };
 
     const gugu::DataEnumInfos* GetDataEnumInfos();
+    const gugu::DataEnumTable& GetDataEnumTable();
     void GetEnumValues(std::vector<EEffectCenter::Type>& enumValues);
     size_t GetSize();
 
@@ -49,6 +50,7 @@ namespace EProjectileAim {
     };
 
     const gugu::DataEnumInfos* GetDataEnumInfos();
+    const gugu::DataEnumTable& GetDataEnumTable();
     void GetEnumValues(std::vector<EProjectileAim::Type>& enumValues);
     size_t GetSize();
 
@@ -18,6 +18,26 @@ namespace demoproject {
 ////////////////////////////////////////////////////////////////
 namespace EWeaponType
 {
+    static constexpr std::string_view enumNames[] =
+    {
+        "Unknown",
+        "Sword",
+        "Mace",
+        "Axe",
+        "Crossbow",
+    };
+
+    static constexpr int enumSortedValues[] =
+    {
+        3,    // Axe
+        4,    // Crossbow
+        2,    // Mace
+        1,    // Sword
+        0,    // Unknown
+    };
+
+    static constexpr gugu::DataEnumTable enumTable = { enumNames, enumSortedValues, 5 };
+
     void Register()
     {
         gugu::DataEnumInfos* enumInfos = new gugu::DataEnumInfos;
@@ -36,6 +56,11 @@ namespace EWeaponType
         return gugu::GetResources()->GetDataEnumInfos("weaponType");
     }
 
+    const gugu::DataEnumTable& GetDataEnumTable()
+    {
+        return enumTable;
+    }
+
     void GetEnumValues(std::vector<EWeaponType::Type>& enumValues)
     {
         enumValues.reserve(5);
@@ -130,8 +155,8 @@ void DS_General::ParseMembers(gugu::DataParseContext& context)
     gugu::binding::ReadIntArray(context, "stats list", m_stats);
     gugu::binding::ReadDatasheetReferenceArray(context, "factions list", m_factions);
     gugu::binding::ReadDatasheetInstanceArray(context, "more sprites", "spriteInfo", m_sprites);
-    gugu::binding::ReadEnum(context, "weapon", "weaponType", m_weapon);
-    gugu::binding::ReadEnumArray(context, "available weapons", "weaponType", m_availableWeapons);
+    gugu::binding::ReadEnum(context, "weapon", EWeaponType::GetDataEnumTable(), m_weapon);
+    gugu::binding::ReadEnumArray(context, "available weapons", EWeaponType::GetDataEnumTable(), m_availableWeapons);
     gugu::binding::ReadDatasheetInstance(context, "playableCondition", "condition", playableCondition);
 }
 
@@ -370,6 +395,36 @@ void DS_GameSave::SerializeMembers(gugu::DataSaveContext& context) const
     gugu::binding::WriteDatasaveInstance(context, "player", "playerSave", player);
 }
 
+void DS_GameSave::SerializeBinaryMembers(gugu::DataBinaryWriteContext& context) const
+{
+    //gugu::DatasheetObject::SerializeBinaryMembers(context);
+
+    gugu::binding::WriteBinaryDatasaveInstance(context, 0x2c99c300, player);
+}
+
+bool DS_GameSave::DeserializeBinaryMember(gugu::DataBinaryReadContext& context, gugu::uint32 memberTag)
+{
+    switch (memberTag)
+    {
+    case 0x2c99c300:    // player
+        return gugu::binding::ReadBinaryDatasaveInstance(context, player);
+    }
+
+    return false;
+}
+
+gugu::uint64 DS_GameSave::GetBinarySchemaHash() const
+{
+    return 0x975dcf08cb8f665bull;
+}
+
+void DS_GameSave::GetDatasaveInstances(std::vector<const gugu::DatasaveObject*>& instances) const
+{
+    //gugu::DatasheetObject::GetDatasaveInstances(instances);
+
+    gugu::binding::GatherDatasaveInstance(instances, player);
+}
+
 const std::string& DS_GameSave::GetDataInstanceType() const
 {
     static const std::string dataInstanceType = "gameSave";
@@ -403,6 +458,45 @@ void DS_PlayerSave::SerializeMembers(gugu::DataSaveContext& context) const
     gugu::binding::WriteDatasaveInstanceArray(context, "inventory", "itemSave", inventory);
 }
 
+void DS_PlayerSave::SetMoney(int value)
+{
+    money = value;
+    SetDirty();
+}
+
+void DS_PlayerSave::SerializeBinaryMembers(gugu::DataBinaryWriteContext& context) const
+{
+    //gugu::DatasheetObject::SerializeBinaryMembers(context);
+
+    gugu::binding::WriteBinaryInt(context, 0xe150c94f, money);
+    gugu::binding::WriteBinaryDatasaveInstanceArray(context, 0xfcfdc43f, inventory);
+}
+
+bool DS_PlayerSave::DeserializeBinaryMember(gugu::DataBinaryReadContext& context, gugu::uint32 memberTag)
+{
+    switch (memberTag)
+    {
+    case 0xe150c94f:    // money
+        return gugu::binding::ReadBinaryInt(context, money);
+    case 0xfcfdc43f:    // inventory
+        return gugu::binding::ReadBinaryDatasaveInstanceArray(context, inventory);
+    }
+
+    return false;
+}
+
+gugu::uint64 DS_PlayerSave::GetBinarySchemaHash() const
+{
+    return 0x3a96c055fc77dfdaull;
+}
+
+void DS_PlayerSave::GetDatasaveInstances(std::vector<const gugu::DatasaveObject*>& instances) const
+{
+    //gugu::DatasheetObject::GetDatasaveInstances(instances);
+
+    gugu::binding::GatherDatasaveInstanceArray(instances, inventory);
+}
+
 const std::string& DS_PlayerSave::GetDataInstanceType() const
 {
     static const std::string dataInstanceType = "playerSave";
@@ -437,6 +531,49 @@ void DS_ItemSave::SerializeMembers(gugu::DataSaveContext& context) const
     gugu::binding::WriteInt(context, "quantity", quantity);
 }
 
+void DS_ItemSave::SetItem(const DS_Item* value)
+{
+    item = value;
+    SetDirty();
+}
+
+void DS_ItemSave::SetQuantity(int value)
+{
+    quantity = value;
+    SetDirty();
+}
+
+void DS_ItemSave::SerializeBinaryMembers(gugu::DataBinaryWriteContext& context) const
+{
+    //gugu::DatasheetObject::SerializeBinaryMembers(context);
+
+    gugu::binding::WriteBinaryDatasheetReference(context, 0x9f3833e6, item);
+    gugu::binding::WriteBinaryInt(context, 0x4b728fd8, quantity);
+}
+
+bool DS_ItemSave::DeserializeBinaryMember(gugu::DataBinaryReadContext& context, gugu::uint32 memberTag)
+{
+    switch (memberTag)
+    {
+    case 0x9f3833e6:    // item
+        return gugu::binding::ReadBinaryDatasheetReference(context, item);
+    case 0x4b728fd8:    // quantity
+        return gugu::binding::ReadBinaryInt(context, quantity);
+    }
+
+    return false;
+}
+
+gugu::uint64 DS_ItemSave::GetBinarySchemaHash() const
+{
+    return 0x54a03e8f71c412a4ull;
+}
+
+void DS_ItemSave::GetDatasaveInstances(std::vector<const gugu::DatasaveObject*>& instances) const
+{
+    //gugu::DatasheetObject::GetDatasaveInstances(instances);
+}
+
 const std::string& DS_ItemSave::GetDataInstanceType() const
 {
     static const std::string dataInstanceType = "itemSave";
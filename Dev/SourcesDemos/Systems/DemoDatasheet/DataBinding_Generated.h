@@ -43,6 +43,7 @@ namespace EWeaponType {
     };
 
     const gugu::DataEnumInfos* GetDataEnumInfos();
+    const gugu::DataEnumTable& GetDataEnumTable();
     void GetEnumValues(std::vector<EWeaponType::Type>& enumValues);
     size_t GetSize();
 
@@ -336,6 +337,12 @@ protected:
     virtual void ParseMembers(gugu::DataParseContext& context) override;
     virtual void SerializeMembers(gugu::DataSaveContext& context) const override;
 
+    virtual void SerializeBinaryMembers(gugu::DataBinaryWriteContext& context) const override;
+    virtual bool DeserializeBinaryMember(gugu::DataBinaryReadContext& context, gugu::uint32 memberTag) override;
+    virtual gugu::uint64 GetBinarySchemaHash() const override;
+
+    virtual void GetDatasaveInstances(std::vector<const gugu::DatasaveObject*>& instances) const override;
+
     virtual const std::string& GetDataInstanceType() const override;
 };
 
@@ -352,11 +359,21 @@ public:
     int money;
     std::vector<DS_ItemSave*> inventory;
 
+public:
+
+    void SetMoney(int value);
+
 protected:
 
     virtual void ParseMembers(gugu::DataParseContext& context) override;
     virtual void SerializeMembers(gugu::DataSaveContext& context) const override;
 
+    virtual void SerializeBinaryMembers(gugu::DataBinaryWriteContext& context) const override;
+    virtual bool DeserializeBinaryMember(gugu::DataBinaryReadContext& context, gugu::uint32 memberTag) override;
+    virtual gugu::uint64 GetBinarySchemaHash() const override;
+
+    virtual void GetDatasaveInstances(std::vector<const gugu::DatasaveObject*>& instances) const override;
+
     virtual const std::string& GetDataInstanceType() const override;
 };
 
@@ -373,11 +390,22 @@ public:
     const DS_Item* item;
     int quantity;
 
+public:
+
+    void SetItem(const DS_Item* value);
+    void SetQuantity(int value);
+
 protected:
 
     virtual void ParseMembers(gugu::DataParseContext& context) override;
     virtual void SerializeMembers(gugu::DataSaveContext& context) const override;
 
+    virtual void SerializeBinaryMembers(gugu::DataBinaryWriteContext& context) const override;
+    virtual bool DeserializeBinaryMember(gugu::DataBinaryReadContext& context, gugu::uint32 memberTag) override;
+    virtual gugu::uint64 GetBinarySchemaHash() const override;
+
+    virtual void GetDatasaveInstances(std::vector<const gugu::DatasaveObject*>& instances) const override;
+
     virtual const std::string& GetDataInstanceType() const override;
 };
 
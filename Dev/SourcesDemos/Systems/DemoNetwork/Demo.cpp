@@ -90,7 +90,7 @@ void Demo::OnButtonClick(int _iButtonID)
     }
     else if (_iButtonID == 3)
     {
-        GetNetwork()->SendNetPacketToAll(new NetPacket(ENetPacket::Ping), false);
+        GetNetwork()->SendNetPacketToAll(GetNetwork()->AcquireNetPacket(ENetPacket::Ping), false);
     }
     else if (_iButtonID == 4)
     {
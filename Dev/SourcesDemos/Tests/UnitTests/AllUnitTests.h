@@ -13,8 +13,17 @@ void RunUnitTests_DataBinding(gugu::UnitTestResults* results);
 void RunUnitTests_Element(gugu::UnitTestResults* results);
 void RunUnitTests_Grid(gugu::UnitTestResults* results);
 void RunUnitTests_Math(gugu::UnitTestResults* results);
+void RunUnitTests_Network(gugu::UnitTestResults* results);
 void RunUnitTests_Resources(gugu::UnitTestResults* results);
 void RunUnitTests_System(gugu::UnitTestResults* results);
 void RunUnitTests_Xml(gugu::UnitTestResults* results);
 
+// Number of heap allocations since the start of the application (all threads).
+// - Only counted when built with GUGU_UTEST_COUNT_ALLOCATIONS, the count stays at zero otherwise.
+size_t GetAllocationCount();
+bool IsAllocationCountEnabled();
+
+// Heavy benchmarks (large socket counts, raised process limits, thousands of generated files) only run when the "--benchmarks" argument is provided.
+bool AreHeavyBenchmarksEnabled();
+
 }   // namespace tests
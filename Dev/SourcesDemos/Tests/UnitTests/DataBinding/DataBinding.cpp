@@ -18,6 +18,26 @@ namespace tests {
 ////////////////////////////////////////////////////////////////
 namespace EWeaponType
 {
+    static constexpr std::string_view enumNames[] =
+    {
+        "Unknown",
+        "Sword",
+        "Mace",
+        "Axe",
+        "Crossbow",
+    };
+
+    static constexpr int enumSortedValues[] =
+    {
+        3,    // Axe
+        4,    // Crossbow
+        2,    // Mace
+        1,    // Sword
+        0,    // Unknown
+    };
+
+    static constexpr gugu::DataEnumTable enumTable = { enumNames, enumSortedValues, 5 };
+
     void Register()
     {
         gugu::DataEnumInfos* enumInfos = new gugu::DataEnumInfos;
@@ -36,6 +56,11 @@ namespace EWeaponType
         return gugu::GetResources()->GetDataEnumInfos("weaponType");
     }
 
+    const gugu::DataEnumTable& GetDataEnumTable()
+    {
+        return enumTable;
+    }
+
     void GetEnumValues(std::vector<EWeaponType::Type>& enumValues)
     {
         enumValues.reserve(5);
@@ -94,13 +119,29 @@ DS_Character::~DS_Character()
     supportSkill = nullptr;
 }
 
+gugu::DataObjectArena& DS_Character::GetDataArena()
+{
+    static gugu::DataObjectArena dataArena(sizeof(DS_Character));
+    return dataArena;
+}
+
+void* DS_Character::operator new(size_t size)
+{
+    return GetDataArena().Allocate(size);
+}
+
+void DS_Character::operator delete(void* object)
+{
+    GetDataArena().Deallocate(object);
+}
+
 void DS_Character::ParseMembers(gugu::DataParseContext& context)
 {
     DS_Entity::ParseMembers(context);
 
     gugu::binding::ReadInt(context, "stamina", stamina);
     gugu::binding::ReadFloat(context, "speed", speed);
-    gugu::binding::ReadEnum(context, "weapon", "weaponType", weapon);
+    gugu::binding::ReadEnum(context, "weapon", EWeaponType::GetDataEnumTable(), weapon);
     gugu::binding::ReadDatasheetInstance(context, "unlocked", "condition", unlocked);
     gugu::binding::ReadDatasheetInstance(context, "actionOnDeath", "action", actionOnDeath);
     gugu::binding::ReadDatasheetInstance(context, "attackSkill", "effect", attackSkill);
@@ -131,6 +172,7 @@ void DS_Faction::ParseMembers(gugu::DataParseContext& context)
 DS_Item::DS_Item()
 {
     name = "";
+    description.workstring = "";
     size = gugu::Vector2::Zero_i;
     scale = gugu::Vector2::Zero_f;
 }
@@ -139,11 +181,28 @@ DS_Item::~DS_Item()
 {
 }
 
+gugu::DataObjectArena& DS_Item::GetDataArena()
+{
+    static gugu::DataObjectArena dataArena(sizeof(DS_Item));
+    return dataArena;
+}
+
+void* DS_Item::operator new(size_t size)
+{
+    return GetDataArena().Allocate(size);
+}
+
+void DS_Item::operator delete(void* object)
+{
+    GetDataArena().Deallocate(object);
+}
+
 void DS_Item::ParseMembers(gugu::DataParseContext& context)
 {
     //gugu::DatasheetObject::ParseMembers(context);
 
-    gugu::binding::ReadString(context, "name", name);
+    gugu::binding::ReadInternedString(context, "name", name);
+    gugu::binding::ReadLocalizedString(context, "description", description);
     gugu::binding::ReadVector2(context, "size", size);
     gugu::binding::ReadVector2(context, "scale", scale);
 }
@@ -292,7 +351,7 @@ void DS_EffectBuff::ParseMembers(gugu::DataParseContext& context)
 {
     DS_Effect::ParseMembers(context);
 
-    gugu::binding::ReadString(context, "buff", buff);
+    gugu::binding::ReadInternedString(context, "buff", buff);
     gugu::binding::ReadInt(context, "value", value);
     gugu::binding::ReadDatasheetReference(context, "entityVfx", entityVfx);
 }
@@ -495,7 +554,7 @@ void DS_GameSave::ParseMembers(gugu::DataParseContext& context)
     gugu::binding::ReadInt(context, "score", score);
     gugu::binding::ReadFloat(context, "walkedDistance", walkedDistance);
     gugu::binding::ReadString(context, "name", name);
-    gugu::binding::ReadEnum(context, "singleWeapon", "weaponType", singleWeapon);
+    gugu::binding::ReadEnum(context, "singleWeapon", EWeaponType::GetDataEnumTable(), singleWeapon);
     gugu::binding::ReadVector2(context, "gridPosition", gridPosition);
     gugu::binding::ReadVector2(context, "position", position);
     gugu::binding::ReadDatasheetReference(context, "emptyCharacter", emptyCharacter);
@@ -506,7 +565,7 @@ void DS_GameSave::ParseMembers(gugu::DataParseContext& context)
     gugu::binding::ReadIntArray(context, "multipleScores", multipleScores);
     gugu::binding::ReadFloatArray(context, "multipleFloats", multipleFloats);
     gugu::binding::ReadStringArray(context, "multipleNames", multipleNames);
-    gugu::binding::ReadEnumArray(context, "multipleWeapons", "weaponType", multipleWeapons);
+    gugu::binding::ReadEnumArray(context, "multipleWeapons", EWeaponType::GetDataEnumTable(), multipleWeapons);
     gugu::binding::ReadVector2Array(context, "multipleGridPositions", multipleGridPositions);
     gugu::binding::ReadVector2Array(context, "multiplePositions", multiplePositions);
     gugu::binding::ReadDatasheetReferenceArray(context, "multipleCharacters", multipleCharacters);
@@ -521,7 +580,7 @@ void DS_GameSave::SerializeMembers(gugu::DataSaveContext& context) const
     gugu::binding::WriteInt(context, "score", score);
     gugu::binding::WriteFloat(context, "walkedDistance", walkedDistance);
     gugu::binding::WriteString(context, "name", name);
-    gugu::binding::WriteEnum(context, "singleWeapon", "weaponType", singleWeapon);
+    gugu::binding::WriteEnum(context, "singleWeapon", EWeaponType::GetDataEnumTable(), singleWeapon);
     gugu::binding::WriteVector2(context, "gridPosition", gridPosition);
     gugu::binding::WriteVector2(context, "position", position);
     gugu::binding::WriteDatasheetReference(context, "emptyCharacter", emptyCharacter);
@@ -532,13 +591,204 @@ void DS_GameSave::SerializeMembers(gugu::DataSaveContext& context) const
     gugu::binding::WriteIntArray(context, "multipleScores", multipleScores);
     gugu::binding::WriteFloatArray(context, "multipleFloats", multipleFloats);
     gugu::binding::WriteStringArray(context, "multipleNames", multipleNames);
-    gugu::binding::WriteEnumArray(context, "multipleWeapons", "weaponType", multipleWeapons);
+    gugu::binding::WriteEnumArray(context, "multipleWeapons", EWeaponType::GetDataEnumTable(), multipleWeapons);
     gugu::binding::WriteVector2Array(context, "multipleGridPositions", multipleGridPositions);
     gugu::binding::WriteVector2Array(context, "multiplePositions", multiplePositions);
     gugu::binding::WriteDatasheetReferenceArray(context, "multipleCharacters", multipleCharacters);
     gugu::binding::WriteDatasaveInstanceArray(context, "multipleItems", "itemSave", multipleItems);
 }
 
+void DS_GameSave::SetReadTutorial(bool value)
+{
+    readTutorial = value;
+    SetDirty();
+}
+
+void DS_GameSave::SetScore(int value)
+{
+    score = value;
+    SetDirty();
+}
+
+void DS_GameSave::SetWalkedDistance(float value)
+{
+    walkedDistance = value;
+    SetDirty();
+}
+
+void DS_GameSave::SetName(const std::string& value)
+{
+    name = value;
+    SetDirty();
+}
+
+void DS_GameSave::SetSingleWeapon(EWeaponType::Type value)
+{
+    singleWeapon = value;
+    SetDirty();
+}
+
+void DS_GameSave::SetGridPosition(const gugu::Vector2i& value)
+{
+    gridPosition = value;
+    SetDirty();
+}
+
+void DS_GameSave::SetPosition(const gugu::Vector2f& value)
+{
+    position = value;
+    SetDirty();
+}
+
+void DS_GameSave::SetEmptyCharacter(const DS_Character* value)
+{
+    emptyCharacter = value;
+    SetDirty();
+}
+
+void DS_GameSave::SetSingleCharacter(const DS_Character* value)
+{
+    singleCharacter = value;
+    SetDirty();
+}
+
+void DS_GameSave::SetMultipleBools(const std::vector<bool>& value)
+{
+    multipleBools = value;
+    SetDirty();
+}
+
+void DS_GameSave::SetMultipleScores(const std::vector<int>& value)
+{
+    multipleScores = value;
+    SetDirty();
+}
+
+void DS_GameSave::SetMultipleFloats(const std::vector<float>& value)
+{
+    multipleFloats = value;
+    SetDirty();
+}
+
+void DS_GameSave::SetMultipleNames(const std::vector<std::string>& value)
+{
+    multipleNames = value;
+    SetDirty();
+}
+
+void DS_GameSave::SetMultipleWeapons(const std::vector<EWeaponType::Type>& value)
+{
+    multipleWeapons = value;
+    SetDirty();
+}
+
+void DS_GameSave::SetMultipleGridPositions(const std::vector<gugu::Vector2i>& value)
+{
+    multipleGridPositions = value;
+    SetDirty();
+}
+
+void DS_GameSave::SetMultiplePositions(const std::vector<gugu::Vector2f>& value)
+{
+    multiplePositions = value;
+    SetDirty();
+}
+
+void DS_GameSave::SetMultipleCharacters(const std::vector<const DS_Character*>& value)
+{
+    multipleCharacters = value;
+    SetDirty();
+}
+
+void DS_GameSave::SerializeBinaryMembers(gugu::DataBinaryWriteContext& context) const
+{
+    //gugu::DatasheetObject::SerializeBinaryMembers(context);
+
+    gugu::binding::WriteBinaryBool(context, 0x31882f4f, readTutorial);
+    gugu::binding::WriteBinaryInt(context, 0xd22f9095, score);
+    gugu::binding::WriteBinaryFloat(context, 0x0500910e, walkedDistance);
+    gugu::binding::WriteBinaryString(context, 0x8d39bde6, name);
+    gugu::binding::WriteBinaryEnum(context, 0x15c5b485, EWeaponType::GetDataEnumTable(), singleWeapon);
+    gugu::binding::WriteBinaryVector2(context, 0x44af9816, gridPosition);
+    gugu::binding::WriteBinaryVector2(context, 0x934f4e0a, position);
+    gugu::binding::WriteBinaryDatasheetReference(context, 0x8f7333d9, emptyCharacter);
+    gugu::binding::WriteBinaryDatasheetReference(context, 0xaa8448bc, singleCharacter);
+    gugu::binding::WriteBinaryDatasaveInstance(context, 0xdac7f1ad, emptyItem);
+    gugu::binding::WriteBinaryDatasaveInstance(context, 0xbec64582, singleItem);
+    gugu::binding::WriteBinaryBoolArray(context, 0xdfa412f6, multipleBools);
+    gugu::binding::WriteBinaryIntArray(context, 0x61e802ee, multipleScores);
+    gugu::binding::WriteBinaryFloatArray(context, 0x3fa486be, multipleFloats);
+    gugu::binding::WriteBinaryStringArray(context, 0x8ead798b, multipleNames);
+    gugu::binding::WriteBinaryEnumArray(context, 0xc84c5daa, EWeaponType::GetDataEnumTable(), multipleWeapons);
+    gugu::binding::WriteBinaryVector2Array(context, 0xd6df6c73, multipleGridPositions);
+    gugu::binding::WriteBinaryVector2Array(context, 0x60be054f, multiplePositions);
+    gugu::binding::WriteBinaryDatasheetReferenceArray(context, 0xca9610c5, multipleCharacters);
+    gugu::binding::WriteBinaryDatasaveInstanceArray(context, 0x601fda2b, multipleItems);
+}
+
+bool DS_GameSave::DeserializeBinaryMember(gugu::DataBinaryReadContext& context, gugu::uint32 memberTag)
+{
+    switch (memberTag)
+    {
+    case 0x31882f4f:    // readTutorial
+        return gugu::binding::ReadBinaryBool(context, readTutorial);
+    case 0xd22f9095:    // score
+        return gugu::binding::ReadBinaryInt(context, score);
+    case 0x0500910e:    // walkedDistance
+        return gugu::binding::ReadBinaryFloat(context, walkedDistance);
+    case 0x8d39bde6:    // name
+        return gugu::binding::ReadBinaryString(context, name);
+    case 0x15c5b485:    // singleWeapon
+        return gugu::binding::ReadBinaryEnum(context, EWeaponType::GetDataEnumTable(), singleWeapon);
+    case 0x44af9816:    // gridPosition
+        return gugu::binding::ReadBinaryVector2(context, gridPosition);
+    case 0x934f4e0a:    // position
+        return gugu::binding::ReadBinaryVector2(context, position);
+    case 0x8f7333d9:    // emptyCharacter
+        return gugu::binding::ReadBinaryDatasheetReference(context, emptyCharacter);
+    case 0xaa8448bc:    // singleCharacter
+        return gugu::binding::ReadBinaryDatasheetReference(context, singleCharacter);
+    case 0xdac7f1ad:    // emptyItem
+        return gugu::binding::ReadBinaryDatasaveInstance(context, emptyItem);
+    case 0xbec64582:    // singleItem
+        return gugu::binding::ReadBinaryDatasaveInstance(context, singleItem);
+    case 0xdfa412f6:    // multipleBools
+        return gugu::binding::ReadBinaryBoolArray(context, multipleBools);
+    case 0x61e802ee:    // multipleScores
+        return gugu::binding::ReadBinaryIntArray(context, multipleScores);
+    case 0x3fa486be:    // multipleFloats
+        return gugu::binding::ReadBinaryFloatArray(context, multipleFloats);
+    case 0x8ead798b:    // multipleNames
+        return gugu::binding::ReadBinaryStringArray(context, multipleNames);
+    case 0xc84c5daa:    // multipleWeapons
+        return gugu::binding::ReadBinaryEnumArray(context, EWeaponType::GetDataEnumTable(), multipleWeapons);
+    case 0xd6df6c73:    // multipleGridPositions
+        return gugu::binding::ReadBinaryVector2Array(context, multipleGridPositions);
+    case 0x60be054f:    // multiplePositions
+        return gugu::binding::ReadBinaryVector2Array(context, multiplePositions);
+    case 0xca9610c5:    // multipleCharacters
+        return gugu::binding::ReadBinaryDatasheetReferenceArray(context, multipleCharacters);
+    case 0x601fda2b:    // multipleItems
+        return gugu::binding::ReadBinaryDatasaveInstanceArray(context, multipleItems);
+    }
+
+    return false;
+}
+
+gugu::uint64 DS_GameSave::GetBinarySchemaHash() const
+{
+    return 0x67817ae8ac965130ull;
+}
+
+void DS_GameSave::GetDatasaveInstances(std::vector<const gugu::DatasaveObject*>& instances) const
+{
+    //gugu::DatasheetObject::GetDatasaveInstances(instances);
+
+    gugu::binding::GatherDatasaveInstance(instances, emptyItem);
+    gugu::binding::GatherDatasaveInstance(instances, singleItem);
+    gugu::binding::GatherDatasaveInstanceArray(instances, multipleItems);
+}
+
 const std::string& DS_GameSave::GetDataInstanceType() const
 {
     static const std::string dataInstanceType = "gameSave";
@@ -573,6 +823,49 @@ void DS_ItemSave::SerializeMembers(gugu::DataSaveContext& context) const
     gugu::binding::WriteInt(context, "quantity", quantity);
 }
 
+void DS_ItemSave::SetItem(const DS_Item* value)
+{
+    item = value;
+    SetDirty();
+}
+
+void DS_ItemSave::SetQuantity(int value)
+{
+    quantity = value;
+    SetDirty();
+}
+
+void DS_ItemSave::SerializeBinaryMembers(gugu::DataBinaryWriteContext& context) const
+{
+    //gugu::DatasheetObject::SerializeBinaryMembers(context);
+
+    gugu::binding::WriteBinaryDatasheetReference(context, 0x9f3833e6, item);
+    gugu::binding::WriteBinaryInt(context, 0x4b728fd8, quantity);
+}
+
+bool DS_ItemSave::DeserializeBinaryMember(gugu::DataBinaryReadContext& context, gugu::uint32 memberTag)
+{
+    switch (memberTag)
+    {
+    case 0x9f3833e6:    // item
+        return gugu::binding::ReadBinaryDatasheetReference(context, item);
+    case 0x4b728fd8:    // quantity
+        return gugu::binding::ReadBinaryInt(context, quantity);
+    }
+
+    return false;
+}
+
+gugu::uint64 DS_ItemSave::GetBinarySchemaHash() const
+{
+    return 0x54a03e8f71c412a4ull;
+}
+
+void DS_ItemSave::GetDatasaveInstances(std::vector<const gugu::DatasaveObject*>& instances) const
+{
+    //gugu::DatasheetObject::GetDatasaveInstances(instances);
+}
+
 const std::string& DS_ItemSave::GetDataInstanceType() const
 {
     static const std::string dataInstanceType = "itemSave";
@@ -48,6 +48,7 @@ namespace EWeaponType {
     };
 
     const gugu::DataEnumInfos* GetDataEnumInfos();
+    const gugu::DataEnumTable& GetDataEnumTable();
     void GetEnumValues(std::vector<EWeaponType::Type>& enumValues);
     size_t GetSize();
 
@@ -80,6 +81,11 @@ public:
     DS_Character();
     virtual ~DS_Character();
 
+    static gugu::DataObjectArena& GetDataArena();
+
+    static void* operator new(size_t size);
+    static void operator delete(void* object);
+
 public:
 
     int stamina;
@@ -106,7 +112,7 @@ public:
 public:
 
     std::string name;
-    const DS_Character* leader;
+    gugu::DataArenaRef<DS_Character> leader;
 
 protected:
 
@@ -121,9 +127,15 @@ public:
     DS_Item();
     virtual ~DS_Item();
 
+    static gugu::DataObjectArena& GetDataArena();
+
+    static void* operator new(size_t size);
+    static void operator delete(void* object);
+
 public:
 
-    std::string name;
+    gugu::InternedString name;
+    gugu::LocalizedString description;
     gugu::Vector2i size;
     gugu::Vector2f scale;
 
@@ -250,7 +262,7 @@ public:
 
 public:
 
-    std::string buff;
+    gugu::InternedString buff;
     int value;
     const DS_VFX* entityVfx;
 
@@ -461,11 +473,37 @@ public:
     std::vector<const DS_Character*> multipleCharacters;
     std::vector<DS_ItemSave*> multipleItems;
 
+public:
+
+    void SetReadTutorial(bool value);
+    void SetScore(int value);
+    void SetWalkedDistance(float value);
+    void SetName(const std::string& value);
+    void SetSingleWeapon(EWeaponType::Type value);
+    void SetGridPosition(const gugu::Vector2i& value);
+    void SetPosition(const gugu::Vector2f& value);
+    void SetEmptyCharacter(const DS_Character* value);
+    void SetSingleCharacter(const DS_Character* value);
+    void SetMultipleBools(const std::vector<bool>& value);
+    void SetMultipleScores(const std::vector<int>& value);
+    void SetMultipleFloats(const std::vector<float>& value);
+    void SetMultipleNames(const std::vector<std::string>& value);
+    void SetMultipleWeapons(const std::vector<EWeaponType::Type>& value);
+    void SetMultipleGridPositions(const std::vector<gugu::Vector2i>& value);
+    void SetMultiplePositions(const std::vector<gugu::Vector2f>& value);
+    void SetMultipleCharacters(const std::vector<const DS_Character*>& value);
+
 protected:
 
     virtual void ParseMembers(gugu::DataParseContext& context) override;
     virtual void SerializeMembers(gugu::DataSaveContext& context) const override;
 
+    virtual void SerializeBinaryMembers(gugu::DataBinaryWriteContext& context) const override;
+    virtual bool DeserializeBinaryMember(gugu::DataBinaryReadContext& context, gugu::uint32 memberTag) override;
+    virtual gugu::uint64 GetBinarySchemaHash() const override;
+
+    virtual void GetDatasaveInstances(std::vector<const gugu::DatasaveObject*>& instances) const override;
+
     virtual const std::string& GetDataInstanceType() const override;
 };
 
@@ -482,11 +520,22 @@ public:
     const DS_Item* item;
     int quantity;
 
+public:
+
+    void SetItem(const DS_Item* value);
+    void SetQuantity(int value);
+
 protected:
 
     virtual void ParseMembers(gugu::DataParseContext& context) override;
     virtual void SerializeMembers(gugu::DataSaveContext& context) const override;
 
+    virtual void SerializeBinaryMembers(gugu::DataBinaryWriteContext& context) const override;
+    virtual bool DeserializeBinaryMember(gugu::DataBinaryReadContext& context, gugu::uint32 memberTag) override;
+    virtual gugu::uint64 GetBinarySchemaHash() const override;
+
+    virtual void GetDatasaveInstances(std::vector<const gugu::DatasaveObject*>& instances) const override;
+
     virtual const std::string& GetDataInstanceType() const override;
 };
 
@@ -5,7 +5,13 @@
 #include "Gugu/Engine.h"
 #include "AllUnitTests.h"
 
-#if defined(GUGU_ENV_VISUAL )
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+// Allocation counting replaces the global operator new, it is opt-in (GUGU_UTEST_COUNT_ALLOCATIONS) and excludes the debug heap of the Visual CRT.
+#if defined(GUGU_ENV_VISUAL ) && !defined(GUGU_UTEST_COUNT_ALLOCATIONS)
 
 #define _CRTDBG_MAP_ALLOC
 #include <stdlib.h>
@@ -19,14 +25,73 @@ using namespace tests;
 ////////////////////////////////////////////////////////////////
 // File Implementation
 
+namespace tests {
+
+std::atomic<size_t> allocationCount(0);
+bool heavyBenchmarksEnabled = false;
+
+size_t GetAllocationCount()
+{
+    return allocationCount.load();
+}
+
+bool IsAllocationCountEnabled()
+{
+#if defined(GUGU_UTEST_COUNT_ALLOCATIONS)
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool AreHeavyBenchmarksEnabled()
+{
+    return heavyBenchmarksEnabled;
+}
+
+}   // namespace tests
+
+#if defined(GUGU_UTEST_COUNT_ALLOCATIONS)
+
+// Allocations are counted to measure the allocations done by the tested systems.
+void* operator new(size_t size)
+{
+    ++tests::allocationCount;
+
+    if (void* memory = std::malloc(size > 0 ? size : 1))
+        return memory;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+    std::free(memory);
+}
+
+#endif
+
 int main(int argc, char* argv[])
 {
-#if defined(GUGU_ENV_VISUAL )
+#if defined(GUGU_ENV_VISUAL ) && !defined(GUGU_UTEST_COUNT_ALLOCATIONS)
 
     _CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
 
 #endif
 
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--benchmarks") == 0)
+        {
+            tests::heavyBenchmarksEnabled = true;
+        }
+    }
+
     //----------------------------------------------
 
     //Init engine
@@ -76,6 +141,7 @@ int main(int argc, char* argv[])
     RunUnitTests_DataBinding(&results);
     RunUnitTests_Resources(&results);
     RunUnitTests_Grid(&results);
+    RunUnitTests_Network(&results);
 
     // Finalize Tests.
     GUGU_UTEST_INIT("Finalize", "UnitTests_Finalize.log", &results);
@@ -8,6 +8,7 @@
 // Includes
 
 #include "Gugu/Core/DeltaTime.h"
+#include "Gugu/Core/StepAccumulator.h"
 #include "Gugu/System/Callback.h"
 #include "Gugu/System/Handle.h"
 #include "Gugu/System/Signal.h"
@@ -226,6 +227,83 @@ void RunUnitTests_Core(UnitTestResults* results)
         GUGU_UTEST_CHECK_APPROX_EQUAL(deltaTimeB.unscaled_ms(), 16.f, math::Epsilon6);
         GUGU_UTEST_CHECK_EQUAL(deltaTimeB.unscaled_micro(), 16000);
         GUGU_UTEST_CHECK_APPROX_EQUAL(deltaTimeB.GetScale(), 0.1f, math::Epsilon6);
+
+        DeltaTime deltaTimeC(sf::milliseconds(16), sf::milliseconds(16), 1.f, 0.25f);
+        GUGU_UTEST_CHECK_EQUAL(deltaTimeA.GetStepInterpolation(), 1.f);
+        GUGU_UTEST_CHECK_EQUAL(deltaTimeC.GetStepInterpolation(), 0.25f);
+    }
+
+    //----------------------------------------------
+
+    GUGU_UTEST_SECTION("Step Accumulator");
+    {
+        const sf::Time stepTime = sf::milliseconds(20);
+
+        // Count the steps of a single loop.
+        auto runLoop = [&](StepAccumulator& accumulator, const sf::Time& loopTime, float speedMultiplier)
+        {
+            accumulator.BeginLoop(loopTime * speedMultiplier, stepTime, 5, speedMultiplier);
+
+            int stepCount = 0;
+            while (accumulator.ConsumeStep())
+            {
+                ++stepCount;
+            }
+
+            accumulator.EndLoop();
+            return stepCount;
+        };
+
+        GUGU_UTEST_SUBSECTION("Interpolation");
+        {
+            StepAccumulator accumulator;
+            GUGU_UTEST_CHECK_EQUAL(accumulator.GetInterpolation(), 1.f);
+
+            GUGU_UTEST_CHECK_EQUAL(runLoop(accumulator, sf::milliseconds(16), 1.f), 0);
+            GUGU_UTEST_CHECK_APPROX_EQUAL(accumulator.GetInterpolation(), 0.8f, math::Epsilon6);
+
+            GUGU_UTEST_CHECK_EQUAL(runLoop(accumulator, sf::milliseconds(16), 1.f), 1);
+            GUGU_UTEST_CHECK_APPROX_EQUAL(accumulator.GetInterpolation(), 0.6f, math::Epsilon6);
+
+            GUGU_UTEST_CHECK_EQUAL(runLoop(accumulator, sf::milliseconds(8), 1.f), 1);
+            GUGU_UTEST_CHECK_EQUAL(accumulator.GetInterpolation(), 0.f);
+
+            accumulator.Reset();
+            GUGU_UTEST_CHECK_EQUAL(accumulator.GetAccumulatedTime().asMicroseconds(), (int64)0);
+        }
+
+        GUGU_UTEST_SUBSECTION("Catch Up");
+        {
+            StepAccumulator accumulator;
+
+            // A slow loop computes up to 5 steps, the exceeding time is dropped except for the partial step.
+            GUGU_UTEST_CHECK_EQUAL(runLoop(accumulator, sf::milliseconds(210), 1.f), 5);
+            GUGU_UTEST_CHECK_EQUAL(accumulator.GetAccumulatedTime().asMicroseconds(), (int64)10000);
+            GUGU_UTEST_CHECK_APPROX_EQUAL(accumulator.GetInterpolation(), 0.5f, math::Epsilon6);
+
+            GUGU_UTEST_CHECK_EQUAL(runLoop(accumulator, sf::milliseconds(30), 1.f), 2);
+            GUGU_UTEST_CHECK_EQUAL(accumulator.GetAccumulatedTime().asMicroseconds(), (int64)0);
+        }
+
+        GUGU_UTEST_SUBSECTION("Speed Multiplier");
+        {
+            StepAccumulator accumulator;
+
+            // A fast-forward keeps all its steps, the limit is scaled by the multiplier.
+            int stepCount = 0;
+            for (int i = 0; i < 10; ++i)
+            {
+                stepCount += runLoop(accumulator, sf::milliseconds(16), 20.f);
+            }
+
+            GUGU_UTEST_CHECK_EQUAL(accumulator.GetMaxStepCount(), 100);
+            GUGU_UTEST_CHECK_EQUAL(stepCount, 160);
+            GUGU_UTEST_CHECK_EQUAL(accumulator.GetAccumulatedTime().asMicroseconds(), (int64)0);
+
+            // A slow motion keeps the default limit.
+            GUGU_UTEST_CHECK_EQUAL(runLoop(accumulator, sf::milliseconds(500), 0.5f), 5);
+            GUGU_UTEST_CHECK_EQUAL(accumulator.GetMaxStepCount(), 5);
+        }
     }
 
     //----------------------------------------------
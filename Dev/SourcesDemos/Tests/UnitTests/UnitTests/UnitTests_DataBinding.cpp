@@ -10,9 +10,19 @@
 #include "DataBinding/DataBinding.h"
 #include "DataBinding/DataBindingImpl.h"
 
+#include "Gugu/Data/DatasaveWriter.h"
 #include "Gugu/Resources/ManagerResources.h"
 #include "Gugu/Resources/Datasheet.h"
+#include "Gugu/Resources/LocalizationTable.h"
+#include "Gugu/System/Memory.h"
 #include "Gugu/System/Platform.h"
+#include "Gugu/System/String.h"
+#include "Gugu/System/StringTable.h"
+#include "Gugu/System/UUID.h"
+#include "Gugu/External/PugiXmlUtility.h"
+
+#include <fstream>
+#include <map>
 
 using namespace gugu;
 
@@ -68,6 +78,20 @@ void RunUnitTests_DataBinding(UnitTestResults* results)
                     GUGU_UTEST_CHECK(enumValues[4] == EWeaponType::Crossbow);
                 }
             }
+
+            const DataEnumTable& enumTable = EWeaponType::GetDataEnumTable();
+            if (GUGU_UTEST_CHECK(enumTable.size == 5))
+            {
+                GUGU_UTEST_CHECK(enumTable.names[EWeaponType::Unknown] == "Unknown");
+                GUGU_UTEST_CHECK(enumTable.names[EWeaponType::Crossbow] == "Crossbow");
+
+                int enumValue = -1;
+                GUGU_UTEST_CHECK(binding::impl::FindEnumTableValue(enumTable, "Axe", enumValue) && enumValue == EWeaponType::Axe);
+                GUGU_UTEST_CHECK(binding::impl::FindEnumTableValue(enumTable, "Unknown", enumValue) && enumValue == EWeaponType::Unknown);
+                GUGU_UTEST_CHECK(binding::impl::FindEnumTableValue(enumTable, "Sword", enumValue) && enumValue == EWeaponType::Sword);
+                GUGU_UTEST_CHECK(!binding::impl::FindEnumTableValue(enumTable, "Bow", enumValue));
+                GUGU_UTEST_CHECK(!binding::impl::FindEnumTableValue(enumTable, "", enumValue));
+            }
         }
 
         GUGU_UTEST_SUBSECTION("Classes");
@@ -437,6 +461,84 @@ void RunUnitTests_DataBinding(UnitTestResults* results)
                 }
             }
         }
+
+        GUGU_UTEST_SUBSECTION("Arena Storage");
+        {
+            // Items and characters use the arena storage.
+            const DS_Item* appleSheet = GetResources()->GetDatasheetObject<DS_Item>("Apple.item");
+            const DS_Item* bananaSheet = GetResources()->GetDatasheetObject<DS_Item>("Banana.item");
+
+            size_t visitedCount = 0;
+            bool appleVisited = false;
+            bool bananaVisited = false;
+            DS_Item::GetDataArena().ForEach<DS_Item>([&](const DS_Item* item)
+            {
+                ++visitedCount;
+                appleVisited = appleVisited || item == appleSheet;
+                bananaVisited = bananaVisited || item == bananaSheet;
+            });
+
+            GUGU_UTEST_CHECK(appleSheet != nullptr && appleVisited);
+            GUGU_UTEST_CHECK(bananaSheet != nullptr && bananaVisited);
+            GUGU_UTEST_CHECK_EQUAL(visitedCount, DS_Item::GetDataArena().GetObjectCount());
+
+            // References to arena classes are compact indices.
+            const DS_Character* billySheet = GetResources()->GetDatasheetObject<DS_Character>("Billy.character");
+            const DS_Faction* factionSheet = GetResources()->GetDatasheetObject<DS_Faction>("Heroes.faction");
+            if (GUGU_UTEST_CHECK(factionSheet != nullptr))
+            {
+                GUGU_UTEST_CHECK(factionSheet->leader.GetIndex() != 0);
+                GUGU_UTEST_CHECK(factionSheet->leader == billySheet);
+
+                if (GUGU_UTEST_CHECK_NOT_NULL(factionSheet->leader.Get()))
+                {
+                    GUGU_UTEST_CHECK_EQUAL(factionSheet->leader->name, "Billy");
+                }
+            }
+
+            GUGU_UTEST_CHECK(DataArenaRef<DS_Character>(billySheet).Get() == billySheet);
+            GUGU_UTEST_CHECK(DataArenaRef<DS_Character>().Get() == nullptr);
+            GUGU_UTEST_CHECK(sizeof(DataArenaRef<DS_Character>) == sizeof(uint32));
+
+            // Indices of deallocated objects are not resolved, even when their slot is reused.
+            DataObjectArena arena(sizeof(int));
+            void* firstObject = arena.Allocate(sizeof(int));
+            uint32 firstIndex = DataObjectArena::GetObjectIndex(firstObject);
+            GUGU_UTEST_CHECK(DataObjectArena::GetIndexedObject(firstIndex) == firstObject);
+
+            arena.Deallocate(firstObject);
+            GUGU_UTEST_CHECK(DataObjectArena::GetIndexedObject(firstIndex) == nullptr);
+
+            void* secondObject = arena.Allocate(sizeof(int));
+            uint32 secondIndex = DataObjectArena::GetObjectIndex(secondObject);
+            GUGU_UTEST_CHECK(secondObject == firstObject);
+            GUGU_UTEST_CHECK(secondIndex != firstIndex);
+            GUGU_UTEST_CHECK(DataObjectArena::GetIndexedObject(secondIndex) == secondObject);
+            GUGU_UTEST_CHECK(DataObjectArena::GetIndexedObject(firstIndex) == nullptr);
+
+            arena.Deallocate(secondObject);
+        }
+
+        GUGU_UTEST_SUBSECTION("Interned Strings");
+        {
+            // Item names and localized strings are interned.
+            const DS_Item* baseSheet = GetResources()->GetDatasheetObject<DS_Item>("BaseConsumable.item");
+            const DS_Item* appleSheet = GetResources()->GetDatasheetObject<DS_Item>("Apple.item");
+            const DS_Item* bananaSheet = GetResources()->GetDatasheetObject<DS_Item>("Banana.item");
+            if (GUGU_UTEST_CHECK(baseSheet != nullptr && appleSheet != nullptr && bananaSheet != nullptr))
+            {
+                GUGU_UTEST_CHECK(appleSheet->name == InternedString("Apple"));
+                GUGU_UTEST_CHECK_EQUAL(appleSheet->description.workstring, "A crunchy fruit.");
+                GUGU_UTEST_CHECK_EQUAL(appleSheet->description.key, "Apple.item/b24a3c1451164d63840a3fff143d2eff/description");
+                GUGU_UTEST_CHECK_TRUE(baseSheet->description.workstring.IsEmpty());
+                GUGU_UTEST_CHECK_TRUE(baseSheet->description.key.IsEmpty());
+
+                // Identical texts share the same storage.
+                GUGU_UTEST_CHECK_EQUAL(appleSheet->description.workstring.GetId(), bananaSheet->description.workstring.GetId());
+                GUGU_UTEST_CHECK(appleSheet->description.workstring.GetCString() == bananaSheet->description.workstring.GetCString());
+                GUGU_UTEST_CHECK(appleSheet->description.key != bananaSheet->description.key);
+            }
+        }
     }
 
     GUGU_UTEST_SECTION("Datasaves");
@@ -707,10 +809,1012 @@ void RunUnitTests_DataBinding(UnitTestResults* results)
             }
         }
 
+        GUGU_UTEST_SUBSECTION("Binary Write / Read");
+        {
+            // The xml format is used as a reference for the binary content.
+            DS_GameSave emptyGameSave;
+            GUGU_UTEST_CHECK(emptyGameSave.SaveToBinaryFile("User/EmptyTestSave.bin"));
+
+            DS_GameSave emptyBinaryGameSave;
+            GUGU_UTEST_CHECK(emptyBinaryGameSave.LoadFromBinaryFile("User/EmptyTestSave.bin"));
+
+            std::string emptySaveResultString;
+            GUGU_UTEST_CHECK(emptyBinaryGameSave.SaveToString(emptySaveResultString));
+            GUGU_UTEST_CHECK(emptySaveResultString == emptySaveExpectedResultString);
+
+            DS_GameSave filledGameSave;
+            GUGU_UTEST_CHECK(filledGameSave.LoadFromFile("User/FilledTestSave.xml"));
+            GUGU_UTEST_CHECK(filledGameSave.SaveToBinaryFile("User/FilledTestSave.bin"));
+
+            DS_GameSave filledBinaryGameSave;
+            GUGU_UTEST_CHECK(filledBinaryGameSave.LoadFromBinaryFile("User/FilledTestSave.bin"));
+
+            std::string filledSaveResultString;
+            GUGU_UTEST_CHECK(filledBinaryGameSave.SaveToString(filledSaveResultString));
+            GUGU_UTEST_CHECK(filledSaveResultString == filledSaveExpectedResultString);
+
+            // Invalid content.
+            std::vector<uint8> buffer;
+            GUGU_UTEST_CHECK(filledGameSave.SaveToBinaryBuffer(buffer));
+
+            DS_ItemSave itemSave;
+            GUGU_UTEST_CHECK(!itemSave.LoadFromBinaryBuffer(buffer));
+
+            buffer.resize(buffer.size() / 2);
+
+            DS_GameSave truncatedGameSave;
+            GUGU_UTEST_CHECK(!truncatedGameSave.LoadFromBinaryBuffer(buffer));
+            GUGU_UTEST_CHECK(!truncatedGameSave.LoadFromBinaryBuffer(std::vector<uint8>()));
+        }
+
+        GUGU_UTEST_SUBSECTION("Incremental Binary Save");
+        {
+            // The regular binary save is used as a reference for the incremental content.
+            DS_GameSave gameSave;
+            GUGU_UTEST_CHECK(gameSave.LoadFromFile("User/FilledTestSave.xml"));
+            GUGU_UTEST_CHECK(gameSave.IsDirty());
+
+            std::vector<uint8> referenceBuffer;
+            std::vector<uint8> incrementalBuffer;
+            size_t reusedSize = 0;
+
+            GUGU_UTEST_CHECK(gameSave.SaveToBinaryBuffer(referenceBuffer));
+            GUGU_UTEST_CHECK(gameSave.SaveToIncrementalBinaryBuffer(incrementalBuffer, reusedSize));
+            GUGU_UTEST_CHECK(incrementalBuffer == referenceBuffer);
+            GUGU_UTEST_CHECK_EQUAL(reusedSize, (size_t)0);
+            GUGU_UTEST_CHECK(!gameSave.IsDirty());
+
+            // Nothing changed, the whole content is reused.
+            GUGU_UTEST_CHECK(gameSave.SaveToIncrementalBinaryBuffer(incrementalBuffer, reusedSize));
+            GUGU_UTEST_CHECK(incrementalBuffer == referenceBuffer);
+            GUGU_UTEST_CHECK(reusedSize > 0 && reusedSize < incrementalBuffer.size());
+
+            // Nested instance change, only the modified instance is serialized again, other records are reused.
+            if (GUGU_UTEST_CHECK(gameSave.multipleItems.size() == 2))
+            {
+                gameSave.multipleItems[1]->SetQuantity(12);
+                GUGU_UTEST_CHECK(gameSave.UpdateDirtyState());
+                GUGU_UTEST_CHECK(gameSave.multipleItems[1]->IsDirty());
+                GUGU_UTEST_CHECK(!gameSave.multipleItems[0]->IsDirty());
+                GUGU_UTEST_CHECK(!gameSave.IsDirty());
+
+                GUGU_UTEST_CHECK(gameSave.SaveToBinaryBuffer(referenceBuffer));
+                GUGU_UTEST_CHECK(gameSave.SaveToIncrementalBinaryBuffer(incrementalBuffer, reusedSize));
+                GUGU_UTEST_CHECK(incrementalBuffer == referenceBuffer);
+                GUGU_UTEST_CHECK(reusedSize > 0 && reusedSize < incrementalBuffer.size());
+            }
+
+            // Direct modification, notified through SetDirty.
+            gameSave.walkedDistance = 12.5f;
+            gameSave.SetDirty();
+
+            GUGU_UTEST_CHECK(gameSave.SaveToBinaryBuffer(referenceBuffer));
+            GUGU_UTEST_CHECK(gameSave.SaveToIncrementalBinaryBuffer(incrementalBuffer, reusedSize));
+            GUGU_UTEST_CHECK(incrementalBuffer == referenceBuffer);
+
+            // Instance removal, detected without SetDirty.
+            SafeDelete(gameSave.singleItem);
+            GUGU_UTEST_CHECK(gameSave.UpdateDirtyState());
+            GUGU_UTEST_CHECK(gameSave.IsDirty());
+
+            GUGU_UTEST_CHECK(gameSave.SaveToBinaryBuffer(referenceBuffer));
+            GUGU_UTEST_CHECK(gameSave.SaveToIncrementalBinaryBuffer(incrementalBuffer, reusedSize));
+            GUGU_UTEST_CHECK(incrementalBuffer == referenceBuffer);
+
+            // Root change, and instance reordering.
+            gameSave.SetScore(42);
+            if (gameSave.multipleItems.size() == 2)
+            {
+                std::swap(gameSave.multipleItems[0], gameSave.multipleItems[1]);
+            }
+
+            GUGU_UTEST_CHECK(gameSave.SaveToBinaryBuffer(referenceBuffer));
+            GUGU_UTEST_CHECK(gameSave.SaveToIncrementalBinaryBuffer(incrementalBuffer, reusedSize));
+            GUGU_UTEST_CHECK(incrementalBuffer == referenceBuffer);
+
+            DS_GameSave loadedGameSave;
+            GUGU_UTEST_CHECK(loadedGameSave.LoadFromBinaryBuffer(incrementalBuffer));
+            GUGU_UTEST_CHECK(loadedGameSave.score == 42);
+            GUGU_UTEST_CHECK(loadedGameSave.singleItem == nullptr);
+
+            if (GUGU_UTEST_CHECK(loadedGameSave.multipleItems.size() == 2))
+            {
+                GUGU_UTEST_CHECK(loadedGameSave.multipleItems[0]->quantity == 12);
+            }
+        }
+
+        GUGU_UTEST_SUBSECTION("Async Save");
+        {
+            DS_GameSave gameSave;
+            GUGU_UTEST_CHECK(gameSave.LoadFromFile("User/FilledTestSave.xml"));
+
+            size_t completedCount = 0;
+            bool allSucceeded = true;
+            auto delegateCompleted = [&](const std::string& path, bool success)
+            {
+                ++completedCount;
+                allSucceeded = allSucceeded && success;
+            };
+
+            DatasaveWriter writer;
+            GUGU_UTEST_CHECK(!writer.SaveAsync(nullptr, "User/AsyncSave/GameSave.bin"));
+            GUGU_UTEST_CHECK(writer.SaveAsync(&gameSave, "User/AsyncSave/GameSave.bin", delegateCompleted));
+
+            // The datasave can be modified while the previous snapshot is written.
+            gameSave.SetScore(99);
+
+            GUGU_UTEST_CHECK(writer.SaveAsync(&gameSave, "User/AsyncSave/GameSave.bin", delegateCompleted));
+            GUGU_UTEST_CHECK(writer.IsSavePending());
+
+            writer.WaitPendingSaves();
+            GUGU_UTEST_CHECK(!writer.IsSavePending());
+            GUGU_UTEST_CHECK_EQUAL(completedCount, (size_t)2);
+            GUGU_UTEST_CHECK(allSucceeded);
+            GUGU_UTEST_CHECK_EQUAL(writer.GetStats().saveCount, (size_t)2);
+            GUGU_UTEST_CHECK_EQUAL(writer.GetStats().failedWriteCount, (size_t)0);
+            GUGU_UTEST_CHECK(!FileExists("User/AsyncSave/GameSave.bin.tmp"));
+
+            DS_GameSave loadedGameSave;
+            GUGU_UTEST_CHECK(loadedGameSave.LoadFromBinaryFile("User/AsyncSave/GameSave.bin"));
+            GUGU_UTEST_CHECK(loadedGameSave.score == 99);
+        }
+
+        // A large save, with a lot of datasave instances.
+        const size_t benchmarkItemCount = 20000;
+
+        DS_GameSave benchmarkGameSave;
+        for (size_t i = 0; i < benchmarkItemCount; ++i)
+        {
+            DS_ItemSave* itemSave = new DS_ItemSave();
+            itemSave->item = GetResources()->GetDatasheetObject<DS_Item>(i % 2 == 0 ? "Apple.item" : "Banana.item");
+            itemSave->quantity = (int)i;
+            benchmarkGameSave.multipleItems.push_back(itemSave);
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Xml Save / Load");
+        {
+            size_t loadedCount = 0;
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                benchmarkGameSave.SaveToFile("User/BenchmarkSave.xml");
+
+                DS_GameSave loadedGameSave;
+                loadedGameSave.LoadFromFile("User/BenchmarkSave.xml");
+                loadedCount = loadedGameSave.multipleItems.size();
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(loadedCount, benchmarkItemCount);
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Binary Save / Load");
+        {
+            size_t loadedCount = 0;
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                benchmarkGameSave.SaveToBinaryFile("User/BenchmarkSave.bin");
+
+                DS_GameSave loadedGameSave;
+                loadedGameSave.LoadFromBinaryFile("User/BenchmarkSave.bin");
+                loadedCount = loadedGameSave.multipleItems.size();
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(loadedCount, benchmarkItemCount);
+
+            std::vector<uint8> xmlContent;
+            std::vector<uint8> binaryContent;
+            if (GUGU_UTEST_CHECK(ReadFileContent("User/BenchmarkSave.xml", xmlContent) && ReadFileContent("User/BenchmarkSave.bin", binaryContent)))
+            {
+                GUGU_UTEST_CHECK(binaryContent.size() < xmlContent.size());
+            }
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Async Autosave");
+        {
+            // Only the main thread part of the save is measured, a single instance is modified between each save.
+            DatasaveWriter writer;
+            writer.SaveAsync(&benchmarkGameSave, "User/BenchmarkAutosave.bin");
+            writer.WaitPendingSaves();
+
+            size_t iteration = 0;
+            GUGU_UTEST_PERFORMANCE(10, [&]()
+            {
+                DS_ItemSave* itemSave = benchmarkGameSave.multipleItems[iteration++ % benchmarkItemCount];
+                itemSave->SetQuantity(itemSave->quantity + 1);
+
+                writer.SaveAsync(&benchmarkGameSave, "User/BenchmarkAutosave.bin");
+            });
+
+            writer.WaitPendingSaves();
+
+            const DatasaveWriter::Stats& stats = writer.GetStats();
+            GUGU_UTEST_CHECK_EQUAL(stats.failedWriteCount, (size_t)0);
+            GUGU_UTEST_CHECK(stats.lastReusedSize > 0 && stats.lastReusedSize < stats.lastSnapshotSize);
+
+            DS_GameSave loadedGameSave;
+            GUGU_UTEST_CHECK(loadedGameSave.LoadFromBinaryFile("User/BenchmarkAutosave.bin"));
+            GUGU_UTEST_CHECK_EQUAL(loadedGameSave.multipleItems.size(), benchmarkItemCount);
+        }
+
+        // Reset
+        GUGU_UTEST_SILENT_CHECK(RemoveDirectoryTree("User"));
+    }
+
+    GUGU_UTEST_SECTION("Member Lookup");
+    {
+        // A wide object, with members stored in reverse order and a duplicated member.
+        const int memberCount = 500;
+
+        pugi::xml_document document;
+        pugi::xml_node objectNode = document.append_child("Object");
+        for (int i = memberCount - 1; i >= 0; --i)
+        {
+            pugi::xml_node dataNode = objectNode.append_child("Data");
+            dataNode.append_attribute("name").set_value(StringFormat("member{0}", i).c_str());
+            dataNode.append_attribute("value").set_value(i);
+        }
+
+        pugi::xml_node duplicateNode = objectNode.append_child("Data");
+        duplicateNode.append_attribute("name").set_value("member0");
+        duplicateNode.append_attribute("value").set_value(-1);
+
+        pugi::xml_node nestedNode = objectNode.append_child("Data");
+        nestedNode.append_attribute("name").set_value("nested");
+        pugi::xml_node nestedDataNode = nestedNode.append_child("Data");
+        nestedDataNode.append_attribute("name").set_value("member1");
+        nestedDataNode.append_attribute("value").set_value(1000);
+
+        std::vector<std::string> memberNames;
+        for (int i = 0; i < memberCount; ++i)
+        {
+            memberNames.push_back(StringFormat("member{0}", i));
+        }
+
+        GUGU_UTEST_SUBSECTION("Read");
+        {
+            DataParseContext context;
+            context.currentNode = &objectNode;
+            context.objectByUUID = nullptr;
+
+            size_t validCount = 0;
+            for (int i = 0; i < memberCount; ++i)
+            {
+                int value = -2;
+                binding::ReadInt(context, memberNames[i], value);
+                validCount += value == i ? 1 : 0;
+            }
+
+            GUGU_UTEST_CHECK_EQUAL(validCount, (size_t)memberCount);
+
+            int missingValue = -2;
+            binding::ReadInt(context, "missing", missingValue);
+            GUGU_UTEST_CHECK_EQUAL(missingValue, -2);
+
+            // Switching the current node should use the nested members, then the object members again.
+            int nestedValue = 0;
+            context.currentNode = &nestedNode;
+            binding::ReadInt(context, "member1", nestedValue);
+            GUGU_UTEST_CHECK_EQUAL(nestedValue, 1000);
+            GUGU_UTEST_CHECK_EQUAL(context.memberIndexCount, 2);
+
+            // The object index is kept while parsing the nested object.
+            int objectValue = 0;
+            context.currentNode = &objectNode;
+            binding::ReadInt(context, "member1", objectValue);
+            GUGU_UTEST_CHECK_EQUAL(objectValue, 1);
+            GUGU_UTEST_CHECK_EQUAL(context.memberIndexCount, 1);
+            GUGU_UTEST_CHECK_EQUAL(context.memberIndices.size(), 2);
+
+            // Parsing an unrelated object replaces the indices instead of stacking them.
+            pugi::xml_node otherNode = document.append_child("Object");
+            context.currentNode = &otherNode;
+            binding::ReadInt(context, "member1", objectValue);
+            GUGU_UTEST_CHECK_EQUAL(context.memberIndexCount, 1);
+            GUGU_UTEST_CHECK_EQUAL(context.memberIndices.size(), 2);
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Wide Object");
+        {
+            int sum = 0;
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                sum = 0;
+                for (size_t loop = 0; loop < 20; ++loop)
+                {
+                    DataParseContext context;
+                    context.currentNode = &objectNode;
+                    context.objectByUUID = nullptr;
+
+                    for (int i = 0; i < memberCount; ++i)
+                    {
+                        int value = 0;
+                        binding::ReadInt(context, memberNames[i], value);
+                        sum += value;
+                    }
+                }
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(sum, 20 * memberCount * (memberCount - 1) / 2);
+        }
+
+        // Narrow objects, from 3 to 10 members, are searched linearly instead of being sorted.
+        const size_t narrowObjectCount = 2000;
+        const size_t defaultSortedIndexMinSize = DataParseContext().sortedIndexMinSize;
+
+        pugi::xml_document narrowDocument;
+        std::vector<pugi::xml_node> narrowObjectNodes;
+        for (size_t i = 0; i < narrowObjectCount; ++i)
+        {
+            pugi::xml_node narrowObjectNode = narrowDocument.append_child("Object");
+            for (size_t member = 0; member < 3 + i % 8; ++member)
+            {
+                pugi::xml_node dataNode = narrowObjectNode.append_child("Data");
+                dataNode.append_attribute("name").set_value(memberNames[member].c_str());
+                dataNode.append_attribute("value").set_value((int)member);
+            }
+
+            narrowObjectNodes.push_back(narrowObjectNode);
+        }
+
+        const auto readNarrowObjects = [&](size_t sortedIndexMinSize)
+        {
+            DataParseContext context;
+            context.objectByUUID = nullptr;
+            context.sortedIndexMinSize = sortedIndexMinSize;
+
+            int sum = 0;
+            for (size_t i = 0; i < narrowObjectCount; ++i)
+            {
+                context.currentNode = &narrowObjectNodes[i];
+                for (size_t member = 0; member < 3 + i % 8; ++member)
+                {
+                    int value = 0;
+                    binding::ReadInt(context, memberNames[member], value);
+                    sum += value;
+                }
+            }
+
+            return sum;
+        };
+
+        int narrowExpectedSum = 0;
+        for (size_t i = 0; i < narrowObjectCount; ++i)
+        {
+            narrowExpectedSum += (int)((2 + i % 8) * (3 + i % 8) / 2);
+        }
+
+        GUGU_UTEST_SUBSECTION("Read Narrow Object");
+        {
+            // The first duplicated member is used, as with a sorted index.
+            pugi::xml_node narrowNode = document.append_child("Object");
+            for (int i : { 0, 1, 2, 1 })
+            {
+                pugi::xml_node dataNode = narrowNode.append_child("Data");
+                dataNode.append_attribute("name").set_value(memberNames[i].c_str());
+                dataNode.append_attribute("value").set_value(i);
+            }
+
+            for (size_t sortedIndexMinSize : { defaultSortedIndexMinSize, (size_t)0 })
+            {
+                DataParseContext context;
+                context.currentNode = &narrowNode;
+                context.objectByUUID = nullptr;
+                context.sortedIndexMinSize = sortedIndexMinSize;
+
+                int value = -2;
+                int missingValue = -2;
+                binding::ReadInt(context, memberNames[1], value);
+                binding::ReadInt(context, "missing", missingValue);
+                GUGU_UTEST_CHECK_EQUAL(value, 1);
+                GUGU_UTEST_CHECK_EQUAL(missingValue, -2);
+                GUGU_UTEST_CHECK_EQUAL(context.memberIndices[0].isSorted, sortedIndexMinSize == 0);
+            }
+
+            GUGU_UTEST_CHECK_EQUAL(readNarrowObjects(defaultSortedIndexMinSize), narrowExpectedSum);
+            GUGU_UTEST_CHECK_EQUAL(readNarrowObjects(0), narrowExpectedSum);
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Narrow Objects Sorted");
+        {
+            GUGU_UTEST_PERFORMANCE(10, [&]()
+            {
+                readNarrowObjects(0);
+            });
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Narrow Objects Linear");
+        {
+            GUGU_UTEST_PERFORMANCE(10, [&]()
+            {
+                readNarrowObjects(defaultSortedIndexMinSize);
+            });
+        }
+
+        // An enum heavy object, read through the registered enum infos or through the generated enum table.
+        const std::string enumNames[] = { "Unknown", "Sword", "Mace", "Axe", "Crossbow" };
+
+        pugi::xml_node enumObjectNode = document.append_child("Object");
+        for (int i = 0; i < memberCount; ++i)
+        {
+            pugi::xml_node dataNode = enumObjectNode.append_child("Data");
+            dataNode.append_attribute("name").set_value(memberNames[i].c_str());
+            dataNode.append_attribute("value").set_value(enumNames[i % 5].c_str());
+        }
+
+        const auto readEnumMembers = [&](bool useEnumTable)
+        {
+            DataParseContext context;
+            context.currentNode = &enumObjectNode;
+            context.objectByUUID = nullptr;
+
+            size_t validCount = 0;
+            for (int i = 0; i < memberCount; ++i)
+            {
+                EWeaponType::Type value = EWeaponType::Unknown;
+                if (useEnumTable)
+                {
+                    binding::ReadEnum(context, memberNames[i], EWeaponType::GetDataEnumTable(), value);
+                }
+                else
+                {
+                    binding::ReadEnum(context, memberNames[i], "weaponType", value);
+                }
+
+                validCount += value == (EWeaponType::Type)(i % 5) ? 1 : 0;
+            }
+
+            return validCount;
+        };
+
+        GUGU_UTEST_SUBSECTION("Benchmark Enums By Name");
+        {
+            size_t validCount = 0;
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                validCount = 0;
+                for (size_t loop = 0; loop < 20; ++loop)
+                {
+                    validCount += readEnumMembers(false);
+                }
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(validCount, (size_t)(20 * memberCount));
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Enums By Table");
+        {
+            size_t validCount = 0;
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                validCount = 0;
+                for (size_t loop = 0; loop < 20; ++loop)
+                {
+                    validCount += readEnumMembers(true);
+                }
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(validCount, (size_t)(20 * memberCount));
+        }
+    }
+
+    GUGU_UTEST_SECTION("Datasheet Hierarchy");
+    {
+        const std::string hierarchyTestsPath = "User/HierarchyTests";
+        RemoveDirectoryTree(hierarchyTestsPath);
+        GUGU_UTEST_SILENT_CHECK(EnsureDirectoryExists(hierarchyTestsPath));
+
+        // A deep chain of base datasheets, shared by a large amount of leaf datasheets.
+        const size_t baseCount = 10;
+        const size_t leafCount = 1000;
+
+        const auto writeDatasheet = [&](const std::string& name, const std::string& parent, const std::string& data)
+        {
+            std::ofstream file(StringFormat("{0}/{1}.item", hierarchyTestsPath, name), std::ios::out | std::ios::binary | std::ios::trunc);
+            file << "<Datasheet serializationVersion=\"2\" bindingVersion=\"1\"";
+            if (!parent.empty())
+            {
+                file << StringFormat(" parent=\"{0}.item\"", parent);
+            }
+            file << ">\n";
+            file << StringFormat("    <RootObject type=\"item\" uuid=\"{0}\">\n", UUID::Generate().ToString());
+            file << data;
+            file << "    </RootObject>\n";
+            file << "</Datasheet>\n";
+        };
+
+        for (size_t i = 0; i < baseCount; ++i)
+        {
+            std::string data;
+            if (i == 0)
+            {
+                data = "        <Data name=\"size\" x=\"32\" y=\"48\" />\n";
+            }
+            else if (i == baseCount / 2)
+            {
+                data = "        <Data name=\"scale\" x=\"2\" y=\"3\" />\n";
+            }
+
+            writeDatasheet(StringFormat("HierarchyBase{0}", i), i > 0 ? StringFormat("HierarchyBase{0}", i - 1) : "", data);
+        }
+
+        for (size_t i = 0; i < leafCount; ++i)
+        {
+            writeDatasheet(StringFormat("HierarchyLeaf{0}", i), StringFormat("HierarchyBase{0}", baseCount - 1), StringFormat("        <Data name=\"name\" value=\"Leaf{0}\" />\n", i));
+        }
+
+        const auto reparseDirectory = [&]()
+        {
+            GetResources()->RemoveResourcesFromPath(hierarchyTestsPath, true);
+            GetResources()->ParseDirectory(hierarchyTestsPath);
+        };
+
+        GUGU_UTEST_SUBSECTION("Inheritance");
+        {
+            reparseDirectory();
+
+            size_t validCount = 0;
+            for (size_t i = 0; i < leafCount; ++i)
+            {
+                const DS_Item* leaf = GetResources()->GetDatasheetObject<DS_Item>(StringFormat("HierarchyLeaf{0}.item", i));
+                if (leaf
+                    && leaf->name == StringFormat("Leaf{0}", i)
+                    && leaf->size == Vector2i(32, 48)
+                    && leaf->scale == Vector2f(2.f, 3.f))
+                {
+                    ++validCount;
+                }
+            }
+
+            GUGU_UTEST_CHECK_EQUAL(validCount, leafCount);
+
+            // The parent documents are shared by the leaves, and bounded once the loads are done.
+            GUGU_UTEST_CHECK_EQUAL(Datasheet::GetParsedDocumentCount(), std::min(baseCount, Datasheet::MaxParsedDocuments));
+
+            Datasheet::ReleaseParsedDocuments();
+            GUGU_UTEST_CHECK_EQUAL(Datasheet::GetParsedDocumentCount(), (size_t)0);
+
+            const DS_Item* base = GetResources()->GetDatasheetObject<DS_Item>(StringFormat("HierarchyBase{0}.item", baseCount - 1));
+            if (GUGU_UTEST_CHECK(base != nullptr))
+            {
+                GUGU_UTEST_CHECK(base->size == Vector2i(32, 48));
+                GUGU_UTEST_CHECK(base->scale == Vector2f(2.f, 3.f));
+                GUGU_UTEST_CHECK(base->GetDatasheet()->GetParentDatasheet() != nullptr);
+            }
+        }
+
+        GUGU_UTEST_SUBSECTION("Allocations");
+        {
+            reparseDirectory();
+
+            // Load the bases first, to only measure the leaves.
+            // The report includes file loading and xml parsing, it requires a build with GUGU_UTEST_COUNT_ALLOCATIONS.
+            GetResources()->GetDatasheet(StringFormat("HierarchyBase{0}.item", baseCount - 1));
+
+            std::vector<std::string> leafIds;
+            for (size_t i = 0; i < leafCount; ++i)
+            {
+                leafIds.push_back(StringFormat("HierarchyLeaf{0}.item", i));
+            }
+
+            size_t allocationCount = GetAllocationCount();
+
+            size_t loadedCount = 0;
+            for (const std::string& leafId : leafIds)
+            {
+                loadedCount += GetResources()->GetDatasheet(leafId) ? 1 : 0;
+            }
+
+            allocationCount = GetAllocationCount() - allocationCount;
+
+            GUGU_UTEST_CHECK_EQUAL(loadedCount, leafCount);
+
+            // Member parsing alone, on an already parsed document.
+            pugi::xml_document leafDocument;
+            leafDocument.load_file(StringFormat("{0}/HierarchyLeaf0.item", hierarchyTestsPath).c_str());
+            pugi::xml_node leafRootNode = leafDocument.child("Datasheet").child("RootObject");
+
+            DS_Item parsedLeaf;
+            size_t parseAllocationCount = GetAllocationCount();
+
+            for (size_t i = 0; i < leafCount; ++i)
+            {
+                DataParseContext context;
+                context.currentNode = &leafRootNode;
+                context.objectByUUID = nullptr;
+                static_cast<DataObject&>(parsedLeaf).ParseMembers(context);
+            }
+
+            parseAllocationCount = GetAllocationCount() - parseAllocationCount;
+
+            GUGU_UTEST_CHECK(parsedLeaf.name == "Leaf0");
+
+            if (IsAllocationCountEnabled())
+            {
+                GUGU_UTEST_REPORT(StringFormat("Datasheet loading : {0} allocations per datasheet", (float)allocationCount / leafCount));
+                GUGU_UTEST_REPORT(StringFormat("Member parsing : {0} allocations per object", (float)parseAllocationCount / leafCount));
+            }
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Load Leaves");
+        {
+            size_t loadedCount = 0;
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                reparseDirectory();
+
+                loadedCount = 0;
+                for (size_t i = 0; i < leafCount; ++i)
+                {
+                    loadedCount += GetResources()->GetDatasheetObject<DS_Item>(StringFormat("HierarchyLeaf{0}.item", i)) ? 1 : 0;
+                }
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(loadedCount, leafCount);
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Load By Type");
+        {
+            std::vector<Datasheet*> datasheets;
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                reparseDirectory();
+
+                datasheets.clear();
+                GetResources()->GetAllDatasheetsByType("item", datasheets);
+            });
+
+            GUGU_UTEST_CHECK(datasheets.size() >= baseCount + leafCount);
+
+            // Datasheets are loaded through the worker threads, only the parents may be completed on demand.
+            reparseDirectory();
+            GetResources()->ResetPrefetchStats();
+
+            datasheets.clear();
+            GetResources()->GetAllDatasheetsByType("item", datasheets);
+
+            GUGU_UTEST_CHECK(datasheets.size() >= baseCount + leafCount);
+            GUGU_UTEST_CHECK(GetResources()->GetPrefetchStats().onDemandLoadCount <= baseCount);
+
+            // Parallel loads should give the same results as sequential loads.
+            size_t validCount = 0;
+            for (size_t i = 0; i < leafCount; ++i)
+            {
+                const DS_Item* leaf = GetResources()->GetDatasheetObject<DS_Item>(StringFormat("HierarchyLeaf{0}.item", i));
+                if (leaf
+                    && leaf->name == StringFormat("Leaf{0}", i)
+                    && leaf->size == Vector2i(32, 48)
+                    && leaf->scale == Vector2f(2.f, 3.f))
+                {
+                    ++validCount;
+                }
+            }
+
+            GUGU_UTEST_CHECK_EQUAL(validCount, leafCount);
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->GetPendingAsyncLoadCount(), (size_t)0);
+        }
+
+        // Iterations over the loaded items, as a list of datasheet objects gathered by name, or through the items arena.
+        const size_t iterationCount = 100;
+
+        GUGU_UTEST_SUBSECTION("Benchmark Iterate Pointers");
+        {
+            std::vector<const DS_Item*> items;
+            for (size_t i = 0; i < leafCount; ++i)
+            {
+                items.push_back(GetResources()->GetDatasheetObject<DS_Item>(StringFormat("HierarchyLeaf{0}.item", i)));
+            }
+
+            int totalSize = 0;
+            GUGU_UTEST_PERFORMANCE(10, [&]()
+            {
+                totalSize = 0;
+                for (size_t i = 0; i < iterationCount; ++i)
+                {
+                    for (const DS_Item* item : items)
+                    {
+                        totalSize += item->size.x;
+                    }
+                }
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(totalSize, (int)(32 * leafCount * iterationCount));
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Iterate Arena");
+        {
+            int totalSize = 0;
+            GUGU_UTEST_PERFORMANCE(10, [&]()
+            {
+                totalSize = 0;
+                for (size_t i = 0; i < iterationCount; ++i)
+                {
+                    DS_Item::GetDataArena().ForEach<DS_Item>([&](const DS_Item* item)
+                    {
+                        totalSize += item->size.x;
+                    });
+                }
+            });
+
+            GUGU_UTEST_CHECK(totalSize >= (int)(32 * leafCount * iterationCount));
+        }
+
         // Reset
+        GetResources()->RemoveResourcesFromPath(hierarchyTestsPath, true);
         GUGU_UTEST_SILENT_CHECK(RemoveDirectoryTree("User"));
     }
 
+    GUGU_UTEST_SECTION("Localization");
+    {
+        const std::string appleKey = "Apple.item/b24a3c1451164d63840a3fff143d2eff/description";
+        const std::string bananaKey = "Banana.item/2e7bdf288b1d4ffda4d12eeb0cf9c714/description";
+
+        GUGU_UTEST_SUBSECTION("Localization Table");
+        {
+            LocalizationTable table;
+
+            LocalizationTextEntry entry;
+            entry.timestamp = 10;
+            entry.text = "Un fruit croquant.";
+            GUGU_UTEST_CHECK(table.TryRegisterEntry("fr", appleKey, entry) == LocalizationRegisterResult::Accepted);
+            GUGU_UTEST_CHECK(table.TryRegisterEntry("fr", appleKey, entry) == LocalizationRegisterResult::Refused_Identical);
+            GUGU_UTEST_CHECK(table.TryRegisterEntry("fr", bananaKey, entry) == LocalizationRegisterResult::Accepted);
+
+            entry.text = "";
+            GUGU_UTEST_CHECK(table.TryRegisterEntry("en", appleKey, entry) == LocalizationRegisterResult::Refused_EmptyText);
+
+            GUGU_UTEST_CHECK(table.GetText("fr", appleKey) == "Un fruit croquant.");
+            GUGU_UTEST_CHECK(table.GetText("en", appleKey).empty());
+            GUGU_UTEST_CHECK(table.GetText("fr", "Unknown/Key").empty());
+
+            // Keys are shared with the datasheets, and identical texts of a language share the same storage.
+            const DS_Item* appleSheet = GetResources()->GetDatasheetObject<DS_Item>("Apple.item");
+            if (GUGU_UTEST_CHECK(appleSheet != nullptr))
+            {
+                GUGU_UTEST_CHECK(table.GetText("fr", std::string(appleSheet->description.key.GetView())) == "Un fruit croquant.");
+            }
+
+            const LocalizationTableEntry* appleEntry = table.GetEntry("fr", appleKey);
+            const LocalizationTableEntry* bananaEntry = table.GetEntry("fr", bananaKey);
+            if (GUGU_UTEST_CHECK(appleEntry != nullptr && bananaEntry != nullptr))
+            {
+                GUGU_UTEST_CHECK(appleEntry->textOffset == bananaEntry->textOffset);
+            }
+
+            // A more recent text replaces the current one, texts are not added to the StringTable.
+            size_t stringCount = GetStringTable()->GetStringCount();
+            entry.timestamp = 20;
+            entry.text = "Un fruit jaune.";
+            GUGU_UTEST_CHECK(table.TryRegisterEntry("fr", bananaKey, entry) == LocalizationRegisterResult::Accepted);
+            GUGU_UTEST_CHECK(table.GetText("fr", bananaKey) == "Un fruit jaune.");
+            GUGU_UTEST_CHECK(table.GetText("fr", appleKey) == "Un fruit croquant.");
+            GUGU_UTEST_CHECK_EQUAL(GetStringTable()->GetStringCount(), stringCount);
+
+            std::string result;
+            LocalizationTable loadedTable;
+            GUGU_UTEST_CHECK(table.SaveToString(result));
+            GUGU_UTEST_CHECK(loadedTable.LoadFromString(result));
+            GUGU_UTEST_CHECK(loadedTable.GetText("fr", appleKey) == "Un fruit croquant.");
+            GUGU_UTEST_CHECK(loadedTable.GetText("fr", bananaKey) == "Un fruit jaune.");
+        }
+
+        GUGU_UTEST_SUBSECTION("Language Switch");
+        {
+            const std::string localizationTestsPath = "User/LocalizationTests";
+            RemoveDirectoryTree(localizationTestsPath);
+            GUGU_UTEST_SILENT_CHECK(EnsureDirectoryExists(localizationTestsPath));
+
+            {
+                LocalizationTable table;
+
+                LocalizationTextEntry entry;
+                entry.timestamp = 1;
+                entry.text = "A crunchy fruit.";
+                table.TryRegisterEntry("en", appleKey, entry);
+                entry.text = "Un fruit croquant.";
+                table.TryRegisterEntry("fr", appleKey, entry);
+
+                std::string result;
+                table.SaveToString(result);
+
+                std::ofstream file(StringFormat("{0}/Texts.localization", localizationTestsPath), std::ios::out | std::ios::binary | std::ios::trunc);
+                file << result;
+            }
+
+            GetResources()->SetLocalizationLanguage("en");
+            GetResources()->ParseDirectory(localizationTestsPath);
+
+            LocalizationTable* table = GetResources()->GetLocalizationTable("Texts.localization");
+            if (GUGU_UTEST_CHECK(table != nullptr))
+            {
+                // Only the active language is loaded.
+                GUGU_UTEST_CHECK(table->GetActiveLanguage() == "en");
+                GUGU_UTEST_CHECK(table->HasLanguage("en"));
+                GUGU_UTEST_CHECK(!table->HasLanguage("fr"));
+                GUGU_UTEST_CHECK(table->GetText(LocalizationHashedKey(appleKey)) == "A crunchy fruit.");
+
+                LocalizedString localizedString;
+                localizedString.key = appleKey;
+                localizedString.workstring = "Workstring";
+                GUGU_UTEST_CHECK(table->GetText(localizedString) == "A crunchy fruit.");
+
+                localizedString.key = "Unknown/Key";
+                GUGU_UTEST_CHECK(table->GetText(localizedString) == "Workstring");
+
+                // The key is checked, another key with the same hash is not found (the hash is forced here).
+                LocalizationHashedKey collidingKey(appleKey);
+                collidingKey.key = "Unknown/Key";
+                GUGU_UTEST_CHECK(table->GetText(collidingKey).empty());
+
+                // A filtered table can not be saved, the other languages would be lost.
+                std::string result;
+                GUGU_UTEST_CHECK(!table->SaveToString(result));
+
+                // The previous texts stay available until the switch is finalized.
+                GetResources()->SetLocalizationLanguage("fr");
+                GUGU_UTEST_CHECK(GetResources()->IsLocalizationLanguagePending());
+                GUGU_UTEST_CHECK(table->GetText(LocalizationHashedKey(appleKey)) == "A crunchy fruit.");
+
+                GetResources()->CompleteAsyncLoads();
+                GUGU_UTEST_CHECK(!GetResources()->IsLocalizationLanguagePending());
+                GUGU_UTEST_CHECK(table->GetActiveLanguage() == "fr");
+                GUGU_UTEST_CHECK(!table->HasLanguage("en"));
+                GUGU_UTEST_CHECK(table->GetText(LocalizationHashedKey(appleKey)) == "Un fruit croquant.");
+
+                // Synchronous switch.
+                GUGU_UTEST_CHECK(table->LoadLanguage("en"));
+                GUGU_UTEST_CHECK(table->GetText(LocalizationHashedKey(appleKey)) == "A crunchy fruit.");
+
+                // An empty language is a valid switch, all languages are loaded.
+                GUGU_UTEST_CHECK(table->LoadLanguageAsync(""));
+                table->CompleteLanguageLoad();
+                GUGU_UTEST_CHECK(table->GetActiveLanguage().empty());
+                GUGU_UTEST_CHECK(table->HasLanguage("en") && table->HasLanguage("fr"));
+                GUGU_UTEST_CHECK(table->GetText("fr", appleKey) == "Un fruit croquant.");
+            }
+
+            // Reset
+            GetResources()->SetLocalizationLanguage("");
+            GetResources()->CompleteAsyncLoads();
+            GetResources()->RemoveResourcesFromPath(localizationTestsPath, true);
+            GUGU_UTEST_SILENT_CHECK(RemoveDirectoryTree("User"));
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Memory");
+        {
+            // A localization data set with a few languages and a lot of repeated texts.
+            // The string copies memory is an estimation based on common std::string implementations (up to 15 characters stored inline).
+            // It only accounts for the entries with a copy of their key and text, without any index.
+            const std::vector<std::string> languageCodes = { "en", "fr", "de" };
+            const size_t keyCount = 5000;
+            const size_t distinctTextCount = 200;
+
+            const auto getStringCopyMemorySize = [](const std::string& value)
+            {
+                return sizeof(std::string) + (value.size() > 15 ? value.size() + 1 : 0);
+            };
+
+            size_t stringTableMemorySize = GetStringTable()->GetMemorySize();
+            size_t stringCopiesMemorySize = 0;
+
+            LocalizationTable table;
+            for (const std::string& languageCode : languageCodes)
+            {
+                for (size_t i = 0; i < keyCount; ++i)
+                {
+                    LocalizationKey key = GenerateLocalizationKeyForDatasheetMember(StringFormat("Item{0}.item", i), "f672f51b605d42498eca87c427c15607", "description");
+                    std::string text = StringFormat("[{0}] Description of a common item, variant {1}.", languageCode, i % distinctTextCount);
+
+                    LocalizationTextEntry entry;
+                    entry.timestamp = 1;
+                    entry.text = text;
+                    table.TryRegisterEntry(languageCode, key, entry);
+
+                    stringCopiesMemorySize += sizeof(int64) + getStringCopyMemorySize(key) + getStringCopyMemorySize(text);
+                }
+            }
+
+            // Texts are accounted in the table, keys in the StringTable.
+            size_t tableMemorySize = table.GetMemorySize() + GetStringTable()->GetMemorySize() - stringTableMemorySize;
+            size_t copiesMemorySize = stringCopiesMemorySize;
+
+            GUGU_UTEST_REPORT(StringFormat("Localization memory : {0} KB with string copies, {1} KB with interned keys and table texts", copiesMemorySize / 1024, tableMemorySize / 1024));
+            GUGU_UTEST_REPORT(StringFormat("String table : {0} strings, {1} KB", GetStringTable()->GetStringCount(), GetStringTable()->GetMemorySize() / 1024));
+            GUGU_UTEST_CHECK(tableMemorySize < copiesMemorySize);
+        }
+
+        // Lookups of all the keys of a language, with the keys as strings, with pre-hashed keys, and with nested maps of strings as a reference.
+        const size_t lookupKeyCount = 5000;
+        const size_t lookupIterationCount = 20;
+
+        std::vector<std::string> lookupKeys;
+        std::vector<LocalizationHashedKey> lookupHashes;
+        LocalizationTable lookupTable;
+        std::map<std::string, std::map<std::string, std::string>> lookupReferenceTable;
+
+        for (size_t i = 0; i < lookupKeyCount; ++i)
+        {
+            LocalizationKey key = GenerateLocalizationKeyForDatasheetMember(StringFormat("Item{0}.item", i), "f672f51b605d42498eca87c427c15607", "description");
+            std::string text = StringFormat("Description of item {0}.", i);
+
+            LocalizationTextEntry entry;
+            entry.timestamp = 1;
+            entry.text = text;
+            lookupTable.TryRegisterEntry("en", key, entry);
+            lookupReferenceTable["en"][key] = text;
+
+            lookupKeys.push_back(key);
+            lookupHashes.push_back(LocalizationHashedKey(key));
+        }
+
+        // Loading the table from a document will only keep the active language.
+        {
+            std::string result;
+            lookupTable.SaveToString(result);
+
+            GetResources()->SetLocalizationLanguage("en");
+            lookupTable.LoadFromString(result);
+            GetResources()->SetLocalizationLanguage("");
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Lookup Reference");
+        {
+            size_t foundCount = 0;
+            GUGU_UTEST_PERFORMANCE(10, [&]()
+            {
+                foundCount = 0;
+                for (size_t i = 0; i < lookupIterationCount; ++i)
+                {
+                    for (const std::string& key : lookupKeys)
+                    {
+                        auto itLanguage = lookupReferenceTable.find("en");
+                        if (itLanguage != lookupReferenceTable.end())
+                        {
+                            auto itEntry = itLanguage->second.find(key);
+                            foundCount += itEntry != itLanguage->second.end() && !itEntry->second.empty() ? 1 : 0;
+                        }
+                    }
+                }
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(foundCount, lookupKeyCount * lookupIterationCount);
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Lookup By Key");
+        {
+            size_t foundCount = 0;
+            GUGU_UTEST_PERFORMANCE(10, [&]()
+            {
+                foundCount = 0;
+                for (size_t i = 0; i < lookupIterationCount; ++i)
+                {
+                    for (const std::string& key : lookupKeys)
+                    {
+                        foundCount += !lookupTable.GetText("en", key).empty() ? 1 : 0;
+                    }
+                }
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(foundCount, lookupKeyCount * lookupIterationCount);
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Lookup By Hash");
+        {
+            size_t foundCount = 0;
+            GUGU_UTEST_PERFORMANCE(10, [&]()
+            {
+                foundCount = 0;
+                for (size_t i = 0; i < lookupIterationCount; ++i)
+                {
+                    for (const LocalizationHashedKey& key : lookupHashes)
+                    {
+                        foundCount += !lookupTable.GetText(key).empty() ? 1 : 0;
+                    }
+                }
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(foundCount, lookupKeyCount * lookupIterationCount);
+        }
+    }
+
     //----------------------------------------------
 
     GUGU_UTEST_FINALIZE();
@@ -0,0 +1,1004 @@
+////////////////////////////////////////////////////////////////
+// Header
+
+#include "Gugu/Common.h"
+#include "AllUnitTests.h"
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/Network/ManagerNetwork.h"
+#include "Gugu/Network/NetworkBuffer.h"
+#include "Gugu/Network/NetworkPacket.h"
+#include "Gugu/Network/NetworkUdpChannel.h"
+#include "Gugu/Debug/Logger.h"
+#include "Gugu/System/String.h"
+#include "Gugu/System/Time.h"
+
+#include <SFML/Network/Packet.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+#include <SFML/Network/UdpSocket.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#if defined(GUGU_OS_LINUX)
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#endif
+
+using namespace gugu;
+
+////////////////////////////////////////////////////////////////
+// File Implementation
+
+namespace tests {
+
+namespace impl {
+
+// Run the main thread side of the network until the condition is met, or until the timeout.
+template<typename TCondition>
+bool PumpNetwork(const TCondition& condition, int timeoutMs)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    while (!condition())
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+            return false;
+
+        GetNetwork()->ProcessWaitingPackets();
+        std::this_thread::yield();
+    }
+
+    return true;
+}
+
+bool PingLoopback(ENetworkBackend::Type backend, uint16 port)
+{
+    GetNetwork()->StartListening(port, backend);
+    if (!GetNetwork()->IsListening())
+        return false;
+
+    sf::TcpSocket socket;
+    bool connected = socket.connect(sf::IpAddress::LocalHost, port, sf::milliseconds(1000)) == sf::Socket::Status::Done;
+    bool ponged = false;
+
+    if (connected)
+    {
+        // Packet types are written as varints, a single byte below 128.
+        sf::Packet ping;
+        ping << static_cast<uint8>(ENetPacket::Ping);
+        socket.send(ping);
+
+        socket.setBlocking(false);
+        PumpNetwork([&]()
+        {
+            sf::Packet pong;
+            if (socket.receive(pong) == sf::Socket::Status::Done)
+            {
+                uint8 type = ENetPacket::Undefined;
+                pong >> type;
+                ponged = type == ENetPacket::Pong;
+                return true;
+            }
+
+            return false;
+        }, 2000);
+
+        socket.disconnect();
+    }
+
+    bool released = PumpNetwork([]() { return GetNetwork()->GetClientCount() == 0; }, 2000);
+
+    GetNetwork()->StopListening();
+    return connected && ponged && released;
+}
+
+const uint32 UdpMessageCount = 500;
+
+// Every 25th message is fragmented, the payload depends on the message index.
+void BuildUdpMessage(uint32 index, std::vector<uint8>& message)
+{
+    size_t size = index % 25 == 0 ? 5000 : 8 + index % 57;
+    message.resize(size);
+    memcpy(message.data(), &index, sizeof(index));
+
+    for (size_t i = sizeof(index); i < size; ++i)
+    {
+        message[i] = static_cast<uint8>(index + i);
+    }
+}
+
+bool ReadUdpMessage(const uint8* data, size_t size, uint32& index)
+{
+    if (size < sizeof(index))
+        return false;
+
+    memcpy(&index, data, sizeof(index));
+
+    std::vector<uint8> expected;
+    BuildUdpMessage(index, expected);
+    return size == expected.size() && memcmp(data, expected.data(), size) == 0;
+}
+
+struct UdpSimulationResults
+{
+    std::vector<uint32> receivedIndices[ENetChannel::Count];
+    size_t refusedMessageCount = 0;
+    size_t invalidMessageCount = 0;
+    size_t droppedDatagramCount = 0;
+    size_t resentFragmentCount = 0;
+    size_t pendingReliableCount = 0;
+    int64 roundTripUs = 0;
+};
+
+// Two channels linked by simulated links, on a virtual clock (both sides are updated every 16 ms).
+void RunUdpChannelSimulation(float lossRatio, int64 latencyUs, int64 jitterUs, UdpSimulationResults& results)
+{
+    NetworkUdpChannel sender;
+    NetworkUdpChannel receiver;
+    NetworkLinkSimulator senderLink;
+    NetworkLinkSimulator receiverLink;
+    senderLink.SetConditions(lossRatio, latencyUs, jitterUs, 7);
+    receiverLink.SetConditions(lossRatio, latencyUs, jitterUs, 11);
+
+    const int64 frameUs = 16 * 1000;
+    const int64 maxTimeUs = 120 * 1000 * 1000;
+
+    std::vector<uint8> message;
+    NetworkDatagram datagram;
+
+    // One message per channel and per frame, then the links run until the reliable messages are acked.
+    uint32 sentCount = 0;
+    for (int64 timeUs = 0; timeUs < maxTimeUs; timeUs += frameUs)
+    {
+        if (sentCount < UdpMessageCount)
+        {
+            BuildUdpMessage(sentCount, message);
+
+            for (ENetChannel::Type channel : { ENetChannel::ReliableOrdered, ENetChannel::ReliableUnordered, ENetChannel::UnreliableSequenced })
+            {
+                results.refusedMessageCount += sender.Send(channel, message.data(), message.size()) ? 0 : 1;
+            }
+
+            ++sentCount;
+        }
+        else if (sender.GetPendingReliableCount() == 0)
+        {
+            break;
+        }
+
+        sender.Update(timeUs, [&](const uint8* data, size_t size)
+        {
+            senderLink.Push(timeUs, 0, 0, data, size);
+        });
+
+        receiver.Update(timeUs, [&](const uint8* data, size_t size)
+        {
+            receiverLink.Push(timeUs, 0, 0, data, size);
+        });
+
+        while (senderLink.Pop(timeUs, datagram))
+        {
+            receiver.ReceiveDatagram(timeUs, datagram.data.data(), datagram.data.size(), [&](ENetChannel::Type channel, const uint8* data, size_t size)
+            {
+                uint32 index = 0;
+                if (ReadUdpMessage(data, size, index))
+                {
+                    results.receivedIndices[channel].push_back(index);
+                }
+                else
+                {
+                    ++results.invalidMessageCount;
+                }
+            });
+        }
+
+        while (receiverLink.Pop(timeUs, datagram))
+        {
+            sender.ReceiveDatagram(timeUs, datagram.data.data(), datagram.data.size(), [](ENetChannel::Type, const uint8*, size_t) {});
+        }
+    }
+
+    results.droppedDatagramCount = senderLink.GetDroppedCount() + receiverLink.GetDroppedCount();
+    results.resentFragmentCount = sender.GetResentFragmentCount();
+    results.pendingReliableCount = sender.GetPendingReliableCount();
+    results.roundTripUs = sender.GetRoundTripTimeUs();
+}
+
+bool IsIndexSequence(const std::vector<uint32>& indices, uint32 count)
+{
+    if (indices.size() != count)
+        return false;
+
+    for (uint32 i = 0; i < count; ++i)
+    {
+        if (indices[i] != i)
+            return false;
+    }
+
+    return true;
+}
+
+bool IsStrictlyIncreasing(const std::vector<uint32>& indices)
+{
+    for (size_t i = 1; i < indices.size(); ++i)
+    {
+        if (indices[i] <= indices[i - 1])
+            return false;
+    }
+
+    return true;
+}
+
+size_t CountFragmentedMessages(const std::vector<uint32>& indices)
+{
+    return std::count_if(indices.begin(), indices.end(), [](uint32 index) { return index % 25 == 0; });
+}
+
+// A single reliable message sent to a peer that never answers, on a virtual clock.
+size_t CountResentFragmentsWithoutAck(int64 durationUs)
+{
+    NetworkUdpChannel channel;
+    uint8 value = 0;
+    channel.Send(ENetChannel::ReliableOrdered, &value, sizeof(value));
+
+    for (int64 timeUs = 0; timeUs < durationUs; timeUs += 16 * 1000)
+    {
+        channel.Update(timeUs, [](const uint8*, size_t) {});
+    }
+
+    return channel.GetResentFragmentCount();
+}
+
+// A datagram carrying the first fragment of a message, the other fragments are never sent.
+void BuildFirstFragmentDatagram(uint16 sequence, ENetChannel::Type channel, uint16 messageId, size_t fragmentCount, NetBufferWriter& writer)
+{
+    size_t fragmentSize = fragmentCount > 1 ? NetworkUdpChannel::MaxFragmentSize : 1;
+    std::vector<uint8> fragment(fragmentSize, 0);
+
+    writer.Reset();
+    writer.WriteUInt16(sequence);
+    writer.WriteUInt8(0);
+    writer.WriteUInt16(0);
+    writer.WriteUInt32(0);
+    writer.WriteUInt8(static_cast<uint8>(channel));
+    writer.WriteUInt16(messageId);
+    writer.WriteUInt8(0);
+    writer.WriteUInt8(static_cast<uint8>(fragmentCount));
+    writer.WriteUInt16(static_cast<uint16>(fragmentSize));
+    writer.WriteBytes(fragment.data(), fragment.size());
+}
+
+// Last datagram sequence acked by the channel on its next update.
+uint16 ReadAckedSequence(NetworkUdpChannel& channel)
+{
+    uint16 ack = 0;
+    channel.Update(0, [&](const uint8* data, size_t size)
+    {
+        NetBufferReader reader(data, size);
+        uint16 sequence = 0;
+        uint8 flags = 0;
+        reader.ReadUInt16(sequence);
+        reader.ReadUInt8(flags);
+        reader.ReadUInt16(ack);
+    });
+
+    return ack;
+}
+
+// The peer uses its own udp socket and channel, its udp port is announced to the ManagerNetwork through tcp.
+// Pings are reliable and ordered, pongs are reliable and unordered.
+// Real sockets are used without a simulated loss, loss and latency are covered by the virtual clock simulation.
+bool PingUdpLoopback(uint16 port, uint16 peerPort, size_t pingCount, size_t& pongCount)
+{
+    GetNetwork()->SetPacketChannel(ENetPacket::Ping, ENetChannel::ReliableOrdered);
+    GetNetwork()->SetPacketChannel(ENetPacket::Pong, ENetChannel::ReliableUnordered);
+    GetNetwork()->StartListening(port);
+
+    // Each ping is logged by the ManagerNetwork.
+    GetLogNetwork()->SetActive(false);
+
+    sf::TcpSocket socket;
+    sf::UdpSocket udpSocket;
+    bool ready = GetNetwork()->IsUdpAvailable()
+        && udpSocket.bind(peerPort, sf::IpAddress::LocalHost) == sf::Socket::Status::Done
+        && socket.connect(sf::IpAddress::LocalHost, port, sf::milliseconds(1000)) == sf::Socket::Status::Done;
+
+    if (ready)
+    {
+        udpSocket.setBlocking(false);
+
+        NetBufferWriter writer;
+        NetPacketClientConnection(sf::IpAddress::LocalHost.toInteger(), peerPort).Serialize(writer);
+
+        sf::Packet clientInfos;
+        clientInfos.append(writer.GetData(), writer.GetSize());
+        socket.send(clientInfos);
+
+        NetworkUdpChannel channel;
+
+        writer.Reset();
+        NetPacket(ENetPacket::Ping).Serialize(writer);
+        for (size_t i = 0; i < pingCount; ++i)
+        {
+            channel.Send(ENetChannel::ReliableOrdered, writer.GetData(), writer.GetSize());
+        }
+
+        // Datagrams sent before the udp port is announced are ignored by the ManagerNetwork, and resent.
+        std::vector<uint8> buffer(NetworkUdpChannel::MaxDatagramSize);
+        PumpNetwork([&]()
+        {
+            int64 timeUs = GetElapsedMicroseconds();
+            channel.Update(timeUs, [&](const uint8* data, size_t size)
+            {
+                udpSocket.send(data, size, sf::IpAddress::LocalHost, port);
+            });
+
+            size_t receivedSize = 0;
+            std::optional<sf::IpAddress> remoteAddress;
+            uint16 remotePort = 0;
+            while (udpSocket.receive(buffer.data(), buffer.size(), receivedSize, remoteAddress, remotePort) == sf::Socket::Status::Done)
+            {
+                channel.ReceiveDatagram(timeUs, buffer.data(), receivedSize, [&](ENetChannel::Type, const uint8* data, size_t size)
+                {
+                    NetBufferReader reader(data, size);
+
+                    uint32 type = ENetPacket::Undefined;
+                    reader.ReadVarUInt32(type);
+                    pongCount += type == ENetPacket::Pong ? 1 : 0;
+                });
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            return pongCount >= pingCount;
+        }, 2000);
+
+        socket.disconnect();
+    }
+
+    bool released = PumpNetwork([]() { return GetNetwork()->GetClientCount() == 0; }, 2000);
+
+    GetNetwork()->StopListening();
+    GetNetwork()->SetPacketChannel(ENetPacket::Ping, ENetChannel::Tcp);
+    GetNetwork()->SetPacketChannel(ENetPacket::Pong, ENetChannel::Tcp);
+    GetLogNetwork()->SetActive(true);
+
+    return ready && released;
+}
+
+const size_t SerializationRecipientCount = 32;
+
+struct SerializationResults
+{
+    size_t messageCount = 0;
+    size_t allocationCount = 0;
+    double elapsedSeconds = 0.0;
+    uint64 turnSum = 0;
+};
+
+// Reference : an sf::Packet is filled for each recipient, and each received packet is allocated.
+void RunSerializationReference(size_t messageCount, std::vector<std::vector<uint8>>& frames, SerializationResults& results)
+{
+    using Clock = std::chrono::steady_clock;
+
+    size_t allocationCount = GetAllocationCount();
+    Clock::time_point startTime = Clock::now();
+
+    for (size_t i = 0; i < messageCount; ++i)
+    {
+        for (std::vector<uint8>& frame : frames)
+        {
+            sf::Packet packet;
+            packet << static_cast<uint32>(ENetPacket::TurnReady) << static_cast<uint32>(i);
+
+            const uint8* data = static_cast<const uint8*>(packet.getData());
+            frame.assign(data, data + packet.getDataSize());
+        }
+
+        sf::Packet receivedPacket;
+        receivedPacket.append(frames[i % frames.size()].data(), frames[i % frames.size()].size());
+
+        uint32 type = ENetPacket::Undefined;
+        uint32 turn = 0;
+        receivedPacket >> type >> turn;
+
+        NetPacketTurnReady* packet = new NetPacketTurnReady(turn);
+        results.turnSum += type == ENetPacket::TurnReady ? packet->m_turn : 0;
+        delete packet;
+    }
+
+    results.elapsedSeconds = std::chrono::duration<double>(Clock::now() - startTime).count();
+    results.allocationCount = GetAllocationCount() - allocationCount;
+    results.messageCount = messageCount;
+}
+
+// Pooled : packets are acquired from a pool, and serialized once in a reused buffer for all the recipients.
+void RunSerializationPooled(size_t messageCount, NetPacketPool& pool, NetBufferWriter& writer, std::vector<std::vector<uint8>>& frames, SerializationResults& results)
+{
+    using Clock = std::chrono::steady_clock;
+
+    size_t allocationCount = GetAllocationCount();
+    Clock::time_point startTime = Clock::now();
+
+    for (size_t i = 0; i < messageCount; ++i)
+    {
+        NetPacketTurnReady* sentPacket = static_cast<NetPacketTurnReady*>(pool.Acquire(ENetPacket::TurnReady));
+        sentPacket->m_turn = static_cast<uint32>(i);
+
+        writer.Reset(sizeof(uint32));
+        sentPacket->Serialize(writer);
+        writer.WriteUInt32At(0, static_cast<uint32>(writer.GetSize()));
+        pool.Release(sentPacket);
+
+        for (std::vector<uint8>& frame : frames)
+        {
+            frame.assign(writer.GetFrameData(), writer.GetFrameData() + writer.GetFrameSize());
+        }
+
+        const std::vector<uint8>& receivedFrame = frames[i % frames.size()];
+        NetBufferReader reader(receivedFrame.data() + sizeof(uint32), receivedFrame.size() - sizeof(uint32));
+
+        uint32 type = ENetPacket::Undefined;
+        reader.ReadVarUInt32(type);
+
+        NetPacket* receivedPacket = pool.Acquire(static_cast<ENetPacket::Type>(type));
+        if (receivedPacket && receivedPacket->Deserialize(reader))
+        {
+            results.turnSum += static_cast<NetPacketTurnReady*>(receivedPacket)->m_turn;
+        }
+
+        pool.Release(receivedPacket);
+    }
+
+    results.elapsedSeconds = std::chrono::duration<double>(Clock::now() - startTime).count();
+    results.allocationCount = GetAllocationCount() - allocationCount;
+    results.messageCount = messageCount;
+}
+
+std::string FormatSerializationReport(const std::string& name, const SerializationResults& results)
+{
+    size_t messagesPerSecond = static_cast<size_t>(results.messageCount / std::max(results.elapsedSeconds, 1e-9));
+    if (!IsAllocationCountEnabled())
+        return StringFormat("{0} : {1} messages/s to {2} recipients", name, messagesPerSecond, SerializationRecipientCount);
+
+    return StringFormat("{0} : {1} messages/s to {2} recipients, {3} allocations per message"
+        , name
+        , messagesPerSecond
+        , SerializationRecipientCount
+        , (float)results.allocationCount / results.messageCount);
+}
+
+#if defined(GUGU_OS_LINUX)
+
+struct SwarmResults
+{
+    size_t clientCount = 0;
+    size_t invalidPacketCount = 0;
+    double elapsedSeconds = 0.0;
+    std::vector<int64> latenciesUs;
+};
+
+// Loopback clients, each client sends a ping and waits for the pong before sending the next one.
+bool RunPingSwarm(uint16 port, size_t clientCount, size_t roundTripsPerClient, SwarmResults& results)
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Frames use the sf::Packet format : 32 bits big-endian size, then the packet type (a single byte varint).
+    const size_t frameSize = sizeof(uint32) + 1;
+    uint8 pingFrame[frameSize];
+    uint32 pingSize = htonl(1);
+    memcpy(pingFrame, &pingSize, sizeof(uint32));
+    pingFrame[sizeof(uint32)] = static_cast<uint8>(ENetPacket::Ping);
+
+    sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    struct SwarmClient
+    {
+        int handle = -1;
+        size_t remainingRoundTrips = 0;
+        Clock::time_point sendTime;
+        uint8 frame[frameSize];
+        size_t frameReceivedSize = 0;
+    };
+
+    std::vector<SwarmClient> clients(clientCount);
+    results.clientCount = clientCount;
+    results.latenciesUs.reserve(clientCount * roundTripsPerClient);
+
+    int epollHandle = epoll_create1(0);
+    bool success = epollHandle >= 0;
+
+    Clock::time_point startTime = Clock::now();
+
+    for (size_t i = 0; success && i < clientCount; ++i)
+    {
+        SwarmClient& client = clients[i];
+        client.remainingRoundTrips = roundTripsPerClient;
+        client.handle = socket(AF_INET, SOCK_STREAM, 0);
+
+        epoll_event event;
+        memset(&event, 0, sizeof(event));
+        event.events = EPOLLIN;
+        event.data.u64 = i;
+
+        success = client.handle >= 0
+            && connect(client.handle, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0
+            && epoll_ctl(epollHandle, EPOLL_CTL_ADD, client.handle, &event) == 0;
+
+        if (success)
+        {
+            client.sendTime = Clock::now();
+            success = send(client.handle, pingFrame, frameSize, MSG_NOSIGNAL) == static_cast<ssize_t>(frameSize);
+        }
+    }
+
+    size_t activeCount = success ? clientCount : 0;
+    Clock::time_point deadline = Clock::now() + std::chrono::seconds(30);
+    epoll_event events[256];
+
+    while (success && activeCount > 0 && Clock::now() < deadline)
+    {
+        int eventCount = epoll_wait(epollHandle, events, 256, 100);
+        for (int eventIndex = 0; success && eventIndex < eventCount; ++eventIndex)
+        {
+            SwarmClient& client = clients[events[eventIndex].data.u64];
+
+            ssize_t readSize = recv(client.handle, client.frame + client.frameReceivedSize, frameSize - client.frameReceivedSize, 0);
+            if (readSize <= 0)
+            {
+                success = false;
+                break;
+            }
+
+            client.frameReceivedSize += static_cast<size_t>(readSize);
+            if (client.frameReceivedSize < frameSize)
+                continue;
+
+            client.frameReceivedSize = 0;
+            results.latenciesUs.push_back(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - client.sendTime).count());
+
+            results.invalidPacketCount += client.frame[sizeof(uint32)] == ENetPacket::Pong ? 0 : 1;
+
+            if (--client.remainingRoundTrips > 0)
+            {
+                client.sendTime = Clock::now();
+                send(client.handle, pingFrame, frameSize, MSG_NOSIGNAL);
+            }
+            else
+            {
+                --activeCount;
+            }
+        }
+    }
+
+    results.elapsedSeconds = std::chrono::duration<double>(Clock::now() - startTime).count();
+
+    for (const SwarmClient& client : clients)
+    {
+        if (client.handle >= 0)
+        {
+            close(client.handle);
+        }
+    }
+
+    if (epollHandle >= 0)
+    {
+        close(epollHandle);
+    }
+
+    return success && activeCount == 0;
+}
+
+bool RunPingSwarmLoopback(ENetworkBackend::Type backend, uint16 port, size_t clientCount, size_t roundTripsPerClient, SwarmResults& results)
+{
+    // Each ping is logged by the ManagerNetwork.
+    if (GetLogNetwork())
+    {
+        GetLogNetwork()->SetActive(false);
+    }
+
+    GetNetwork()->StartListening(port, backend);
+
+    bool swarmSuccess = false;
+    std::atomic<bool> swarmDone(false);
+    std::thread swarm([&]()
+    {
+        swarmSuccess = RunPingSwarm(port, clientCount, roundTripsPerClient, results);
+        swarmDone = true;
+    });
+
+    // The test thread is used as the main thread.
+    PumpNetwork([&]() { return swarmDone.load(); }, 60000);
+    swarm.join();
+
+    bool released = PumpNetwork([]() { return GetNetwork()->GetClientCount() == 0; }, 5000);
+
+    GetNetwork()->StopListening();
+    GetLogNetwork()->SetActive(true);
+
+    return swarmSuccess && released;
+}
+
+std::string FormatSwarmReport(const std::string& backendName, SwarmResults& results)
+{
+    std::vector<int64>& latencies = results.latenciesUs;
+    if (latencies.empty())
+        return StringFormat("{0} : no round trip", backendName);
+
+    std::sort(latencies.begin(), latencies.end());
+
+    size_t roundTripsPerSecond = static_cast<size_t>(latencies.size() / results.elapsedSeconds);
+    return StringFormat("{0} : {1} clients, {2} round trips/s, latency p50 {3} us, p99 {4} us, p99.9 {5} us, max {6} us"
+        , backendName
+        , results.clientCount
+        , roundTripsPerSecond
+        , latencies[latencies.size() / 2]
+        , latencies[latencies.size() * 99 / 100]
+        , latencies[latencies.size() * 999 / 1000]
+        , latencies.back());
+}
+
+#endif
+
+}   // namespace impl
+
+void RunUnitTests_Network(UnitTestResults* results)
+{
+    GUGU_UTEST_INIT("Network", "UnitTests_Network.log", results);
+
+    const uint16 testPort = 45670;
+
+    //----------------------------------------------
+
+    GUGU_UTEST_SECTION("Serialization");
+    {
+        GUGU_UTEST_SUBSECTION("Buffer");
+        {
+            NetBufferWriter writer;
+            writer.WriteVarUInt32(0);
+            writer.WriteVarUInt32(127);
+            writer.WriteVarUInt32(128);
+            writer.WriteVarUInt32(0xFFFFFFFF);
+            writer.WriteVarInt32(-1);
+            writer.WriteVarInt32(63);
+            writer.WriteVarInt32(-64);
+            writer.WriteVarInt32(-2147483647 - 1);
+            writer.WriteVarUInt64(0xFFFFFFFFFFFFFFFF);
+            writer.WriteBool(true);
+            writer.WriteBits(5, 3);
+            writer.WriteBits(0x1FF, 9);
+            writer.WriteUInt16(0xBEEF);
+            writer.WriteFloat(1.5f);
+            writer.WriteString("gugu");
+
+            // Varints : 9 + 8 + 10 bytes, bits : 2 bytes, then 2 + 4 + 5 bytes.
+            GUGU_UTEST_CHECK_EQUAL(writer.GetSize(), (size_t)40);
+
+            NetBufferReader reader(writer.GetData(), writer.GetSize());
+            uint32 valueUInt32 = 0;
+            int32 valueInt32 = 0;
+            uint64 valueUInt64 = 0;
+            bool valueBool = false;
+            uint16 valueUInt16 = 0;
+            float valueFloat = 0.f;
+            std::string valueString;
+
+            GUGU_UTEST_CHECK(reader.ReadVarUInt32(valueUInt32) && valueUInt32 == 0);
+            GUGU_UTEST_CHECK(reader.ReadVarUInt32(valueUInt32) && valueUInt32 == 127);
+            GUGU_UTEST_CHECK(reader.ReadVarUInt32(valueUInt32) && valueUInt32 == 128);
+            GUGU_UTEST_CHECK(reader.ReadVarUInt32(valueUInt32) && valueUInt32 == 0xFFFFFFFF);
+            GUGU_UTEST_CHECK(reader.ReadVarInt32(valueInt32) && valueInt32 == -1);
+            GUGU_UTEST_CHECK(reader.ReadVarInt32(valueInt32) && valueInt32 == 63);
+            GUGU_UTEST_CHECK(reader.ReadVarInt32(valueInt32) && valueInt32 == -64);
+            GUGU_UTEST_CHECK(reader.ReadVarInt32(valueInt32) && valueInt32 == -2147483647 - 1);
+            GUGU_UTEST_CHECK(reader.ReadVarUInt64(valueUInt64) && valueUInt64 == 0xFFFFFFFFFFFFFFFF);
+            GUGU_UTEST_CHECK(reader.ReadBool(valueBool) && valueBool);
+            GUGU_UTEST_CHECK(reader.ReadBits(valueUInt32, 3) && valueUInt32 == 5);
+            GUGU_UTEST_CHECK(reader.ReadBits(valueUInt32, 9) && valueUInt32 == 0x1FF);
+            GUGU_UTEST_CHECK(reader.ReadUInt16(valueUInt16) && valueUInt16 == 0xBEEF);
+            GUGU_UTEST_CHECK(reader.ReadFloat(valueFloat) && valueFloat == 1.5f);
+            GUGU_UTEST_CHECK(reader.ReadString(valueString) && valueString == "gugu");
+            GUGU_UTEST_CHECK(reader.IsEnd() && reader.IsValid());
+
+            // Reading past the end invalidates the reader.
+            uint8 valueUInt8 = 0;
+            GUGU_UTEST_CHECK(!reader.ReadUInt8(valueUInt8));
+            GUGU_UTEST_CHECK(!reader.IsValid());
+
+            NetBufferReader truncatedReader(writer.GetData(), 3);
+            GUGU_UTEST_CHECK(truncatedReader.ReadVarUInt32(valueUInt32) && valueUInt32 == 0);
+            GUGU_UTEST_CHECK(truncatedReader.ReadVarUInt32(valueUInt32) && valueUInt32 == 127);
+            GUGU_UTEST_CHECK(!truncatedReader.ReadVarUInt32(valueUInt32));
+            GUGU_UTEST_CHECK(!truncatedReader.IsValid());
+
+            // The frame header receives the payload size.
+            writer.Reset(sizeof(uint32));
+            writer.WriteVarUInt32(300);
+            writer.WriteUInt32At(0, static_cast<uint32>(writer.GetSize()));
+
+            const uint8 expectedFrame[] = { 0, 0, 0, 2, 0xAC, 0x02 };
+            GUGU_UTEST_CHECK_EQUAL(writer.GetSize(), (size_t)2);
+            GUGU_UTEST_CHECK_EQUAL(writer.GetFrameSize(), sizeof(expectedFrame));
+            GUGU_UTEST_CHECK(memcmp(writer.GetFrameData(), expectedFrame, sizeof(expectedFrame)) == 0);
+        }
+
+        GUGU_UTEST_SUBSECTION("Packets");
+        {
+            NetPacketPool pool;
+            NetBufferWriter writer;
+
+            NetPacketAddPlayer sentPacket(0x7F000001, 45670, 12);
+            sentPacket.Serialize(writer);
+
+            NetBufferReader reader(writer.GetData(), writer.GetSize());
+            uint32 type = ENetPacket::Undefined;
+            GUGU_UTEST_CHECK(reader.ReadVarUInt32(type) && type == ENetPacket::AddPlayer);
+
+            NetPacket* receivedPacket = pool.Acquire(static_cast<ENetPacket::Type>(type));
+            GUGU_UTEST_CHECK(receivedPacket && receivedPacket->Deserialize(reader) && reader.IsEnd());
+
+            NetPacketAddPlayer* receivedAddPlayer = static_cast<NetPacketAddPlayer*>(receivedPacket);
+            GUGU_UTEST_CHECK_EQUAL(receivedAddPlayer->m_ipAddress, (uint32)0x7F000001);
+            GUGU_UTEST_CHECK_EQUAL(receivedAddPlayer->m_port, (uint16)45670);
+            GUGU_UTEST_CHECK_EQUAL(receivedAddPlayer->m_playerID, 12);
+
+            // Released packets are recycled.
+            pool.Release(receivedPacket);
+            GUGU_UTEST_CHECK_EQUAL(pool.GetFreeCount(ENetPacket::AddPlayer), (size_t)1);
+            GUGU_UTEST_CHECK(pool.Acquire(ENetPacket::AddPlayer) == receivedPacket);
+            pool.Release(receivedPacket);
+
+            GUGU_UTEST_CHECK(pool.Acquire(ENetPacket::Game) == nullptr);
+            GUGU_UTEST_CHECK(pool.Acquire(ENetPacket::Undefined) == nullptr);
+
+            // A truncated packet is refused.
+            NetBufferReader truncatedReader(writer.GetData(), writer.GetSize() - 1);
+            truncatedReader.ReadVarUInt32(type);
+
+            NetPacket* truncatedPacket = pool.Acquire(static_cast<ENetPacket::Type>(type));
+            GUGU_UTEST_CHECK(!truncatedPacket->Deserialize(truncatedReader));
+            pool.Release(truncatedPacket);
+
+            // Turns are varints : 3 bytes instead of 8 with sf::Packet.
+            writer.Reset();
+            NetPacketTurnReady(1000).Serialize(writer);
+            GUGU_UTEST_CHECK_EQUAL(writer.GetSize(), (size_t)3);
+        }
+
+        std::vector<std::vector<uint8>> frames(impl::SerializationRecipientCount, std::vector<uint8>(64));
+        const size_t messageCount = 20000;
+
+        GUGU_UTEST_SUBSECTION("Allocations");
+        {
+            NetPacketPool pool;
+            NetBufferWriter writer(64);
+
+            // The first message fills the pool.
+            impl::SerializationResults warmupResults;
+            impl::RunSerializationPooled(1, pool, writer, frames, warmupResults);
+
+            impl::SerializationResults results;
+            impl::RunSerializationPooled(1000, pool, writer, frames, results);
+
+            GUGU_UTEST_CHECK_EQUAL(results.allocationCount, (size_t)0);
+            GUGU_UTEST_CHECK_EQUAL(results.turnSum, (uint64)(999 * 1000 / 2));
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Reference");
+        {
+            impl::SerializationResults results;
+            impl::RunSerializationReference(messageCount, frames, results);
+
+            GUGU_UTEST_CHECK_EQUAL(results.turnSum, (uint64)(messageCount * (messageCount - 1) / 2));
+            GUGU_UTEST_REPORT(impl::FormatSerializationReport("sf::Packet", results));
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Pooled");
+        {
+            NetPacketPool pool;
+            NetBufferWriter writer(64);
+
+            impl::SerializationResults results;
+            impl::RunSerializationPooled(messageCount, pool, writer, frames, results);
+
+            GUGU_UTEST_CHECK_EQUAL(results.turnSum, (uint64)(messageCount * (messageCount - 1) / 2));
+            GUGU_UTEST_REPORT(impl::FormatSerializationReport("Pooled", results));
+        }
+    }
+
+    //----------------------------------------------
+
+    GUGU_UTEST_SECTION("Loopback");
+    {
+        GUGU_UTEST_SUBSECTION("Ping Selector");
+        {
+            GUGU_UTEST_CHECK(impl::PingLoopback(ENetworkBackend::Selector, testPort));
+        }
+
+#if defined(GUGU_OS_LINUX)
+
+        GUGU_UTEST_SUBSECTION("Ping Epoll");
+        {
+            GUGU_UTEST_CHECK(impl::PingLoopback(ENetworkBackend::Epoll, testPort + 1));
+        }
+
+#endif
+    }
+
+    //----------------------------------------------
+
+    GUGU_UTEST_SECTION("Udp Channel");
+    {
+        // 20% loss on both sides, 50 ms latency, and a jitter reordering the datagrams.
+        impl::UdpSimulationResults results;
+        impl::RunUdpChannelSimulation(0.2f, 50 * 1000, 20 * 1000, results);
+
+        GUGU_UTEST_CHECK_EQUAL(results.refusedMessageCount, (size_t)0);
+        GUGU_UTEST_CHECK_EQUAL(results.invalidMessageCount, (size_t)0);
+        GUGU_UTEST_CHECK_EQUAL(results.pendingReliableCount, (size_t)0);
+
+        GUGU_UTEST_SUBSECTION("Reliable Ordered");
+        {
+            GUGU_UTEST_CHECK(impl::IsIndexSequence(results.receivedIndices[ENetChannel::ReliableOrdered], impl::UdpMessageCount));
+        }
+
+        GUGU_UTEST_SUBSECTION("Reliable Unordered");
+        {
+            std::vector<uint32> sortedIndices = results.receivedIndices[ENetChannel::ReliableUnordered];
+            std::sort(sortedIndices.begin(), sortedIndices.end());
+
+            GUGU_UTEST_CHECK(impl::IsIndexSequence(sortedIndices, impl::UdpMessageCount));
+            GUGU_UTEST_CHECK(sortedIndices != results.receivedIndices[ENetChannel::ReliableUnordered]);
+        }
+
+        GUGU_UTEST_SUBSECTION("Unreliable Sequenced");
+        {
+            const std::vector<uint32>& indices = results.receivedIndices[ENetChannel::UnreliableSequenced];
+
+            GUGU_UTEST_CHECK(impl::IsStrictlyIncreasing(indices));
+            GUGU_UTEST_CHECK(indices.size() > impl::UdpMessageCount / 2);
+            GUGU_UTEST_CHECK(indices.size() < impl::UdpMessageCount);
+        }
+
+        GUGU_UTEST_SUBSECTION("Fragmentation");
+        {
+            GUGU_UTEST_CHECK_EQUAL(impl::CountFragmentedMessages(results.receivedIndices[ENetChannel::ReliableOrdered]), (size_t)(impl::UdpMessageCount / 25));
+            GUGU_UTEST_CHECK_EQUAL(impl::CountFragmentedMessages(results.receivedIndices[ENetChannel::ReliableUnordered]), (size_t)(impl::UdpMessageCount / 25));
+        }
+
+        GUGU_UTEST_SUBSECTION("Round Trip");
+        {
+            // Acks are sent on the next update, up to one frame later.
+            GUGU_UTEST_CHECK(results.roundTripUs >= 100 * 1000);
+            GUGU_UTEST_CHECK(results.roundTripUs <= 100 * 1000 + 2 * 20 * 1000 + 3 * 16 * 1000);
+            GUGU_UTEST_CHECK(results.droppedDatagramCount > 0);
+            GUGU_UTEST_CHECK(results.resentFragmentCount > 0);
+            GUGU_UTEST_REPORT(StringFormat("Round trip {0} us, {1} dropped datagrams, {2} resent fragments", results.roundTripUs, results.droppedDatagramCount, results.resentFragmentCount));
+        }
+
+        GUGU_UTEST_SUBSECTION("Backoff");
+        {
+            // Without backoff, a 200 ms timeout would resend the fragment about 50 times in 10 s.
+            size_t resentCount = impl::CountResentFragmentsWithoutAck(10 * 1000 * 1000);
+            GUGU_UTEST_CHECK(resentCount >= 4);
+            GUGU_UTEST_CHECK(resentCount <= 6);
+        }
+
+        GUGU_UTEST_SUBSECTION("Buffered Size");
+        {
+            NetBufferWriter writer;
+            auto ignoreMessage = [](ENetChannel::Type, const uint8*, size_t) {};
+
+            // Incomplete messages fill the channel, the datagrams refused for lack of space are not acked.
+            NetworkUdpChannel receiver;
+            for (uint16 i = 0; i < 64; ++i)
+            {
+                impl::BuildFirstFragmentDatagram(i, ENetChannel::ReliableUnordered, i, NetworkUdpChannel::MaxFragmentCount, writer);
+                GUGU_UTEST_SILENT_CHECK(receiver.ReceiveDatagram(0, writer.GetData(), writer.GetSize(), ignoreMessage));
+            }
+
+            GUGU_UTEST_CHECK_EQUAL(receiver.GetBufferedSize(), NetworkUdpChannel::MaxBufferedSizePerChannel);
+            GUGU_UTEST_CHECK_EQUAL(impl::ReadAckedSequence(receiver), (uint16)(NetworkUdpChannel::MaxBufferedSizePerChannel / NetworkUdpChannel::MaxMessageSize - 1));
+
+            // A newer sequenced message drops the previous reassembly.
+            NetworkUdpChannel sequencedReceiver;
+            impl::BuildFirstFragmentDatagram(0, ENetChannel::UnreliableSequenced, 0, NetworkUdpChannel::MaxFragmentCount, writer);
+            sequencedReceiver.ReceiveDatagram(0, writer.GetData(), writer.GetSize(), ignoreMessage);
+            GUGU_UTEST_CHECK_EQUAL(sequencedReceiver.GetBufferedSize(), NetworkUdpChannel::MaxMessageSize);
+
+            impl::BuildFirstFragmentDatagram(1, ENetChannel::UnreliableSequenced, 1, 1, writer);
+            sequencedReceiver.ReceiveDatagram(0, writer.GetData(), writer.GetSize(), ignoreMessage);
+            GUGU_UTEST_CHECK_EQUAL(sequencedReceiver.GetBufferedSize(), (size_t)0);
+
+            // A reassembly too far ahead of a received message is stale, its message id has wrapped around.
+            impl::BuildFirstFragmentDatagram(2, ENetChannel::UnreliableSequenced, 2000, NetworkUdpChannel::MaxFragmentCount, writer);
+            sequencedReceiver.ReceiveDatagram(0, writer.GetData(), writer.GetSize(), ignoreMessage);
+            GUGU_UTEST_CHECK_EQUAL(sequencedReceiver.GetBufferedSize(), NetworkUdpChannel::MaxMessageSize);
+
+            impl::BuildFirstFragmentDatagram(3, ENetChannel::UnreliableSequenced, 2, 1, writer);
+            sequencedReceiver.ReceiveDatagram(0, writer.GetData(), writer.GetSize(), ignoreMessage);
+            GUGU_UTEST_CHECK_EQUAL(sequencedReceiver.GetBufferedSize(), (size_t)0);
+        }
+
+        GUGU_UTEST_SUBSECTION("Loopback Ping");
+        {
+            const size_t pingCount = 200;
+            size_t pongCount = 0;
+
+            GUGU_UTEST_CHECK(impl::PingUdpLoopback(testPort + 4, testPort + 5, pingCount, pongCount));
+            GUGU_UTEST_CHECK_EQUAL(pongCount, pingCount);
+        }
+    }
+
+    //----------------------------------------------
+
+#if defined(GUGU_OS_LINUX)
+
+    // Opt-in : the swarm raises the handle limit and opens more than 2000 loopback sockets.
+    if (AreHeavyBenchmarksEnabled())
+    {
+        GUGU_UTEST_SECTION("Loopback Swarm");
+        {
+            // Each connection uses a handle on both sides.
+            size_t clientCount = 1024;
+            const size_t roundTripsPerClient = 20;
+
+            rlimit limit;
+            getrlimit(RLIMIT_NOFILE, &limit);
+
+            rlim_t requiredHandleCount = clientCount * 2 + 64;
+            if (limit.rlim_cur < requiredHandleCount)
+            {
+                limit.rlim_cur = std::min(limit.rlim_max, requiredHandleCount);
+                setrlimit(RLIMIT_NOFILE, &limit);
+                getrlimit(RLIMIT_NOFILE, &limit);
+            }
+
+            clientCount = std::min<size_t>(clientCount, (limit.rlim_cur - 64) / 2);
+
+            GUGU_UTEST_SUBSECTION("Benchmark Selector Reference");
+            {
+                // The selector relies on select, limited to FD_SETSIZE handles.
+                size_t selectorClientCount = std::min<size_t>(clientCount, 256);
+
+                impl::SwarmResults swarmResults;
+                GUGU_UTEST_CHECK(impl::RunPingSwarmLoopback(ENetworkBackend::Selector, testPort + 2, selectorClientCount, roundTripsPerClient, swarmResults));
+                GUGU_UTEST_CHECK_EQUAL(swarmResults.latenciesUs.size(), selectorClientCount * roundTripsPerClient);
+                GUGU_UTEST_CHECK_EQUAL(swarmResults.invalidPacketCount, (size_t)0);
+                GUGU_UTEST_REPORT(impl::FormatSwarmReport("Selector", swarmResults));
+            }
+
+            GUGU_UTEST_SUBSECTION("Benchmark Epoll");
+            {
+                impl::SwarmResults swarmResults;
+                GUGU_UTEST_CHECK(impl::RunPingSwarmLoopback(ENetworkBackend::Epoll, testPort + 3, clientCount, roundTripsPerClient, swarmResults));
+                GUGU_UTEST_CHECK_EQUAL(swarmResults.latenciesUs.size(), clientCount * roundTripsPerClient);
+                GUGU_UTEST_CHECK_EQUAL(swarmResults.invalidPacketCount, (size_t)0);
+                GUGU_UTEST_REPORT(impl::FormatSwarmReport("Epoll", swarmResults));
+            }
+        }
+    }
+
+#endif
+
+    //----------------------------------------------
+
+    GUGU_UTEST_FINALIZE();
+}
+
+}   // namespace tests
@@ -7,10 +7,38 @@
 ////////////////////////////////////////////////////////////////
 // Includes
 
+#include "Gugu/Engine.h"
+#include "Gugu/Element/2D/ElementSprite.h"
 #include "Gugu/Resources/ManagerResources.h"
 #include "Gugu/Resources/ImageSet.h"
+#include "Gugu/Resources/AudioClip.h"
+#include "Gugu/Resources/Texture.h"
+#include "Gugu/Resources/ResourceArchive.h"
+#include "Gugu/Resources/ResourceInfo.h"
+#include "Gugu/Resources/ResourceRef.h"
+#include "Gugu/Resources/Datasheet.h"
+#include "Gugu/Resources/PreloadManifest.h"
+#include "Gugu/Scene/ManagerScenes.h"
+#include "Gugu/Scene/Scene.h"
+#include "Gugu/Core/DeltaTime.h"
+#include "Gugu/Core/EngineConfig.h"
+#include "Gugu/External/PugiXmlUtility.h"
+#include "Gugu/Math/MathUtility.h"
+#include "Gugu/System/Container.h"
 #include "Gugu/System/Platform.h"
 #include "Gugu/System/Memory.h"
+#include "Gugu/System/String.h"
+#include "Gugu/System/ThreadPool.h"
+#include "Gugu/System/UUID.h"
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <set>
+#include <thread>
 
 using namespace gugu;
 
@@ -19,6 +47,40 @@ using namespace gugu;
 
 namespace tests {
 
+namespace impl {
+
+// Benchmarks generate thousands of files, a small set is enough to check their results when the heavy benchmarks are disabled.
+size_t GetBenchmarkFileCount(size_t heavyCount)
+{
+    return AreHeavyBenchmarksEnabled() ? heavyCount : std::min<size_t>(heavyCount, 100);
+}
+
+// Item datasheets named after their index, organized as a tree when childCount is not zero (each datasheet inherits from its parent).
+void WriteItemDatasheet(const std::string& directoryPath, const std::string& prefix, size_t index, size_t childCount, const std::string& name)
+{
+    std::ofstream file(StringFormat("{0}/{1}{2}.item", directoryPath, prefix, index), std::ios::out | std::ios::binary | std::ios::trunc);
+    file << "<Datasheet serializationVersion=\"2\" bindingVersion=\"1\"";
+    if (childCount > 0 && index > 0)
+    {
+        file << StringFormat(" parent=\"{0}{1}.item\"", prefix, (index - 1) / childCount);
+    }
+    file << ">\n";
+    file << StringFormat("    <RootObject type=\"item\" uuid=\"{0}\">\n", UUID::Generate().ToString());
+    file << StringFormat("        <Data name=\"name\" value=\"{0}\" />\n", name);
+    file << "    </RootObject>\n";
+    file << "</Datasheet>\n";
+}
+
+void WriteItemDatasheets(const std::string& directoryPath, const std::string& prefix, size_t count, size_t childCount)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        WriteItemDatasheet(directoryPath, prefix, i, childCount, StringFormat("Item{0}", i));
+    }
+}
+
+}   // namespace impl
+
 void RunUnitTests_Resources(UnitTestResults* results)
 {
     GUGU_UTEST_INIT("Resources", "UnitTests_Resources.log", results);
@@ -63,6 +125,52 @@ void RunUnitTests_Resources(UnitTestResults* results)
             GUGU_UTEST_CHECK_TRUE(GetResources()->IsResourceLoaded("TextureResource.png"));
         }
 
+        GUGU_UTEST_SUBSECTION("Async Resources");
+        {
+            Resource* loadedResource = nullptr;
+            size_t loadedCallbackCount = 0;
+            const auto onResourceLoaded = [&](Resource* resource)
+            {
+                loadedResource = resource;
+                ++loadedCallbackCount;
+            };
+
+            GUGU_UTEST_CHECK_TRUE(GetResources()->HasResource("ding.flac"));
+            GUGU_UTEST_CHECK_FALSE(GetResources()->IsResourceLoaded("ding.flac"));
+
+            Handle loadHandle = GetResources()->LoadResourceAsync("ding.flac", onResourceLoaded);
+            GUGU_UTEST_CHECK_TRUE(loadHandle.IsValid());
+            GUGU_UTEST_CHECK_TRUE(GetResources()->IsAsyncLoadPending(loadHandle));
+            GUGU_UTEST_CHECK_FALSE(GetResources()->IsResourceLoaded("ding.flac"));
+            GUGU_UTEST_CHECK_TRUE(GetResources()->LoadResourceAsync("ding.flac", onResourceLoaded) == loadHandle);
+
+            GetResources()->CompleteAsyncLoads();
+
+            GUGU_UTEST_CHECK_FALSE(GetResources()->IsAsyncLoadPending(loadHandle));
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->GetPendingAsyncLoadCount(), 0);
+            GUGU_UTEST_CHECK_TRUE(GetResources()->IsResourceLoaded("ding.flac"));
+            GUGU_UTEST_CHECK_EQUAL(loadedCallbackCount, 2);
+            GUGU_UTEST_CHECK_TRUE(loadedResource == GetResources()->GetAudioClip("ding.flac"));
+
+            // Short clips are decoded during the preparation, on a worker thread.
+            GUGU_UTEST_CHECK_TRUE(GetResources()->GetAudioClip("ding.flac")->GetMemorySize() > 0);
+
+            // Already loaded resources are notified immediately.
+            GUGU_UTEST_CHECK_FALSE(GetResources()->LoadResourceAsync("ding.flac", onResourceLoaded).IsValid());
+            GUGU_UTEST_CHECK_EQUAL(loadedCallbackCount, 3);
+
+            // Synchronous getters will complete a pending load.
+            loadHandle = GetResources()->LoadResourceAsync("Legulysse_Coldwave_Mood.ogg", onResourceLoaded);
+            GUGU_UTEST_CHECK_TRUE(GetResources()->IsAsyncLoadPending(loadHandle));
+            GUGU_UTEST_CHECK_NOT_NULL(GetResources()->GetAudioClip("Legulysse_Coldwave_Mood.ogg"));
+            GUGU_UTEST_CHECK_FALSE(GetResources()->IsAsyncLoadPending(loadHandle));
+            GUGU_UTEST_CHECK_EQUAL(loadedCallbackCount, 4);
+
+            // Longer clips are expected to be streamed, only their duration is read during the preparation.
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->GetAudioClip("Legulysse_Coldwave_Mood.ogg")->GetMemorySize(), 0);
+            GUGU_UTEST_CHECK_TRUE(GetResources()->GetAudioClip("Legulysse_Coldwave_Mood.ogg")->GetOrReadDuration() > sf::Time::Zero);
+        }
+
         GUGU_UTEST_SUBSECTION("New Resources");
         {
             std::string tempImageSetResourceId = "TempImageSetResource.imageset.xml";
@@ -109,6 +217,1102 @@ void RunUnitTests_Resources(UnitTestResults* results)
             GUGU_UTEST_CHECK_FALSE(GetResources()->HasResource(tempImageSetResourceId));
             GUGU_UTEST_CHECK_FALSE(GetResources()->IsResourceLoaded(tempImageSetResourceId));
         }
+
+        GUGU_UTEST_SUBSECTION("Resource Refs");
+        {
+            ResourceRef invalidRef;
+            GUGU_UTEST_CHECK_FALSE(invalidRef.IsRegistered());
+            GUGU_UTEST_CHECK_NULL(invalidRef.GetResource());
+
+            ResourceRef textureRef("TextureResource.png");
+            GUGU_UTEST_CHECK_TRUE(textureRef.IsRegistered());
+            GUGU_UTEST_CHECK_TRUE(textureRef.Get<Texture>() == GetResources()->GetTexture("TextureResource.png"));
+            GUGU_UTEST_CHECK_TRUE(textureRef.IsLoaded());
+
+            // Refs are invalidated when resources are removed.
+            std::string tempImageSetResourceId = "TempRefImageSetResource.imageset.xml";
+            FileInfo tempImageSetResourceFileInfo = FileInfo::FromString_utf8("Assets/TestResources/TempRefImageSetResource.imageset.xml");
+
+            ImageSet* tempImageSetResource = new ImageSet;
+            GUGU_UTEST_CHECK_TRUE(GetResources()->AddResource(tempImageSetResource, tempImageSetResourceFileInfo));
+
+            ResourceRef tempImageSetRef(tempImageSetResourceId);
+            GUGU_UTEST_CHECK_TRUE(tempImageSetRef.Get<ImageSet>() == tempImageSetResource);
+            GUGU_UTEST_CHECK_TRUE(GetResources()->RemoveResource(tempImageSetResourceId, true));
+            GUGU_UTEST_CHECK_FALSE(tempImageSetRef.IsRegistered());
+            GUGU_UTEST_CHECK_TRUE(textureRef.IsLoaded());
+        }
+
+        GUGU_UTEST_SUBSECTION("Eviction");
+        {
+            const std::string evictionTestsPath = "User/EvictionTests";
+            RemoveDirectoryTree(evictionTestsPath);
+            GUGU_UTEST_SILENT_CHECK(EnsureDirectoryExists(evictionTestsPath));
+
+            sf::Image image({ 64, 64 }, sf::Color::White);
+            GUGU_UTEST_SILENT_CHECK(image.saveToFile(evictionTestsPath + "/EvictedTexture.png"));
+            GUGU_UTEST_SILENT_CHECK(image.saveToFile(evictionTestsPath + "/SharedTexture.png"));
+            GetResources()->ParseDirectory(evictionTestsPath);
+
+            const std::string textureResourceId = "EvictedTexture.png";
+            const std::string sharedTextureResourceId = "SharedTexture.png";
+
+            // Refs are counted by resource ID.
+            {
+                ResourceRef textureRef(textureResourceId);
+                GUGU_UTEST_CHECK_EQUAL(GetResources()->GetResourceRefCount(textureResourceId), 1);
+
+                ResourceRef textureRefCopy(textureRef);
+                GUGU_UTEST_CHECK_EQUAL(GetResources()->GetResourceRefCount(textureResourceId), 2);
+
+                textureRefCopy.SetResourceID("");
+                GUGU_UTEST_CHECK_EQUAL(GetResources()->GetResourceRefCount(textureResourceId), 1);
+            }
+
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->GetResourceRefCount(textureResourceId), 0);
+
+            // Referenced resources are kept when the budget is exceeded.
+            ResourceRef textureRef(textureResourceId);
+            GUGU_UTEST_CHECK_NOT_NULL(textureRef.Get<Texture>());
+            GUGU_UTEST_CHECK_TRUE(textureRef.Get<Texture>()->GetMemorySize() > 0);
+
+            GUGU_UTEST_CHECK_NOT_NULL(GetResources()->GetTexture(sharedTextureResourceId));
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->GetResourcePinCount(sharedTextureResourceId), 1);
+
+            size_t evictedCount = GetResources()->GetResidencyStats().evictedResourceCount;
+            GetResources()->SetMemoryBudget(1);
+            GetResources()->ProcessEvictions();
+            GetResources()->ProcessEvictions();
+
+            GUGU_UTEST_CHECK_TRUE(GetResources()->IsResourceLoaded(textureResourceId));
+            GUGU_UTEST_CHECK_TRUE(GetResources()->GetResidencyStats().residentMemory > 1);
+
+            // Unreferenced resources are evicted, once they are not accessed during a whole loop.
+            GUGU_UTEST_CHECK_NOT_NULL(textureRef.Get<Texture>());
+            textureRef.SetResourceID("");
+            GetResources()->ProcessEvictions();
+            GUGU_UTEST_CHECK_TRUE(GetResources()->IsResourceLoaded(textureResourceId));
+
+            GetResources()->ProcessEvictions();
+            GUGU_UTEST_CHECK_FALSE(GetResources()->IsResourceLoaded(textureResourceId));
+            GUGU_UTEST_CHECK_TRUE(GetResources()->GetResidencyStats().evictedResourceCount > evictedCount);
+            GUGU_UTEST_CHECK_TRUE(GetResources()->IsResourceLoaded(sharedTextureResourceId));
+
+            // Evicted resources are reloaded on their next access.
+            GetResources()->SetMemoryBudget(0);
+            GUGU_UTEST_CHECK_NOT_NULL(GetResources()->GetTexture(textureResourceId));
+            GUGU_UTEST_CHECK_TRUE(GetResources()->IsResourceLoaded(textureResourceId));
+
+            // Pinned resources are kept until their pointer is released.
+            GetResources()->SetMemoryBudget(1);
+            GetResources()->ProcessEvictions();
+            GetResources()->ProcessEvictions();
+            GUGU_UTEST_CHECK_TRUE(GetResources()->IsResourceLoaded(textureResourceId));
+
+            GetResources()->ReleaseResource(textureResourceId);
+            GetResources()->ReleaseResource(sharedTextureResourceId);
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->GetResourcePinCount(sharedTextureResourceId), 0);
+
+            GetResources()->ProcessEvictions();
+            GUGU_UTEST_CHECK_FALSE(GetResources()->IsResourceLoaded(textureResourceId));
+            GUGU_UTEST_CHECK_FALSE(GetResources()->IsResourceLoaded(sharedTextureResourceId));
+
+            // Sprites release the pin of the textures they retrieved themselves.
+            {
+                ElementSprite sprite;
+                sprite.SetTexture(textureResourceId);
+                GUGU_UTEST_CHECK_EQUAL(GetResources()->GetResourcePinCount(textureResourceId), 1);
+
+                sprite.SetTexture(sharedTextureResourceId);
+                GUGU_UTEST_CHECK_EQUAL(GetResources()->GetResourcePinCount(textureResourceId), 0);
+                GUGU_UTEST_CHECK_EQUAL(GetResources()->GetResourcePinCount(sharedTextureResourceId), 1);
+            }
+
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->GetResourcePinCount(sharedTextureResourceId), 0);
+
+            GetResources()->ProcessEvictions();
+            GetResources()->ProcessEvictions();
+            GUGU_UTEST_CHECK_FALSE(GetResources()->IsResourceLoaded(sharedTextureResourceId));
+
+            GetResources()->SetMemoryBudget(0);
+            GetResources()->RemoveResourcesFromPath(evictionTestsPath, true);
+            RemoveDirectoryTree(evictionTestsPath);
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark GetResource By ID");
+        {
+            size_t loadedCount = 0;
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                loadedCount = 0;
+                for (size_t i = 0; i < 100000; ++i)
+                {
+                    loadedCount += GetResources()->GetTexture("TextureResource.png") ? 1 : 0;
+                }
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(loadedCount, 100000);
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark GetResource By Ref");
+        {
+            ResourceRef textureRef("TextureResource.png");
+
+            size_t loadedCount = 0;
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                loadedCount = 0;
+                for (size_t i = 0; i < 100000; ++i)
+                {
+                    loadedCount += textureRef.Get<Texture>() ? 1 : 0;
+                }
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(loadedCount, 100000);
+        }
+    }
+
+    //----------------------------------------------
+
+    GUGU_UTEST_SECTION("Dependencies");
+    {
+        // The dependency graph is only enabled for this section, the other tests run with the default engine config.
+        GetResources()->SetHandleResourceDependencies(true);
+
+        const std::string dependencyTestsPath = "User/DependencyTests";
+        RemoveDirectoryTree(dependencyTestsPath);
+        GUGU_UTEST_SILENT_CHECK(EnsureDirectoryExists(dependencyTestsPath));
+
+        // Datasheets are organized as a tree, each datasheet depending on all its ancestors.
+        const size_t benchmarkFileCount = impl::GetBenchmarkFileCount(10000);
+        const size_t benchmarkChildCount = 4;
+
+        impl::WriteItemDatasheets(dependencyTestsPath, "DependencySheet", benchmarkFileCount, benchmarkChildCount);
+
+        const auto loadDatasheets = [&]()
+        {
+            GetResources()->ParseDirectory(dependencyTestsPath);
+
+            size_t loadedCount = 0;
+            for (size_t i = 0; i < benchmarkFileCount; ++i)
+            {
+                loadedCount += GetResources()->GetDatasheet(StringFormat("DependencySheet{0}.item", i)) ? 1 : 0;
+            }
+
+            return loadedCount;
+        };
+
+        GUGU_UTEST_SUBSECTION("Graph");
+        {
+            GUGU_UTEST_CHECK_EQUAL(loadDatasheets(), benchmarkFileCount);
+
+            Datasheet* rootDatasheet = GetResources()->GetDatasheet("DependencySheet0.item");
+            Datasheet* leafDatasheet = GetResources()->GetDatasheet(StringFormat("DependencySheet{0}.item", benchmarkFileCount - 1));
+            GUGU_UTEST_CHECK_NULL(rootDatasheet->GetParentDatasheet());
+            GUGU_UTEST_CHECK_NOT_NULL(leafDatasheet->GetParentDatasheet());
+
+            const ManagerResources::ResourceDependencies* rootDependencies = GetResources()->FindResourceDependencies(rootDatasheet);
+            GUGU_UTEST_CHECK_NOT_NULL(rootDependencies);
+            GUGU_UTEST_CHECK_EQUAL(rootDependencies->dependencies.size(), 0);
+            GUGU_UTEST_CHECK_EQUAL(rootDependencies->referencers.size(), benchmarkFileCount - 1);
+
+            std::set<Resource*> leafAncestors;
+            leafDatasheet->GetDependencies(leafAncestors);
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->FindResourceDependencies(leafDatasheet)->dependencies.size(), leafAncestors.size());
+
+            // Removing a resource will unlink it from its referencers.
+            // - Its descendants lose their parent, they also stop depending on the ancestors inherited from it.
+            const size_t removedIndex = (benchmarkFileCount - 2) / benchmarkChildCount;
+            size_t removedSubtreeCount = 0;
+            for (size_t i = 1; i < benchmarkFileCount; ++i)
+            {
+                size_t ancestorIndex = i;
+                while (ancestorIndex > removedIndex)
+                {
+                    ancestorIndex = (ancestorIndex - 1) / benchmarkChildCount;
+                }
+
+                removedSubtreeCount += ancestorIndex == removedIndex ? 1 : 0;
+            }
+
+            GUGU_UTEST_CHECK_TRUE(GetResources()->RemoveResource(leafDatasheet->GetParentDatasheet()->GetID(), true));
+            GUGU_UTEST_CHECK_NULL(leafDatasheet->GetParentDatasheet());
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->FindResourceDependencies(leafDatasheet)->dependencies.size(), 0);
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->FindResourceDependencies(rootDatasheet)->referencers.size(), benchmarkFileCount - 1 - removedSubtreeCount);
+
+            GetResources()->RemoveResourcesFromPath(dependencyTestsPath, true);
+            GUGU_UTEST_CHECK_FALSE(GetResources()->HasResource("DependencySheet0.item"));
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Load Datasheets");
+        {
+            size_t loadedCount = 0;
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                loadedCount = loadDatasheets();
+                GetResources()->RemoveResourcesFromPath(dependencyTestsPath, true);
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(loadedCount, benchmarkFileCount);
+        }
+
+        RemoveDirectoryTree(dependencyTestsPath);
+
+        GetResources()->SetHandleResourceDependencies(false);
+        GUGU_UTEST_CHECK_TRUE(GetResources()->GetResourceDependencies().empty());
+    }
+
+    GUGU_UTEST_SECTION("Archive");
+    {
+        const std::string archiveTestsPath = "User/ArchiveTests";
+        RemoveDirectoryTree(archiveTestsPath);
+        GUGU_UTEST_SILENT_CHECK(EnsureDirectoryExists(archiveTestsPath));
+
+        const auto readFile = [](const std::string& path, std::vector<uint8>& content)
+        {
+            std::ifstream file(path, std::ios::in | std::ios::binary);
+            content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            return file.eof();
+        };
+
+        GUGU_UTEST_SUBSECTION("Pack and Read");
+        {
+            const std::string archivePath = archiveTestsPath + "/TestResources.pak";
+            GUGU_UTEST_CHECK_TRUE(ResourceArchive::PackDirectory("Assets/TestResources", archivePath, true));
+
+            ResourceArchive archive;
+            GUGU_UTEST_CHECK_TRUE(archive.Open(archivePath));
+            GUGU_UTEST_CHECK_NULL(archive.FindEntry("UnknownResource.png"));
+
+            const ResourceArchiveEntry* entry = archive.FindEntry("TextureResource.png");
+            GUGU_UTEST_CHECK_NOT_NULL(entry);
+
+            std::vector<uint8> fileContent;
+            GUGU_UTEST_CHECK_TRUE(readFile("Assets/TestResources/TextureResource.png", fileContent));
+
+            const uint8* data = nullptr;
+            size_t size = 0;
+            std::vector<uint8> buffer;
+            GUGU_UTEST_CHECK_TRUE(archive.GetEntryContent(entry, data, size, buffer));
+            GUGU_UTEST_CHECK_EQUAL(size, fileContent.size());
+            GUGU_UTEST_CHECK_TRUE(std::equal(fileContent.begin(), fileContent.end(), data));
+
+            GUGU_UTEST_ADD_EXPECTED_ERROR_COUNT(2);
+            GUGU_UTEST_CHECK_FALSE(archive.Open(archiveTestsPath + "/UnknownArchive.pak"));
+            GUGU_UTEST_CHECK_FALSE(archive.Open("Assets/TestResources/TextureResource.png"));
+        }
+
+        GUGU_UTEST_SUBSECTION("Mount");
+        {
+            // Use a dedicated manager, to avoid conflicts with the resources already registered in the engine.
+            EngineConfig config;
+            config.pathAssets = "Assets/TestResources";
+            config.pathAssetsArchive = archiveTestsPath + "/TestResources.pak";
+
+            ManagerResources* archiveResources = new ManagerResources;
+            GUGU_UTEST_CHECK_TRUE(archiveResources->Init(config));
+            GUGU_UTEST_CHECK_TRUE(archiveResources->HasResource("TextureResource.png"));
+
+            Texture* texture = archiveResources->GetTexture("TextureResource.png");
+            GUGU_UTEST_CHECK_NOT_NULL(texture);
+            GUGU_UTEST_CHECK_TRUE(texture && texture->IsArchived());
+            GUGU_UTEST_CHECK_TRUE(texture && texture->GetSFTexture() != nullptr);
+
+            archiveResources->Release();
+            SafeDelete(archiveResources);
+        }
+
+        // Benchmark a large set of small files, as loose files and as archives.
+        const size_t benchmarkFileCount = impl::GetBenchmarkFileCount(10000);
+        const std::string benchmarkFilesPath = archiveTestsPath + "/Files";
+
+        for (size_t i = 0; i < benchmarkFileCount; ++i)
+        {
+            std::string directoryPath = StringFormat("{0}/Directory{1}", benchmarkFilesPath, i % 100);
+            if (i < 100)
+            {
+                EnsureDirectoryExists(directoryPath);
+            }
+
+            std::ofstream file(StringFormat("{0}/File{1}.xml", directoryPath, i), std::ios::out | std::ios::binary | std::ios::trunc);
+            file << "<Datasheet>\n";
+            for (size_t line = 0; line < 8; ++line)
+            {
+                file << StringFormat("    <Data name=\"member{0}\" value=\"{1}\"/>\n", line, (i + line) % 37);
+            }
+            file << "</Datasheet>\n";
+        }
+
+        const std::string benchmarkArchivePath = archiveTestsPath + "/Files.pak";
+        const std::string benchmarkCompressedArchivePath = archiveTestsPath + "/FilesCompressed.pak";
+
+        GUGU_UTEST_CHECK_TRUE(ResourceArchive::PackDirectory(benchmarkFilesPath, benchmarkArchivePath, false));
+        GUGU_UTEST_CHECK_TRUE(ResourceArchive::PackDirectory(benchmarkFilesPath, benchmarkCompressedArchivePath, true));
+
+        EngineConfig benchmarkConfig;
+        benchmarkConfig.pathAssets = benchmarkFilesPath;
+
+        const auto initResources = [&benchmarkConfig]()
+        {
+            ManagerResources resources;
+            resources.Init(benchmarkConfig);
+
+            std::vector<const ResourceInfo*> resourceInfos;
+            resources.GetAllResourceInfos(resourceInfos);
+            resources.Release();
+
+            return resourceInfos.size();
+        };
+
+        GUGU_UTEST_SUBSECTION("Benchmark Parse Loose Files");
+        {
+            size_t resourceCount = 0;
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                resourceCount = initResources();
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(resourceCount, benchmarkFileCount);
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Mount Archive");
+        {
+            benchmarkConfig.pathAssetsArchive = benchmarkArchivePath;
+
+            size_t resourceCount = 0;
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                resourceCount = initResources();
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(resourceCount, benchmarkFileCount);
+        }
+
+        size_t looseTotalSize = 0;
+        size_t archiveTotalSize = 0;
+        size_t compressedArchiveTotalSize = 0;
+
+        GUGU_UTEST_SUBSECTION("Benchmark Read Loose Files");
+        {
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                looseTotalSize = 0;
+
+                std::vector<FileInfo> files;
+                GetFiles(benchmarkFilesPath, files, true);
+
+                std::vector<uint8> content;
+                for (const FileInfo& fileInfo : files)
+                {
+                    readFile(fileInfo.GetFileSystemPath(), content);
+                    looseTotalSize += content.size();
+                }
+            });
+
+            GUGU_UTEST_CHECK_NOT_EQUAL(looseTotalSize, 0);
+        }
+
+        const auto readArchive = [](const std::string& archivePath, size_t& totalSize)
+        {
+            totalSize = 0;
+
+            ResourceArchive archive;
+            archive.Open(archivePath);
+
+            const uint8* data = nullptr;
+            size_t size = 0;
+            std::vector<uint8> buffer;
+            for (size_t i = 0; i < archive.GetEntryCount(); ++i)
+            {
+                archive.GetEntryContent(archive.GetEntry(i), data, size, buffer);
+                totalSize += size;
+            }
+        };
+
+        GUGU_UTEST_SUBSECTION("Benchmark Read Archive");
+        {
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                readArchive(benchmarkArchivePath, archiveTotalSize);
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(archiveTotalSize, looseTotalSize);
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Read Compressed Archive");
+        {
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                readArchive(benchmarkCompressedArchivePath, compressedArchiveTotalSize);
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(compressedArchiveTotalSize, looseTotalSize);
+        }
+
+        RemoveDirectoryTree(archiveTestsPath);
+    }
+
+    //----------------------------------------------
+
+    GUGU_UTEST_SECTION("Cooked Resources");
+    {
+        const std::string cookTestsPath = "User/CookTests";
+        RemoveDirectoryTree(cookTestsPath);
+        GUGU_UTEST_SILENT_CHECK(EnsureDirectoryExists(cookTestsPath));
+
+        const size_t benchmarkFileCount = impl::GetBenchmarkFileCount(2000);
+        const size_t benchmarkSubImageCount = 32;
+
+        for (size_t i = 0; i < benchmarkFileCount; ++i)
+        {
+            std::ofstream file(StringFormat("{0}/ImageSet{1}.imageset.xml", cookTestsPath, i), std::ios::out | std::ios::binary | std::ios::trunc);
+            file << "<ImageSet serializationVersion=\"1\">\n";
+            for (size_t subImage = 0; subImage < benchmarkSubImageCount; ++subImage)
+            {
+                file << StringFormat("    <SubImage name=\"SubImage{0}\" x=\"{1}\" y=\"{2}\" w=\"32\" h=\"32\"/>\n", subImage, (subImage % 8) * 32, (subImage / 8) * 32);
+            }
+            file << "</ImageSet>\n";
+        }
+
+        EngineConfig config;
+        config.pathAssets = cookTestsPath;
+
+        const auto loadResources = [&config](size_t& cookedCount)
+        {
+            ManagerResources resources;
+            resources.Init(config);
+            resources.PreloadAll();
+
+            size_t subImageCount = 0;
+            cookedCount = 0;
+
+            std::vector<const ResourceInfo*> resourceInfos;
+            resources.GetAllResourceInfos(resourceInfos);
+            for (const ResourceInfo* resourceInfo : resourceInfos)
+            {
+                const ImageSet* imageSet = dynamic_cast<const ImageSet*>(resourceInfo->resource);
+                subImageCount += imageSet ? imageSet->GetSubImageCount() : 0;
+                cookedCount += resourceInfo->hasCookedFile ? 1 : 0;
+            }
+
+            resources.Release();
+            return subImageCount;
+        };
+
+        GUGU_UTEST_SUBSECTION("Benchmark Load Xml Files");
+        {
+            size_t subImageCount = 0;
+            size_t cookedCount = 0;
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                subImageCount = loadResources(cookedCount);
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(subImageCount, benchmarkFileCount * benchmarkSubImageCount);
+            GUGU_UTEST_CHECK_EQUAL(cookedCount, 0);
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Load Xml Files Without Workers");
+        {
+            ThreadPool* threadPool = GetEngine()->GetThreadPool();
+            size_t threadCount = threadPool->GetThreadCount();
+            threadPool->Stop();
+
+            size_t subImageCount = 0;
+            size_t cookedCount = 0;
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                subImageCount = loadResources(cookedCount);
+            });
+
+            threadPool->Start(threadCount);
+
+            GUGU_UTEST_CHECK_EQUAL(subImageCount, benchmarkFileCount * benchmarkSubImageCount);
+            GUGU_UTEST_CHECK_EQUAL(cookedCount, 0);
+        }
+
+        GUGU_UTEST_SUBSECTION("Cook");
+        {
+            ManagerResources resources;
+            resources.Init(config);
+            GUGU_UTEST_CHECK_TRUE(resources.CookResources(cookTestsPath));
+            resources.Release();
+
+            GUGU_UTEST_CHECK_TRUE(FileExists(cookTestsPath + "/ImageSet0.imageset.xml.cooked"));
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Load Cooked Files");
+        {
+            size_t subImageCount = 0;
+            size_t cookedCount = 0;
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                subImageCount = loadResources(cookedCount);
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(subImageCount, benchmarkFileCount * benchmarkSubImageCount);
+            GUGU_UTEST_CHECK_EQUAL(cookedCount, benchmarkFileCount);
+        }
+
+        GUGU_UTEST_SUBSECTION("Remove Cooked Files");
+        {
+            ManagerResources resources;
+            resources.Init(config);
+            resources.RemoveCookedResources(cookTestsPath);
+            resources.Release();
+
+            GUGU_UTEST_CHECK_FALSE(FileExists(cookTestsPath + "/ImageSet0.imageset.xml.cooked"));
+
+            size_t cookedCount = 0;
+            GUGU_UTEST_CHECK_EQUAL(loadResources(cookedCount), benchmarkFileCount * benchmarkSubImageCount);
+            GUGU_UTEST_CHECK_EQUAL(cookedCount, 0);
+        }
+
+        RemoveDirectoryTree(cookTestsPath);
+
+        // Datasheets are not read in place, their cooked files are converted back to an xml document on the worker threads.
+        // - The conversion is also measured alone, it is part of the cooked datasheets loading time.
+        const std::string cookDatasheetTestsPath = "User/CookDatasheetTests";
+        RemoveDirectoryTree(cookDatasheetTestsPath);
+        GUGU_UTEST_SILENT_CHECK(EnsureDirectoryExists(cookDatasheetTestsPath));
+
+        const size_t benchmarkDatasheetCount = impl::GetBenchmarkFileCount(2000);
+        impl::WriteItemDatasheets(cookDatasheetTestsPath, "CookSheet", benchmarkDatasheetCount, 0);
+
+        const auto loadDatasheets = [&]()
+        {
+            GetResources()->ParseDirectory(cookDatasheetTestsPath);
+
+            std::vector<Datasheet*> datasheets;
+            GetResources()->GetAllDatasheetsByType("item", datasheets);
+
+            size_t loadedCount = 0;
+            for (const Datasheet* datasheet : datasheets)
+            {
+                loadedCount += (StdStringStartsWith(datasheet->GetID(), "CookSheet") && datasheet->GetRootObject()) ? 1 : 0;
+            }
+
+            GetResources()->RemoveResourcesFromPath(cookDatasheetTestsPath, true);
+            return loadedCount;
+        };
+
+        GUGU_UTEST_SUBSECTION("Benchmark Load Xml Datasheets");
+        {
+            size_t loadedCount = 0;
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                loadedCount = loadDatasheets();
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(loadedCount, benchmarkDatasheetCount);
+        }
+
+        GUGU_UTEST_SUBSECTION("Cook Datasheets");
+        {
+            GetResources()->ParseDirectory(cookDatasheetTestsPath);
+            GUGU_UTEST_CHECK_TRUE(GetResources()->CookResources(cookDatasheetTestsPath));
+            GetResources()->RemoveResourcesFromPath(cookDatasheetTestsPath, true);
+
+            GUGU_UTEST_CHECK_TRUE(FileExists(cookDatasheetTestsPath + "/CookSheet0.item.cooked"));
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Load Cooked Datasheets");
+        {
+            size_t loadedCount = 0;
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                loadedCount = loadDatasheets();
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(loadedCount, benchmarkDatasheetCount);
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Convert Cooked Datasheets");
+        {
+            std::vector<std::vector<uint8>> cookedFiles(benchmarkDatasheetCount);
+            for (size_t i = 0; i < benchmarkDatasheetCount; ++i)
+            {
+                GUGU_UTEST_SILENT_CHECK(ReadFileContent(StringFormat("{0}/CookSheet{1}.item.cooked", cookDatasheetTestsPath, i), cookedFiles[i]));
+            }
+
+            size_t convertedCount = 0;
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                convertedCount = 0;
+                for (const std::vector<uint8>& cookedData : cookedFiles)
+                {
+                    xml::BinaryDocument binaryDocument;
+                    pugi::xml_document document;
+                    convertedCount += (binaryDocument.Parse(cookedData.data(), cookedData.size()) && binaryDocument.ConvertToXml(document)) ? 1 : 0;
+                }
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(convertedCount, benchmarkDatasheetCount);
+        }
+
+        RemoveDirectoryTree(cookDatasheetTestsPath);
+    }
+
+    //----------------------------------------------
+
+    GUGU_UTEST_SECTION("Texture Streaming");
+    {
+        const std::string streamingTestsPath = "User/StreamingTests";
+        RemoveDirectoryTree(streamingTestsPath);
+        GUGU_UTEST_SILENT_CHECK(EnsureDirectoryExists(streamingTestsPath));
+
+        const Vector2u textureSize(2048, 1024);
+        const size_t textureMemorySize = static_cast<size_t>(textureSize.x) * textureSize.y * 4;
+
+        sf::Image image(textureSize, sf::Color(200, 100, 50));
+        GUGU_UTEST_SILENT_CHECK(image.saveToFile(streamingTestsPath + "/StreamedTexture0.png"));
+        GUGU_UTEST_SILENT_CHECK(image.saveToFile(streamingTestsPath + "/StreamedTexture1.png"));
+
+        GetResources()->ParseDirectory(streamingTestsPath);
+        GetResources()->SetTextureStreamingMinSize(1024);
+        GetResources()->SetTextureStreamingBudget(textureMemorySize);
+
+        // Render the texture and process the streaming until the full resolution is resident.
+        const auto streamTexture = [](Texture* texture, float renderScale)
+        {
+            for (size_t i = 0; i < 1000 && !texture->IsFullResolutionResident(); ++i)
+            {
+                texture->GetRenderSFTexture(renderScale);
+                GetResources()->ProcessTextureStreaming();
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+
+            return texture->IsFullResolutionResident();
+        };
+
+        GUGU_UTEST_SUBSECTION("Fallback");
+        {
+            Texture* texture = GetResources()->GetTexture("StreamedTexture0.png");
+            GUGU_UTEST_CHECK_NOT_NULL(texture);
+            GUGU_UTEST_CHECK_TRUE(texture->IsStreamed());
+            GUGU_UTEST_CHECK_FALSE(texture->IsFullResolutionResident());
+            GUGU_UTEST_CHECK_EQUAL(texture->GetSize(), textureSize);
+            GUGU_UTEST_CHECK_EQUAL(texture->GetMemorySize(), textureMemorySize / 16);
+            GUGU_UTEST_CHECK_APPROX_EQUAL(texture->GetResidentScale().x, 0.25f, math::Epsilon6);
+            GUGU_UTEST_CHECK_APPROX_EQUAL(texture->GetResidentScale().y, 0.25f, math::Epsilon6);
+
+            // Vertices drawn by sprite groups, tilemaps and particles are scaled to the fallback.
+            sf::Vertex vertex;
+            vertex.texCoords = Vector2f(textureSize);
+            std::vector<sf::Vertex> residentVertices;
+            texture->ComputeResidentVertices(&vertex, 1, residentVertices);
+            GUGU_UTEST_CHECK_EQUAL(residentVertices.size(), 1);
+            GUGU_UTEST_CHECK_EQUAL(residentVertices[0].texCoords, Vector2f(512.f, 256.f));
+
+            // The fallback is enough when the texture is rendered small enough.
+            GUGU_UTEST_CHECK_NOT_NULL(texture->GetRenderSFTexture(0.2f));
+            GetResources()->ProcessTextureStreaming();
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->GetTextureStreamingStats().pendingLoadCount, 0);
+            GUGU_UTEST_CHECK_FALSE(texture->IsFullResolutionResident());
+        }
+
+        GUGU_UTEST_SUBSECTION("Full Resolution");
+        {
+            Texture* texture = GetResources()->GetTexture("StreamedTexture0.png");
+            uint32 residencyVersion = texture->GetResidencyVersion();
+
+            GUGU_UTEST_CHECK_TRUE(streamTexture(texture, 1.f));
+            GUGU_UTEST_CHECK_NOT_EQUAL(texture->GetResidencyVersion(), residencyVersion);
+            GUGU_UTEST_CHECK_EQUAL(texture->GetResidentScale(), Vector2f(1.f, 1.f));
+            GUGU_UTEST_CHECK_EQUAL(texture->GetRenderSFTexture(1.f)->getSize(), textureSize);
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->GetTextureStreamingStats().fullResolutionMemory, textureMemorySize);
+
+            // The budget only allows one full resolution, the least recently rendered texture is dropped.
+            Texture* otherTexture = GetResources()->GetTexture("StreamedTexture1.png");
+            GUGU_UTEST_CHECK_TRUE(streamTexture(otherTexture, 1.f));
+            GUGU_UTEST_CHECK_FALSE(texture->IsFullResolutionResident());
+
+            // The full resolution is dropped once the texture is not rendered anymore.
+            GetResources()->SetTextureStreamingDropDelay(0);
+            GetResources()->ProcessTextureStreaming();
+            GUGU_UTEST_CHECK_FALSE(otherTexture->IsFullResolutionResident());
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->GetTextureStreamingStats().fullResolutionMemory, 0);
+
+            // Accessing the sfml texture stops the streaming.
+            GUGU_UTEST_CHECK_NOT_NULL(otherTexture->GetSFTexture());
+            GUGU_UTEST_CHECK_FALSE(otherTexture->IsStreamed());
+            GUGU_UTEST_CHECK_EQUAL(otherTexture->GetSize(), textureSize);
+            GUGU_UTEST_CHECK_EQUAL(otherTexture->GetMemorySize(), textureMemorySize);
+
+            GetResources()->SetTextureStreamingDropDelay(EngineConfig().textureStreamingDropDelayMs);
+        }
+
+        GUGU_UTEST_SUBSECTION("Cooked Fallback");
+        {
+            GUGU_UTEST_CHECK_TRUE(GetResources()->CookResources(streamingTestsPath));
+            GUGU_UTEST_CHECK_TRUE(FileExists(streamingTestsPath + "/StreamedTexture0.png.cooked"));
+
+            GetResources()->RemoveResourcesFromPath(streamingTestsPath, true);
+            GetResources()->ParseDirectory(streamingTestsPath);
+
+            Texture* texture = GetResources()->GetTexture("StreamedTexture0.png");
+            GUGU_UTEST_CHECK_NOT_NULL(texture);
+            GUGU_UTEST_CHECK_TRUE(texture->IsStreamed());
+            GUGU_UTEST_CHECK_EQUAL(texture->GetSize(), textureSize);
+            GUGU_UTEST_CHECK_EQUAL(texture->GetMemorySize(), textureMemorySize / 16);
+            GUGU_UTEST_CHECK_TRUE(streamTexture(texture, 1.f));
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Load Streamed Textures");
+        {
+            size_t streamedCount = 0;
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                GetResources()->RemoveCookedResources(streamingTestsPath);
+                GetResources()->RemoveResourcesFromPath(streamingTestsPath, true);
+                GetResources()->ParseDirectory(streamingTestsPath);
+
+                streamedCount = 0;
+                streamedCount += GetResources()->GetTexture("StreamedTexture0.png")->IsStreamed() ? 1 : 0;
+                streamedCount += GetResources()->GetTexture("StreamedTexture1.png")->IsStreamed() ? 1 : 0;
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(streamedCount, 2);
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Load Streamed Textures From Cooked Files");
+        {
+            GUGU_UTEST_CHECK_TRUE(GetResources()->CookResources(streamingTestsPath));
+
+            size_t streamedCount = 0;
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                GetResources()->RemoveResourcesFromPath(streamingTestsPath, true);
+                GetResources()->ParseDirectory(streamingTestsPath);
+
+                streamedCount = 0;
+                streamedCount += GetResources()->GetTexture("StreamedTexture0.png")->IsStreamed() ? 1 : 0;
+                streamedCount += GetResources()->GetTexture("StreamedTexture1.png")->IsStreamed() ? 1 : 0;
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(streamedCount, 2);
+        }
+
+        GetResources()->RemoveResourcesFromPath(streamingTestsPath, true);
+        GetResources()->SetTextureStreamingMinSize(0);
+        GetResources()->SetTextureStreamingBudget(0);
+        RemoveDirectoryTree(streamingTestsPath);
+    }
+
+    //----------------------------------------------
+
+    GUGU_UTEST_SECTION("Resource Cache");
+    {
+        const std::string cacheTestsPath = "User/CacheTests";
+        const std::string cachePath = "User/CacheTests.cache";
+        RemoveDirectoryTree(cacheTestsPath);
+        RemoveFile(cachePath);
+        GUGU_UTEST_SILENT_CHECK(EnsureDirectoryExists(cacheTestsPath));
+
+        // Datasheets are organized as a tree, each datasheet depending on all its ancestors.
+        const size_t benchmarkFileCount = 2000;
+        const size_t benchmarkChildCount = 4;
+
+        impl::WriteItemDatasheets(cacheTestsPath, "CacheSheet", benchmarkFileCount, benchmarkChildCount);
+
+        const auto findResourceInfo = [](const std::string& resourceId) -> const ResourceInfo*
+        {
+            std::vector<const ResourceInfo*> resourceInfos;
+            GetResources()->GetAllResourceInfos(resourceInfos);
+
+            for (const ResourceInfo* resourceInfo : resourceInfos)
+            {
+                if (resourceInfo->resourceID == resourceId)
+                    return resourceInfo;
+            }
+
+            return nullptr;
+        };
+
+        const auto reparseDirectory = [&]()
+        {
+            GetResources()->RemoveResourcesFromPath(cacheTestsPath, true);
+            GetResources()->ParseDirectory(cacheTestsPath);
+        };
+
+        const std::string leafId = StringFormat("CacheSheet{0}.item", benchmarkFileCount - 1);
+
+        size_t leafDepth = 0;
+        for (size_t i = benchmarkFileCount - 1; i > 0; i = (i - 1) / benchmarkChildCount)
+        {
+            ++leafDepth;
+        }
+
+        GUGU_UTEST_SUBSECTION("Record");
+        {
+            GUGU_UTEST_CHECK_FALSE(GetResources()->LoadResourceCache(cachePath));
+            GetResources()->ParseDirectory(cacheTestsPath);
+
+            // Datasheets can't be identified from their extension.
+            GUGU_UTEST_CHECK_EQUAL(findResourceInfo(leafId)->resourceType, EResourceType::Unknown);
+
+            size_t loadedCount = 0;
+            for (size_t i = 0; i < benchmarkFileCount; ++i)
+            {
+                loadedCount += GetResources()->GetDatasheet(StringFormat("CacheSheet{0}.item", i)) ? 1 : 0;
+            }
+
+            GUGU_UTEST_CHECK_EQUAL(loadedCount, benchmarkFileCount);
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->GetResourceCacheStats().recordedEntryCount, benchmarkFileCount);
+            GUGU_UTEST_CHECK_EQUAL(findResourceInfo(leafId)->cachedDependencies.size(), leafDepth);
+
+            GUGU_UTEST_CHECK_TRUE(GetResources()->SaveResourceCache());
+            GUGU_UTEST_CHECK_TRUE(FileExists(cachePath));
+        }
+
+        GUGU_UTEST_SUBSECTION("Restore");
+        {
+            GetResources()->RemoveResourcesFromPath(cacheTestsPath, true);
+            GUGU_UTEST_CHECK_TRUE(GetResources()->LoadResourceCache(cachePath));
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->GetResourceCacheStats().loadedEntryCount, benchmarkFileCount);
+
+            GetResources()->ParseDirectory(cacheTestsPath);
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->GetResourceCacheStats().restoredEntryCount, benchmarkFileCount);
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->GetResourceCacheStats().invalidatedEntryCount, 0);
+
+            const ResourceInfo* leafInfo = findResourceInfo(leafId);
+            GUGU_UTEST_CHECK_NULL(leafInfo->resource);
+            GUGU_UTEST_CHECK_EQUAL(leafInfo->resourceType, EResourceType::Datasheet);
+            GUGU_UTEST_CHECK_EQUAL(leafInfo->cachedDependencies.size(), leafDepth);
+            GUGU_UTEST_CHECK_TRUE(StdVectorContains(leafInfo->cachedDependencies, std::string("CacheSheet0.item")));
+
+            // Restored types allow datasheets to be loaded without an explicit type, unchanged entries are not recorded again.
+            GUGU_UTEST_CHECK_NOT_NULL(GetResources()->GetResource(leafId));
+            GUGU_UTEST_CHECK_NOT_NULL(leafInfo->resource);
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->GetResourceCacheStats().recordedEntryCount, 0);
+        }
+
+        GUGU_UTEST_SUBSECTION("Restore Dependency Graph");
+        {
+            // A batch loaded with the restored entries links the same dependency graph as a load without the cache.
+            GetResources()->SetHandleResourceDependencies(true);
+            reparseDirectory();
+
+            std::vector<Datasheet*> datasheets;
+            GetResources()->GetAllDatasheetsByType("item", datasheets);
+
+            const Datasheet* rootDatasheet = GetResources()->GetDatasheet("CacheSheet0.item");
+            const Datasheet* leafDatasheet = GetResources()->GetDatasheet(leafId);
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->FindResourceDependencies(leafDatasheet)->dependencies.size(), leafDepth);
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->FindResourceDependencies(rootDatasheet)->referencers.size(), benchmarkFileCount - 1);
+
+            GetResources()->SetHandleResourceDependencies(false);
+        }
+
+        GUGU_UTEST_SUBSECTION("Invalidate");
+        {
+            impl::WriteItemDatasheet(cacheTestsPath, "CacheSheet", 1, benchmarkChildCount, "ModifiedItem1");
+
+            GetResources()->RemoveResourcesFromPath(cacheTestsPath, true);
+            GUGU_UTEST_CHECK_TRUE(GetResources()->LoadResourceCache(cachePath));
+            GetResources()->ParseDirectory(cacheTestsPath);
+
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->GetResourceCacheStats().restoredEntryCount, benchmarkFileCount - 1);
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->GetResourceCacheStats().invalidatedEntryCount, 1);
+            GUGU_UTEST_CHECK_EQUAL(findResourceInfo("CacheSheet1.item")->resourceType, EResourceType::Unknown);
+            GUGU_UTEST_CHECK_TRUE(findResourceInfo("CacheSheet1.item")->cachedDependencies.empty());
+
+            // Loading the modified file records its entry again.
+            GUGU_UTEST_CHECK_NOT_NULL(GetResources()->GetDatasheet("CacheSheet1.item"));
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->GetResourceCacheStats().recordedEntryCount, 1);
+            GUGU_UTEST_CHECK_TRUE(GetResources()->SaveResourceCache());
+        }
+
+        // Load the leaves asynchronously, their ancestors are either loaded during their finalization, or prefetched from the cache.
+        const auto loadLeavesAsync = [&]()
+        {
+            size_t loadedCount = 0;
+            for (size_t i = (benchmarkFileCount - 1) / benchmarkChildCount + 1; i < benchmarkFileCount; ++i)
+            {
+                GetResources()->LoadResourceAsync(StringFormat("CacheSheet{0}.item", i), [&loadedCount](Resource* resource)
+                {
+                    loadedCount += resource ? 1 : 0;
+                }, EResourceType::Datasheet);
+            }
+
+            GetResources()->CompleteAsyncLoads();
+            return loadedCount;
+        };
+
+        const size_t leafCount = benchmarkFileCount - ((benchmarkFileCount - 1) / benchmarkChildCount + 1);
+
+        GUGU_UTEST_SUBSECTION("Benchmark Async Load Without Cache");
+        {
+            GetResources()->LoadResourceCache("");
+
+            size_t loadedCount = 0;
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                reparseDirectory();
+                loadedCount = loadLeavesAsync();
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(loadedCount, leafCount);
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Async Load With Cache");
+        {
+            GUGU_UTEST_CHECK_TRUE(GetResources()->LoadResourceCache(cachePath));
+
+            size_t loadedCount = 0;
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                reparseDirectory();
+                loadedCount = loadLeavesAsync();
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(loadedCount, leafCount);
+        }
+
+        GetResources()->RemoveResourcesFromPath(cacheTestsPath, true);
+        GetResources()->LoadResourceCache("");
+        RemoveFile(cachePath);
+        RemoveDirectoryTree(cacheTestsPath);
+    }
+
+    //----------------------------------------------
+
+    GUGU_UTEST_SECTION("Preload Manifest");
+    {
+        const std::string manifestTestsPath = "User/ManifestTests";
+        const std::string manifestId = "Scene.manifest.xml";
+        RemoveDirectoryTree(manifestTestsPath);
+        GUGU_UTEST_SILENT_CHECK(EnsureDirectoryExists(manifestTestsPath));
+
+        const size_t benchmarkFileCount = 2000;
+
+        impl::WriteItemDatasheets(manifestTestsPath, "ManifestSheet", benchmarkFileCount, 0);
+
+        const auto reparseDirectory = [&]()
+        {
+            GetResources()->RemoveResourcesFromPath(manifestTestsPath, true);
+            GetResources()->ParseDirectory(manifestTestsPath);
+        };
+
+        const auto accessDatasheets = [&]()
+        {
+            size_t loadedCount = 0;
+            for (size_t i = 0; i < benchmarkFileCount; ++i)
+            {
+                loadedCount += GetResources()->GetDatasheet(StringFormat("ManifestSheet{0}.item", i)) ? 1 : 0;
+            }
+
+            return loadedCount;
+        };
+
+        GUGU_UTEST_SUBSECTION("Record");
+        {
+            GetResources()->ParseDirectory(manifestTestsPath);
+
+            GetResources()->StartLoadsRecording();
+            GUGU_UTEST_CHECK_TRUE(GetResources()->IsRecordingLoads());
+
+            // Resources accessed multiple times are only recorded once.
+            GUGU_UTEST_CHECK_EQUAL(accessDatasheets(), benchmarkFileCount);
+            GUGU_UTEST_CHECK_EQUAL(accessDatasheets(), benchmarkFileCount);
+
+            std::vector<PreloadManifestEntry> entries;
+            GetResources()->StopLoadsRecording(entries);
+            GUGU_UTEST_CHECK_FALSE(GetResources()->IsRecordingLoads());
+            GUGU_UTEST_CHECK_EQUAL(entries.size(), benchmarkFileCount);
+            GUGU_UTEST_CHECK_EQUAL(entries[0].resourceId, "ManifestSheet0.item");
+            GUGU_UTEST_CHECK_EQUAL(entries[0].resourceType, EResourceType::Datasheet);
+
+            PreloadManifest* manifest = new PreloadManifest;
+            manifest->SetEntries(entries);
+            GUGU_UTEST_CHECK_TRUE(GetResources()->AddResource(manifest, FileInfo::FromString_utf8(manifestTestsPath + "/" + manifestId)));
+            GUGU_UTEST_CHECK_TRUE(manifest->SaveToFile());
+        }
+
+        GUGU_UTEST_SUBSECTION("Prefetch");
+        {
+            reparseDirectory();
+
+            PreloadManifest* manifest = GetResources()->GetPreloadManifest(manifestId);
+            GUGU_UTEST_CHECK_NOT_NULL(manifest);
+            GUGU_UTEST_CHECK_EQUAL(manifest->GetEntries().size(), benchmarkFileCount);
+            GUGU_UTEST_CHECK_EQUAL(manifest->GetEntries()[0].resourceType, EResourceType::Datasheet);
+
+            GetResources()->ResetPrefetchStats();
+
+            size_t progressCount = 0;
+            size_t lastLoadedCount = 0;
+            Handle prefetchHandle = GetResources()->PrefetchManifest(manifestId, [&](size_t loadedCount, size_t resourceCount)
+            {
+                progressCount += (loadedCount == lastLoadedCount + 1 && resourceCount == benchmarkFileCount) ? 1 : 0;
+                lastLoadedCount = loadedCount;
+            });
+
+            GUGU_UTEST_CHECK_TRUE(GetResources()->IsPrefetchPending(prefetchHandle));
+            GUGU_UTEST_CHECK_TRUE(GetResources()->GetPrefetchProgress(prefetchHandle) < 1.f);
+
+            GetResources()->CompleteAsyncLoads();
+            GUGU_UTEST_CHECK_FALSE(GetResources()->IsPrefetchPending(prefetchHandle));
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->GetPrefetchProgress(prefetchHandle), 1.f);
+            GUGU_UTEST_CHECK_EQUAL(progressCount, benchmarkFileCount);
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->GetPrefetchStats().prefetchedResourceCount, benchmarkFileCount);
+
+            // Prefetched resources are accessed without any load on demand.
+            GUGU_UTEST_CHECK_EQUAL(accessDatasheets(), benchmarkFileCount);
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->GetPrefetchStats().avoidedHitchCount, benchmarkFileCount);
+            GUGU_UTEST_CHECK_EQUAL(GetResources()->GetPrefetchStats().onDemandLoadCount, 0);
+
+            // Prefetching loaded resources completes immediately.
+            GUGU_UTEST_CHECK_FALSE(GetResources()->IsPrefetchPending(GetResources()->PrefetchManifest(manifestId)));
+        }
+
+        GUGU_UTEST_SUBSECTION("Scene Switch");
+        {
+            reparseDirectory();
+
+            Scene* scene = new Scene;
+            bool sceneSwitched = false;
+            GetScenes()->SwitchRootScene(scene, manifestId, [&sceneSwitched]() { sceneSwitched = true; });
+            GUGU_UTEST_CHECK_TRUE(GetScenes()->IsSceneSwitchPending());
+            GUGU_UTEST_CHECK_TRUE(GetScenes()->GetRootScene() != scene);
+
+            GetResources()->CompleteAsyncLoads();
+            GUGU_UTEST_CHECK_EQUAL(GetScenes()->GetSceneSwitchProgress(), 1.f);
+
+            GetScenes()->Update(DeltaTime(sf::Time::Zero, sf::Time::Zero, 1.f));
+            GUGU_UTEST_CHECK_TRUE(sceneSwitched);
+            GUGU_UTEST_CHECK_FALSE(GetScenes()->IsSceneSwitchPending());
+            GUGU_UTEST_CHECK_TRUE(GetScenes()->GetRootScene() == scene);
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Access On Demand");
+        {
+            size_t loadedCount = 0;
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                reparseDirectory();
+                loadedCount = accessDatasheets();
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(loadedCount, benchmarkFileCount);
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Access After Prefetch");
+        {
+            size_t loadedCount = 0;
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                reparseDirectory();
+                GetResources()->PrefetchManifest(manifestId);
+                GetResources()->CompleteAsyncLoads();
+                loadedCount = accessDatasheets();
+            });
+
+            GUGU_UTEST_CHECK_EQUAL(loadedCount, benchmarkFileCount);
+        }
+
+        GetResources()->RemoveResourcesFromPath(manifestTestsPath, true);
+        RemoveDirectoryTree(manifestTestsPath);
     }
 
     //----------------------------------------------
@@ -13,9 +13,16 @@
 #include "Gugu/System/Platform.h"
 #include "Gugu/System/UUID.h"
 #include "Gugu/System/Hash.h"
+#include "Gugu/System/HashMap.h"
 #include "Gugu/System/Memory.h"
+#include "Gugu/System/SpscQueue.h"
+#include "Gugu/System/StringTable.h"
 #include "Gugu/System/Time.h"
 
+#include <mutex>
+#include <queue>
+#include <thread>
+
 using namespace gugu;
 
 ////////////////////////////////////////////////////////////////
@@ -1032,6 +1039,350 @@ void RunUnitTests_System(UnitTestResults* results)
 
     //----------------------------------------------
 
+    GUGU_UTEST_SECTION("HashMap");
+    {
+        GUGU_UTEST_SUBSECTION("Insert/Find");
+        {
+            HashMap<int> container;
+            GUGU_UTEST_CHECK_TRUE(container.IsEmpty());
+            GUGU_UTEST_CHECK_NULL(container.Find(Hash("A")));
+
+            GUGU_UTEST_CHECK_TRUE(container.Insert(Hash("A"), 1));
+            GUGU_UTEST_CHECK_TRUE(container.Insert(Hash("B"), 2));
+            GUGU_UTEST_CHECK_FALSE(container.Insert(Hash("A"), 3));
+            GUGU_UTEST_CHECK_EQUAL(container.Size(), 2);
+            GUGU_UTEST_CHECK_TRUE(container.Contains(Hash("A")));
+            GUGU_UTEST_CHECK_FALSE(container.Contains(Hash("C")));
+            GUGU_UTEST_CHECK_EQUAL(*container.Find(Hash("A")), 1);
+            GUGU_UTEST_CHECK_EQUAL(*container.Find(Hash("B")), 2);
+
+            *container.Find(Hash("B")) = 4;
+            GUGU_UTEST_CHECK_EQUAL(*container.Find(Hash("B")), 4);
+        }
+
+        GUGU_UTEST_SUBSECTION("Remove");
+        {
+            HashMap<int> container;
+            for (int i = 0; i < 1000; ++i)
+            {
+                container.Insert(Hash(ToString(i)), i);
+            }
+
+            GUGU_UTEST_CHECK_EQUAL(container.Size(), 1000);
+
+            for (int i = 0; i < 1000; i += 2)
+            {
+                GUGU_UTEST_CHECK_TRUE(container.Remove(Hash(ToString(i))));
+            }
+
+            GUGU_UTEST_CHECK_FALSE(container.Remove(Hash(ToString(0))));
+            GUGU_UTEST_CHECK_EQUAL(container.Size(), 500);
+
+            bool allFound = true;
+            for (int i = 0; i < 1000; ++i)
+            {
+                const int* value = container.Find(Hash(ToString(i)));
+                allFound &= (i % 2 == 0) ? value == nullptr : (value && *value == i);
+            }
+
+            GUGU_UTEST_CHECK_TRUE(allFound);
+
+            size_t iteratedCount = 0;
+            int iteratedSum = 0;
+            for (const auto& entry : container)
+            {
+                ++iteratedCount;
+                iteratedSum += entry.value;
+            }
+
+            GUGU_UTEST_CHECK_EQUAL(iteratedCount, 500);
+            GUGU_UTEST_CHECK_EQUAL(iteratedSum, 250000);
+
+            container.Clear();
+            GUGU_UTEST_CHECK_TRUE(container.IsEmpty());
+            GUGU_UTEST_CHECK_TRUE(container.begin() == container.end());
+        }
+
+        GUGU_UTEST_SUBSECTION("Growth");
+        {
+            HashMap<int> container;
+            container.Insert(Hash("0"), 0);
+            GUGU_UTEST_CHECK_EQUAL(container.Capacity(), 16);
+
+            // The load factor stays under 70%.
+            for (int i = 1; i < 11; ++i)
+            {
+                container.Insert(Hash(ToString(i)), i);
+            }
+
+            GUGU_UTEST_CHECK_EQUAL(container.Capacity(), 16);
+
+            container.Insert(Hash("11"), 11);
+            GUGU_UTEST_CHECK_EQUAL(container.Capacity(), 32);
+
+            container.Reserve(100);
+            GUGU_UTEST_CHECK_EQUAL(container.Capacity(), 256);
+            GUGU_UTEST_CHECK_EQUAL(container.Size(), 12);
+            GUGU_UTEST_CHECK_EQUAL(*container.Find(Hash("11")), 11);
+        }
+
+        GUGU_UTEST_SUBSECTION("ClearHashMap");
+        {
+            HashMap<int*> container;
+            container.Insert(Hash("A"), new int(1));
+            container.Insert(Hash("B"), new int(2));
+            ClearHashMap(container);
+            GUGU_UTEST_CHECK_TRUE(container.IsEmpty());
+        }
+    }
+
+    //----------------------------------------------
+
+    GUGU_UTEST_SECTION("StringTable");
+    {
+        GUGU_UTEST_SUBSECTION("Intern");
+        {
+            InternedString emptyString;
+            GUGU_UTEST_CHECK_TRUE(emptyString.IsEmpty());
+            GUGU_UTEST_CHECK_EQUAL(emptyString.GetId(), (uint32)0);
+            GUGU_UTEST_CHECK(emptyString == "");
+            GUGU_UTEST_CHECK(InternedString("") == emptyString);
+
+            InternedString hello("Hello World");
+            InternedString helloCopy(std::string("Hello World"));
+            InternedString other("Hello Other");
+            GUGU_UTEST_CHECK_EQUAL(hello.GetId(), helloCopy.GetId());
+            GUGU_UTEST_CHECK(hello == helloCopy);
+            GUGU_UTEST_CHECK(hello != other);
+            GUGU_UTEST_CHECK(hello == "Hello World");
+            GUGU_UTEST_CHECK(std::string("Hello World") == hello);
+            GUGU_UTEST_CHECK(std::string(hello.GetCString()) == "Hello World");
+            GUGU_UTEST_CHECK(hello.GetCString() == helloCopy.GetCString());
+            GUGU_UTEST_CHECK(other < hello);
+            GUGU_UTEST_CHECK_EQUAL(ToString(hello), "Hello World");
+
+            hello = "Hello Other";
+            GUGU_UTEST_CHECK(hello == other);
+        }
+
+        GUGU_UTEST_SUBSECTION("Find");
+        {
+            InternedString result;
+            GUGU_UTEST_CHECK(InternedString::TryFind("Hello World", result));
+            GUGU_UTEST_CHECK(result == "Hello World");
+
+            // Lookups and comparisons do not register new strings.
+            size_t stringCount = GetStringTable()->GetStringCount();
+            GUGU_UTEST_CHECK(!InternedString::TryFind("Never Interned", result));
+            GUGU_UTEST_CHECK(InternedString("Hello World") != "Never Interned");
+            GUGU_UTEST_CHECK_EQUAL(GetStringTable()->GetStringCount(), stringCount);
+        }
+
+        GUGU_UTEST_SUBSECTION("Stable Views");
+        {
+            InternedString stableString("Stable View");
+            std::string_view stableView = stableString.GetView();
+
+            for (size_t i = 0; i < 10000; ++i)
+            {
+                GetStringTable()->Intern(StringFormat("Stable View {0}", i));
+            }
+
+            std::string largeValue(20000, 'x');
+            InternedString largeString(largeValue);
+
+            GUGU_UTEST_CHECK(stableString.GetView().data() == stableView.data());
+            GUGU_UTEST_CHECK(stableView == "Stable View");
+            GUGU_UTEST_CHECK(largeString == largeValue);
+            GUGU_UTEST_CHECK(InternedString("Stable View 9999") == "Stable View 9999");
+        }
+
+        GUGU_UTEST_SUBSECTION("Threads");
+        {
+            // Concurrent registrations of the same strings should resolve to the same ids.
+            const size_t threadCount = 4;
+            const size_t stringCount = 1000;
+
+            std::vector<std::vector<uint32>> threadIds(threadCount);
+            std::vector<std::thread> threads;
+            for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+            {
+                threads.push_back(std::thread([&, threadIndex]()
+                {
+                    for (size_t i = 0; i < stringCount; ++i)
+                    {
+                        threadIds[threadIndex].push_back(InternedString(StringFormat("Thread String {0}", i)).GetId());
+                    }
+                }));
+            }
+
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+
+            size_t validCount = 0;
+            for (size_t i = 0; i < stringCount; ++i)
+            {
+                bool valid = GetStringTable()->GetString(threadIds[0][i]) == StringFormat("Thread String {0}", i);
+                for (size_t threadIndex = 1; threadIndex < threadCount; ++threadIndex)
+                {
+                    valid = valid && threadIds[threadIndex][i] == threadIds[0][i];
+                }
+
+                validCount += valid ? 1 : 0;
+            }
+
+            GUGU_UTEST_CHECK_EQUAL(validCount, stringCount);
+        }
+    }
+
+    //----------------------------------------------
+
+    GUGU_UTEST_SECTION("SpscQueue");
+    {
+        GUGU_UTEST_SUBSECTION("Push/Pop");
+        {
+            SpscQueue<int> queue(3);
+            GUGU_UTEST_CHECK_EQUAL(queue.Capacity(), (size_t)4);
+            GUGU_UTEST_CHECK_TRUE(queue.IsEmpty());
+
+            int value = 0;
+            GUGU_UTEST_CHECK_FALSE(queue.TryPop(value));
+
+            GUGU_UTEST_CHECK_TRUE(queue.TryPush(1));
+            GUGU_UTEST_CHECK_TRUE(queue.TryPush(2));
+            GUGU_UTEST_CHECK_TRUE(queue.TryPush(3));
+            GUGU_UTEST_CHECK_TRUE(queue.TryPush(4));
+            GUGU_UTEST_CHECK_FALSE(queue.TryPush(5));
+            GUGU_UTEST_CHECK_FALSE(queue.IsEmpty());
+
+            GUGU_UTEST_CHECK_TRUE(queue.TryPop(value));
+            GUGU_UTEST_CHECK_EQUAL(value, 1);
+            GUGU_UTEST_CHECK_TRUE(queue.TryPush(5));
+
+            std::vector<int> values;
+            while (queue.TryPop(value))
+            {
+                values.push_back(value);
+            }
+
+            GUGU_UTEST_CHECK(values == std::vector<int>({ 2, 3, 4, 5 }));
+            GUGU_UTEST_CHECK_TRUE(queue.IsEmpty());
+        }
+
+        GUGU_UTEST_SUBSECTION("Threads");
+        {
+            // Values should be received in order, without losses, while the queue wraps around.
+            const size_t valueCount = 1000000;
+            SpscQueue<size_t> queue(64);
+
+            std::thread producer([&]()
+            {
+                for (size_t i = 0; i < valueCount;)
+                {
+                    if (queue.TryPush(i))
+                    {
+                        ++i;
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+
+            size_t receivedCount = 0;
+            size_t orderedCount = 0;
+            while (receivedCount < valueCount)
+            {
+                size_t value = 0;
+                if (queue.TryPop(value))
+                {
+                    orderedCount += value == receivedCount ? 1 : 0;
+                    ++receivedCount;
+                }
+            }
+
+            producer.join();
+
+            GUGU_UTEST_CHECK_EQUAL(orderedCount, valueCount);
+            GUGU_UTEST_CHECK_TRUE(queue.IsEmpty());
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Mutex Reference");
+        {
+            const size_t valueCount = 1000000;
+
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                std::mutex mutex;
+                std::queue<size_t> queue;
+
+                std::thread producer([&]()
+                {
+                    for (size_t i = 0; i < valueCount; ++i)
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        queue.push(i);
+                    }
+                });
+
+                size_t receivedCount = 0;
+                while (receivedCount < valueCount)
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    while (!queue.empty())
+                    {
+                        queue.pop();
+                        ++receivedCount;
+                    }
+                }
+
+                producer.join();
+            });
+        }
+
+        GUGU_UTEST_SUBSECTION("Benchmark Threads");
+        {
+            const size_t valueCount = 1000000;
+
+            GUGU_UTEST_PERFORMANCE(3, [&]()
+            {
+                SpscQueue<size_t> queue(4096);
+
+                std::thread producer([&]()
+                {
+                    for (size_t i = 0; i < valueCount;)
+                    {
+                        if (queue.TryPush(i))
+                        {
+                            ++i;
+                        }
+                        else
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+
+                size_t receivedCount = 0;
+                size_t value = 0;
+                while (receivedCount < valueCount)
+                {
+                    while (queue.TryPop(value))
+                    {
+                        ++receivedCount;
+                    }
+                }
+
+                producer.join();
+            });
+        }
+    }
+
+    //----------------------------------------------
+
     GUGU_UTEST_SECTION("UUID");
     {
         UUID uuidA = GenerateUUID();
@@ -337,6 +337,65 @@ void RunUnitTests_Xml(UnitTestResults* results)
         }
     }
 
+    GUGU_UTEST_SECTION("Binary");
+    {
+        const std::string source = "<Root version=\"10\"><Data name=\"age\" value=\"30\"/><Data name=\"name\" value=\"Billy\">Text</Data><Empty/></Root>";
+        pugi::xml_document document = xml::ParseDocumentFromString(source);
+
+        std::vector<uint8> binary;
+        xml::SaveDocumentToBinary(document, binary);
+
+        pugi::xml_document binaryDocument;
+        GUGU_UTEST_CHECK_TRUE(xml::ParseDocumentFromBinary(binary.data(), binary.size(), binaryDocument));
+        GUGU_UTEST_CHECK(xml::SaveDocumentToString(binaryDocument) == source);
+
+        pugi::xml_document emptyDocument;
+        xml::SaveDocumentToBinary(emptyDocument, binary);
+        GUGU_UTEST_CHECK_TRUE(xml::ParseDocumentFromBinary(binary.data(), binary.size(), binaryDocument));
+        GUGU_UTEST_CHECK_FALSE(binaryDocument.first_child());
+
+        // Invalid data.
+        xml::SaveDocumentToBinary(document, binary);
+        GUGU_UTEST_CHECK_FALSE(xml::ParseDocumentFromBinary(binary.data(), binary.size() - 1, binaryDocument));
+        GUGU_UTEST_CHECK_FALSE(xml::ParseDocumentFromBinary(nullptr, 0, binaryDocument));
+
+        binary[4] += 1;     // Version.
+        GUGU_UTEST_CHECK_FALSE(xml::ParseDocumentFromBinary(binary.data(), binary.size(), binaryDocument));
+
+        GUGU_UTEST_SUBSECTION("Binary Document");
+        {
+            xml::SaveDocumentToBinary(document, binary);
+
+            xml::BinaryDocument readDocument;
+            GUGU_UTEST_CHECK_TRUE(readDocument.Parse(binary.data(), binary.size()));
+
+            xml::BinaryNode nodeRoot = readDocument.child("Root");
+            GUGU_UTEST_CHECK_TRUE(nodeRoot);
+            GUGU_UTEST_CHECK_EQUAL(nodeRoot.attribute("version").as_int(), 10);
+            GUGU_UTEST_CHECK_EQUAL(nodeRoot.attribute("missing").as_int(5), 5);
+            GUGU_UTEST_CHECK_FALSE(nodeRoot.next_sibling());
+
+            xml::BinaryNode nodeAge = nodeRoot.child("Data");
+            xml::BinaryNode nodeName = nodeAge.next_sibling("Data");
+            GUGU_UTEST_CHECK_EQUAL(std::string(nodeAge.attribute("value").as_string()), "30");
+            GUGU_UTEST_CHECK_EQUAL(std::string(nodeName.attribute("value").as_string()), "Billy");
+            GUGU_UTEST_CHECK_EQUAL(std::string(nodeName.child_value()), "Text");
+            GUGU_UTEST_CHECK_FALSE(nodeName.next_sibling("Data"));
+            GUGU_UTEST_CHECK_TRUE(nodeRoot.child("Empty"));
+            GUGU_UTEST_CHECK_FALSE(nodeRoot.child("Empty").first_child());
+            GUGU_UTEST_CHECK_FALSE(nodeRoot.child("Missing").child("Missing"));
+
+            // The document owns its data when parsed from a buffer.
+            pugi::xml_document convertedDocument;
+            GUGU_UTEST_CHECK_TRUE(readDocument.Parse(std::vector<uint8>(binary)));
+            GUGU_UTEST_CHECK_TRUE(readDocument.ConvertToXml(convertedDocument));
+            GUGU_UTEST_CHECK(xml::SaveDocumentToString(convertedDocument) == source);
+
+            GUGU_UTEST_CHECK_FALSE(readDocument.Parse(binary.data(), binary.size() - 1));
+            GUGU_UTEST_CHECK_FALSE(readDocument.child("Root"));
+        }
+    }
+
     //----------------------------------------------
 
     GUGU_UTEST_FINALIZE();
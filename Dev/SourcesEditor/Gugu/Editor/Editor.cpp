@@ -365,6 +365,17 @@ void Editor::Update(const DeltaTime& dt)
                 MigrateResources();
             }
 
+            ImGui::Separator();
+            if (ImGui::MenuItem("Cook Resources", nullptr, false, IsProjectOpen()))
+            {
+                GetResources()->CookResources(m_project->projectAssetsPath);
+            }
+
+            if (ImGui::MenuItem("Remove Cooked Resources", nullptr, false, IsProjectOpen()))
+            {
+                GetResources()->RemoveCookedResources(m_project->projectAssetsPath);
+            }
+
             ImGui::Separator();
             if (ImGui::MenuItem("Import ImageSet"))
             {
@@ -136,7 +136,7 @@ void GatherDatasheetTexts(const LocalizationTable* localizationTable, const std:
                                     writer.WriteField("UPDATE");    // Text Status.
                                 else
                                     writer.WriteField("OK");        // Text Status.
-                                writer.WriteField(entry->text);     // Text.
+                                writer.WriteField(std::string(localizationTable->GetText(languageCode, key)));  // Text.
                             }
                             else
                             {
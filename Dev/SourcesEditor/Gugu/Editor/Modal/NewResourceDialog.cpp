@@ -17,6 +17,7 @@
 #include "Gugu/Resources/ParticleEffect.h"
 #include "Gugu/Resources/ElementWidget.h"
 #include "Gugu/Resources/LocalizationTable.h"
+#include "Gugu/Resources/PreloadManifest.h"
 #include "Gugu/System/Path.h"
 #include "Gugu/System/Memory.h"
 #include "Gugu/External/ImGuiUtility.h"
@@ -42,6 +43,7 @@ NewResourceDialog::NewResourceDialog(const std::string& resourcePath, EResourceT
         { EResourceType::ParticleEffect, "particle.xml" },
         { EResourceType::ElementWidget, "widget.xml" },
         { EResourceType::LocalizationTable, "localization.xml" },
+        { EResourceType::PreloadManifest, "manifest.xml" },
     };
 
     if (m_resourceType == EResourceType::Datasheet)
@@ -161,6 +163,10 @@ void NewResourceDialog::UpdateModalImpl(const DeltaTime& dt)
         {
             newResource = new LocalizationTable;
         }
+        else if (m_resourceType == EResourceType::PreloadManifest)
+        {
+            newResource = new PreloadManifest;
+        }
         else if (m_resourceType == EResourceType::Datasheet)
         {
             DatasheetParser::ClassDefinition* classDefinition;
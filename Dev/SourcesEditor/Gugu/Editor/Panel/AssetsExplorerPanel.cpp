@@ -491,6 +491,11 @@ void AssetsExplorerPanel::HandleDirectoryContextMenu(TreeNode* node, bool* colla
                 GetEditor()->OpenModalDialog(new NewResourceDialog(node->path, EResourceType::LocalizationTable));
             }
 
+            if (ImGui::MenuItem("PreloadManifest"))
+            {
+                GetEditor()->OpenModalDialog(new NewResourceDialog(node->path, EResourceType::PreloadManifest));
+            }
+
             ImGui::EndMenu();
         }
 
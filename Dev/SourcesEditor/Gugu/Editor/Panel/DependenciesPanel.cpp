@@ -33,17 +33,52 @@ void DependenciesPanel::UpdatePanel(const DeltaTime& dt)
 {
     if (ImGui::Begin(m_title.c_str(), nullptr))
     {
-        const std::map<const Resource*, ManagerResources::ResourceDependencies>& resourceDependencies = GetResources()->GetResourceDependencies();
+        const std::vector<ManagerResources::ResourceDependencies>& resourceDependencies = GetResources()->GetResourceDependencies();
+
+        const ManagerResources::ResidencyStats& residencyStats = GetResources()->GetResidencyStats();
+        if (ImGui::TreeNodeEx("Residency:", ImGuiTreeNodeFlags_None))
+        {
+            if (residencyStats.memoryBudget > 0)
+            {
+                ImGui::Text(StringFormat("Resident Memory: {0} KB / {1} KB", residencyStats.residentMemory / 1024, residencyStats.memoryBudget / 1024));
+                ImGui::Text(StringFormat("Resident Resources: {0}", residencyStats.residentResourceCount));
+            }
+            else
+            {
+                ImGui::Text("Memory Budget: none (eviction disabled)");
+            }
+
+            ImGui::Text(StringFormat("Evicted Resources: {0} ({1} KB)", residencyStats.evictedResourceCount, residencyStats.evictedMemory / 1024));
+
+            const ManagerResources::TextureStreamingStats& streamingStats = GetResources()->GetTextureStreamingStats();
+            if (GetResources()->GetTextureStreamingMinSize() > 0)
+            {
+                ImGui::Text(StringFormat("Streamed Textures: {0} (Full Resolution {1}, Pending {2}, Dropped {3})", streamingStats.streamedTextureCount, streamingStats.fullResolutionTextureCount, streamingStats.pendingLoadCount, streamingStats.droppedTextureCount));
+                ImGui::Text(StringFormat("Streaming Memory: {0} KB / {1} KB", streamingStats.fullResolutionMemory / 1024, streamingStats.memoryBudget / 1024));
+            }
+            else
+            {
+                ImGui::Text("Texture Streaming: disabled");
+            }
+
+            const ManagerResources::PrefetchStats& prefetchStats = GetResources()->GetPrefetchStats();
+            ImGui::Text(StringFormat("Prefetched Resources: {0} (Avoided Hitches {1})", prefetchStats.prefetchedResourceCount, prefetchStats.avoidedHitchCount));
+            ImGui::Text(StringFormat("On Demand Loads: {0} ({1} ms, Max {2} ms)", prefetchStats.onDemandLoadCount, ToStringf(prefetchStats.onDemandLoadTimeMs, 2), ToStringf(prefetchStats.maxOnDemandLoadTimeMs, 2)));
+
+            ImGui::TreePop();
+        }
+
+        ImGui::Spacing();
         
         DocumentPanel* lastActiveDocument = GetEditor()->GetLastActiveDocument();
         if (lastActiveDocument)
         {
-            auto it = resourceDependencies.find(lastActiveDocument->GetResource());
-            if (it != resourceDependencies.end())
+            const ManagerResources::ResourceDependencies* activeDocumentDependencies = GetResources()->FindResourceDependencies(lastActiveDocument->GetResource());
+            if (activeDocumentDependencies)
             {
-                if (ImGui::TreeNodeEx(StringFormat("Active Document ({0}):###_ACTIVE_DOCUMENT", it->first->GetID()).c_str(), ImGuiTreeNodeFlags_DefaultOpen))
+                if (ImGui::TreeNodeEx(StringFormat("Active Document ({0}):###_ACTIVE_DOCUMENT", activeDocumentDependencies->resource->GetID()).c_str(), ImGuiTreeNodeFlags_DefaultOpen))
                 {
-                    DisplayResourceDependencies(it->second);
+                    DisplayResourceDependencies(*activeDocumentDependencies, resourceDependencies);
 
                     ImGui::TreePop();
                 }
@@ -54,11 +89,14 @@ void DependenciesPanel::UpdatePanel(const DeltaTime& dt)
 
         if (ImGui::TreeNodeEx("Loaded Resources:", ImGuiTreeNodeFlags_DefaultOpen))
         {
-            for (const auto& kvp : resourceDependencies)
+            for (const auto& dependencies : resourceDependencies)
             {
-                if (ImGui::TreeNodeEx(kvp.first->GetID().c_str(), ImGuiTreeNodeFlags_None))
+                if (!dependencies.resource)
+                    continue;
+
+                if (ImGui::TreeNodeEx(dependencies.resource->GetID().c_str(), ImGuiTreeNodeFlags_None))
                 {
-                    DisplayResourceDependencies(kvp.second);
+                    DisplayResourceDependencies(dependencies, resourceDependencies);
 
                     ImGui::TreePop();
                 }
@@ -70,25 +108,25 @@ void DependenciesPanel::UpdatePanel(const DeltaTime& dt)
     ImGui::End();
 }
 
-void DependenciesPanel::DisplayResourceDependencies(const ManagerResources::ResourceDependencies& dependencies) const
+void DependenciesPanel::DisplayResourceDependencies(const ManagerResources::ResourceDependencies& dependencies, const std::vector<ManagerResources::ResourceDependencies>& resourceDependencies) const
 {
     ImGui::Indent();
 
     ImGui::Text(StringFormat("Dependencies: {0}", dependencies.dependencies.size()));
 
     ImGui::Indent();
-    for (const auto& dependency : dependencies.dependencies)
+    for (uint32 dependencyIndex : dependencies.dependencies)
     {
-        ImGui::Text(StringFormat("{0}", dependency->GetID()));
+        ImGui::Text(StringFormat("{0}", resourceDependencies[dependencyIndex].resource->GetID()));
     }
     ImGui::Unindent();
 
     ImGui::Text(StringFormat("Referencers: {0}", dependencies.referencers.size()));
 
     ImGui::Indent();
-    for (const auto& referencer : dependencies.referencers)
+    for (uint32 referencerIndex : dependencies.referencers)
     {
-        ImGui::Text(StringFormat("{0}", referencer->GetID()));
+        ImGui::Text(StringFormat("{0}", resourceDependencies[referencerIndex].resource->GetID()));
     }
     ImGui::Unindent();
 
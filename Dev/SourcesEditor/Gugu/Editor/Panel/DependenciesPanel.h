@@ -31,7 +31,7 @@ public:
 
 private:
 
-    void DisplayResourceDependencies(const ManagerResources::ResourceDependencies& dependencies) const;
+    void DisplayResourceDependencies(const ManagerResources::ResourceDependencies& dependencies, const std::vector<ManagerResources::ResourceDependencies>& resourceDependencies) const;
 };
 
 }   //namespace gugu
@@ -4,7 +4,9 @@
 #include "Gugu/Common.h"
 #include "EditorApp.h"
 #include "Gugu/Editor/Editor.h"
+#include "Gugu/Editor/Core/ProjectSettings.h"
 #include "Gugu/Engine.h"
+#include "Gugu/Resources/ManagerResources.h"
 
 #if defined(GUGU_ENV_VISUAL )
 
@@ -43,6 +45,24 @@ int main(int argc, char* argv[])
 
     GetEngine()->Init(config);
 
+    //----------------------------------------------
+    // Command line cooking : "--cook <ProjectSettings.xml>" will cook the project resources, then exit.
+
+    if (argc >= 3 && std::string(argv[1]) == "--cook")
+    {
+        bool cooked = false;
+
+        ProjectSettings project;
+        if (project.LoadFromFile(argv[2]))
+        {
+            GetResources()->ParseDirectory(project.projectAssetsPath);
+            cooked = GetResources()->CookResources(project.projectAssetsPath);
+        }
+
+        GetEngine()->Release();
+        return cooked ? 0 : 1;
+    }
+
     //----------------------------------------------
     // Init editor
 
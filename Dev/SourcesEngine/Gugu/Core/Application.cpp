@@ -55,7 +55,7 @@ void Application::ComputeCommandLine(const std::string& command, const std::vect
 {
 }
 
-NetPacketGame* Application::ReadGamePacket(sf::Packet* sfPacket)
+NetPacketGame* Application::ReadGamePacket(NetBufferReader& reader)
 {
     return nullptr;
 }
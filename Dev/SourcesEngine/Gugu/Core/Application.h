@@ -16,11 +16,7 @@ namespace gugu
     class Datasheet;
     class NetPacketGame;
     class ClientInfo;
-}
-
-namespace sf
-{
-    class Packet;
+    class NetBufferReader;
 }
 
 ////////////////////////////////////////////////////////////////
@@ -48,7 +44,8 @@ public:
 
     virtual void ComputeCommandLine(const std::string& command, const std::vector<std::string>& args);
 
-    virtual NetPacketGame* ReadGamePacket(sf::Packet* sfPacket);
+    // The packet type has been read, the application creates the game packet and deserializes it (null if invalid).
+    virtual NetPacketGame* ReadGamePacket(NetBufferReader& reader);
     virtual void PlayerAddedToGame(ClientInfo* client);
 };
 
@@ -9,10 +9,16 @@
 namespace gugu {
 
 DeltaTime::DeltaTime(const sf::Time& time, const sf::Time& unscaledTime, float scale)
+    : DeltaTime(time, unscaledTime, scale, 1.f)
+{
+}
+
+DeltaTime::DeltaTime(const sf::Time& time, const sf::Time& unscaledTime, float scale, float stepInterpolation)
 {
     m_time = time;
     m_unscaledTime = unscaledTime;
     m_scale = scale;
+    m_stepInterpolation = stepInterpolation;
 
     // Cache the conversions (it will be used a lot).
     m_seconds = static_cast<float>(static_cast<double>(m_time.asMicroseconds()) / 1000000.0);
@@ -36,6 +42,11 @@ float DeltaTime::GetScale() const
     return m_scale;
 }
 
+float DeltaTime::GetStepInterpolation() const
+{
+    return m_stepInterpolation;
+}
+
 float DeltaTime::s() const
 {
     return m_seconds;
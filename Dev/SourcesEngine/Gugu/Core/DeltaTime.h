@@ -17,11 +17,15 @@ class DeltaTime
 public:
     
     DeltaTime(const sf::Time& time, const sf::Time& unscaledTime, float scale);
+    DeltaTime(const sf::Time& time, const sf::Time& unscaledTime, float scale, float stepInterpolation);
 
     sf::Time GetTime() const;
     sf::Time GetUnscaledTime() const;
     float GetScale() const;
 
+    // Ratio [0, 1] of the time accumulated toward the next constant step, used to blend between the last two step states.
+    float GetStepInterpolation() const;
+
     float s() const;
     float ms() const;
     int64 micro() const;
@@ -39,6 +43,7 @@ private:
     sf::Time m_time;
     sf::Time m_unscaledTime;
     float m_scale;
+    float m_stepInterpolation;
 
     float m_seconds;
     float m_unscaledSeconds;
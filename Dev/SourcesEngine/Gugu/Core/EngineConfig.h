@@ -33,15 +33,26 @@ struct EngineConfig
     // Step
     bool useConstantStep;
     int constantStepTimeMs;
+    int maxStepCountPerLoop;            // Max steps computed in a single loop to catch up on slow frames (exceeding time is dropped), scaled by the speed multiplier.
 
     // Resources
     bool useAssetsFullPaths;
     std::string pathAssets;
+    std::string pathAssetsArchive;      // Optional packed assets, mounted instead of parsing the assets directory (the directory is used as a fallback).
+    std::string pathResourceCache;      // Optional cache file, persisting resource types and dependencies between runs (empty disables the cache).
     std::string pathScreenshots;
     std::string defaultFont;
     std::string debugFont;
     bool defaultTextureSmooth;
     bool handleResourceDependencies;
+    int maxAsyncLoadTimePerLoopMs;      // Main thread time budget for finalizing asynchronous resource loads (at least one load is finalized per loop).
+    int resourceMemoryBudgetMb;         // Unreferenced resources are evicted when their resident memory exceeds this budget (0 disables the eviction).
+    int textureStreamingMinSize;        // Textures with a dimension reaching this size only load a downscaled fallback until needed (0 disables the streaming).
+    int textureStreamingBudgetMb;       // Memory budget for the full resolution of streamed textures (0 disables the limit).
+    int textureStreamingDropDelayMs;    // Delay without rendering before the full resolution of a streamed texture is dropped.
+
+    // Threads
+    int workerThreadCount;              // Worker threads used by background tasks (0 will use the hardware concurrency).
 
     // Graphics
     EGameWindow::Type gameWindow;
@@ -76,14 +87,24 @@ struct EngineConfig
 
         useConstantStep = true;
         constantStepTimeMs = 20;
+        maxStepCountPerLoop = 5;
 
         useAssetsFullPaths = false;
         pathAssets = "";
+        pathAssetsArchive = "";
+        pathResourceCache = "";
         pathScreenshots = "Screenshots";
         defaultFont = "";
         debugFont = "";
         defaultTextureSmooth = false;
         handleResourceDependencies = false;
+        maxAsyncLoadTimePerLoopMs = 4;
+        resourceMemoryBudgetMb = 0;
+        textureStreamingMinSize = 0;
+        textureStreamingBudgetMb = 0;
+        textureStreamingDropDelayMs = 5000;
+
+        workerThreadCount = 0;
 
         gameWindow = EGameWindow::Sfml;
         windowWidth = 800;
@@ -0,0 +1,85 @@
+////////////////////////////////////////////////////////////////
+// Header
+
+#include "Gugu/Common.h"
+#include "Gugu/Core/StepAccumulator.h"
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/Math/MathUtility.h"
+
+#include <cmath>
+
+////////////////////////////////////////////////////////////////
+// File Implementation
+
+namespace gugu {
+
+StepAccumulator::StepAccumulator()
+{
+    Reset();
+}
+
+void StepAccumulator::Reset()
+{
+    m_accumulatedTime = sf::Time::Zero;
+    m_stepTime = sf::Time::Zero;
+    m_maxStepCount = 1;
+    m_stepCount = 0;
+}
+
+void StepAccumulator::BeginLoop(const sf::Time& loopTime, const sf::Time& stepTime, int maxStepCountPerLoop, float speedMultiplier)
+{
+    m_accumulatedTime += loopTime;
+    m_stepTime = stepTime;
+    m_stepCount = 0;
+
+    // A speed multiplier of 10 needs 10 times more steps per loop.
+    m_maxStepCount = Max(1, maxStepCountPerLoop);
+    if (speedMultiplier > 1.f)
+    {
+        m_maxStepCount = static_cast<int>(std::ceil(m_maxStepCount * speedMultiplier));
+    }
+}
+
+bool StepAccumulator::ConsumeStep()
+{
+    if (m_stepTime <= sf::Time::Zero || m_accumulatedTime < m_stepTime || m_stepCount >= m_maxStepCount)
+        return false;
+
+    m_accumulatedTime -= m_stepTime;
+    ++m_stepCount;
+    return true;
+}
+
+void StepAccumulator::EndLoop()
+{
+    // If we could not catch up, drop the exceeding time instead of accumulating an ever-growing lag.
+    if (m_stepTime > sf::Time::Zero && m_accumulatedTime >= m_stepTime)
+    {
+        m_accumulatedTime %= m_stepTime;
+    }
+}
+
+int StepAccumulator::GetMaxStepCount() const
+{
+    return m_maxStepCount;
+}
+
+int StepAccumulator::GetStepCount() const
+{
+    return m_stepCount;
+}
+
+sf::Time StepAccumulator::GetAccumulatedTime() const
+{
+    return m_accumulatedTime;
+}
+
+float StepAccumulator::GetInterpolation() const
+{
+    return m_stepTime > sf::Time::Zero ? Clamp01(m_accumulatedTime / m_stepTime) : 1.f;
+}
+
+}   // namespace gugu
@@ -0,0 +1,41 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include <SFML/System/Time.hpp>
+
+////////////////////////////////////////////////////////////////
+// File Declarations
+
+namespace gugu {
+
+// Accumulates the loop time, and consumes it by constant steps.
+// - Slow loops compute several steps to catch up, up to a max step count per loop, the exceeding time is dropped.
+// - The max step count is scaled by the speed multiplier, a fast-forward still runs all its steps.
+class StepAccumulator
+{
+public:
+
+    StepAccumulator();
+
+    void Reset();
+
+    void BeginLoop(const sf::Time& loopTime, const sf::Time& stepTime, int maxStepCountPerLoop, float speedMultiplier);
+    bool ConsumeStep();     // True if a step should be computed.
+    void EndLoop();
+
+    int GetMaxStepCount() const;
+    int GetStepCount() const;           // Steps consumed since BeginLoop.
+    sf::Time GetAccumulatedTime() const;
+    float GetInterpolation() const;     // Ratio [0, 1] of the time accumulated toward the next step.
+
+private:
+
+    sf::Time m_accumulatedTime;
+    sf::Time m_stepTime;
+    int m_maxStepCount;
+    int m_stepCount;
+};
+
+}   // namespace gugu
@@ -12,10 +12,15 @@
 #include "Gugu/Data/DatasaveObject.h"
 #include "Gugu/Resources/ManagerResources.h"
 #include "Gugu/Resources/Datasheet.h"
+#include "Gugu/System/Container.h"
+#include "Gugu/System/Memory.h"
 #include "Gugu/System/String.h"
+#include "Gugu/System/Hash.h"
 #include "Gugu/Debug/Logger.h"
 #include "Gugu/External/PugiXmlUtility.h"
 
+#include <algorithm>
+
 ////////////////////////////////////////////////////////////////
 // File Implementation
 
@@ -25,25 +30,116 @@ namespace binding {
 
 namespace impl {
 
-pugi::xml_node FindNodeData(DataParseContext& _kContext, const std::string& _strName)
+bool CompareDataNodeHash(const std::pair<uint64, pugi::xml_node_struct*>& left, uint64 right)
 {
-    return _kContext.currentNode->find_child_by_attribute("Data", "name", _strName.c_str());
+    return left.first < right;
+}
+
+const DataMemberIndex& GetDataMemberIndex(DataParseContext& context)
+{
+    const pugi::xml_node_struct* currentNode = context.currentNode->internal_object();
+
+    // Returning to a parent node drops the indices of the children objects parsed in between.
+    for (size_t i = context.memberIndexCount; i > 0; --i)
+    {
+        if (context.memberIndices[i - 1].indexedNode == currentNode)
+        {
+            context.memberIndexCount = i;
+            return context.memberIndices[i - 1];
+        }
+    }
+
+    // Entering a new node only keeps the indices of its ancestors, a sibling object replaces the previous one.
+    size_t ancestorCount = 0;
+    for (pugi::xml_node ancestor = context.currentNode->parent(); ancestor && ancestorCount == 0; ancestor = ancestor.parent())
+    {
+        for (size_t i = context.memberIndexCount; i > 0; --i)
+        {
+            if (context.memberIndices[i - 1].indexedNode == ancestor.internal_object())
+            {
+                ancestorCount = i;
+                break;
+            }
+        }
+    }
+
+    context.memberIndexCount = ancestorCount;
+
+    if (context.memberIndexCount == context.memberIndices.size())
+    {
+        context.memberIndices.emplace_back();
+    }
+
+    DataMemberIndex& index = context.memberIndices[context.memberIndexCount++];
+    index.indexedNode = currentNode;
+    index.dataNodes.clear();
+
+    for (pugi::xml_node child = context.currentNode->child("Data"); child; child = child.next_sibling("Data"))
+    {
+        index.dataNodes.push_back(std::make_pair(0, child.internal_object()));
+    }
+
+    index.isSorted = index.dataNodes.size() >= context.sortedIndexMinSize;
+    if (!index.isSorted)
+        return index;
+
+    for (auto& dataNode : index.dataNodes)
+    {
+        dataNode.first = Hash::HashString(pugi::xml_node(dataNode.second).attribute("name").value());
+    }
+
+    // Stable sort keeps the document order between duplicate names, the first one is used, as with a linear search.
+    std::stable_sort(index.dataNodes.begin(), index.dataNodes.end(), [](const auto& left, const auto& right)
+    {
+        return left.first < right.first;
+    });
+
+    return index;
 }
 
-pugi::xml_node AddNodeData(DataSaveContext& _kContext, const std::string& _strName)
+pugi::xml_node FindNodeData(DataParseContext& _kContext, std::string_view _strName)
+{
+    const DataMemberIndex& index = GetDataMemberIndex(_kContext);
+    const std::vector<std::pair<uint64, pugi::xml_node_struct*>>& dataNodes = index.dataNodes;
+
+    if (!index.isSorted)
+    {
+        for (const auto& dataNode : dataNodes)
+        {
+            pugi::xml_node node(dataNode.second);
+            if (_strName == node.attribute("name").value())
+                return node;
+        }
+
+        return pugi::xml_node();
+    }
+
+    uint64 nameHash = Hash::HashString(_strName);
+    for (auto it = std::lower_bound(dataNodes.begin(), dataNodes.end(), nameHash, CompareDataNodeHash); it != dataNodes.end() && it->first == nameHash; ++it)
+    {
+        // Check the actual name in case of a hash collision.
+        pugi::xml_node node(it->second);
+        if (_strName == node.attribute("name").value())
+            return node;
+    }
+
+    return pugi::xml_node();
+}
+
+pugi::xml_node AddNodeData(DataSaveContext& _kContext, std::string_view _strName)
 {
     pugi::xml_node nodeData = _kContext.currentNode->append_child("Data");
-    nodeData.append_attribute("name").set_value(_strName.c_str());
+    nodeData.append_attribute("name").set_value(_strName.data(), _strName.size());
     return nodeData;
 }
 
-bool ReadEnumValue(DataParseContext& context, const std::string& name, const std::string& enumTypeName, int& value)
+bool ReadEnumValue(DataParseContext& context, std::string_view name, std::string_view enumTypeName, int& value)
 {
     if (const DataEnumInfos* enumInfos = GetResources()->GetDataEnumInfos(enumTypeName))
     {
         if (pugi::xml_node node = FindNodeData(context, name))
         {
-            std::string enumValue = node.attribute("value").as_string("");
+            std::string_view enumValue = node.attribute("value").as_string("");
             for (size_t i = 0; i < enumInfos->values.size(); ++i)
             {
                 if (enumInfos->values[i] == enumValue)
@@ -58,7 +154,7 @@ bool ReadEnumValue(DataParseContext& context, const std::string& name, const std
     return false;
 }
 
-bool ReadEnumValues(DataParseContext& context, const std::string& name, const std::string& enumTypeName, std::vector<int>& values)
+bool ReadEnumValues(DataParseContext& context, std::string_view name, std::string_view enumTypeName, std::vector<int>& values)
 {
     if (const DataEnumInfos* enumInfos = GetResources()->GetDataEnumInfos(enumTypeName))
     {
@@ -66,7 +162,7 @@ bool ReadEnumValues(DataParseContext& context, const std::string& name, const st
         {
             for (pugi::xml_node child = node.child("Child"); child; child = child.next_sibling("Child"))
             {
-                std::string enumValue = child.attribute("value").as_string("");
+                std::string_view enumValue = child.attribute("value").as_string("");
                 for (size_t i = 0; i < enumInfos->values.size(); ++i)
                 {
                     if (enumInfos->values[i] == enumValue)
@@ -83,7 +179,7 @@ bool ReadEnumValues(DataParseContext& context, const std::string& name, const st
     return false;
 }
 
-void WriteEnumValue(DataSaveContext& _kContext, const std::string& _strName, const std::string& _strType, int _iValue)
+void WriteEnumValue(DataSaveContext& _kContext, std::string_view _strName, std::string_view _strType, int _iValue)
 {
     const DataEnumInfos* pEnum = GetResources()->GetDataEnumInfos(_strType);
     if (pEnum && _iValue >= 0 && _iValue < pEnum->values.size())
@@ -92,7 +188,7 @@ void WriteEnumValue(DataSaveContext& _kContext, const std::string& _strName, con
     }
 }
 
-void WriteEnumValues(DataSaveContext& _kContext, const std::string& _strName, const std::string& _strType, const std::vector<int>& _vecValues)
+void WriteEnumValues(DataSaveContext& _kContext, std::string_view _strName, std::string_view _strType, const std::vector<int>& _vecValues)
 {
     const DataEnumInfos* pEnum = GetResources()->GetDataEnumInfos(_strType);
     if (pEnum)
@@ -110,22 +206,89 @@ void WriteEnumValues(DataSaveContext& _kContext, const std::string& _strName, co
     }
 }
 
+bool FindEnumTableValue(const DataEnumTable& enumTable, std::string_view name, int& value)
+{
+    const int* sortedValuesEnd = enumTable.sortedValues + enumTable.size;
+    const int* it = std::lower_bound(enumTable.sortedValues, sortedValuesEnd, name, [&enumTable](int left, std::string_view right)
+    {
+        return enumTable.names[left] < right;
+    });
+
+    if (it != sortedValuesEnd && enumTable.names[*it] == name)
+    {
+        value = *it;
+        return true;
+    }
+
+    return false;
+}
+
+bool ReadEnumValue(DataParseContext& context, std::string_view name, const DataEnumTable& enumTable, int& value)
+{
+    if (pugi::xml_node node = FindNodeData(context, name))
+    {
+        return FindEnumTableValue(enumTable, node.attribute("value").as_string(""), value);
+    }
+
+    return false;
+}
+
+bool ReadEnumValues(DataParseContext& context, std::string_view name, const DataEnumTable& enumTable, std::vector<int>& values)
+{
+    if (pugi::xml_node node = FindNodeData(context, name))
+    {
+        for (pugi::xml_node child = node.child("Child"); child; child = child.next_sibling("Child"))
+        {
+            int value = 0;
+            if (FindEnumTableValue(enumTable, child.attribute("value").as_string(""), value))
+            {
+                values.push_back(value);
+            }
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+void WriteEnumValue(DataSaveContext& context, std::string_view name, const DataEnumTable& enumTable, int value)
+{
+    if (value >= 0 && (size_t)value < enumTable.size)
+    {
+        impl::AddNodeData(context, name).append_attribute("value").set_value(enumTable.names[value].data());
+    }
+}
+
+void WriteEnumValues(DataSaveContext& context, std::string_view name, const DataEnumTable& enumTable, const std::vector<int>& values)
+{
+    pugi::xml_node node = impl::AddNodeData(context, name);
+
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        int value = values[i];
+        if (value >= 0 && (size_t)value < enumTable.size)
+        {
+            node.append_child("Child").append_attribute("value").set_value(enumTable.names[value].data());
+        }
+    }
+}
+
 const DatasheetObject* ResolveDatasheetReference(const std::string& _strName)
 {
     Datasheet* datasheet = GetResources()->GetDatasheet(_strName);
     return datasheet ? datasheet->GetRootObject() : nullptr;
 }
 
-bool ResolveDatasheetReference(DataParseContext& _kContext, const std::string& _strName, const DatasheetObject*& _pNewDatasheet)
+bool ResolveDatasheetReference(DataParseContext& _kContext, std::string_view _strName, const DatasheetObject*& _pNewDatasheet)
 {
     if (pugi::xml_node pNode = FindNodeData(_kContext, _strName))
     {
         // Reference can be null.
-        std::string datasheetID = pNode.attribute("value").as_string();
-        if (datasheetID != "")
+        const char* datasheetID = pNode.attribute("value").as_string();
+        if (!StringEquals(datasheetID, ""))
         {
-            std::string strSheetName = datasheetID;
-            _pNewDatasheet = ResolveDatasheetReference(strSheetName);
+            _pNewDatasheet = ResolveDatasheetReference(datasheetID);
         }
 
         return true;
@@ -134,15 +297,15 @@ bool ResolveDatasheetReference(DataParseContext& _kContext, const std::string& _
     return false;
 }
 
-bool ResolveDatasheetReferences(DataParseContext& _kContext, const std::string& _strName, std::vector<const DatasheetObject*>& _vecReferences)
+bool ResolveDatasheetReferences(DataParseContext& _kContext, std::string_view _strName, std::vector<const DatasheetObject*>& _vecReferences)
 {
     if (pugi::xml_node node = FindNodeData(_kContext, _strName))
     {
         for (pugi::xml_node child = node.child("Child"); child; child = child.next_sibling("Child"))
         {
             // Reference can be null.
-            std::string datasheetID = child.attribute("value").as_string();
-            if (datasheetID != "")
+            const char* datasheetID = child.attribute("value").as_string();
+            if (!StringEquals(datasheetID, ""))
             {
                 const DatasheetObject* reference = ResolveDatasheetReference(datasheetID);
                 _vecReferences.push_back(reference);
@@ -159,7 +322,7 @@ bool ResolveDatasheetReferences(DataParseContext& _kContext, const std::string&
     return false;
 }
 
-void WriteDatasheetReferences(DataSaveContext& _kContext, const std::string& _strName, const std::vector<const DatasheetObject*>& _pMember)
+void WriteDatasheetReferences(DataSaveContext& _kContext, std::string_view _strName, const std::vector<const DatasheetObject*>& _pMember)
 {
     pugi::xml_node pNode = AddNodeData(_kContext, _strName);
 
@@ -177,7 +340,7 @@ void WriteDatasheetReferences(DataSaveContext& _kContext, const std::string& _st
     }
 }
 
-bool ResolveDatasheetObjectInstance(DataParseContext& _kContext, const std::string& _strName, const std::string& _strDefaultType, DataObject*& _pInstance)
+bool ResolveDatasheetObjectInstance(DataParseContext& _kContext, std::string_view _strName, std::string_view _strDefaultType, DataObject*& _pInstance)
 {
     if (pugi::xml_node node = FindNodeData(_kContext, _strName))
     {
@@ -200,7 +363,7 @@ bool ResolveDatasheetObjectInstance(DataParseContext& _kContext, const std::stri
     return false;
 }
 
-bool ResolveDatasheetObjectInstances(DataParseContext& _kContext, const std::string& _strName, const std::string& _strDefaultType, std::vector<DataObject*>& _vecInstances)
+bool ResolveDatasheetObjectInstances(DataParseContext& _kContext, std::string_view _strName, std::string_view _strDefaultType, std::vector<DataObject*>& _vecInstances)
 {
     if (pugi::xml_node node = FindNodeData(_kContext, _strName))
     {
@@ -237,7 +400,7 @@ bool ResolveDatasheetObjectInstances(DataParseContext& _kContext, const std::str
     return false;
 }
 
-DataObject* InstanciateDatasaveObject(DataParseContext& _kContext, const std::string& _strType)
+DataObject* InstanciateDatasaveObject(DataParseContext& _kContext, std::string_view _strType)
 {
     DataObject* instance = GetResources()->InstanciateDataObject(_strType);
     if (instance)
@@ -247,13 +410,13 @@ DataObject* InstanciateDatasaveObject(DataParseContext& _kContext, const std::st
     }
     else
     {
-        GetLogEngine()->Print(ELog::Warning, ELogEngine::Resources, StringFormat("Could not instantiate Datasave Object : {0}", _strType));
+        GetLogEngine()->Print(ELog::Warning, ELogEngine::Resources, StringFormat("Could not instantiate Datasave Object : {0}", std::string(_strType)));
     }
 
     return nullptr;
 }
 
-bool InstanciateDatasaveObject(DataParseContext& _kContext, const std::string& _strName, const std::string& _strDefaultType, DataObject*& _pInstance)
+bool InstanciateDatasaveObject(DataParseContext& _kContext, std::string_view _strName, std::string_view _strDefaultType, DataObject*& _pInstance)
 {
     if (pugi::xml_node pNode = FindNodeData(_kContext, _strName))
     {
@@ -274,7 +437,7 @@ bool InstanciateDatasaveObject(DataParseContext& _kContext, const std::string& _
     return false;
 }
 
-bool InstanciateDatasaveObjects(DataParseContext& _kContext, const std::string& _strName, const std::string& _strDefaultType, std::vector<DataObject*>& _vecInstances)
+bool InstanciateDatasaveObjects(DataParseContext& _kContext, std::string_view _strName, std::string_view _strDefaultType, std::vector<DataObject*>& _vecInstances)
 {
     if (pugi::xml_node node = FindNodeData(_kContext, _strName))
     {
@@ -305,7 +468,7 @@ bool InstanciateDatasaveObjects(DataParseContext& _kContext, const std::string&
     return false;
 }
 
-void WriteDatasaveInstances(DataSaveContext& _kContext, const std::string& _strName, const std::string& _strType, const std::vector<DatasaveObject*>& _pMember)
+void WriteDatasaveInstances(DataSaveContext& _kContext, std::string_view _strName, std::string_view _strType, const std::vector<DatasaveObject*>& _pMember)
 {
     pugi::xml_node* pNodeParent = _kContext.currentNode;
     pugi::xml_node pNode = AddNodeData(_kContext, _strName);
@@ -330,9 +493,252 @@ void WriteDatasaveInstances(DataSaveContext& _kContext, const std::string& _strN
     _kContext.currentNode = pNodeParent;
 }
 
+void WriteBinaryStringValue(DataBinaryWriteContext& context, std::string_view value)
+{
+    WriteBinaryValue(context, (uint32)value.size());
+    context.buffer->insert(context.buffer->end(), value.begin(), value.end());
+}
+
+bool ReadBinaryStringValue(DataBinaryReadContext& context, std::string_view& value)
+{
+    uint32 size = 0;
+    if (!ReadBinaryValue(context, size) || context.size - context.position < size)
+        return false;
+
+    value = std::string_view(reinterpret_cast<const char*>(context.data + context.position), size);
+    context.position += size;
+    return true;
+}
+
+size_t BeginBinaryRecord(DataBinaryWriteContext& context, uint32 tag)
+{
+    WriteBinaryValue(context, tag);
+
+    size_t sizePosition = context.buffer->size();
+    WriteBinaryValue(context, (uint32)0);
+    return sizePosition;
+}
+
+void EndBinaryRecord(DataBinaryWriteContext& context, size_t sizePosition)
+{
+    uint32 size = (uint32)(context.buffer->size() - sizePosition - sizeof(uint32));
+    std::memcpy(context.buffer->data() + sizePosition, &size, sizeof(uint32));
+}
+
+bool ReadBinaryMembers(DataBinaryReadContext& context, DatasaveObject* object)
+{
+    while (true)
+    {
+        uint32 tag = 0;
+        if (!ReadBinaryValue(context, tag))
+            return false;
+
+        if (tag == 0)
+            return true;
+
+        uint32 size = 0;
+        if (!ReadBinaryValue(context, size) || context.size - context.position < size)
+            return false;
+
+        // A member can only read its own record, an unknown tag or a failed read (type change) will skip the record.
+        // A null object will skip all its records (unknown instance type).
+        size_t parentSize = context.size;
+        size_t recordEnd = context.position + size;
+
+        if (object)
+        {
+            context.size = recordEnd;
+            object->DeserializeBinaryMember(context, tag);
+            context.size = parentSize;
+        }
+
+        context.position = recordEnd;
+    }
+}
+
+void WriteBinaryMembers(DataBinaryWriteContext& context, const DatasaveObject* object)
+{
+    object->WriteBinaryRecords(context);
+}
+
+template<typename T, typename R>
+bool ReadBinaryArray(DataBinaryReadContext& context, std::vector<T>& values, const R& readValue)
+{
+    uint32 count = 0;
+    if (!ReadBinaryValue(context, count))
+        return false;
+
+    std::vector<T> result;
+    result.reserve(std::min<size_t>(count, context.size - context.position));
+
+    for (uint32 i = 0; i < count; ++i)
+    {
+        T value{};
+        if (!readValue(context, value))
+            return false;
+
+        result.push_back(value);
+    }
+
+    values.swap(result);
+    return true;
+}
+
+template<typename T, typename W>
+void WriteBinaryArray(DataBinaryWriteContext& context, uint32 tag, const std::vector<T>& values, const W& writeValue)
+{
+    size_t sizePosition = BeginBinaryRecord(context, tag);
+    WriteBinaryValue(context, (uint32)values.size());
+
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        writeValue(context, values[i]);
+    }
+
+    EndBinaryRecord(context, sizePosition);
+}
+
+bool ReadBinaryEnumValues(DataBinaryReadContext& context, const DataEnumTable& enumTable, std::vector<int>& values)
+{
+    uint32 count = 0;
+    if (!ReadBinaryValue(context, count))
+        return false;
+
+    for (uint32 i = 0; i < count; ++i)
+    {
+        std::string_view name;
+        if (!ReadBinaryStringValue(context, name))
+            return false;
+
+        // Unknown values are ignored, as with the xml format.
+        int value = 0;
+        if (FindEnumTableValue(enumTable, name, value))
+        {
+            values.push_back(value);
+        }
+    }
+
+    return true;
+}
+
+void WriteBinaryEnumValues(DataBinaryWriteContext& context, uint32 tag, const DataEnumTable& enumTable, const std::vector<int>& values)
+{
+    size_t sizePosition = BeginBinaryRecord(context, tag);
+
+    size_t countPosition = context.buffer->size();
+    WriteBinaryValue(context, (uint32)0);
+
+    uint32 count = 0;
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        int value = values[i];
+        if (value >= 0 && (size_t)value < enumTable.size)
+        {
+            WriteBinaryStringValue(context, enumTable.names[value]);
+            ++count;
+        }
+    }
+
+    std::memcpy(context.buffer->data() + countPosition, &count, sizeof(uint32));
+    EndBinaryRecord(context, sizePosition);
+}
+
+bool ReadBinaryDatasheetReferences(DataBinaryReadContext& context, std::vector<const DatasheetObject*>& values)
+{
+    return ReadBinaryArray(context, values, [](DataBinaryReadContext& context, const DatasheetObject*& value)
+    {
+        std::string_view resourceId;
+        if (!ReadBinaryStringValue(context, resourceId))
+            return false;
+
+        value = resourceId.empty() ? nullptr : ResolveDatasheetReference(std::string(resourceId));
+        return true;
+    });
+}
+
+void WriteBinaryDatasheetReferences(DataBinaryWriteContext& context, uint32 tag, const std::vector<const DatasheetObject*>& values)
+{
+    WriteBinaryArray(context, tag, values, [](DataBinaryWriteContext& context, const DatasheetObject* value)
+    {
+        const Datasheet* datasheet = value == nullptr ? nullptr : value->GetDatasheet();
+        WriteBinaryStringValue(context, datasheet ? datasheet->GetID() : "");
+    });
+}
+
+bool ReadBinaryDatasaveObject(DataBinaryReadContext& context, DataObject*& instance)
+{
+    instance = nullptr;
+
+    std::string_view instanceType;
+    if (!ReadBinaryStringValue(context, instanceType))
+        return false;
+
+    if (instanceType.empty())
+        return true;
+
+    DataObject* dataObject = GetResources()->InstanciateDataObject(instanceType);
+    DatasaveObject* datasaveObject = dynamic_cast<DatasaveObject*>(dataObject);
+    if (!datasaveObject)
+    {
+        GetLogEngine()->Print(ELog::Warning, ELogEngine::Resources, StringFormat("Could not instantiate Datasave Object : {0}", std::string(instanceType)));
+        SafeDelete(dataObject);
+    }
+
+    if (!ReadBinaryMembers(context, datasaveObject))
+    {
+        SafeDelete(datasaveObject);
+        return false;
+    }
+
+    instance = datasaveObject;
+    return true;
+}
+
+bool ReadBinaryDatasaveObjects(DataBinaryReadContext& context, std::vector<DataObject*>& instances)
+{
+    uint32 count = 0;
+    if (!ReadBinaryValue(context, count))
+        return false;
+
+    std::vector<DataObject*> result;
+    result.reserve(std::min<size_t>(count, context.size - context.position));
+
+    for (uint32 i = 0; i < count; ++i)
+    {
+        // Instance can be null.
+        DataObject* instance = nullptr;
+        if (!ReadBinaryDatasaveObject(context, instance))
+        {
+            ClearStdVector(result);
+            return false;
+        }
+
+        result.push_back(instance);
+    }
+
+    instances.swap(result);
+    return true;
+}
+
+void WriteBinaryDatasaveObjects(DataBinaryWriteContext& context, uint32 tag, const std::vector<DatasaveObject*>& instances)
+{
+    WriteBinaryArray(context, tag, instances, [](DataBinaryWriteContext& context, const DatasaveObject* value)
+    {
+        if (value)
+        {
+            WriteBinaryStringValue(context, value->GetDataInstanceType());
+            WriteBinaryMembers(context, value);
+        }
+        else
+        {
+            WriteBinaryStringValue(context, "");
+        }
+    });
+}
+
 }   // namespace impl
 
-void ReadString(DataParseContext& context, const std::string& name, std::string& value)
+void ReadString(DataParseContext& context, std::string_view name, std::string& value)
 {
     if (pugi::xml_node node = impl::FindNodeData(context, name))
     {
@@ -340,7 +746,7 @@ void ReadString(DataParseContext& context, const std::string& name, std::string&
     }
 }
 
-void ReadInt(DataParseContext& context, const std::string& name, int& value)
+void ReadInt(DataParseContext& context, std::string_view name, int& value)
 {
     if (pugi::xml_node node = impl::FindNodeData(context, name))
     {
@@ -348,7 +754,7 @@ void ReadInt(DataParseContext& context, const std::string& name, int& value)
     }
 }
 
-void ReadFloat(DataParseContext& context, const std::string& name, float& value)
+void ReadFloat(DataParseContext& context, std::string_view name, float& value)
 {
     if (pugi::xml_node node = impl::FindNodeData(context, name))
     {
@@ -356,7 +762,7 @@ void ReadFloat(DataParseContext& context, const std::string& name, float& value)
     }
 }
 
-void ReadBool(DataParseContext& context, const std::string& name, bool& value)
+void ReadBool(DataParseContext& context, std::string_view name, bool& value)
 {
     if (pugi::xml_node node = impl::FindNodeData(context, name))
     {
@@ -364,16 +770,24 @@ void ReadBool(DataParseContext& context, const std::string& name, bool& value)
     }
 }
 
-void ReadLocalizedString(DataParseContext& context, const std::string& name, LocalizedString& value)
+void ReadLocalizedString(DataParseContext& context, std::string_view name, LocalizedString& value)
+{
+    if (pugi::xml_node node = impl::FindNodeData(context, name))
+    {
+        value.workstring = node.attribute("value").as_string(value.workstring.GetCString());
+        value.key = node.child("Localization").attribute("key").as_string(value.key.GetCString());
+    }
+}
+
+void ReadInternedString(DataParseContext& context, std::string_view name, InternedString& value)
 {
     if (pugi::xml_node node = impl::FindNodeData(context, name))
     {
-        value.workstring = node.attribute("value").as_string(value.workstring.c_str());
-        value.key = node.child("Localization").attribute("key").as_string(value.key.c_str());
+        value = node.attribute("value").as_string(value.GetCString());
     }
 }
 
-void ReadStringArray(DataParseContext& context, const std::string& name, std::vector<std::string>& values)
+void ReadStringArray(DataParseContext& context, std::string_view name, std::vector<std::string>& values)
 {
     if (pugi::xml_node node = impl::FindNodeData(context, name))
     {
@@ -386,7 +800,7 @@ void ReadStringArray(DataParseContext& context, const std::string& name, std::ve
     }
 }
 
-void ReadIntArray(DataParseContext& context, const std::string& name, std::vector<int>& values)
+void ReadIntArray(DataParseContext& context, std::string_view name, std::vector<int>& values)
 {
     if (pugi::xml_node node = impl::FindNodeData(context, name))
     {
@@ -399,7 +813,7 @@ void ReadIntArray(DataParseContext& context, const std::string& name, std::vecto
     }
 }
 
-void ReadFloatArray(DataParseContext& context, const std::string& name, std::vector<float>& values)
+void ReadFloatArray(DataParseContext& context, std::string_view name, std::vector<float>& values)
 {
     if (pugi::xml_node node = impl::FindNodeData(context, name))
     {
@@ -412,7 +826,7 @@ void ReadFloatArray(DataParseContext& context, const std::string& name, std::vec
     }
 }
 
-void ReadBoolArray(DataParseContext& context, const std::string& name, std::vector<bool>& values)
+void ReadBoolArray(DataParseContext& context, std::string_view name, std::vector<bool>& values)
 {
     if (pugi::xml_node node = impl::FindNodeData(context, name))
     {
@@ -425,27 +839,40 @@ void ReadBoolArray(DataParseContext& context, const std::string& name, std::vect
     }
 }
 
-void WriteString(DataSaveContext& _kContext, const std::string& _strName, const std::string& _strMember)
+void ReadInternedStringArray(DataParseContext& context, std::string_view name, std::vector<InternedString>& values)
+{
+    if (pugi::xml_node node = impl::FindNodeData(context, name))
+    {
+        values.clear();
+
+        for (pugi::xml_node child = node.child("Child"); child; child = child.next_sibling("Child"))
+        {
+            values.push_back(InternedString(child.attribute("value").as_string("")));
+        }
+    }
+}
+
+void WriteString(DataSaveContext& _kContext, std::string_view _strName, const std::string& _strMember)
 {
     impl::AddNodeData(_kContext, _strName).append_attribute("value").set_value(_strMember.c_str());
 }
 
-void WriteInt(DataSaveContext& _kContext, const std::string& _strName, int _iMember)
+void WriteInt(DataSaveContext& _kContext, std::string_view _strName, int _iMember)
 {
     impl::AddNodeData(_kContext, _strName).append_attribute("value").set_value(_iMember);
 }
 
-void WriteFloat(DataSaveContext& _kContext, const std::string& _strName, float _fMember)
+void WriteFloat(DataSaveContext& _kContext, std::string_view _strName, float _fMember)
 {
     impl::AddNodeData(_kContext, _strName).append_attribute("value").set_value(_fMember);
 }
 
-void WriteBool(DataSaveContext& _kContext, const std::string& _strName, bool _bMember)
+void WriteBool(DataSaveContext& _kContext, std::string_view _strName, bool _bMember)
 {
     impl::AddNodeData(_kContext, _strName).append_attribute("value").set_value(_bMember);
 }
 
-void WriteStringArray(DataSaveContext& _kContext, const std::string& _strName, const std::vector<std::string>& _vecMember)
+void WriteStringArray(DataSaveContext& _kContext, std::string_view _strName, const std::vector<std::string>& _vecMember)
 {
     pugi::xml_node pNode = impl::AddNodeData(_kContext, _strName);
 
@@ -455,7 +882,7 @@ void WriteStringArray(DataSaveContext& _kContext, const std::string& _strName, c
     }
 }
 
-void WriteIntArray(DataSaveContext& _kContext, const std::string& _strName, const std::vector<int>& _vecMember)
+void WriteIntArray(DataSaveContext& _kContext, std::string_view _strName, const std::vector<int>& _vecMember)
 {
     pugi::xml_node pNode = impl::AddNodeData(_kContext, _strName);
 
@@ -465,7 +892,7 @@ void WriteIntArray(DataSaveContext& _kContext, const std::string& _strName, cons
     }
 }
 
-void WriteFloatArray(DataSaveContext& _kContext, const std::string& _strName, const std::vector<float>& _vecMember)
+void WriteFloatArray(DataSaveContext& _kContext, std::string_view _strName, const std::vector<float>& _vecMember)
 {
     pugi::xml_node pNode = impl::AddNodeData(_kContext, _strName);
 
@@ -475,7 +902,7 @@ void WriteFloatArray(DataSaveContext& _kContext, const std::string& _strName, co
     }
 }
 
-void WriteBoolArray(DataSaveContext& _kContext, const std::string& _strName, const std::vector<bool>& _vecMember)
+void WriteBoolArray(DataSaveContext& _kContext, std::string_view _strName, const std::vector<bool>& _vecMember)
 {
     pugi::xml_node pNode = impl::AddNodeData(_kContext, _strName);
 
@@ -485,7 +912,7 @@ void WriteBoolArray(DataSaveContext& _kContext, const std::string& _strName, con
     }
 }
 
-void ReadVector2(DataParseContext& context, const std::string& name, Vector2i& value)
+void ReadVector2(DataParseContext& context, std::string_view name, Vector2i& value)
 {
     if (pugi::xml_node node = impl::FindNodeData(context, name))
     {
@@ -493,7 +920,7 @@ void ReadVector2(DataParseContext& context, const std::string& name, Vector2i& v
     }
 }
 
-void ReadVector2(DataParseContext& context, const std::string& name, Vector2f& value)
+void ReadVector2(DataParseContext& context, std::string_view name, Vector2f& value)
 {
     if (pugi::xml_node node = impl::FindNodeData(context, name))
     {
@@ -501,7 +928,7 @@ void ReadVector2(DataParseContext& context, const std::string& name, Vector2f& v
     }
 }
 
-void ReadVector2Array(DataParseContext& context, const std::string& name, std::vector<Vector2i>& values)
+void ReadVector2Array(DataParseContext& context, std::string_view name, std::vector<Vector2i>& values)
 {
     if (pugi::xml_node node = impl::FindNodeData(context, name))
     {
@@ -514,7 +941,7 @@ void ReadVector2Array(DataParseContext& context, const std::string& name, std::v
     }
 }
 
-void ReadVector2Array(DataParseContext& context, const std::string& name, std::vector<Vector2f>& values)
+void ReadVector2Array(DataParseContext& context, std::string_view name, std::vector<Vector2f>& values)
 {
     if (pugi::xml_node node = impl::FindNodeData(context, name))
     {
@@ -527,17 +954,17 @@ void ReadVector2Array(DataParseContext& context, const std::string& name, std::v
     }
 }
 
-void WriteVector2(DataSaveContext& context, const std::string& name, const Vector2i& value)
+void WriteVector2(DataSaveContext& context, std::string_view name, const Vector2i& value)
 {
     xml::WriteVector2i(impl::AddNodeData(context, name), value);
 }
 
-void WriteVector2(DataSaveContext& context, const std::string& name, const Vector2f& value)
+void WriteVector2(DataSaveContext& context, std::string_view name, const Vector2f& value)
 {
     xml::WriteVector2f(impl::AddNodeData(context, name), value);
 }
 
-void WriteVector2Array(DataSaveContext& context, const std::string& name, const std::vector<Vector2i>& values)
+void WriteVector2Array(DataSaveContext& context, std::string_view name, const std::vector<Vector2i>& values)
 {
     pugi::xml_node node = impl::AddNodeData(context, name);
 
@@ -547,7 +974,7 @@ void WriteVector2Array(DataSaveContext& context, const std::string& name, const
     }
 }
 
-void WriteVector2Array(DataSaveContext& context, const std::string& name, const std::vector<Vector2f>& values)
+void WriteVector2Array(DataSaveContext& context, std::string_view name, const std::vector<Vector2f>& values)
 {
     pugi::xml_node node = impl::AddNodeData(context, name);
 
@@ -557,7 +984,7 @@ void WriteVector2Array(DataSaveContext& context, const std::string& name, const
     }
 }
 
-void WriteDatasheetReference(DataSaveContext& _kContext, const std::string& _strName, const DatasheetObject* _pMember)
+void WriteDatasheetReference(DataSaveContext& _kContext, std::string_view _strName, const DatasheetObject* _pMember)
 {
     pugi::xml_node pNode = impl::AddNodeData(_kContext, _strName);
 
@@ -572,7 +999,7 @@ void WriteDatasheetReference(DataSaveContext& _kContext, const std::string& _str
     }
 }
 
-void WriteDatasaveInstance(DataSaveContext& _kContext, const std::string& _strName, const std::string& _strType, const DatasaveObject* _pMember)
+void WriteDatasaveInstance(DataSaveContext& _kContext, std::string_view _strName, std::string_view _strType, const DatasaveObject* _pMember)
 {
     pugi::xml_node pNode = impl::AddNodeData(_kContext, _strName);
 
@@ -593,6 +1020,209 @@ void WriteDatasaveInstance(DataSaveContext& _kContext, const std::string& _strNa
     }
 }
 
+bool ReadBinaryString(DataBinaryReadContext& context, std::string& value)
+{
+    std::string_view binaryValue;
+    if (!impl::ReadBinaryStringValue(context, binaryValue))
+        return false;
+
+    value.assign(binaryValue);
+    return true;
+}
+
+bool ReadBinaryInt(DataBinaryReadContext& context, int& value)
+{
+    int32 binaryValue = 0;
+    if (!impl::ReadBinaryValue(context, binaryValue))
+        return false;
+
+    value = binaryValue;
+    return true;
+}
+
+bool ReadBinaryFloat(DataBinaryReadContext& context, float& value)
+{
+    return impl::ReadBinaryValue(context, value);
+}
+
+bool ReadBinaryBool(DataBinaryReadContext& context, bool& value)
+{
+    uint8 binaryValue = 0;
+    if (!impl::ReadBinaryValue(context, binaryValue))
+        return false;
+
+    value = binaryValue != 0;
+    return true;
+}
+
+bool ReadBinaryVector2(DataBinaryReadContext& context, Vector2i& value)
+{
+    int32 x = 0;
+    int32 y = 0;
+    if (!impl::ReadBinaryValue(context, x) || !impl::ReadBinaryValue(context, y))
+        return false;
+
+    value = Vector2i(x, y);
+    return true;
+}
+
+bool ReadBinaryVector2(DataBinaryReadContext& context, Vector2f& value)
+{
+    float x = 0.f;
+    float y = 0.f;
+    if (!impl::ReadBinaryValue(context, x) || !impl::ReadBinaryValue(context, y))
+        return false;
+
+    value = Vector2f(x, y);
+    return true;
+}
+
+bool ReadBinaryStringArray(DataBinaryReadContext& context, std::vector<std::string>& values)
+{
+    return impl::ReadBinaryArray(context, values, [](DataBinaryReadContext& context, std::string& value) { return ReadBinaryString(context, value); });
+}
+
+bool ReadBinaryIntArray(DataBinaryReadContext& context, std::vector<int>& values)
+{
+    return impl::ReadBinaryArray(context, values, [](DataBinaryReadContext& context, int& value) { return ReadBinaryInt(context, value); });
+}
+
+bool ReadBinaryFloatArray(DataBinaryReadContext& context, std::vector<float>& values)
+{
+    return impl::ReadBinaryArray(context, values, [](DataBinaryReadContext& context, float& value) { return ReadBinaryFloat(context, value); });
+}
+
+bool ReadBinaryBoolArray(DataBinaryReadContext& context, std::vector<bool>& values)
+{
+    return impl::ReadBinaryArray(context, values, [](DataBinaryReadContext& context, bool& value) { return ReadBinaryBool(context, value); });
+}
+
+bool ReadBinaryVector2Array(DataBinaryReadContext& context, std::vector<Vector2i>& values)
+{
+    return impl::ReadBinaryArray(context, values, [](DataBinaryReadContext& context, Vector2i& value) { return ReadBinaryVector2(context, value); });
+}
+
+bool ReadBinaryVector2Array(DataBinaryReadContext& context, std::vector<Vector2f>& values)
+{
+    return impl::ReadBinaryArray(context, values, [](DataBinaryReadContext& context, Vector2f& value) { return ReadBinaryVector2(context, value); });
+}
+
+void WriteBinaryString(DataBinaryWriteContext& context, uint32 tag, const std::string& value)
+{
+    size_t sizePosition = impl::BeginBinaryRecord(context, tag);
+    impl::WriteBinaryStringValue(context, value);
+    impl::EndBinaryRecord(context, sizePosition);
+}
+
+void WriteBinaryInt(DataBinaryWriteContext& context, uint32 tag, int value)
+{
+    size_t sizePosition = impl::BeginBinaryRecord(context, tag);
+    impl::WriteBinaryValue(context, (int32)value);
+    impl::EndBinaryRecord(context, sizePosition);
+}
+
+void WriteBinaryFloat(DataBinaryWriteContext& context, uint32 tag, float value)
+{
+    size_t sizePosition = impl::BeginBinaryRecord(context, tag);
+    impl::WriteBinaryValue(context, value);
+    impl::EndBinaryRecord(context, sizePosition);
+}
+
+void WriteBinaryBool(DataBinaryWriteContext& context, uint32 tag, bool value)
+{
+    size_t sizePosition = impl::BeginBinaryRecord(context, tag);
+    impl::WriteBinaryValue(context, (uint8)(value ? 1 : 0));
+    impl::EndBinaryRecord(context, sizePosition);
+}
+
+void WriteBinaryVector2(DataBinaryWriteContext& context, uint32 tag, const Vector2i& value)
+{
+    size_t sizePosition = impl::BeginBinaryRecord(context, tag);
+    impl::WriteBinaryValue(context, (int32)value.x);
+    impl::WriteBinaryValue(context, (int32)value.y);
+    impl::EndBinaryRecord(context, sizePosition);
+}
+
+void WriteBinaryVector2(DataBinaryWriteContext& context, uint32 tag, const Vector2f& value)
+{
+    size_t sizePosition = impl::BeginBinaryRecord(context, tag);
+    impl::WriteBinaryValue(context, value.x);
+    impl::WriteBinaryValue(context, value.y);
+    impl::EndBinaryRecord(context, sizePosition);
+}
+
+void WriteBinaryStringArray(DataBinaryWriteContext& context, uint32 tag, const std::vector<std::string>& values)
+{
+    impl::WriteBinaryArray(context, tag, values, [](DataBinaryWriteContext& context, const std::string& value) { impl::WriteBinaryStringValue(context, value); });
+}
+
+void WriteBinaryIntArray(DataBinaryWriteContext& context, uint32 tag, const std::vector<int>& values)
+{
+    impl::WriteBinaryArray(context, tag, values, [](DataBinaryWriteContext& context, int value) { impl::WriteBinaryValue(context, (int32)value); });
+}
+
+void WriteBinaryFloatArray(DataBinaryWriteContext& context, uint32 tag, const std::vector<float>& values)
+{
+    impl::WriteBinaryArray(context, tag, values, [](DataBinaryWriteContext& context, float value) { impl::WriteBinaryValue(context, value); });
+}
+
+void WriteBinaryBoolArray(DataBinaryWriteContext& context, uint32 tag, const std::vector<bool>& values)
+{
+    impl::WriteBinaryArray(context, tag, values, [](DataBinaryWriteContext& context, bool value) { impl::WriteBinaryValue(context, (uint8)(value ? 1 : 0)); });
+}
+
+void WriteBinaryVector2Array(DataBinaryWriteContext& context, uint32 tag, const std::vector<Vector2i>& values)
+{
+    impl::WriteBinaryArray(context, tag, values, [](DataBinaryWriteContext& context, const Vector2i& value)
+    {
+        impl::WriteBinaryValue(context, (int32)value.x);
+        impl::WriteBinaryValue(context, (int32)value.y);
+    });
+}
+
+void WriteBinaryVector2Array(DataBinaryWriteContext& context, uint32 tag, const std::vector<Vector2f>& values)
+{
+    impl::WriteBinaryArray(context, tag, values, [](DataBinaryWriteContext& context, const Vector2f& value)
+    {
+        impl::WriteBinaryValue(context, value.x);
+        impl::WriteBinaryValue(context, value.y);
+    });
+}
+
+void WriteBinaryDatasheetReference(DataBinaryWriteContext& context, uint32 tag, const DatasheetObject* value)
+{
+    const Datasheet* datasheet = value == nullptr ? nullptr : value->GetDatasheet();
+
+    size_t sizePosition = impl::BeginBinaryRecord(context, tag);
+    impl::WriteBinaryStringValue(context, datasheet ? datasheet->GetID() : "");
+    impl::EndBinaryRecord(context, sizePosition);
+}
+
+void WriteBinaryDatasaveInstance(DataBinaryWriteContext& context, uint32 tag, const DatasaveObject* value)
+{
+    size_t sizePosition = impl::BeginBinaryRecord(context, tag);
+
+    if (value)
+    {
+        impl::WriteBinaryStringValue(context, value->GetDataInstanceType());
+        impl::WriteBinaryMembers(context, value);
+    }
+    else
+    {
+        impl::WriteBinaryStringValue(context, "");
+    }
+
+    impl::EndBinaryRecord(context, sizePosition);
+}
+
+void GatherDatasaveInstance(std::vector<const DatasaveObject*>& instances, const DatasaveObject* value)
+{
+    if (value)
+    {
+        instances.push_back(value);
+    }
+}
+
 }   // namespace binding
 
 }   // namespace gugu
@@ -3,13 +3,18 @@
 ////////////////////////////////////////////////////////////////
 // Includes
 
+#include "Gugu/Data/DataObjectArena.h"
 #include "Gugu/Data/LocalizedString.h"
 #include "Gugu/Math/Vector2.h"
+#include "Gugu/System/StringTable.h"
 #include "Gugu/System/UUID.h"
+#include "Gugu/System/Types.h"
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <map>
+#include <cstring>
 
 ////////////////////////////////////////////////////////////////
 // Forward Declarations
@@ -24,6 +29,7 @@ namespace gugu
 namespace pugi
 {
     class xml_node;
+    struct xml_node_struct;
 }
 
 ////////////////////////////////////////////////////////////////
@@ -31,10 +37,28 @@ namespace pugi
 
 namespace gugu {
 
+// Index of the data nodes contained in an object node, sorted by name hash.
+// - Built once per parsed node, to avoid a linear search of the children for every member.
+// - Narrow objects are not sorted, their data nodes are kept in document order and searched linearly.
+struct DataMemberIndex
+{
+    const pugi::xml_node_struct* indexedNode = nullptr;
+    bool isSorted = false;
+    std::vector<std::pair<uint64, pugi::xml_node_struct*>> dataNodes;
+};
+
 struct DataParseContext
 {
     pugi::xml_node* currentNode;
     const std::map<UUID, DataObject*>* objectByUUID;
+
+    // Stack of indices for the current node and its ancestors, the parent index is kept while parsing a child object.
+    // - Entries above memberIndexCount are unused, their storage is reused by the next child object.
+    std::vector<DataMemberIndex> memberIndices;
+    size_t memberIndexCount = 0;
+
+    // Below this count of data nodes, hashing and sorting the names costs more than a linear search.
+    size_t sortedIndexMinSize = 12;
 };
 
 struct DataSaveContext
@@ -42,150 +66,319 @@ struct DataSaveContext
     pugi::xml_node* currentNode;
 };
 
+// Binary datasave contexts.
+// - Object members are stored as tagged records (tag, size, payload), and terminated by a null tag.
+// - Unknown tags are skipped, and missing tags keep their default values, to stay compatible across binding changes.
+struct DataBinaryReadContext
+{
+    const uint8* data = nullptr;
+    size_t size = 0;        // Readable size, restricted to the end of the current record while reading a member.
+    size_t position = 0;
+};
+
+// Buffer range of a nested instance, used by incremental saves to cache each object records without the records of its instances.
+struct DataBinaryInstanceRecord
+{
+    const DatasaveObject* instance = nullptr;
+    size_t start = 0;
+    size_t end = 0;
+};
+
+struct DataBinaryWriteContext
+{
+    std::vector<uint8>* buffer = nullptr;
+    bool incremental = false;   // Reuse the serialized data of objects that are not dirty.
+    size_t reusedSize = 0;
+    std::vector<DataBinaryInstanceRecord>* instanceRecords = nullptr;   // Incremental : instances written by the object being serialized.
+};
+
 struct DataEnumInfos
 {
     std::vector<std::string> values;    //TODO: Store both string and enum values
 };
 
+// Constant table of enum names, generated by the binding tool.
+// - Names are indexed by enum value, and point to null-terminated literals.
+// - Sorted values list the enum values ordered by name, for binary searches.
+struct DataEnumTable
+{
+    const std::string_view* names;
+    const int* sortedValues;
+    size_t size;
+};
+
 namespace binding {
 
+// Member and type names are passed as views : generated code uses literals, without temporary strings.
+
 //----------------------------------------------
 // Read base types
 
-void ReadString(DataParseContext& _kContext, const std::string& _strName, std::string& _strMember);
-void ReadInt(DataParseContext& _kContext, const std::string& _strName, int& _iMember);
-void ReadFloat(DataParseContext& _kContext, const std::string& _strName, float& _fMember);
-void ReadBool(DataParseContext& _kContext, const std::string& _strName, bool& _bMember);
+void ReadString(DataParseContext& _kContext, std::string_view _strName, std::string& _strMember);
+void ReadInt(DataParseContext& _kContext, std::string_view _strName, int& _iMember);
+void ReadFloat(DataParseContext& _kContext, std::string_view _strName, float& _fMember);
+void ReadBool(DataParseContext& _kContext, std::string_view _strName, bool& _bMember);
 
-void ReadLocalizedString(DataParseContext& _kContext, const std::string& _strName, LocalizedString& _strMember);
+void ReadLocalizedString(DataParseContext& _kContext, std::string_view _strName, LocalizedString& _strMember);
+void ReadInternedString(DataParseContext& _kContext, std::string_view _strName, InternedString& _strMember);
 
-void ReadStringArray(DataParseContext& _kContext, const std::string& _strName, std::vector<std::string>& _vecMember);
-void ReadIntArray(DataParseContext& _kContext, const std::string& _strName, std::vector<int>& _vecMember);
-void ReadFloatArray(DataParseContext& _kContext, const std::string& _strName, std::vector<float>& _vecMember);
-void ReadBoolArray(DataParseContext& _kContext, const std::string& _strName, std::vector<bool>& _vecMember);
+void ReadStringArray(DataParseContext& _kContext, std::string_view _strName, std::vector<std::string>& _vecMember);
+void ReadIntArray(DataParseContext& _kContext, std::string_view _strName, std::vector<int>& _vecMember);
+void ReadFloatArray(DataParseContext& _kContext, std::string_view _strName, std::vector<float>& _vecMember);
+void ReadBoolArray(DataParseContext& _kContext, std::string_view _strName, std::vector<bool>& _vecMember);
+void ReadInternedStringArray(DataParseContext& _kContext, std::string_view _strName, std::vector<InternedString>& _vecMember);
 
 //----------------------------------------------
 // Write base types
 
-void WriteString(DataSaveContext& _kContext, const std::string& _strName, const std::string& _strMember);
-void WriteInt(DataSaveContext& _kContext, const std::string& _strName, int _iMember);
-void WriteFloat(DataSaveContext& _kContext, const std::string& _strName, float _fMember);
-void WriteBool(DataSaveContext& _kContext, const std::string& _strName, bool _bMember);
+void WriteString(DataSaveContext& _kContext, std::string_view _strName, const std::string& _strMember);
+void WriteInt(DataSaveContext& _kContext, std::string_view _strName, int _iMember);
+void WriteFloat(DataSaveContext& _kContext, std::string_view _strName, float _fMember);
+void WriteBool(DataSaveContext& _kContext, std::string_view _strName, bool _bMember);
 
-void WriteStringArray(DataSaveContext& _kContext, const std::string& _strName, const std::vector<std::string>& _vecMember);
-void WriteIntArray(DataSaveContext& _kContext, const std::string& _strName, const std::vector<int>& _vecMember);
-void WriteFloatArray(DataSaveContext& _kContext, const std::string& _strName, const std::vector<float>& _vecMember);
-void WriteBoolArray(DataSaveContext& _kContext, const std::string& _strName, const std::vector<bool>& _vecMember);
+void WriteStringArray(DataSaveContext& _kContext, std::string_view _strName, const std::vector<std::string>& _vecMember);
+void WriteIntArray(DataSaveContext& _kContext, std::string_view _strName, const std::vector<int>& _vecMember);
+void WriteFloatArray(DataSaveContext& _kContext, std::string_view _strName, const std::vector<float>& _vecMember);
+void WriteBoolArray(DataSaveContext& _kContext, std::string_view _strName, const std::vector<bool>& _vecMember);
 
 //----------------------------------------------
 // Read enums
 
 template<typename T>
-void ReadEnum(DataParseContext& _kContext, const std::string& _strName, const std::string& _strType, T& _eMember);
+void ReadEnum(DataParseContext& _kContext, std::string_view _strName, std::string_view _strType, T& _eMember);
 
 template<typename T>
-void ReadEnumArray(DataParseContext& _kContext, const std::string& _strName, const std::string& _strType, std::vector<T>& _vecMember);
+void ReadEnumArray(DataParseContext& _kContext, std::string_view _strName, std::string_view _strType, std::vector<T>& _vecMember);
+
+// Enum readers using a generated table, without a lookup of the registered enum infos.
+template<typename T>
+void ReadEnum(DataParseContext& context, std::string_view name, const DataEnumTable& enumTable, T& value);
+
+template<typename T>
+void ReadEnumArray(DataParseContext& context, std::string_view name, const DataEnumTable& enumTable, std::vector<T>& values);
 
 //----------------------------------------------
 // Write enums
 
 template<typename T>
-void WriteEnum(DataSaveContext& _kContext, const std::string& _strName, const std::string& _strType, T _eMember);
+void WriteEnum(DataSaveContext& _kContext, std::string_view _strName, std::string_view _strType, T _eMember);
 
 template<typename T>
-void WriteEnumArray(DataSaveContext& _kContext, const std::string& _strName, const std::string& _strType, const std::vector<T>& _vecMember);
+void WriteEnumArray(DataSaveContext& _kContext, std::string_view _strName, std::string_view _strType, const std::vector<T>& _vecMember);
+
+// Enum writers using a generated table, without a lookup of the registered enum infos.
+template<typename T>
+void WriteEnum(DataSaveContext& context, std::string_view name, const DataEnumTable& enumTable, T value);
+
+template<typename T>
+void WriteEnumArray(DataSaveContext& context, std::string_view name, const DataEnumTable& enumTable, const std::vector<T>& values);
 
 //----------------------------------------------
 // Read Vector2
 
 // TODO: Move with basic types.
-void ReadVector2(DataParseContext& context, const std::string& name, Vector2i& value);
-void ReadVector2(DataParseContext& context, const std::string& name, Vector2f& value);
+void ReadVector2(DataParseContext& context, std::string_view name, Vector2i& value);
+void ReadVector2(DataParseContext& context, std::string_view name, Vector2f& value);
 
-void ReadVector2Array(DataParseContext& context, const std::string& name, std::vector<Vector2i>& values);
-void ReadVector2Array(DataParseContext& context, const std::string& name, std::vector<Vector2f>& values);
+void ReadVector2Array(DataParseContext& context, std::string_view name, std::vector<Vector2i>& values);
+void ReadVector2Array(DataParseContext& context, std::string_view name, std::vector<Vector2f>& values);
 
 //----------------------------------------------
 // Write Vector2    
 
 // TODO: Move with basic types.
-void WriteVector2(DataSaveContext& context, const std::string& name, const Vector2i& value);
-void WriteVector2(DataSaveContext& context, const std::string& name, const Vector2f& value);
+void WriteVector2(DataSaveContext& context, std::string_view name, const Vector2i& value);
+void WriteVector2(DataSaveContext& context, std::string_view name, const Vector2f& value);
 
-void WriteVector2Array(DataSaveContext& context, const std::string& name, const std::vector<Vector2i>& values);
-void WriteVector2Array(DataSaveContext& context, const std::string& name, const std::vector<Vector2f>& values);
+void WriteVector2Array(DataSaveContext& context, std::string_view name, const std::vector<Vector2i>& values);
+void WriteVector2Array(DataSaveContext& context, std::string_view name, const std::vector<Vector2f>& values);
 
 //----------------------------------------------
 // Read datasheet references
 
 template<typename T>
-void ReadDatasheetReference(DataParseContext& _kContext, const std::string& _strName, const T*& _pMember);
+void ReadDatasheetReference(DataParseContext& _kContext, std::string_view _strName, const T*& _pMember);
+
+template<typename T>
+void ReadDatasheetReferenceArray(DataParseContext& _kContext, std::string_view _strName, std::vector<const T*>& _vecMember);
+
+// Compact references, used by classes generated with the arena storage.
+template<typename T>
+void ReadDatasheetReference(DataParseContext& context, std::string_view name, DataArenaRef<T>& member);
 
 template<typename T>
-void ReadDatasheetReferenceArray(DataParseContext& _kContext, const std::string& _strName, std::vector<const T*>& _vecMember);
+void ReadDatasheetReferenceArray(DataParseContext& context, std::string_view name, std::vector<DataArenaRef<T>>& members);
 
 //----------------------------------------------
 // Write datasheet references
 
-void WriteDatasheetReference(DataSaveContext& _kContext, const std::string& _strName, const DatasheetObject* _pMember);
+void WriteDatasheetReference(DataSaveContext& _kContext, std::string_view _strName, const DatasheetObject* _pMember);
 
 template<typename T>
-void WriteDatasheetReferenceArray(DataSaveContext& _kContext, const std::string& _strName, const std::vector<const T*>& _pMember);
+void WriteDatasheetReferenceArray(DataSaveContext& _kContext, std::string_view _strName, const std::vector<const T*>& _pMember);
 
 //----------------------------------------------
 // Read datasheet instances
 
 template<typename T>
-void ReadDatasheetInstance(DataParseContext& _kContext, const std::string& _strName, const std::string& _strType, const T*& _pMember);
+void ReadDatasheetInstance(DataParseContext& _kContext, std::string_view _strName, std::string_view _strType, const T*& _pMember);
 
 template<typename T>
-void ReadDatasheetInstanceArray(DataParseContext& _kContext, const std::string& _strName, const std::string& _strType, std::vector<const T*>& _vecMember);
+void ReadDatasheetInstanceArray(DataParseContext& _kContext, std::string_view _strName, std::string_view _strType, std::vector<const T*>& _vecMember);
 
 //----------------------------------------------
 // Read datasave instances
 
 template<typename T>
-void ReadDatasaveInstance(DataParseContext& _kContext, const std::string& _strName, const std::string& _strType, T*& _pMember);
+void ReadDatasaveInstance(DataParseContext& _kContext, std::string_view _strName, std::string_view _strType, T*& _pMember);
 
 template<typename T>
-void ReadDatasaveInstanceArray(DataParseContext& _kContext, const std::string& _strName, const std::string& _strType, std::vector<T*>& _vecMember);
+void ReadDatasaveInstanceArray(DataParseContext& _kContext, std::string_view _strName, std::string_view _strType, std::vector<T*>& _vecMember);
 
 //----------------------------------------------
 // Write datasave instances
 
-void WriteDatasaveInstance(DataSaveContext& _kContext, const std::string& _strName, const std::string& _strType, const DatasaveObject* _pMember);
+void WriteDatasaveInstance(DataSaveContext& _kContext, std::string_view _strName, std::string_view _strType, const DatasaveObject* _pMember);
 
 template<typename T>
-void WriteDatasaveInstanceArray(DataSaveContext& _kContext, const std::string& _strName, const std::string& _strType, const std::vector<T*>& _pMember);
+void WriteDatasaveInstanceArray(DataSaveContext& _kContext, std::string_view _strName, std::string_view _strType, const std::vector<T*>& _pMember);
+
+//----------------------------------------------
+// Read binary values
+
+bool ReadBinaryString(DataBinaryReadContext& context, std::string& value);
+bool ReadBinaryInt(DataBinaryReadContext& context, int& value);
+bool ReadBinaryFloat(DataBinaryReadContext& context, float& value);
+bool ReadBinaryBool(DataBinaryReadContext& context, bool& value);
+bool ReadBinaryVector2(DataBinaryReadContext& context, Vector2i& value);
+bool ReadBinaryVector2(DataBinaryReadContext& context, Vector2f& value);
+
+bool ReadBinaryStringArray(DataBinaryReadContext& context, std::vector<std::string>& values);
+bool ReadBinaryIntArray(DataBinaryReadContext& context, std::vector<int>& values);
+bool ReadBinaryFloatArray(DataBinaryReadContext& context, std::vector<float>& values);
+bool ReadBinaryBoolArray(DataBinaryReadContext& context, std::vector<bool>& values);
+bool ReadBinaryVector2Array(DataBinaryReadContext& context, std::vector<Vector2i>& values);
+bool ReadBinaryVector2Array(DataBinaryReadContext& context, std::vector<Vector2f>& values);
+
+template<typename T>
+bool ReadBinaryEnum(DataBinaryReadContext& context, const DataEnumTable& enumTable, T& value);
+
+template<typename T>
+bool ReadBinaryEnumArray(DataBinaryReadContext& context, const DataEnumTable& enumTable, std::vector<T>& values);
+
+template<typename T>
+bool ReadBinaryDatasheetReference(DataBinaryReadContext& context, const T*& value);
+
+template<typename T>
+bool ReadBinaryDatasheetReferenceArray(DataBinaryReadContext& context, std::vector<const T*>& values);
+
+template<typename T>
+bool ReadBinaryDatasaveInstance(DataBinaryReadContext& context, T*& value);
+
+template<typename T>
+bool ReadBinaryDatasaveInstanceArray(DataBinaryReadContext& context, std::vector<T*>& values);
+
+//----------------------------------------------
+// Write binary values
+
+void WriteBinaryString(DataBinaryWriteContext& context, uint32 tag, const std::string& value);
+void WriteBinaryInt(DataBinaryWriteContext& context, uint32 tag, int value);
+void WriteBinaryFloat(DataBinaryWriteContext& context, uint32 tag, float value);
+void WriteBinaryBool(DataBinaryWriteContext& context, uint32 tag, bool value);
+void WriteBinaryVector2(DataBinaryWriteContext& context, uint32 tag, const Vector2i& value);
+void WriteBinaryVector2(DataBinaryWriteContext& context, uint32 tag, const Vector2f& value);
+
+void WriteBinaryStringArray(DataBinaryWriteContext& context, uint32 tag, const std::vector<std::string>& values);
+void WriteBinaryIntArray(DataBinaryWriteContext& context, uint32 tag, const std::vector<int>& values);
+void WriteBinaryFloatArray(DataBinaryWriteContext& context, uint32 tag, const std::vector<float>& values);
+void WriteBinaryBoolArray(DataBinaryWriteContext& context, uint32 tag, const std::vector<bool>& values);
+void WriteBinaryVector2Array(DataBinaryWriteContext& context, uint32 tag, const std::vector<Vector2i>& values);
+void WriteBinaryVector2Array(DataBinaryWriteContext& context, uint32 tag, const std::vector<Vector2f>& values);
+
+template<typename T>
+void WriteBinaryEnum(DataBinaryWriteContext& context, uint32 tag, const DataEnumTable& enumTable, T value);
+
+template<typename T>
+void WriteBinaryEnumArray(DataBinaryWriteContext& context, uint32 tag, const DataEnumTable& enumTable, const std::vector<T>& values);
+
+void WriteBinaryDatasheetReference(DataBinaryWriteContext& context, uint32 tag, const DatasheetObject* value);
+
+template<typename T>
+void WriteBinaryDatasheetReferenceArray(DataBinaryWriteContext& context, uint32 tag, const std::vector<const T*>& values);
+
+void WriteBinaryDatasaveInstance(DataBinaryWriteContext& context, uint32 tag, const DatasaveObject* value);
+
+template<typename T>
+void WriteBinaryDatasaveInstanceArray(DataBinaryWriteContext& context, uint32 tag, const std::vector<T*>& values);
+
+// Nested datasave instances, in serialization order, null instances are skipped (see DatasaveObject::GetDatasaveInstances).
+void GatherDatasaveInstance(std::vector<const DatasaveObject*>& instances, const DatasaveObject* value);
+
+template<typename T>
+void GatherDatasaveInstanceArray(std::vector<const DatasaveObject*>& instances, const std::vector<T*>& values);
 
 //----------------------------------------------
 // impl methods
 
 namespace impl {
 
-pugi::xml_node FindNodeData(DataParseContext& _kContext, const std::string& _strName);
-pugi::xml_node AddNodeData(DataSaveContext& _kContext, const std::string& _strName);
+pugi::xml_node FindNodeData(DataParseContext& _kContext, std::string_view _strName);
+pugi::xml_node AddNodeData(DataSaveContext& _kContext, std::string_view _strName);
 
-bool ReadEnumValue(DataParseContext& _kContext, const std::string& _strName, const std::string& _strType, int& _iValue);
-bool ReadEnumValues(DataParseContext& _kContext, const std::string& _strName, const std::string& _strType, std::vector<int>& _vecValues);
+bool ReadEnumValue(DataParseContext& _kContext, std::string_view _strName, std::string_view _strType, int& _iValue);
+bool ReadEnumValues(DataParseContext& _kContext, std::string_view _strName, std::string_view _strType, std::vector<int>& _vecValues);
 
-void WriteEnumValue(DataSaveContext& _kContext, const std::string& _strName, const std::string& _strType, int _iValue);
-void WriteEnumValues(DataSaveContext& _kContext, const std::string& _strName, const std::string& _strType, const std::vector<int>& _vecValues);
+void WriteEnumValue(DataSaveContext& _kContext, std::string_view _strName, std::string_view _strType, int _iValue);
+void WriteEnumValues(DataSaveContext& _kContext, std::string_view _strName, std::string_view _strType, const std::vector<int>& _vecValues);
+
+bool FindEnumTableValue(const DataEnumTable& enumTable, std::string_view name, int& value);
+
+bool ReadEnumValue(DataParseContext& context, std::string_view name, const DataEnumTable& enumTable, int& value);
+bool ReadEnumValues(DataParseContext& context, std::string_view name, const DataEnumTable& enumTable, std::vector<int>& values);
+
+void WriteEnumValue(DataSaveContext& context, std::string_view name, const DataEnumTable& enumTable, int value);
+void WriteEnumValues(DataSaveContext& context, std::string_view name, const DataEnumTable& enumTable, const std::vector<int>& values);
 
 const DatasheetObject* ResolveDatasheetReference(const std::string& _strName);
-bool ResolveDatasheetReference(DataParseContext& _kContext, const std::string& _strName, const DatasheetObject*& _pDatasheet);
-bool ResolveDatasheetReferences(DataParseContext& _kContext, const std::string& _strName, std::vector<const DatasheetObject*>& _vecDatasheets);
+bool ResolveDatasheetReference(DataParseContext& _kContext, std::string_view _strName, const DatasheetObject*& _pDatasheet);
+bool ResolveDatasheetReferences(DataParseContext& _kContext, std::string_view _strName, std::vector<const DatasheetObject*>& _vecDatasheets);
+
+void WriteDatasheetReferences(DataSaveContext& _kContext, std::string_view _strName, const std::vector<const DatasheetObject*>& _pMember);
+
+bool ResolveDatasheetObjectInstance(DataParseContext& _kContext, std::string_view _strName, std::string_view _strDefaultType, DataObject*& _pInstance);
+bool ResolveDatasheetObjectInstances(DataParseContext& _kContext, std::string_view _strName, std::string_view _strDefaultType, std::vector<DataObject*>& _vecInstances);
+
+DataObject* InstanciateDatasaveObject(DataParseContext& _kContext, std::string_view _strType);
+bool InstanciateDatasaveObject(DataParseContext& _kContext, std::string_view _strName, std::string_view _strDefaultType, DataObject*& _pInstance);
+bool InstanciateDatasaveObjects(DataParseContext& _kContext, std::string_view _strName, std::string_view _strDefaultType, std::vector<DataObject*>& _vecInstances);
+
+void WriteDatasaveInstances(DataSaveContext& _kContext, std::string_view _strName, std::string_view _strType, const std::vector<DatasaveObject*>& _pMember);
+
+template<typename T>
+void WriteBinaryValue(DataBinaryWriteContext& context, const T& value);
+void WriteBinaryStringValue(DataBinaryWriteContext& context, std::string_view value);
+
+template<typename T>
+bool ReadBinaryValue(DataBinaryReadContext& context, T& value);
+bool ReadBinaryStringValue(DataBinaryReadContext& context, std::string_view& value);
+
+// Records store their payload size after the tag, it is patched once the payload has been written.
+size_t BeginBinaryRecord(DataBinaryWriteContext& context, uint32 tag);
+void EndBinaryRecord(DataBinaryWriteContext& context, size_t sizePosition);
 
-void WriteDatasheetReferences(DataSaveContext& _kContext, const std::string& _strName, const std::vector<const DatasheetObject*>& _pMember);
+bool ReadBinaryMembers(DataBinaryReadContext& context, DatasaveObject* object);
+void WriteBinaryMembers(DataBinaryWriteContext& context, const DatasaveObject* object);
 
-bool ResolveDatasheetObjectInstance(DataParseContext& _kContext, const std::string& _strName, const std::string& _strDefaultType, DataObject*& _pInstance);
-bool ResolveDatasheetObjectInstances(DataParseContext& _kContext, const std::string& _strName, const std::string& _strDefaultType, std::vector<DataObject*>& _vecInstances);
+bool ReadBinaryEnumValues(DataBinaryReadContext& context, const DataEnumTable& enumTable, std::vector<int>& values);
+void WriteBinaryEnumValues(DataBinaryWriteContext& context, uint32 tag, const DataEnumTable& enumTable, const std::vector<int>& values);
 
-DataObject* InstanciateDatasaveObject(DataParseContext& _kContext, const std::string& _strType);
-bool InstanciateDatasaveObject(DataParseContext& _kContext, const std::string& _strName, const std::string& _strDefaultType, DataObject*& _pInstance);
-bool InstanciateDatasaveObjects(DataParseContext& _kContext, const std::string& _strName, const std::string& _strDefaultType, std::vector<DataObject*>& _vecInstances);
+bool ReadBinaryDatasheetReferences(DataBinaryReadContext& context, std::vector<const DatasheetObject*>& values);
+void WriteBinaryDatasheetReferences(DataBinaryWriteContext& context, uint32 tag, const std::vector<const DatasheetObject*>& values);
 
-void WriteDatasaveInstances(DataSaveContext& _kContext, const std::string& _strName, const std::string& _strType, const std::vector<DatasaveObject*>& _pMember);
+// Instances are stored with their type (empty for null instances), followed by their members.
+bool ReadBinaryDatasaveObject(DataBinaryReadContext& context, DataObject*& instance);
+bool ReadBinaryDatasaveObjects(DataBinaryReadContext& context, std::vector<DataObject*>& instances);
+void WriteBinaryDatasaveObjects(DataBinaryWriteContext& context, uint32 tag, const std::vector<DatasaveObject*>& instances);
 
 }   // namespace impl
 
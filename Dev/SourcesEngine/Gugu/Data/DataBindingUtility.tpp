@@ -8,7 +8,7 @@ namespace gugu {
 namespace binding {
 
 template<typename T>
-void ReadEnum(DataParseContext& _kContext, const std::string& _strName, const std::string& _strType, T& _eMember)
+void ReadEnum(DataParseContext& _kContext, std::string_view _strName, std::string_view _strType, T& _eMember)
 {
     int iValue = 0;
     if (impl::ReadEnumValue(_kContext, _strName, _strType, iValue))
@@ -16,7 +16,7 @@ void ReadEnum(DataParseContext& _kContext, const std::string& _strName, const st
 }
 
 template<typename T>
-void ReadEnumArray(DataParseContext& _kContext, const std::string& _strName, const std::string& _strType, std::vector<T>& _vecMember)
+void ReadEnumArray(DataParseContext& _kContext, std::string_view _strName, std::string_view _strType, std::vector<T>& _vecMember)
 {
     std::vector<int> vecValues;
     if (impl::ReadEnumValues(_kContext, _strName, _strType, vecValues))
@@ -31,13 +31,37 @@ void ReadEnumArray(DataParseContext& _kContext, const std::string& _strName, con
 }
 
 template<typename T>
-void WriteEnum(DataSaveContext& _kContext, const std::string& _strName, const std::string& _strType, T _eMember)
+void ReadEnum(DataParseContext& context, std::string_view name, const DataEnumTable& enumTable, T& value)
+{
+    int enumValue = 0;
+    if (impl::ReadEnumValue(context, name, enumTable, enumValue))
+        value = (T)enumValue;
+}
+
+template<typename T>
+void ReadEnumArray(DataParseContext& context, std::string_view name, const DataEnumTable& enumTable, std::vector<T>& values)
+{
+    std::vector<int> enumValues;
+    if (impl::ReadEnumValues(context, name, enumTable, enumValues))
+    {
+        values.clear();
+        values.reserve(enumValues.size());
+
+        for (size_t i = 0; i < enumValues.size(); ++i)
+        {
+            values.push_back((T)(enumValues[i]));
+        }
+    }
+}
+
+template<typename T>
+void WriteEnum(DataSaveContext& _kContext, std::string_view _strName, std::string_view _strType, T _eMember)
 {
     impl::WriteEnumValue(_kContext, _strName, _strType, (int)_eMember);
 }
 
 template<typename T>
-void WriteEnumArray(DataSaveContext& _kContext, const std::string& _strName, const std::string& _strType, const std::vector<T>& _vecMember)
+void WriteEnumArray(DataSaveContext& _kContext, std::string_view _strName, std::string_view _strType, const std::vector<T>& _vecMember)
 {
     std::vector<int> vecValues;
     vecValues.reserve(_vecMember.size());
@@ -51,7 +75,27 @@ void WriteEnumArray(DataSaveContext& _kContext, const std::string& _strName, con
 }
 
 template<typename T>
-void ReadDatasheetReference(DataParseContext& _kContext, const std::string& _strName, const T*& _pMember)
+void WriteEnum(DataSaveContext& context, std::string_view name, const DataEnumTable& enumTable, T value)
+{
+    impl::WriteEnumValue(context, name, enumTable, (int)value);
+}
+
+template<typename T>
+void WriteEnumArray(DataSaveContext& context, std::string_view name, const DataEnumTable& enumTable, const std::vector<T>& values)
+{
+    std::vector<int> enumValues;
+    enumValues.reserve(values.size());
+
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        enumValues.push_back((int)values[i]);
+    }
+
+    impl::WriteEnumValues(context, name, enumTable, enumValues);
+}
+
+template<typename T>
+void ReadDatasheetReference(DataParseContext& _kContext, std::string_view _strName, const T*& _pMember)
 {
     static_assert(std::is_base_of<DatasheetObject, T>::value, "Data type is not based on DatasheetObject type");
 
@@ -63,7 +107,7 @@ void ReadDatasheetReference(DataParseContext& _kContext, const std::string& _str
 }
 
 template<typename T>
-void ReadDatasheetReferenceArray(DataParseContext& _kContext, const std::string& _strName, std::vector<const T*>& _vecMember)
+void ReadDatasheetReferenceArray(DataParseContext& _kContext, std::string_view _strName, std::vector<const T*>& _vecMember)
 {
     static_assert(std::is_base_of<DatasheetObject, T>::value, "Data type is not based on DatasheetObject type");
 
@@ -82,7 +126,38 @@ void ReadDatasheetReferenceArray(DataParseContext& _kContext, const std::string&
 }
 
 template<typename T>
-void WriteDatasheetReferenceArray(DataSaveContext& _kContext, const std::string& _strName, const std::vector<const T*>& _pMember)
+void ReadDatasheetReference(DataParseContext& context, std::string_view name, DataArenaRef<T>& member)
+{
+    static_assert(std::is_base_of<DatasheetObject, T>::value, "Data type is not based on DatasheetObject type");
+
+    const DatasheetObject* reference = nullptr;
+    if (impl::ResolveDatasheetReference(context, name, reference))
+    {
+        member = dynamic_cast<const T*>(reference);
+    }
+}
+
+template<typename T>
+void ReadDatasheetReferenceArray(DataParseContext& context, std::string_view name, std::vector<DataArenaRef<T>>& members)
+{
+    static_assert(std::is_base_of<DatasheetObject, T>::value, "Data type is not based on DatasheetObject type");
+
+    std::vector<const DatasheetObject*> references;
+    if (impl::ResolveDatasheetReferences(context, name, references))
+    {
+        members.clear();
+        members.reserve(references.size());
+
+        for (size_t i = 0; i < references.size(); ++i)
+        {
+            // Fill the actual member values (may contain null values).
+            members.push_back(DataArenaRef<T>(dynamic_cast<const T*>(references[i])));
+        }
+    }
+}
+
+template<typename T>
+void WriteDatasheetReferenceArray(DataSaveContext& _kContext, std::string_view _strName, const std::vector<const T*>& _pMember)
 {
     static_assert(std::is_base_of<DatasheetObject, T>::value, "Data type is not based on DatasheetObject type");
 
@@ -98,7 +173,7 @@ void WriteDatasheetReferenceArray(DataSaveContext& _kContext, const std::string&
 }
 
 template<typename T>
-void ReadDatasheetInstance(DataParseContext& _kContext, const std::string& _strName, const std::string& _strType, const T*& _pMember)
+void ReadDatasheetInstance(DataParseContext& _kContext, std::string_view _strName, std::string_view _strType, const T*& _pMember)
 {
     static_assert(std::is_base_of<DatasheetObject, T>::value, "Data type is not based on DatasheetObject type");
 
@@ -110,7 +185,7 @@ void ReadDatasheetInstance(DataParseContext& _kContext, const std::string& _strN
 }
 
 template<typename T>
-void ReadDatasheetInstanceArray(DataParseContext& _kContext, const std::string& _strName, const std::string& _strType, std::vector<const T*>& _vecMember)
+void ReadDatasheetInstanceArray(DataParseContext& _kContext, std::string_view _strName, std::string_view _strType, std::vector<const T*>& _vecMember)
 {
     static_assert(std::is_base_of<DatasheetObject, T>::value, "Data type is not based on DatasheetObject type");
 
@@ -129,7 +204,7 @@ void ReadDatasheetInstanceArray(DataParseContext& _kContext, const std::string&
 }
 
 template<typename T>
-void ReadDatasaveInstance(DataParseContext& _kContext, const std::string& _strName, const std::string& _strType, T*& _pMember)
+void ReadDatasaveInstance(DataParseContext& _kContext, std::string_view _strName, std::string_view _strType, T*& _pMember)
 {
     static_assert(std::is_base_of<DatasaveObject, T>::value, "Data type is not based on DatasaveObject type");
 
@@ -142,7 +217,7 @@ void ReadDatasaveInstance(DataParseContext& _kContext, const std::string& _strNa
 }
 
 template<typename T>
-void ReadDatasaveInstanceArray(DataParseContext& _kContext, const std::string& _strName, const std::string& _strType, std::vector<T*>& _vecMember)
+void ReadDatasaveInstanceArray(DataParseContext& _kContext, std::string_view _strName, std::string_view _strType, std::vector<T*>& _vecMember)
 {
     static_assert(std::is_base_of<DatasaveObject, T>::value, "Data type is not based on DatasaveObject type");
 
@@ -161,7 +236,7 @@ void ReadDatasaveInstanceArray(DataParseContext& _kContext, const std::string& _
 }
 
 template<typename T>
-void WriteDatasaveInstanceArray(DataSaveContext& _kContext, const std::string& _strName, const std::string& _strType, const std::vector<T*>& _pMember)
+void WriteDatasaveInstanceArray(DataSaveContext& _kContext, std::string_view _strName, std::string_view _strType, const std::vector<T*>& _pMember)
 {
     static_assert(std::is_base_of<DatasaveObject, T>::value, "Data type is not based on DatasaveObject type");
 
@@ -176,6 +251,215 @@ void WriteDatasaveInstanceArray(DataSaveContext& _kContext, const std::string& _
     impl::WriteDatasaveInstances(_kContext, _strName, _strType, vecInstances);
 }
 
+template<typename T>
+bool ReadBinaryEnum(DataBinaryReadContext& context, const DataEnumTable& enumTable, T& value)
+{
+    std::string_view name;
+    int enumValue = 0;
+    if (impl::ReadBinaryStringValue(context, name) && impl::FindEnumTableValue(enumTable, name, enumValue))
+    {
+        value = (T)enumValue;
+        return true;
+    }
+
+    return false;
+}
+
+template<typename T>
+bool ReadBinaryEnumArray(DataBinaryReadContext& context, const DataEnumTable& enumTable, std::vector<T>& values)
+{
+    std::vector<int> enumValues;
+    if (!impl::ReadBinaryEnumValues(context, enumTable, enumValues))
+        return false;
+
+    values.clear();
+    values.reserve(enumValues.size());
+
+    for (size_t i = 0; i < enumValues.size(); ++i)
+    {
+        values.push_back((T)(enumValues[i]));
+    }
+
+    return true;
+}
+
+template<typename T>
+bool ReadBinaryDatasheetReference(DataBinaryReadContext& context, const T*& value)
+{
+    static_assert(std::is_base_of<DatasheetObject, T>::value, "Data type is not based on DatasheetObject type");
+
+    std::string_view resourceId;
+    if (!impl::ReadBinaryStringValue(context, resourceId))
+        return false;
+
+    value = resourceId.empty() ? nullptr : dynamic_cast<const T*>(impl::ResolveDatasheetReference(std::string(resourceId)));
+    return true;
+}
+
+template<typename T>
+bool ReadBinaryDatasheetReferenceArray(DataBinaryReadContext& context, std::vector<const T*>& values)
+{
+    static_assert(std::is_base_of<DatasheetObject, T>::value, "Data type is not based on DatasheetObject type");
+
+    std::vector<const DatasheetObject*> references;
+    if (!impl::ReadBinaryDatasheetReferences(context, references))
+        return false;
+
+    values.clear();
+    values.reserve(references.size());
+
+    for (size_t i = 0; i < references.size(); ++i)
+    {
+        // Fill the actual member values (may contain null values).
+        values.push_back(dynamic_cast<const T*>(references[i]));
+    }
+
+    return true;
+}
+
+template<typename T>
+bool ReadBinaryDatasaveInstance(DataBinaryReadContext& context, T*& value)
+{
+    static_assert(std::is_base_of<DatasaveObject, T>::value, "Data type is not based on DatasaveObject type");
+
+    DataObject* instance = nullptr;
+    if (!impl::ReadBinaryDatasaveObject(context, instance))
+        return false;
+
+    T* typedInstance = dynamic_cast<T*>(instance);
+    if (!typedInstance)
+    {
+        SafeDelete(instance);
+    }
+
+    SafeDelete(value);
+    value = typedInstance;
+    return true;
+}
+
+template<typename T>
+bool ReadBinaryDatasaveInstanceArray(DataBinaryReadContext& context, std::vector<T*>& values)
+{
+    static_assert(std::is_base_of<DatasaveObject, T>::value, "Data type is not based on DatasaveObject type");
+
+    std::vector<DataObject*> instances;
+    if (!impl::ReadBinaryDatasaveObjects(context, instances))
+        return false;
+
+    ClearStdVector(values);
+    values.reserve(instances.size());
+
+    for (size_t i = 0; i < instances.size(); ++i)
+    {
+        // Fill the actual member values (may contain null values).
+        T* typedInstance = dynamic_cast<T*>(instances[i]);
+        if (!typedInstance)
+        {
+            SafeDelete(instances[i]);
+        }
+
+        values.push_back(typedInstance);
+    }
+
+    return true;
+}
+
+template<typename T>
+void WriteBinaryEnum(DataBinaryWriteContext& context, uint32 tag, const DataEnumTable& enumTable, T value)
+{
+    // Enums are stored by name, to stay valid when enum values are reordered.
+    int enumValue = (int)value;
+    if (enumValue >= 0 && (size_t)enumValue < enumTable.size)
+    {
+        size_t sizePosition = impl::BeginBinaryRecord(context, tag);
+        impl::WriteBinaryStringValue(context, enumTable.names[enumValue]);
+        impl::EndBinaryRecord(context, sizePosition);
+    }
+}
+
+template<typename T>
+void WriteBinaryEnumArray(DataBinaryWriteContext& context, uint32 tag, const DataEnumTable& enumTable, const std::vector<T>& values)
+{
+    std::vector<int> enumValues;
+    enumValues.reserve(values.size());
+
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        enumValues.push_back((int)values[i]);
+    }
+
+    impl::WriteBinaryEnumValues(context, tag, enumTable, enumValues);
+}
+
+template<typename T>
+void WriteBinaryDatasheetReferenceArray(DataBinaryWriteContext& context, uint32 tag, const std::vector<const T*>& values)
+{
+    static_assert(std::is_base_of<DatasheetObject, T>::value, "Data type is not based on DatasheetObject type");
+
+    std::vector<const DatasheetObject*> references;
+    references.reserve(values.size());
+
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        references.push_back(values[i]);
+    }
+
+    impl::WriteBinaryDatasheetReferences(context, tag, references);
+}
+
+template<typename T>
+void WriteBinaryDatasaveInstanceArray(DataBinaryWriteContext& context, uint32 tag, const std::vector<T*>& values)
+{
+    static_assert(std::is_base_of<DatasaveObject, T>::value, "Data type is not based on DatasaveObject type");
+
+    std::vector<DatasaveObject*> instances;
+    instances.reserve(values.size());
+
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        instances.push_back((DatasaveObject*)values[i]);
+    }
+
+    impl::WriteBinaryDatasaveObjects(context, tag, instances);
+}
+
+template<typename T>
+void GatherDatasaveInstanceArray(std::vector<const DatasaveObject*>& instances, const std::vector<T*>& values)
+{
+    static_assert(std::is_base_of<DatasaveObject, T>::value, "Data type is not based on DatasaveObject type");
+
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        GatherDatasaveInstance(instances, values[i]);
+    }
+}
+
+namespace impl {
+
+template<typename T>
+void WriteBinaryValue(DataBinaryWriteContext& context, const T& value)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Binary values need to be trivially copyable");
+
+    const uint8* bytes = reinterpret_cast<const uint8*>(&value);
+    context.buffer->insert(context.buffer->end(), bytes, bytes + sizeof(T));
+}
+
+template<typename T>
+bool ReadBinaryValue(DataBinaryReadContext& context, T& value)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Binary values need to be trivially copyable");
+
+    if (context.size - context.position < sizeof(T))
+        return false;
+
+    std::memcpy(&value, context.data + context.position, sizeof(T));
+    context.position += sizeof(T);
+    return true;
+}
+
+}   // namespace impl
+
 }   // namespace binding
 
 }   // namespace gugu
@@ -0,0 +1,249 @@
+////////////////////////////////////////////////////////////////
+// Header
+
+#include "Gugu/Common.h"
+#include "Gugu/Data/DataObjectArena.h"
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include <new>
+
+////////////////////////////////////////////////////////////////
+// File Implementation
+
+namespace gugu {
+
+namespace impl {
+
+// Each slot starts with a header, followed by the object (aligned like a regular heap allocation).
+struct DataArenaSlotHeader
+{
+    uint32 index = 0;
+    uint32 flags = 0;
+};
+
+namespace EDataArenaSlotFlag
+{
+    enum Type : uint32
+    {
+        None    = 0,
+        Used    = 1 << 0,   // Slot from an arena chunk, currently holding an object.
+        Heap    = 1 << 1,   // Standalone heap allocation.
+    };
+}
+
+constexpr size_t DataArenaSlotHeaderSize = alignof(std::max_align_t) >= sizeof(DataArenaSlotHeader) ? alignof(std::max_align_t) : sizeof(DataArenaSlotHeader);
+
+size_t AlignArenaSize(size_t size)
+{
+    constexpr size_t alignment = alignof(std::max_align_t);
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+DataArenaSlotHeader* GetSlotHeader(const void* object)
+{
+    return reinterpret_cast<DataArenaSlotHeader*>(const_cast<uint8*>(static_cast<const uint8*>(object)) - DataArenaSlotHeaderSize);
+}
+
+// Indices are made of a table entry and the generation of this entry, incremented every time the entry is released.
+// - An entry is retired once its generation is exhausted, a released index can never reach another object.
+constexpr uint32 DataArenaEntryBits = 24;
+constexpr uint32 DataArenaEntryMask = (1u << DataArenaEntryBits) - 1;
+constexpr uint32 DataArenaMaxGeneration = 0xFF;
+
+// Indices shared by all arenas, the 0 index is reserved for null references.
+struct DataArenaIndexTable
+{
+    std::vector<void*> objects;
+    std::vector<uint8> generations;
+    std::vector<uint32> freeEntries;
+
+    DataArenaIndexTable()
+    {
+        objects.push_back(nullptr);
+        generations.push_back(0);
+    }
+};
+
+DataArenaIndexTable& GetDataArenaIndexTable()
+{
+    static DataArenaIndexTable table;
+    return table;
+}
+
+uint32 RegisterArenaObject(void* object)
+{
+    DataArenaIndexTable& table = GetDataArenaIndexTable();
+
+    uint32 entry = 0;
+    if (!table.freeEntries.empty())
+    {
+        entry = table.freeEntries.back();
+        table.freeEntries.pop_back();
+        table.objects[entry] = object;
+    }
+    else if (table.objects.size() <= DataArenaEntryMask)
+    {
+        entry = (uint32)table.objects.size();
+        table.objects.push_back(object);
+        table.generations.push_back(0);
+    }
+    else
+    {
+        // The table is full, the object will not be referenceable.
+        return 0;
+    }
+
+    return ((uint32)table.generations[entry] << DataArenaEntryBits) | entry;
+}
+
+void UnregisterArenaObject(uint32 index)
+{
+    if (index == 0)
+        return;
+
+    DataArenaIndexTable& table = GetDataArenaIndexTable();
+
+    uint32 entry = index & DataArenaEntryMask;
+    table.objects[entry] = nullptr;
+
+    if (table.generations[entry] < DataArenaMaxGeneration)
+    {
+        ++table.generations[entry];
+        table.freeEntries.push_back(entry);
+    }
+}
+
+}   // namespace impl
+
+DataObjectArena::DataObjectArena(size_t objectSize, size_t chunkSlotCount)
+    : m_slotSize(impl::DataArenaSlotHeaderSize + impl::AlignArenaSize(objectSize))
+    , m_chunkSlotCount(chunkSlotCount > 0 ? chunkSlotCount : 1)
+    , m_lastChunkUsedSlotCount(0)
+    , m_objectCount(0)
+{
+    // Ensure the index table outlives the arena (arenas are static objects in generated classes).
+    impl::GetDataArenaIndexTable();
+}
+
+DataObjectArena::~DataObjectArena()
+{
+    // Remaining objects are leaked on purpose, their memory needs to stay valid until the end of the application.
+    if (m_objectCount > 0)
+        return;
+
+    for (uint8* chunk : m_chunks)
+    {
+        ::operator delete(chunk);
+    }
+}
+
+void* DataObjectArena::Allocate(size_t size)
+{
+    uint8* slot = nullptr;
+    uint32 flags = impl::EDataArenaSlotFlag::Used;
+
+    if (impl::DataArenaSlotHeaderSize + impl::AlignArenaSize(size) != m_slotSize)
+    {
+        slot = static_cast<uint8*>(::operator new(impl::DataArenaSlotHeaderSize + size));
+        flags = impl::EDataArenaSlotFlag::Heap;
+    }
+    else if (!m_freeSlots.empty())
+    {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+        ++m_objectCount;
+    }
+    else
+    {
+        if (m_chunks.empty() || m_lastChunkUsedSlotCount == m_chunkSlotCount)
+        {
+            m_chunks.push_back(static_cast<uint8*>(::operator new(m_slotSize * m_chunkSlotCount)));
+            m_lastChunkUsedSlotCount = 0;
+        }
+
+        slot = m_chunks.back() + m_slotSize * m_lastChunkUsedSlotCount;
+        ++m_lastChunkUsedSlotCount;
+        ++m_objectCount;
+    }
+
+    void* object = GetSlotObject(slot);
+
+    impl::DataArenaSlotHeader* header = new (slot) impl::DataArenaSlotHeader;
+    header->index = impl::RegisterArenaObject(object);
+    header->flags = flags;
+
+    return object;
+}
+
+void DataObjectArena::Deallocate(void* object)
+{
+    if (!object)
+        return;
+
+    impl::DataArenaSlotHeader* header = impl::GetSlotHeader(object);
+    impl::UnregisterArenaObject(header->index);
+
+    if (header->flags & impl::EDataArenaSlotFlag::Heap)
+    {
+        ::operator delete(header);
+    }
+    else
+    {
+        header->index = 0;
+        header->flags = impl::EDataArenaSlotFlag::None;
+
+        m_freeSlots.push_back(reinterpret_cast<uint8*>(header));
+        --m_objectCount;
+    }
+}
+
+size_t DataObjectArena::GetObjectCount() const
+{
+    return m_objectCount;
+}
+
+size_t DataObjectArena::GetChunkCount() const
+{
+    return m_chunks.size();
+}
+
+uint32 DataObjectArena::GetObjectIndex(const void* object)
+{
+    return object ? impl::GetSlotHeader(object)->index : 0;
+}
+
+void* DataObjectArena::GetIndexedObject(uint32 index)
+{
+    const impl::DataArenaIndexTable& table = impl::GetDataArenaIndexTable();
+
+    // Indices of released objects have an outdated generation.
+    uint32 entry = index & impl::DataArenaEntryMask;
+    if (entry >= table.objects.size() || table.generations[entry] != (index >> impl::DataArenaEntryBits))
+        return nullptr;
+
+    return table.objects[entry];
+}
+
+uint8* DataObjectArena::GetSlot(size_t chunkIndex, size_t slotIndex) const
+{
+    return m_chunks[chunkIndex] + m_slotSize * slotIndex;
+}
+
+size_t DataObjectArena::GetChunkUsedSlotCount(size_t chunkIndex) const
+{
+    return chunkIndex + 1 == m_chunks.size() ? m_lastChunkUsedSlotCount : m_chunkSlotCount;
+}
+
+bool DataObjectArena::IsSlotUsed(const uint8* slot)
+{
+    return (reinterpret_cast<const impl::DataArenaSlotHeader*>(slot)->flags & impl::EDataArenaSlotFlag::Used) != 0;
+}
+
+void* DataObjectArena::GetSlotObject(uint8* slot)
+{
+    return slot + impl::DataArenaSlotHeaderSize;
+}
+
+}   // namespace gugu
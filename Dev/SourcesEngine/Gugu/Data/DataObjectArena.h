@@ -0,0 +1,89 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/System/Types.h"
+
+#include <cstddef>
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// File Declarations
+
+namespace gugu {
+
+// Contiguous storage for data objects, used by datasheet classes generated with the arena storage (see DataBindingTool).
+// - Objects of a given class are allocated in fixed size slots, inside chunks of contiguous memory, to keep iterations cache friendly.
+// - Every object receives a compact index, unique across all arenas, used by 32 bits references (see DataArenaRef).
+// - Indices are limited to 16M live objects, with 8 bits of generation to detect references to deallocated objects.
+// - Allocations of a different size (classes derived from an arena class without their own arena) are done on the heap, and only receive an index.
+// - Allocations are expected from the main thread (datasheets are instantiated during the load finalization).
+class DataObjectArena
+{
+public:
+
+    DataObjectArena(size_t objectSize, size_t chunkSlotCount = 256);
+    ~DataObjectArena();
+
+    void* Allocate(size_t size);
+    void Deallocate(void* object);
+
+    size_t GetObjectCount() const;      // Objects stored in the arena slots.
+    size_t GetChunkCount() const;
+
+    // Visit all the objects stored in the arena slots, in memory order.
+    template<typename T, typename F>
+    void ForEach(const F& visitor) const;
+
+    // Indices contain a generation, the index of a deallocated object stays invalid even if its entry is reused.
+    static uint32 GetObjectIndex(const void* object);   // Return 0 for a null object.
+    static void* GetIndexedObject(uint32 index);        // Return null for the 0 index, and for indices of deallocated objects.
+
+private:
+
+    uint8* GetSlot(size_t chunkIndex, size_t slotIndex) const;
+    size_t GetChunkUsedSlotCount(size_t chunkIndex) const;
+
+    static bool IsSlotUsed(const uint8* slot);
+    static void* GetSlotObject(uint8* slot);
+
+private:
+
+    size_t m_slotSize;
+    size_t m_chunkSlotCount;
+    size_t m_lastChunkUsedSlotCount;
+    size_t m_objectCount;
+
+    std::vector<uint8*> m_chunks;
+    std::vector<uint8*> m_freeSlots;
+};
+
+// Compact reference to an object allocated through a DataObjectArena.
+// - Datasheet classes use single inheritance, an object shares its address with all its base classes.
+// - A reference to a deallocated object returns null, it never resolves to the object reusing its slot or entry.
+template<typename T>
+class DataArenaRef
+{
+public:
+
+    DataArenaRef();
+    DataArenaRef(const T* object);
+
+    const T* Get() const;
+    uint32 GetIndex() const;
+
+    operator const T*() const;
+    const T* operator->() const;
+
+private:
+
+    uint32 m_index;
+};
+
+}   // namespace gugu
+
+////////////////////////////////////////////////////////////////
+// Template Implementation
+
+#include "Gugu/Data/DataObjectArena.tpp"
@@ -0,0 +1,61 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// File Implementation
+
+namespace gugu {
+
+template<typename T, typename F>
+void DataObjectArena::ForEach(const F& visitor) const
+{
+    for (size_t chunkIndex = 0; chunkIndex < m_chunks.size(); ++chunkIndex)
+    {
+        size_t usedSlotCount = GetChunkUsedSlotCount(chunkIndex);
+        for (size_t slotIndex = 0; slotIndex < usedSlotCount; ++slotIndex)
+        {
+            uint8* slot = GetSlot(chunkIndex, slotIndex);
+            if (IsSlotUsed(slot))
+            {
+                visitor(static_cast<const T*>(GetSlotObject(slot)));
+            }
+        }
+    }
+}
+
+template<typename T>
+DataArenaRef<T>::DataArenaRef()
+    : m_index(0)
+{
+}
+
+template<typename T>
+DataArenaRef<T>::DataArenaRef(const T* object)
+    : m_index(DataObjectArena::GetObjectIndex(object))
+{
+}
+
+template<typename T>
+const T* DataArenaRef<T>::Get() const
+{
+    return static_cast<const T*>(DataObjectArena::GetIndexedObject(m_index));
+}
+
+template<typename T>
+uint32 DataArenaRef<T>::GetIndex() const
+{
+    return m_index;
+}
+
+template<typename T>
+DataArenaRef<T>::operator const T*() const
+{
+    return Get();
+}
+
+template<typename T>
+const T* DataArenaRef<T>::operator->() const
+{
+    return Get();
+}
+
+}   // namespace gugu
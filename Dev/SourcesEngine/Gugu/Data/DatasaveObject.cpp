@@ -8,14 +8,35 @@
 // Includes
 
 #include "Gugu/Data/DataBindingUtility.h"
+#include "Gugu/System/Platform.h"
+#include "Gugu/System/String.h"
 #include "Gugu/External/PugiXmlUtility.h"
+#include "Gugu/Debug/Logger.h"
 
 ////////////////////////////////////////////////////////////////
 // File Implementation
 
 namespace gugu {
 
+namespace impl {
+
+// Binary datasave layout : header, root object type, then root object members.
+struct DatasaveBinaryHeader
+{
+    uint32 magic = 0;
+    uint32 version = 0;
+    uint64 schemaHash = 0;
+};
+
+constexpr uint32 DatasaveBinaryMagic = 0x42534447;     // "GDSB".
+constexpr uint32 DatasaveBinaryVersion = 1;
+
+}   // namespace impl
+
 DatasaveObject::DatasaveObject()
+    : m_dirty(true)
+    , m_subtreeDirty(true)
+    , m_hasBinaryCache(false)
 {
 }
 
@@ -38,6 +59,8 @@ bool DatasaveObject::LoadFromFile(const std::string& path)
     context.currentNode = &rootNode;
     ParseMembers(context);
 
+    SetDirty();
+
     // Note:
     // This method could return a struct with some infos like serialization and binding versions.
     // It would allow the calling site to get those infos without the need of storing them on every DatasaveObject.
@@ -65,6 +88,231 @@ bool DatasaveObject::SaveToString(std::string& result) const
     return true;
 }
 
+bool DatasaveObject::LoadFromBinaryFile(const std::string& path)
+{
+    std::vector<uint8> buffer;
+    if (!ReadFileContent(path, buffer))
+        return false;
+
+    return LoadFromBinaryBuffer(buffer);
+}
+
+bool DatasaveObject::LoadFromBinaryBuffer(const std::vector<uint8>& buffer)
+{
+    DataBinaryReadContext context;
+    context.data = buffer.data();
+    context.size = buffer.size();
+    context.position = 0;
+
+    impl::DatasaveBinaryHeader header;
+    if (!binding::impl::ReadBinaryValue(context, header)
+        || header.magic != impl::DatasaveBinaryMagic
+        || header.version != impl::DatasaveBinaryVersion)
+    {
+        GetLogEngine()->Print(ELog::Error, ELogEngine::Databinding, StringFormat("Invalid binary datasave header : {0}", GetDataInstanceType()));
+        return false;
+    }
+
+    std::string_view instanceType;
+    if (!binding::impl::ReadBinaryStringValue(context, instanceType) || instanceType != GetDataInstanceType())
+    {
+        GetLogEngine()->Print(ELog::Error, ELogEngine::Databinding, StringFormat("Binary datasave type mismatch : {0}", GetDataInstanceType()));
+        return false;
+    }
+
+    if (header.schemaHash != GetBinarySchemaHash())
+    {
+        GetLogEngine()->Print(ELog::Info, ELogEngine::Databinding, StringFormat("Binary datasave saved with a different binding, members will be matched by tags : {0}", GetDataInstanceType()));
+    }
+
+    SetDirty();
+    return binding::impl::ReadBinaryMembers(context, this);
+}
+
+bool DatasaveObject::SaveToBinaryFile(const std::string& path) const
+{
+    std::vector<uint8> buffer;
+    if (!SaveToBinaryBuffer(buffer))
+        return false;
+
+    return WriteFileContent(path, buffer);
+}
+
+bool DatasaveObject::SaveToBinaryBuffer(std::vector<uint8>& buffer) const
+{
+    buffer.clear();
+
+    DataBinaryWriteContext context;
+    context.buffer = &buffer;
+
+    impl::DatasaveBinaryHeader header;
+    header.magic = impl::DatasaveBinaryMagic;
+    header.version = impl::DatasaveBinaryVersion;
+    header.schemaHash = GetBinarySchemaHash();
+
+    binding::impl::WriteBinaryValue(context, header);
+    binding::impl::WriteBinaryStringValue(context, GetDataInstanceType());
+    binding::impl::WriteBinaryMembers(context, this);
+
+    return true;
+}
+
+bool DatasaveObject::SaveToIncrementalBinaryBuffer(std::vector<uint8>& buffer, size_t& reusedSize) const
+{
+    UpdateDirtyState();
+
+    buffer.clear();
+
+    DataBinaryWriteContext context;
+    context.buffer = &buffer;
+    context.incremental = true;
+
+    impl::DatasaveBinaryHeader header;
+    header.magic = impl::DatasaveBinaryMagic;
+    header.version = impl::DatasaveBinaryVersion;
+    header.schemaHash = GetBinarySchemaHash();
+
+    binding::impl::WriteBinaryValue(context, header);
+    binding::impl::WriteBinaryStringValue(context, GetDataInstanceType());
+    binding::impl::WriteBinaryMembers(context, this);
+
+    reusedSize = context.reusedSize;
+    return true;
+}
+
+void DatasaveObject::SetDirty()
+{
+    m_dirty = true;
+}
+
+bool DatasaveObject::IsDirty() const
+{
+    return m_dirty;
+}
+
+bool DatasaveObject::UpdateDirtyState() const
+{
+    std::vector<const DatasaveObject*> instances;
+    return UpdateDirtyState(instances);
+}
+
+bool DatasaveObject::UpdateDirtyState(std::vector<const DatasaveObject*>& instances) const
+{
+    // The instances vector is shared by the whole hierarchy, each object uses the range after its parent instances.
+    size_t firstInstance = instances.size();
+    GetDatasaveInstances(instances);
+    size_t instanceCount = instances.size() - firstInstance;
+
+    // The cached records reference the previous instances, any structural change invalidates them.
+    if (instanceCount != m_cachedInstances.size())
+    {
+        m_dirty = true;
+    }
+
+    // Nested instances need to be refreshed even if this object is already dirty.
+    bool instancesDirty = false;
+    for (size_t i = 0; i < instanceCount; ++i)
+    {
+        const DatasaveObject* instance = instances[firstInstance + i];
+        if (!m_dirty && instance != m_cachedInstances[i].instance)
+        {
+            m_dirty = true;
+        }
+
+        if (instance->UpdateDirtyState(instances))
+        {
+            instancesDirty = true;
+        }
+    }
+
+    instances.resize(firstInstance);
+
+    // A dirty instance may change its records size, which is stored in the records of this object.
+    m_subtreeDirty = m_dirty || instancesDirty;
+    return m_subtreeDirty;
+}
+
+void DatasaveObject::WriteBinaryRecords(DataBinaryWriteContext& context) const
+{
+    if (!context.incremental)
+    {
+        SerializeBinaryMembers(context);
+        binding::impl::WriteBinaryValue(context, (uint32)0);
+        return;
+    }
+
+    std::vector<DataBinaryInstanceRecord>* parentInstanceRecords = context.instanceRecords;
+    size_t startPosition = context.buffer->size();
+
+    if (!m_subtreeDirty && m_hasBinaryCache)
+    {
+        context.instanceRecords = nullptr;
+        WriteCachedBinaryRecords(context);
+    }
+    else
+    {
+        std::vector<DataBinaryInstanceRecord> instanceRecords;
+        context.instanceRecords = &instanceRecords;
+
+        SerializeBinaryMembers(context);
+        binding::impl::WriteBinaryValue(context, (uint32)0);
+
+        UpdateBinaryCache(context, startPosition, instanceRecords);
+    }
+
+    context.instanceRecords = parentInstanceRecords;
+    if (parentInstanceRecords)
+    {
+        DataBinaryInstanceRecord record;
+        record.instance = this;
+        record.start = startPosition;
+        record.end = context.buffer->size();
+        parentInstanceRecords->push_back(record);
+    }
+}
+
+void DatasaveObject::WriteCachedBinaryRecords(DataBinaryWriteContext& context) const
+{
+    size_t offset = 0;
+    for (const CachedInstance& cachedInstance : m_cachedInstances)
+    {
+        context.buffer->insert(context.buffer->end(), m_binaryCache.begin() + offset, m_binaryCache.begin() + cachedInstance.offset);
+        cachedInstance.instance->WriteBinaryRecords(context);
+        offset = cachedInstance.offset;
+    }
+
+    context.buffer->insert(context.buffer->end(), m_binaryCache.begin() + offset, m_binaryCache.end());
+    context.reusedSize += m_binaryCache.size();
+}
+
+void DatasaveObject::UpdateBinaryCache(const DataBinaryWriteContext& context, size_t startPosition, const std::vector<DataBinaryInstanceRecord>& instanceRecords) const
+{
+    // Only the records of this object are kept, nested instances keep their own records.
+    const std::vector<uint8>& buffer = *context.buffer;
+
+    m_binaryCache.clear();
+    m_cachedInstances.clear();
+
+    size_t position = startPosition;
+    for (const DataBinaryInstanceRecord& record : instanceRecords)
+    {
+        m_binaryCache.insert(m_binaryCache.end(), buffer.begin() + position, buffer.begin() + record.start);
+
+        CachedInstance cachedInstance;
+        cachedInstance.offset = m_binaryCache.size();
+        cachedInstance.instance = record.instance;
+        m_cachedInstances.push_back(cachedInstance);
+
+        position = record.end;
+    }
+
+    m_binaryCache.insert(m_binaryCache.end(), buffer.begin() + position, buffer.end());
+
+    m_hasBinaryCache = true;
+    m_dirty = false;
+    m_subtreeDirty = false;
+}
+
 bool DatasaveObject::SaveToXml(pugi::xml_document& document) const
 {
     pugi::xml_node datasaveNode = document.append_child("Datasave");
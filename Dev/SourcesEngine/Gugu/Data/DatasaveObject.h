@@ -4,8 +4,10 @@
 // Includes
 
 #include "Gugu/Data/DataObject.h"
+#include "Gugu/System/Types.h"
 
 #include <string>
+#include <vector>
 
 ////////////////////////////////////////////////////////////////
 // Forward Declarations
@@ -14,6 +16,9 @@ namespace gugu
 {
     struct DataParseContext;
     struct DataSaveContext;
+    struct DataBinaryReadContext;
+    struct DataBinaryWriteContext;
+    struct DataBinaryInstanceRecord;
 }
 
 namespace pugi
@@ -38,14 +43,67 @@ public:
     bool SaveToFile(const std::string& path) const;
     bool SaveToString(std::string& result) const;
 
+    // Binary format, faster and smaller than the xml format (which stays available for debugging).
+    // - The root object type needs to match the saved type, members are matched by tags.
+    bool LoadFromBinaryFile(const std::string& path);
+    bool LoadFromBinaryBuffer(const std::vector<uint8>& buffer);
+
+    bool SaveToBinaryFile(const std::string& path) const;
+    bool SaveToBinaryBuffer(std::vector<uint8>& buffer) const;
+
+    // Incremental binary save : objects that are not dirty since the previous incremental save reuse their previous serialized data.
+    // - Each object keeps a copy of its own records, the records of its nested instances are spliced in when writing.
+    // - This is meant for autosaves of large datasaves (see DatasaveWriter).
+    bool SaveToIncrementalBinaryBuffer(std::vector<uint8>& buffer, size_t& reusedSize) const;
+
+    // Dirty tracking, used by incremental saves.
+    // - The generated setters call SetDirty, members modified directly need an explicit call.
+    // - Added, removed or replaced nested instances are detected when refreshing the dirty state.
+    void SetDirty();
+    bool IsDirty() const;
+
+    // Refresh the dirty state of the object and its nested instances, return true if any of them is dirty.
+    bool UpdateDirtyState() const;
+
+    // Binary serialization of the members records (see DatasaveObject::SaveToIncrementalBinaryBuffer).
+    void WriteBinaryRecords(DataBinaryWriteContext& context) const;
+
     virtual void ParseMembers(DataParseContext& _kContext) = 0;
     virtual void SerializeMembers(DataSaveContext& _kContext) const = 0;
 
+    virtual void SerializeBinaryMembers(DataBinaryWriteContext& context) const = 0;
+    virtual bool DeserializeBinaryMember(DataBinaryReadContext& context, uint32 memberTag) = 0;
+
+    // Hash of the members layout (names and types), generated by the binding tool.
+    virtual uint64 GetBinarySchemaHash() const = 0;
+
+    // Nested instances in serialization order, generated by the binding tool.
+    virtual void GetDatasaveInstances(std::vector<const DatasaveObject*>& instances) const = 0;
+
     virtual const std::string& GetDataInstanceType() const = 0;
 
 private:
 
     bool SaveToXml(pugi::xml_document& document) const;
+
+    bool UpdateDirtyState(std::vector<const DatasaveObject*>& instances) const;
+    void WriteCachedBinaryRecords(DataBinaryWriteContext& context) const;
+    void UpdateBinaryCache(const DataBinaryWriteContext& context, size_t startPosition, const std::vector<DataBinaryInstanceRecord>& instanceRecords) const;
+
+private:
+
+    // Nested instance records are spliced in the cached records at their offset.
+    struct CachedInstance
+    {
+        size_t offset = 0;
+        const DatasaveObject* instance = nullptr;
+    };
+
+    mutable bool m_dirty;
+    mutable bool m_subtreeDirty;
+    mutable bool m_hasBinaryCache;
+    mutable std::vector<uint8> m_binaryCache;
+    mutable std::vector<CachedInstance> m_cachedInstances;
 };
 
 }   // namespace gugu
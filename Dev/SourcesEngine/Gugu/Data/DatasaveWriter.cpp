@@ -0,0 +1,171 @@
+////////////////////////////////////////////////////////////////
+// Header
+
+#include "Gugu/Common.h"
+#include "Gugu/Data/DatasaveWriter.h"
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/Engine.h"
+#include "Gugu/Data/DatasaveObject.h"
+#include "Gugu/System/Memory.h"
+#include "Gugu/System/Path.h"
+#include "Gugu/System/Platform.h"
+#include "Gugu/System/String.h"
+#include "Gugu/System/ThreadPool.h"
+#include "Gugu/Debug/Logger.h"
+
+#include <SFML/System/Clock.hpp>
+
+#include <algorithm>
+
+////////////////////////////////////////////////////////////////
+// File Implementation
+
+namespace gugu {
+
+DatasaveWriter::DatasaveWriter()
+    : m_pendingSaveCount(0)
+    , m_isWriting(false)
+{
+}
+
+DatasaveWriter::~DatasaveWriter()
+{
+    WaitPendingSaves();
+}
+
+bool DatasaveWriter::SaveAsync(const DatasaveObject* datasave, const std::string& path_utf8, const DelegateSaveCompleted& delegateCompleted)
+{
+    if (!datasave || path_utf8.empty())
+        return false;
+
+    sf::Clock clock;
+
+    WriteRequest* request = new WriteRequest;
+    request->path = path_utf8;
+    request->delegateCompleted = delegateCompleted;
+
+    size_t reusedSize = 0;
+    if (!datasave->SaveToIncrementalBinaryBuffer(request->data, reusedSize))
+    {
+        SafeDelete(request);
+        return false;
+    }
+
+    float snapshotTimeMs = static_cast<float>(static_cast<double>(clock.getElapsedTime().asMicroseconds()) / 1000.0);
+
+    m_stats.saveCount += 1;
+    m_stats.lastSnapshotTimeMs = snapshotTimeMs;
+    m_stats.maxSnapshotTimeMs = std::max(m_stats.maxSnapshotTimeMs, snapshotTimeMs);
+    m_stats.lastSnapshotSize = request->data.size();
+    m_stats.lastReusedSize = reusedSize;
+
+    m_pendingSaveCount += 1;
+
+    bool startWriting = false;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queuedWrites.push_back(request);
+
+        if (!m_isWriting)
+        {
+            m_isWriting = true;
+            startWriting = true;
+        }
+    }
+
+    // A single task processes the queue, to keep successive saves of the same file in order.
+    if (startWriting)
+    {
+        GetEngine()->GetThreadPool()->PushTask([this]()
+        {
+            ProcessWrites();
+        });
+    }
+
+    return true;
+}
+
+void DatasaveWriter::ProcessWrites()
+{
+    while (true)
+    {
+        WriteRequest* request = nullptr;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_queuedWrites.empty())
+            {
+                // The writer may be destroyed as soon as the lock is released, it should not be accessed anymore.
+                m_isWriting = false;
+                m_conditionWriteCompleted.notify_all();
+                return;
+            }
+
+            request = m_queuedWrites.front();
+            m_queuedWrites.pop_front();
+        }
+
+        request->success = EnsureDirectoryExists(DirectoryPartFromPath(request->path))
+            && ReplaceFileContent(request->path, request->data);
+
+        // The snapshot is not needed anymore, release it before the notification.
+        std::vector<uint8>().swap(request->data);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_completedWrites.push_back(request);
+    }
+}
+
+void DatasaveWriter::Step()
+{
+    std::vector<WriteRequest*> completedWrites;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        completedWrites.swap(m_completedWrites);
+    }
+
+    for (WriteRequest* request : completedWrites)
+    {
+        m_pendingSaveCount -= 1;
+
+        if (!request->success)
+        {
+            m_stats.failedWriteCount += 1;
+            GetLogEngine()->Print(ELog::Error, ELogEngine::Databinding, StringFormat("Could not write datasave : {0}", request->path));
+        }
+
+        if (request->delegateCompleted)
+        {
+            request->delegateCompleted(request->path, request->success);
+        }
+
+        SafeDelete(request);
+    }
+}
+
+void DatasaveWriter::WaitPendingSaves()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_conditionWriteCompleted.wait(lock, [this]() { return !m_isWriting && m_queuedWrites.empty(); });
+    }
+
+    Step();
+}
+
+bool DatasaveWriter::IsSavePending() const
+{
+    return m_pendingSaveCount > 0;
+}
+
+const DatasaveWriter::Stats& DatasaveWriter::GetStats() const
+{
+    return m_stats;
+}
+
+}   // namespace gugu
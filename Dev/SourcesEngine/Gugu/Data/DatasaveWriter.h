@@ -0,0 +1,92 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/System/Types.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// Forward Declarations
+
+namespace gugu
+{
+    class DatasaveObject;
+}
+
+////////////////////////////////////////////////////////////////
+// File Declarations
+
+namespace gugu {
+
+// Asynchronous datasave writer, meant for autosaves.
+// - The datasave is captured in a binary snapshot on the main thread, reusing the data of objects that are not dirty since the previous save.
+// - The snapshot is written on a worker thread in a temporary file flushed to the disk, then renamed to the target path (an interrupted write keeps the previous save intact).
+// - Writes are processed one at a time, in submission order.
+class DatasaveWriter
+{
+public:
+
+    using DelegateSaveCompleted = std::function<void(const std::string& path, bool success)>;
+
+    struct Stats
+    {
+        size_t saveCount = 0;
+        size_t failedWriteCount = 0;
+        float lastSnapshotTimeMs = 0.f;     // Main thread stall of the last save.
+        float maxSnapshotTimeMs = 0.f;
+        size_t lastSnapshotSize = 0;
+        size_t lastReusedSize = 0;          // Part of the last snapshot reused from unchanged objects.
+    };
+
+public:
+
+    DatasaveWriter();
+    ~DatasaveWriter();  // Pending writes will be completed before destruction.
+
+    // The datasave can be modified as soon as this returns.
+    // - The delegate will be called from the main thread, during Step or WaitPendingSaves.
+    bool SaveAsync(const DatasaveObject* datasave, const std::string& path_utf8, const DelegateSaveCompleted& delegateCompleted = nullptr);
+
+    // Notify completed writes, should be called regularly from the main thread.
+    void Step();
+
+    // Block until all pending writes are completed, and notify them.
+    void WaitPendingSaves();
+
+    bool IsSavePending() const;
+
+    const Stats& GetStats() const;
+
+private:
+
+    struct WriteRequest
+    {
+        std::string path;
+        std::vector<uint8> data;
+        DelegateSaveCompleted delegateCompleted;
+        bool success = false;
+    };
+
+    void ProcessWrites();
+
+private:
+
+    Stats m_stats;
+    size_t m_pendingSaveCount;
+
+    std::deque<WriteRequest*> m_queuedWrites;
+    std::vector<WriteRequest*> m_completedWrites;
+    bool m_isWriting;
+
+    std::mutex m_mutex;
+    std::condition_variable m_conditionWriteCompleted;
+};
+
+}   // namespace gugu
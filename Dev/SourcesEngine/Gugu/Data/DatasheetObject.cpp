@@ -29,16 +29,30 @@ DatasheetObject::~DatasheetObject()
 {
 }
 
-bool DatasheetObject::LoadFromFile(const std::string& path, Datasheet* ownerDatasheet, std::vector<Datasheet*>& ancestors)
+bool DatasheetObject::LoadFromFile(const Datasheet* sourceDatasheet, Datasheet* ownerDatasheet, std::vector<Datasheet*>& ancestors)
 {
-    // This will only be true for the actual datasheet, and false when parsing parent datasheets.
-    bool isActualRoot = ancestors.size() == 1;
-    
+    // The actual datasheet is parsed once, parent datasheets keep their parsed document to share it with all their descendants.
+    if (sourceDatasheet != ownerDatasheet)
+    {
+        const pugi::xml_document* parentDocument = sourceDatasheet->GetParsedDocument();
+        if (!parentDocument)
+            return false;
+
+        return LoadFromDocument(*parentDocument, ownerDatasheet, ancestors);
+    }
+
     pugi::xml_document document;
-    pugi::xml_parse_result result = document.load_file(path.c_str());
-    if (!result)
+    if (!sourceDatasheet->LoadXmlDocument(document))
         return false;
 
+    return LoadFromDocument(document, ownerDatasheet, ancestors);
+}
+
+bool DatasheetObject::LoadFromDocument(const pugi::xml_document& document, Datasheet* ownerDatasheet, std::vector<Datasheet*>& ancestors)
+{
+    // This will only be true for the actual datasheet, and false when parsing parent datasheets.
+    bool isActualRoot = ancestors.size() == 1;
+
     pugi::xml_node datasheetNode = document.child("Datasheet");
     if (datasheetNode.empty())
         return false;
@@ -83,8 +97,13 @@ bool DatasheetObject::LoadFromFile(const std::string& path, Datasheet* ownerData
             }
             else
             {
+                if (isActualRoot)
+                {
+                    ownerDatasheet->m_parentDatasheet = parentSheet;
+                }
+
                 ancestors.push_back(parentSheet);
-                LoadFromFile(parentSheet->GetFileInfo().GetFileSystemPath(), ownerDatasheet, ancestors);
+                LoadFromFile(parentSheet, ownerDatasheet, ancestors);
             }
         }
     }
@@ -18,6 +18,11 @@ namespace gugu
     class Datasheet;
 }
 
+namespace pugi
+{
+    class xml_document;
+}
+
 ////////////////////////////////////////////////////////////////
 // File Declarations
 
@@ -30,7 +35,9 @@ public:
     DatasheetObject();
     virtual ~DatasheetObject();
 
-    bool LoadFromFile(const std::string& path, Datasheet* ownerDatasheet, std::vector<class Datasheet*>& ancestors);
+    // The source datasheet is either the owner datasheet, or one of its ancestors.
+    bool LoadFromFile(const Datasheet* sourceDatasheet, Datasheet* ownerDatasheet, std::vector<class Datasheet*>& ancestors);
+    bool LoadFromDocument(const pugi::xml_document& document, Datasheet* ownerDatasheet, std::vector<class Datasheet*>& ancestors);
 
     virtual void ParseMembers(DataParseContext& _kContext) = 0;
 
@@ -3,17 +3,18 @@
 ////////////////////////////////////////////////////////////////
 // Includes
 
-#include <string>
+#include "Gugu/System/StringTable.h"
 
 ////////////////////////////////////////////////////////////////
 // File Declarations
 
 namespace gugu {
 
+// Keys and workstrings are interned, they are often shared between datasheets and localization tables.
 struct LocalizedString
 {
-    std::string key;
-    std::string workstring;
+    InternedString key;
+    InternedString workstring;
 };
 
 }   // namespace gugu
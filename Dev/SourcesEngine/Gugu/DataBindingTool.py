@@ -33,6 +33,12 @@ class DefinitionBinding():
         self.dictEnums = {}
         self.dictClassNames = {}    # dictionary of string (name) > string (class) (TODO: clean and merge with self.classes)
         
+    def IsArenaClass(self, _className):
+        for definitionClass in self.classes:
+            if definitionClass.name == _className:
+                return definitionClass.isArenaStorage
+        return False
+        
 class DefinitionEnum():
     def __init__(self):
         self.name = ''
@@ -59,6 +65,7 @@ class DefinitionEnum():
         
         _file.write('\n')
         _file.write('    const gugu::DataEnumInfos* GetDataEnumInfos();\n')
+        _file.write('    const gugu::DataEnumTable& GetDataEnumTable();\n')
         _file.write('    void GetEnumValues(std::vector<'+ self.code +'::Type>& enumValues);\n')
         _file.write('    size_t GetSize();\n')
         _file.write('\n')
@@ -72,6 +79,25 @@ class DefinitionEnum():
         _file.write('namespace '+ self.code +'\n')
         _file.write('{\n')
         
+        # Constant names table, sorted values allow binary searches when parsing.
+        if len(self.values) > 0:
+            _file.write('    static constexpr std::string_view enumNames[] =\n')
+            _file.write('    {\n')
+            for enumValue in self.values:
+                _file.write('        "'+ enumValue.name +'",\n')
+            _file.write('    };\n')
+            _file.write('\n')
+            _file.write('    static constexpr int enumSortedValues[] =\n')
+            _file.write('    {\n')
+            for index in sorted(range(len(self.values)), key=lambda i: self.values[i].name):
+                _file.write('        '+ str(index) +',    // '+ self.values[index].name +'\n')
+            _file.write('    };\n')
+            _file.write('\n')
+            _file.write('    static constexpr gugu::DataEnumTable enumTable = { enumNames, enumSortedValues, '+ str(len(self.values)) +' };\n')
+        else:
+            _file.write('    static constexpr gugu::DataEnumTable enumTable = { nullptr, nullptr, 0 };\n')
+        _file.write('\n')
+        
         _file.write('    void Register()\n')
         _file.write('    {\n')
         _file.write('        gugu::DataEnumInfos* enumInfos = new gugu::DataEnumInfos;\n')
@@ -88,6 +114,12 @@ class DefinitionEnum():
         _file.write('        return gugu::GetResources()->GetDataEnumInfos("'+ self.name +'");\n')
         _file.write('    }\n')
         
+        _file.write('\n')
+        _file.write('    const gugu::DataEnumTable& GetDataEnumTable()\n')
+        _file.write('    {\n')
+        _file.write('        return enumTable;\n')
+        _file.write('    }\n')
+        
         _file.write('\n')
         _file.write('    void GetEnumValues(std::vector<'+ self.code +'::Type>& enumValues)\n')
         _file.write('    {\n')
@@ -120,11 +152,22 @@ class DefinitionMember():
         self.code = ''
         self.type = ''
         self.isLocalized = False
+        self.isInterned = False     # String members stored in the engine StringTable (datasheets only).
         self.isArray = False
         self.isReference = False
         self.isInstance = False
         self.default = ''
         
+    def GetSchemaType(self):
+        schemaType = ''
+        if self.isArray:
+            schemaType += 'array:'
+        if self.isReference:
+            schemaType += 'reference:'
+        if self.isInstance:
+            schemaType += 'instance:'
+        return schemaType + self.type
+        
     def ParseType(self, _strType):
         aFlags = _strType.split(':')
         if len(aFlags) > 0:
@@ -189,9 +232,45 @@ class DefinitionClass():
         self.type = 'datasheet'
         self.baseClassName = ''
         self.isAbstract = False
+        self.isArenaStorage = False     # Instances allocated in a per-class DataObjectArena, references to this class use compact indices.
         self.members = []
         self.methods = []
 
+    def GetHierarchy(self, _definitionBinding):
+        # Classes from the root ancestor to this class.
+        hierarchy = [self]
+        for definitionClass in _definitionBinding.classes:
+            if definitionClass.name == self.baseClassName and definitionClass not in hierarchy:
+                hierarchy = definitionClass.GetHierarchy(_definitionBinding) + hierarchy
+                break
+        return hierarchy
+
+    def GetBinarySchemaHash(self, _definitionBinding):
+        # Members layout of the whole hierarchy, any change will modify the hash.
+        schema = ''
+        for definitionClass in self.GetHierarchy(_definitionBinding):
+            schema += definitionClass.name +'{'
+            for member in definitionClass.members:
+                schema += member.GetSchemaType() +' '+ member.name +';'
+            schema += '}'
+        return HashFnv1a(schema, 64)
+
+    def GetBinaryMemberTags(self, _definitionBinding):
+        # Tags are the 32 bits hash of member names, they need to be unique in the whole hierarchy (the null tag is reserved).
+        memberTags = {}
+        usedTags = {0: ''}
+        for definitionClass in self.GetHierarchy(_definitionBinding):
+            for member in definitionClass.members:
+                if member.type != '' and member.name != '' and member.code != '':
+                    tag = HashFnv1a(member.name, 32)
+                    if tag in usedTags:
+                        print('Error : Binary tag collision between members "'+ member.name +'" and "'+ usedTags[tag] +'" in class "'+ self.name +'", skipping binary serialization for "'+ member.name +'".')
+                        continue
+                    usedTags[tag] = member.name
+                    if definitionClass == self:
+                        memberTags[member.name] = tag
+        return memberTags
+
     def SaveForwardDeclarationCpp(self, _file):
         _file.write('class '+ self.code +';\n')
 
@@ -202,6 +281,76 @@ class DefinitionClass():
             _file.write('        return new '+ self.code +';\n')
             _file.write('    }\n')
 
+    def GetMemberTypeCpp(self, _member, _definitionBinding):
+        strType = ''
+            
+        if _member.isReference and self.type == 'datasheet' and _definitionBinding.IsArenaClass(_member.type):
+            strType = 'gugu::DataArenaRef<'
+            strType += _definitionBinding.dictClassNames[_member.type]
+            strType += '>'
+        elif _member.isReference:
+            strType = 'const '
+            strType += _definitionBinding.dictClassNames[_member.type]
+            strType += '*'
+        elif _member.isInstance:
+            if self.type == 'datasheet':
+                strType = 'const '
+            strType += _definitionBinding.dictClassNames[_member.type]
+            strType += '*'
+        elif _member.type in _definitionBinding.dictEnums:
+            strType = _definitionBinding.dictEnums[_member.type].code
+            strType += '::Type'
+        elif _member.isLocalized:
+            if _member.type == 'string':
+                strType = 'gugu::LocalizedString'
+        elif _member.isInterned:
+            if _member.type == 'string':
+                strType = 'gugu::InternedString'
+        else:
+            if _member.type == 'string':
+                strType = 'std::string'
+            elif _member.type == 'int':
+                strType = 'int'
+            elif _member.type == 'float':
+                strType = 'float'
+            elif _member.type == 'bool':
+                strType = 'bool'
+            elif _member.type == 'vector2i':
+                strType += 'gugu::Vector2i'
+            elif _member.type == 'vector2f':
+                strType += 'gugu::Vector2f'
+            else:
+                return ''
+            
+        if _member.isArray:
+            strType = 'std::vector<'+ strType +'>'
+        
+        return strType
+        
+    def GetSetterMembers(self, _definitionBinding):
+        # Datasave setters mark the object dirty for incremental saves, instances are tracked by the datasave itself.
+        setterMembers = []
+        if self.type != 'datasave':
+            return setterMembers
+        
+        for member in self.members:
+            if member.isInstance:
+                continue
+            
+            strType = self.GetMemberTypeCpp(member, _definitionBinding)
+            if strType == '':
+                continue
+            
+            if member.isArray or member.type in ['string', 'vector2i', 'vector2f']:
+                setterMembers.append((member, 'const '+ strType +'&'))
+            else:
+                setterMembers.append((member, strType))
+        
+        return setterMembers
+        
+    def GetSetterName(self, _member):
+        return 'Set'+ _member.code[:1].upper() + _member.code[1:]
+        
     def SaveDeclarationCpp(self, _file, _definitionBinding):
         _file.write('\n')
         _file.write('////////////////////////////////////////////////////////////////\n')
@@ -223,6 +372,14 @@ class DefinitionClass():
         _file.write('    '+ self.code +'();\n')
         _file.write('    virtual ~'+ self.code +'();\n')
         
+        # Arena Storage
+        if self.isArenaStorage:
+            _file.write('\n')
+            _file.write('    static gugu::DataObjectArena& GetDataArena();\n')
+            _file.write('\n')
+            _file.write('    static void* operator new(size_t size);\n')
+            _file.write('    static void operator delete(void* object);\n')
+        
         # Methods
         if len(self.methods) > 0:
             _file.write('\n')
@@ -237,46 +394,22 @@ class DefinitionClass():
             _file.write('public:\n')
             _file.write('\n')        
             for member in self.members:
-                strType = ''
-                    
-                if member.isReference:
-                    strType = 'const '
-                    strType += _definitionBinding.dictClassNames[member.type]
-                    strType += '*'
-                elif member.isInstance:
-                    if self.type == 'datasheet':
-                        strType = 'const '
-                    strType += _definitionBinding.dictClassNames[member.type]
-                    strType += '*'
-                elif member.type in _definitionBinding.dictEnums:
-                    strType = _definitionBinding.dictEnums[member.type].code
-                    strType += '::Type'
-                elif member.isLocalized:
-                    if member.type == 'string':
-                        strType = 'gugu::LocalizedString'
-                else:
-                    if member.type == 'string':
-                        strType = 'std::string'
-                    elif member.type == 'int':
-                        strType = 'int'
-                    elif member.type == 'float':
-                        strType = 'float'
-                    elif member.type == 'bool':
-                        strType = 'bool'
-                    elif member.type == 'vector2i':
-                        strType += 'gugu::Vector2i'
-                    elif member.type == 'vector2f':
-                        strType += 'gugu::Vector2f'
-                        
-                    else:
-                        print('Error : Unkown type "'+member.type+'" for member "'+member.name+'", skipping member declaration.')
-                        continue
-                    
-                if member.isArray:
-                    strType = 'std::vector<'+ strType +'>'
+                strType = self.GetMemberTypeCpp(member, _definitionBinding)
+                if strType == '':
+                    print('Error : Unkown type "'+member.type+'" for member "'+member.name+'", skipping member declaration.')
+                    continue
                     
                 _file.write('    '+ strType +' '+ member.code +';\n')
         
+        # Setters
+        setterMembers = self.GetSetterMembers(_definitionBinding)
+        if len(setterMembers) > 0:
+            _file.write('\n')
+            _file.write('public:\n')
+            _file.write('\n')
+            for member, strParameter in setterMembers:
+                _file.write('    void '+ self.GetSetterName(member) +'('+ strParameter +' value);\n')
+        
         # Parser
         _file.write('\n')
         _file.write('protected:\n')
@@ -287,6 +420,12 @@ class DefinitionClass():
         if self.type == 'datasave':
             _file.write('    virtual void SerializeMembers(gugu::DataSaveContext& context) const override;\n')
             _file.write('\n')
+            _file.write('    virtual void SerializeBinaryMembers(gugu::DataBinaryWriteContext& context) const override;\n')
+            _file.write('    virtual bool DeserializeBinaryMember(gugu::DataBinaryReadContext& context, gugu::uint32 memberTag) override;\n')
+            _file.write('    virtual gugu::uint64 GetBinarySchemaHash() const override;\n')
+            _file.write('\n')
+            _file.write('    virtual void GetDatasaveInstances(std::vector<const gugu::DatasaveObject*>& instances) const override;\n')
+            _file.write('\n')
             _file.write('    virtual const std::string& GetDataInstanceType() const override;\n')
 
         # Finalize
@@ -341,6 +480,25 @@ class DefinitionClass():
                     
         _file.write('}\n')
         
+        # Arena Storage
+        if self.isArenaStorage:
+            _file.write('\n')
+            _file.write('gugu::DataObjectArena& '+ self.code +'::GetDataArena()\n')
+            _file.write('{\n')
+            _file.write('    static gugu::DataObjectArena dataArena(sizeof('+ self.code +'));\n')
+            _file.write('    return dataArena;\n')
+            _file.write('}\n')
+            _file.write('\n')
+            _file.write('void* '+ self.code +'::operator new(size_t size)\n')
+            _file.write('{\n')
+            _file.write('    return GetDataArena().Allocate(size);\n')
+            _file.write('}\n')
+            _file.write('\n')
+            _file.write('void '+ self.code +'::operator delete(void* object)\n')
+            _file.write('{\n')
+            _file.write('    GetDataArena().Deallocate(object);\n')
+            _file.write('}\n')
+        
         # Parser
         _file.write('\n')
         _file.write('void '+ self.code +'::ParseMembers(gugu::DataParseContext& context)\n')
@@ -373,9 +531,9 @@ class DefinitionClass():
                             _file.write('    gugu::binding::ReadDatasaveInstanceArray(context, "'+member.name +'", "'+ member.type +'", '+ member.code +');\n')
                 elif member.type in _definitionBinding.dictEnums:
                     if not member.isArray:
-                        _file.write('    gugu::binding::ReadEnum(context, "'+member.name +'", "'+ member.type +'", '+ member.code +');\n')
+                        _file.write('    gugu::binding::ReadEnum(context, "'+member.name +'", '+ _definitionBinding.dictEnums[member.type].code +'::GetDataEnumTable(), '+ member.code +');\n')
                     else:
-                        _file.write('    gugu::binding::ReadEnumArray(context, "'+member.name +'", "'+ member.type +'", '+ member.code +');\n')
+                        _file.write('    gugu::binding::ReadEnumArray(context, "'+member.name +'", '+ _definitionBinding.dictEnums[member.type].code +'::GetDataEnumTable(), '+ member.code +');\n')
                 else:
                     strMethod = 'gugu::binding::Read'
                     
@@ -385,6 +543,15 @@ class DefinitionClass():
                         else:
                             #print('Error : Unkown type "'+member.type+'" for member "'+member.name+'", skipping parsing method declaration.')
                             continue
+                    elif member.isInterned:
+                        if member.type == 'string':
+                            strMethod += 'InternedString'
+                        else:
+                            #print('Error : Unkown type "'+member.type+'" for member "'+member.name+'", skipping parsing method declaration.')
+                            continue
+                            
+                        if member.isArray:
+                            strMethod += 'Array'
                     else:
                         if member.type == 'string':
                             strMethod += 'String'
@@ -436,9 +603,9 @@ class DefinitionClass():
                             _file.write('    gugu::binding::WriteDatasaveInstanceArray(context, "'+member.name +'", "'+ member.type +'", '+ member.code +');\n')
                     elif member.type in _definitionBinding.dictEnums:
                         if not member.isArray:
-                            _file.write('    gugu::binding::WriteEnum(context, "'+member.name +'", "'+ member.type +'", '+ member.code +');\n')
+                            _file.write('    gugu::binding::WriteEnum(context, "'+member.name +'", '+ _definitionBinding.dictEnums[member.type].code +'::GetDataEnumTable(), '+ member.code +');\n')
                         else:
-                            _file.write('    gugu::binding::WriteEnumArray(context, "'+member.name +'", "'+ member.type +'", '+ member.code +');\n')
+                            _file.write('    gugu::binding::WriteEnumArray(context, "'+member.name +'", '+ _definitionBinding.dictEnums[member.type].code +'::GetDataEnumTable(), '+ member.code +');\n')
                     else:
                         strMethod = 'gugu::binding::Write'
                         
@@ -465,6 +632,17 @@ class DefinitionClass():
                     
             _file.write('}\n')
             
+            # Setters
+            for member, strParameter in self.GetSetterMembers(_definitionBinding):
+                _file.write('\n')
+                _file.write('void '+ self.code +'::'+ self.GetSetterName(member) +'('+ strParameter +' value)\n')
+                _file.write('{\n')
+                _file.write('    '+ member.code +' = value;\n')
+                _file.write('    SetDirty();\n')
+                _file.write('}\n')
+            
+            self.SaveBinaryImplementationCpp(_file, _definitionBinding, parentClassName, hasConcreteParentClass)
+            
             _file.write('\n')
             _file.write('const std::string& '+ self.code +'::GetDataInstanceType() const\n')
             _file.write('{\n')
@@ -473,6 +651,131 @@ class DefinitionClass():
             _file.write('}\n')
 
 
+    def SaveBinaryImplementationCpp(self, _file, _definitionBinding, _parentClassName, _hasConcreteParentClass):
+        memberTags = self.GetBinaryMemberTags(_definitionBinding)
+        binaryMembers = []
+        
+        for member in self.members:
+            if member.name not in memberTags:
+                continue
+            
+            strValue = ''
+            if member.isReference:
+                strValue = 'DatasheetReference'
+            elif member.isInstance:
+                strValue = 'DatasaveInstance'
+            elif member.type in _definitionBinding.dictEnums:
+                strValue = 'Enum'
+            elif member.isLocalized:
+                continue
+            elif member.type == 'string':
+                strValue = 'String'
+            elif member.type == 'int':
+                strValue = 'Int'
+            elif member.type == 'float':
+                strValue = 'Float'
+            elif member.type == 'bool':
+                strValue = 'Bool'
+            elif member.type == 'vector2i' or member.type == 'vector2f':
+                strValue = 'Vector2'
+            else:
+                continue
+            
+            if member.isArray:
+                strValue += 'Array'
+            
+            strEnumTable = ''
+            if member.type in _definitionBinding.dictEnums:
+                strEnumTable = _definitionBinding.dictEnums[member.type].code +'::GetDataEnumTable(), '
+            
+            binaryMembers.append((member, '0x%08x' % memberTags[member.name], strValue, strEnumTable))
+        
+        # Binary Serializer
+        _file.write('\n')
+        _file.write('void '+ self.code +'::SerializeBinaryMembers(gugu::DataBinaryWriteContext& context) const\n')
+        _file.write('{\n')
+        
+        if _hasConcreteParentClass:
+            _file.write('    '+ _parentClassName +'::SerializeBinaryMembers(context);\n')
+            _file.write('\n')
+        else:
+            _file.write('    //'+ _parentClassName +'::SerializeBinaryMembers(context);\n')
+            _file.write('\n')
+        
+        for member, strTag, strValue, strEnumTable in binaryMembers:
+            _file.write('    gugu::binding::WriteBinary'+ strValue +'(context, '+ strTag +', '+ strEnumTable + member.code +');\n')
+        
+        _file.write('}\n')
+        
+        # Binary Deserializer
+        _file.write('\n')
+        _file.write('bool '+ self.code +'::DeserializeBinaryMember(gugu::DataBinaryReadContext& context, gugu::uint32 memberTag)\n')
+        _file.write('{\n')
+        
+        if len(binaryMembers) > 0:
+            _file.write('    switch (memberTag)\n')
+            _file.write('    {\n')
+            for member, strTag, strValue, strEnumTable in binaryMembers:
+                _file.write('    case '+ strTag +':    // '+ member.name +'\n')
+                _file.write('        return gugu::binding::ReadBinary'+ strValue +'(context, '+ strEnumTable + member.code +');\n')
+            _file.write('    }\n')
+            _file.write('\n')
+        
+        if _hasConcreteParentClass:
+            _file.write('    return '+ _parentClassName +'::DeserializeBinaryMember(context, memberTag);\n')
+        else:
+            _file.write('    return false;\n')
+        
+        _file.write('}\n')
+        
+        # Binary Schema
+        _file.write('\n')
+        _file.write('gugu::uint64 '+ self.code +'::GetBinarySchemaHash() const\n')
+        _file.write('{\n')
+        _file.write('    return 0x%016xull;\n' % self.GetBinarySchemaHash(_definitionBinding))
+        _file.write('}\n')
+        
+        # Nested Instances
+        _file.write('\n')
+        _file.write('void '+ self.code +'::GetDatasaveInstances(std::vector<const gugu::DatasaveObject*>& instances) const\n')
+        _file.write('{\n')
+        
+        if _hasConcreteParentClass:
+            _file.write('    '+ _parentClassName +'::GetDatasaveInstances(instances);\n')
+        else:
+            _file.write('    //'+ _parentClassName +'::GetDatasaveInstances(instances);\n')
+        
+        # Same order as the binary serializer, incremental saves splice the instances records in this order.
+        instanceMembers = [member for member, strTag, strValue, strEnumTable in binaryMembers if member.isInstance]
+        if len(instanceMembers) > 0:
+            _file.write('\n')
+        
+        for member in instanceMembers:
+            if member.isArray:
+                _file.write('    gugu::binding::GatherDatasaveInstanceArray(instances, '+ member.code +');\n')
+            else:
+                _file.write('    gugu::binding::GatherDatasaveInstance(instances, '+ member.code +');\n')
+        
+        _file.write('}\n')
+
+
+#------------------------------------------------------
+# Utility
+
+def HashFnv1a(_value, _bits):
+    # FNV-1a hash, on the utf-8 bytes of the value.
+    if _bits == 32:
+        hashValue = 0x811c9dc5
+        prime = 0x01000193
+    else:
+        hashValue = 0xcbf29ce484222325
+        prime = 0x100000001b3
+    mask = (1 << _bits) - 1
+    for byte in _value.encode('utf-8'):
+        hashValue = ((hashValue ^ byte) * prime) & mask
+    return hashValue
+
+
 #------------------------------------------------------
 # Generators
 
@@ -686,6 +989,12 @@ def ParseXmlClass(_xmlClass):
         
     if 'abstract' in _xmlClass.attributes:
         newClass.isAbstract = _xmlClass.attributes['abstract'].value
+        
+    if 'storage' in _xmlClass.attributes:
+        if _xmlClass.attributes['storage'].value == 'arena' and newClass.type == 'datasheet':
+            newClass.isArenaStorage = True
+        else:
+            print('Error : Unknown storage "'+ _xmlClass.attributes['storage'].value +'" (class '+ newClass.name +'), arena storage is only available for datasheets.')
     
     # Methods
     xmlNodeListMethods = _xmlClass.getElementsByTagName('Method')
@@ -716,6 +1025,12 @@ def ParseXmlClass(_xmlClass):
         if 'localized' in xmlMember.attributes:
             newMember.isLocalized = xmlMember.attributes['localized'].value     # TODO: Is there a proper python way to check/convert this to bool ?
 
+        if 'interned' in xmlMember.attributes:
+            if xmlMember.attributes['interned'].value == 'true' and newMember.type == 'string' and newClass.type == 'datasheet':
+                newMember.isInterned = True
+            else:
+                print('Error : Invalid interned member "'+ newMember.name +'" (class '+ newClass.name +'), interning is only available for datasheet string members.')
+
         if 'default' in xmlMember.attributes:
             newMember.default = xmlMember.attributes['default'].value
             
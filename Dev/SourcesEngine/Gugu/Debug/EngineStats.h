@@ -19,6 +19,7 @@ struct EngineStats
     std::list<float> stepTimes;
     std::list<float> updateTimes;
     std::list<float> renderTimes;
+    std::list<float> networkTimes;      // Main thread time spent on received packets, only filled while listening.
     std::list<int> stepCount;
     int animationCount = 0;
     int particleSystemCount = 0;
@@ -37,6 +37,7 @@ StatsDrawer::StatsDrawer()
     , m_statTextAnimations(nullptr)
     , m_statTextParticleSystems(nullptr)
     , m_statTextSoundInstancess(nullptr)
+    , m_statTextNetworkTime(nullptr)
     , m_statTextIsTracing(nullptr)
 {
     m_curveHeight = 50.f;
@@ -135,6 +136,10 @@ StatsDrawer::StatsDrawer()
     m_statTextSoundInstancess->setFillColor(colorDefault);
     m_statTextSoundInstancess->setCharacterSize(fontSize);
 
+    m_statTextNetworkTime = new sf::Text(*font);
+    m_statTextNetworkTime->setFillColor(colorDefault);
+    m_statTextNetworkTime->setCharacterSize(fontSize);
+
     m_statTextIsTracing = new sf::Text(*font);
     m_statTextIsTracing->setFillColor(colorDefault);
     m_statTextIsTracing->setCharacterSize(fontSize);
@@ -158,6 +163,7 @@ StatsDrawer::~StatsDrawer()
     SafeDelete(m_statTextAnimations);
     SafeDelete(m_statTextParticleSystems);
     SafeDelete(m_statTextSoundInstancess);
+    SafeDelete(m_statTextNetworkTime);
     SafeDelete(m_statTextIsTracing);
 }
 
@@ -263,6 +269,7 @@ void StatsDrawer::DrawStats(const FrameInfos& frameInfos, const sf::Time& render
     StatsSummary statsSummaryUpdates;
     StatsSummary statsSummaryRenders;
     StatsSummary statsSummaryDrawCalls;
+    StatsSummary statsSummaryNetwork;
     //StatsSummary statsSummaryStepCount;
 
     {
@@ -272,6 +279,7 @@ void StatsDrawer::DrawStats(const FrameInfos& frameInfos, const sf::Time& render
         ComputeStatsSummary(engineStats.updateTimes, statsSummaryUpdates);
         ComputeStatsSummary(engineStats.renderTimes, statsSummaryRenders);
         ComputeStatsSummary(m_statDrawCalls, statsSummaryDrawCalls);
+        ComputeStatsSummary(engineStats.networkTimes, statsSummaryNetwork);
         //ComputeStatsSummary(engineStats.stepCount, statsSummaryStepCount);
     }
 
@@ -370,6 +378,15 @@ void StatsDrawer::DrawStats(const FrameInfos& frameInfos, const sf::Time& render
         renderWindow->draw(*m_statTextSoundInstancess);
         ++lineCount;
 
+        // Network Times
+        if (!engineStats.networkTimes.empty())
+        {
+            m_statTextNetworkTime->setPosition(Vector2f(positionTextLines.x, positionTextLines.y + textLineOffset * lineCount));
+            m_statTextNetworkTime->setString(StringFormat("network: {0} ms,  max: {1} ms", ToStringf(statsSummaryNetwork.avg, 2), ToStringf(statsSummaryNetwork.max, 2)));
+            renderWindow->draw(*m_statTextNetworkTime);
+            ++lineCount;
+        }
+
         //// IsInputAllowed
         //if (window->IsInputAllowed())
         //{
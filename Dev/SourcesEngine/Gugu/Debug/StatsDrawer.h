@@ -80,6 +80,7 @@ private:
     sf::Text* m_statTextAnimations;
     sf::Text* m_statTextParticleSystems;
     sf::Text* m_statTextSoundInstancess;
+    sf::Text* m_statTextNetworkTime;
     sf::Text* m_statTextIsTracing;
     //sf::Text* m_statTextIsInputAllowed;
 };
@@ -239,6 +239,11 @@ void UnitTestHandler::RunPerformanceTest(size_t warmupLoops, size_t loops, const
     m_logger.Print(StringFormat("Performance Test : avg: {0} ms, total: {1} ms ({2} iterations)", avgTime, totalTime, loops));
 }
 
+void UnitTestHandler::PrintReport(const std::string& report)
+{
+    m_logger.Print(StringFormat("Report : {0}", report));
+}
+
 void UnitTestHandler::FinalizeSection()
 {
     FinalizeSubSection();
@@ -55,6 +55,7 @@ public:
     bool RunTestCheck(bool result, const std::string& expression, const std::string& file, size_t line);
     bool SilentRunTestCheck(bool result, const std::string& expression, const std::string& file, size_t line);
     void RunPerformanceTest(size_t warmupLoops, size_t loops, const std::function<void()>& executionMethod);
+    void PrintReport(const std::string& report);
     
     template<typename T1, typename T2>
     bool RunTestCompare(const T1& left, const T2& right, bool expectedResult, const std::string& expression, const std::string& file, size_t line)
@@ -166,4 +167,7 @@ private:
 #define GUGU_UTEST_PERFORMANCE_WITH_WARMUP(WARMUP_LOOPS, LOOPS, EXECUTION_METHOD)   \
     unitTestHandler.RunPerformanceTest(WARMUP_LOOPS, LOOPS, EXECUTION_METHOD);
 
+#define GUGU_UTEST_REPORT(REPORT)                               \
+    unitTestHandler.PrintReport(REPORT)
+
 }   // namespace gugu
@@ -7,6 +7,7 @@
 ////////////////////////////////////////////////////////////////
 // Includes
 
+#include "Gugu/Engine.h"
 #include "Gugu/Element/ElementData.h"
 #include "Gugu/Element/ElementUtility.h"
 #include "Gugu/Resources/ManagerResources.h"
@@ -23,21 +24,32 @@ namespace gugu {
     
 ElementSprite::ElementSprite()
     : m_texture(nullptr)
+    , m_textureResidencyVersion(0)
 {
 }
 
 ElementSprite::~ElementSprite()
 {
+    ReleasePinnedTexture();
 }
 
 void ElementSprite::SetTexture(const std::string& _strTexturePath, bool updateTextureRect, bool updateSize)
 {
-    SetTexture(GetResources()->GetTexture(_strTexturePath), updateTextureRect, updateSize);
+    Texture* texture = GetResources()->GetTexture(_strTexturePath);
+    SetTexture(texture, updateTextureRect, updateSize);
+
+    if (texture)
+    {
+        m_pinnedTextureId = _strTexturePath;
+    }
 }
 
 void ElementSprite::SetTexture(Texture* _pTexture, bool updateTextureRect, bool updateSize)
 {
+    ReleasePinnedTexture();
+
     m_texture = _pTexture;
+    m_dirtyVertices = true;
 
     if (updateTextureRect)
     {
@@ -69,7 +81,10 @@ void ElementSprite::SetSubImage(SubImage* _pSubImage, bool updateSize)
 {
     if (_pSubImage && _pSubImage->GetImageSet() && _pSubImage->GetImageSet()->GetTexture())
     {
+        ReleasePinnedTexture();
+
         m_texture = _pSubImage->GetImageSet()->GetTexture();
+        m_dirtyVertices = true;
         SetSubRect(_pSubImage->GetRect(), updateSize);
     }
     else
@@ -83,6 +98,20 @@ Texture* ElementSprite::GetTexture() const
     return m_texture;
 }
 
+void ElementSprite::ReleasePinnedTexture()
+{
+    if (m_pinnedTextureId.empty())
+        return;
+
+    // Sprites may be destroyed after the engine release.
+    if (Engine::IsInstanciated())
+    {
+        GetResources()->ReleaseResource(m_pinnedTextureId);
+    }
+
+    m_pinnedTextureId.clear();
+}
+
 void ElementSprite::SetBlendMode(const sf::BlendMode& blendMode)
 {
     m_blendMode = blendMode;
@@ -95,15 +124,22 @@ const sf::BlendMode& ElementSprite::GetBlendMode() const
 
 void ElementSprite::RenderImpl(RenderPass& _kRenderPass, const sf::Transform& _kTransformSelf)
 {
-    if (!m_texture || !m_texture->GetSFTexture())
+    if (!m_texture)
         return;
 
     sf::FloatRect kGlobalTransformed = _kTransformSelf.transformRect(sf::FloatRect(Vector2::Zero_f, m_size));
     if (_kRenderPass.rectViewport.findIntersection(kGlobalTransformed))
     {
-        if (m_dirtyVertices)
+        // Streamed textures use the render scale to select their resident resolution.
+        float renderScale = m_texture->IsStreamed() ? Renderer::ComputeTextureRenderScale(_kRenderPass, kGlobalTransformed, Vector2f(m_subRect.size)) : 1.f;
+        sf::Texture* sfTexture = m_texture->GetRenderSFTexture(renderScale);
+        if (!sfTexture)
+            return;
+
+        if (m_dirtyVertices || m_textureResidencyVersion != m_texture->GetResidencyVersion())
         {
             m_dirtyVertices = false;
+            m_textureResidencyVersion = m_texture->GetResidencyVersion();
 
             RecomputeVerticesPositionAndTextureCoords();
             RecomputeVerticesColor();
@@ -112,7 +148,7 @@ void ElementSprite::RenderImpl(RenderPass& _kRenderPass, const sf::Transform& _k
         // Draw
         sf::RenderStates states;
         states.transform = _kTransformSelf;
-        states.texture = m_texture->GetSFTexture();
+        states.texture = sfTexture;
         states.blendMode = m_blendMode;
         _kRenderPass.target->draw(m_vertices, states);
 
@@ -136,6 +172,17 @@ void ElementSprite::RecomputeVerticesPositionAndTextureCoords()
     m_vertices.resize(count);
 
     ElementSpriteBase::RecomputeVerticesPositionAndTextureCoords(&m_vertices[0]);
+
+    // The fallback of a streamed texture is smaller than the texture size used by the sub rect.
+    Vector2f residentScale = m_texture ? m_texture->GetResidentScale() : Vector2f(1.f, 1.f);
+    if (residentScale != Vector2f(1.f, 1.f))
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            m_vertices[i].texCoords.x *= residentScale.x;
+            m_vertices[i].texCoords.y *= residentScale.y;
+        }
+    }
 }
 
 void ElementSprite::RecomputeVerticesColor()
@@ -38,6 +38,7 @@ public:
 protected:
 
     void RecomputeVerticesPositionAndTextureCoords();
+    void ReleasePinnedTexture();
     void RecomputeVerticesColor();
 
     virtual void RenderImpl(RenderPass& _kRenderPass, const sf::Transform& _kTransformSelf) override;
@@ -47,6 +48,8 @@ protected:
 protected:
 
     Texture* m_texture;
+    std::string m_pinnedTextureId;      // Set when the texture has been retrieved by the sprite itself, its pin is released with the texture.
+    uint32 m_textureResidencyVersion;   // Streamed textures need their texture coordinates to be recomputed when their resident texture changes.
     sf::BlendMode m_blendMode;
     sf::VertexArray m_vertices;
 };
@@ -115,6 +115,8 @@ bool ElementSpriteGroupItem::LoadFromDataImpl(ElementDataContext& context)
 ElementSpriteGroup::ElementSpriteGroup()
     : m_imageSet(nullptr)
     , m_texture(nullptr)
+    , m_textureResidencyVersion(0)
+    , m_dirtyResidentVertices(true)
 {
 }
 
@@ -148,6 +150,7 @@ void ElementSpriteGroup::SetTexture(const std::string& _strTexturePath)
 void ElementSpriteGroup::SetTexture(Texture* _pTexture)
 {
     m_texture = _pTexture;
+    m_dirtyResidentVertices = true;
 }
 
 Texture* ElementSpriteGroup::GetTexture() const
@@ -170,7 +173,7 @@ void ElementSpriteGroup::OnSizeChanged()
 
 void ElementSpriteGroup::RenderImpl(RenderPass& _kRenderPass, const sf::Transform& _kTransformSelf)
 {
-    if (!m_texture || !m_texture->GetSFTexture())
+    if (!m_texture)
         return;
 
     //TODO: maybe need a parameter to bypass this check ?
@@ -179,11 +182,32 @@ void ElementSpriteGroup::RenderImpl(RenderPass& _kRenderPass, const sf::Transfor
     {
         if (m_vertices.getVertexCount() > 0)
         {
+            // Streamed textures use the render scale to select their resident resolution (items are expected to use one texel per unit).
+            float renderScale = m_texture->IsStreamed() ? Renderer::ComputeTextureRenderScale(_kRenderPass, kGlobalTransformed, m_size) : 1.f;
+            sf::Texture* sfTexture = m_texture->GetRenderSFTexture(renderScale);
+            if (!sfTexture)
+                return;
+
             sf::RenderStates states;
             states.transform = _kTransformSelf;
-            states.texture = m_texture->GetSFTexture();
+            states.texture = sfTexture;
             states.blendMode = m_blendMode;
-            _kRenderPass.target->draw(m_vertices, states);
+
+            if (m_texture->GetResidentScale() != Vector2f(1.f, 1.f))
+            {
+                if (m_dirtyResidentVertices || m_textureResidencyVersion != m_texture->GetResidencyVersion())
+                {
+                    m_dirtyResidentVertices = false;
+                    m_textureResidencyVersion = m_texture->GetResidencyVersion();
+                    m_texture->ComputeResidentVertices(&m_vertices[0], m_vertices.getVertexCount(), m_residentVertices);
+                }
+
+                _kRenderPass.target->draw(&m_residentVertices[0], m_residentVertices.size(), sf::PrimitiveType::Triangles, states);
+            }
+            else
+            {
+                _kRenderPass.target->draw(m_vertices, states);
+            }
 
             //Stats
             if (_kRenderPass.frameInfos)
@@ -222,6 +246,7 @@ void ElementSpriteGroup::RecomputeImpl()
     // Reset vertices
     m_vertices.setPrimitiveType(sf::PrimitiveType::Triangles);
     m_vertices.resize(totalVertexCount);
+    m_dirtyResidentVertices = true;
 
     if (totalVertexCount > 0)
     {
@@ -93,6 +93,9 @@ protected:
     Texture* m_texture;
     sf::BlendMode m_blendMode;
     sf::VertexArray m_vertices;
+    std::vector<sf::Vertex> m_residentVertices;     // Vertices scaled to the resident texture, while a streamed texture only has its fallback resident.
+    uint32 m_textureResidencyVersion;
+    bool m_dirtyResidentVertices;
 
     std::vector<ElementSpriteGroupItem*> m_items;    //TODO: Rename as Components ?
 };
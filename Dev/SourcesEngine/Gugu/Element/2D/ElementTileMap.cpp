@@ -23,6 +23,8 @@ namespace gugu {
 
 ElementTileMap::ElementTileMap()
     : m_texture(nullptr)
+    , m_textureResidencyVersion(0)
+    , m_dirtyResidentVertices(true)
 {
 }
 
@@ -38,6 +40,7 @@ void ElementTileMap::SetTexture(const std::string& _strTexturePath)
 void ElementTileMap::SetTexture(Texture* _pTexture)
 {
     m_texture = _pTexture;
+    m_dirtyResidentVertices = true;
 }
 
 Texture* ElementTileMap::GetTexture() const
@@ -129,6 +132,7 @@ void ElementTileMap::BuildFromTileCount(size_t count, const Vector2f& mapSize)
     // Reset vertices.
     m_vertices.setPrimitiveType(sf::PrimitiveType::Triangles);
     m_vertices.resize(count * 6);
+    m_dirtyResidentVertices = true;
 
     SetSize(mapSize);
 }
@@ -146,6 +150,7 @@ void ElementTileMap::UpdateTilePositionAndSize(size_t index, const sf::FloatRect
     float bottom = top + rect.size.y;
 
     sf::Vertex* quad = &m_vertices[index * 6];
+    m_dirtyResidentVertices = true;
 
     quad[0].position = Vector2f(left, top);
     quad[1].position = Vector2f(right, top);
@@ -169,6 +174,7 @@ void ElementTileMap::UpdateTileTextureCoords(size_t index, const sf::IntRect& re
     float bottom = top + (float)rect.size.y;
 
     sf::Vertex* quad = &m_vertices[index * 6];
+    m_dirtyResidentVertices = true;
 
     quad[0].texCoords = Vector2f(left, top);
     quad[1].texCoords = Vector2f(right, top);
@@ -187,6 +193,7 @@ void ElementTileMap::UpdateTileColor(size_t x, size_t y, size_t width, const sf:
 void ElementTileMap::UpdateTileColor(size_t index, const sf::Color& color)
 {
     sf::Vertex* quad = &m_vertices[index * 6];
+    m_dirtyResidentVertices = true;
 
     quad[0].color = color;
     quad[1].color = color;
@@ -199,7 +206,7 @@ void ElementTileMap::UpdateTileColor(size_t index, const sf::Color& color)
 
 void ElementTileMap::RenderImpl(RenderPass& _kRenderPass, const sf::Transform& _kTransformSelf)
 {
-    if (!m_texture || !m_texture->GetSFTexture())
+    if (!m_texture)
         return;
 
     //TODO: maybe need a parameter to bypass this check ?
@@ -208,11 +215,32 @@ void ElementTileMap::RenderImpl(RenderPass& _kRenderPass, const sf::Transform& _
     {
         if (m_vertices.getVertexCount() > 0)
         {
+            // Streamed textures use the render scale to select their resident resolution (tiles are expected to use one texel per unit).
+            float renderScale = m_texture->IsStreamed() ? Renderer::ComputeTextureRenderScale(_kRenderPass, kGlobalTransformed, m_size) : 1.f;
+            sf::Texture* sfTexture = m_texture->GetRenderSFTexture(renderScale);
+            if (!sfTexture)
+                return;
+
             sf::RenderStates states;
             states.transform = _kTransformSelf;
-            states.texture = m_texture->GetSFTexture();
+            states.texture = sfTexture;
             states.blendMode = m_blendMode;
-            _kRenderPass.target->draw(m_vertices, states);
+
+            if (m_texture->GetResidentScale() != Vector2f(1.f, 1.f))
+            {
+                if (m_dirtyResidentVertices || m_textureResidencyVersion != m_texture->GetResidencyVersion())
+                {
+                    m_dirtyResidentVertices = false;
+                    m_textureResidencyVersion = m_texture->GetResidencyVersion();
+                    m_texture->ComputeResidentVertices(&m_vertices[0], m_vertices.getVertexCount(), m_residentVertices);
+                }
+
+                _kRenderPass.target->draw(&m_residentVertices[0], m_residentVertices.size(), sf::PrimitiveType::Triangles, states);
+            }
+            else
+            {
+                _kRenderPass.target->draw(m_vertices, states);
+            }
 
             //Stats
             if (_kRenderPass.frameInfos)
@@ -12,6 +12,7 @@
 #include "Gugu/Events/ElementEventHandler.h"
 #include "Gugu/Resources/ManagerResources.h"
 #include "Gugu/Resources/ElementWidget.h"
+#include "Gugu/Scene/ManagerScenes.h"
 #include "Gugu/Window/Renderer.h"
 #include "Gugu/Math/MathUtility.h"
 #include "Gugu/System/Container.h"
@@ -34,6 +35,7 @@ Element::Element()
     , m_renderPass(GUGU_RENDERPASS_DEFAULT)
     , m_zIndex(0)
     , m_showDebugBounds(false)
+    , m_interpolationState(nullptr)
     , m_useDimOrigin(false)
     , m_useDimPosition(false)
     , m_useDimSize(false)
@@ -55,6 +57,7 @@ Element::~Element()
     }
 
     ClearSizeReference();
+    SetTransformInterpolation(false);
 
     //SafeDelete(m_pShader);
 
@@ -489,6 +492,55 @@ const sf::Transform& Element::GetInverseTransform() const
     return m_transform.getInverseTransform();
 }
 
+void Element::SetTransformInterpolation(bool interpolate)
+{
+    if (interpolate == (m_interpolationState != nullptr))
+        return;
+
+    if (interpolate)
+    {
+        m_interpolationState = new InterpolationState;
+        SaveInterpolationState();
+
+        GetScenes()->RegisterInterpolatedElement(this);
+    }
+    else
+    {
+        GetScenes()->UnregisterInterpolatedElement(this);
+
+        SafeDelete(m_interpolationState);
+    }
+}
+
+bool Element::IsTransformInterpolated() const
+{
+    return m_interpolationState != nullptr;
+}
+
+void Element::SaveInterpolationState()
+{
+    if (m_interpolationState)
+    {
+        m_interpolationState->position = m_transform.getPosition();
+        m_interpolationState->rotation = m_transform.getRotation();
+        m_interpolationState->scale = m_transform.getScale();
+    }
+}
+
+sf::Transform Element::ComputeInterpolatedTransform(float ratio) const
+{
+    if (!m_interpolationState || ratio >= 1.f)
+        return GetTransform();
+
+    // Rotation is blended along the shortest path.
+    sf::Transformable interpolated;
+    interpolated.setOrigin(m_transform.getOrigin());
+    interpolated.setPosition(Lerp(m_interpolationState->position, m_transform.getPosition(), ratio));
+    interpolated.setRotation(m_interpolationState->rotation + (m_transform.getRotation() - m_interpolationState->rotation).wrapSigned() * ratio);
+    interpolated.setScale(Lerp(m_interpolationState->scale, m_transform.getScale(), ratio));
+    return interpolated.getTransform();
+}
+
 void Element::GetGlobalCorners(Vector2f& topLeft, Vector2f& topRight, Vector2f& bottomLeft, Vector2f& bottomRight) const
 {
     topLeft = TransformToGlobal(Vector2::Zero_f);
@@ -755,7 +807,7 @@ void Element::Render(RenderPass& _kRenderPass, const sf::Transform& _kTransformP
     {
         RecomputeIfNeeded();
 
-        sf::Transform combinedTransform = _kTransformParent * GetTransform();
+        sf::Transform combinedTransform = _kTransformParent * (m_interpolationState ? ComputeInterpolatedTransform(_kRenderPass.stepInterpolation) : GetTransform());
 
         if ((_kRenderPass.pass & m_renderPass) != GUGU_RENDERPASS_INVALID)
         {
@@ -145,6 +145,14 @@ public:
     const sf::Transform& GetTransform() const;
     const sf::Transform& GetInverseTransform() const;
 
+    // Transform interpolation will blend the rendered transform between the previous and current step states.
+    // - This is useful for Elements moved during steps, when the render framerate is higher than the step rate.
+    // - SaveInterpolationState can be called after a teleport to skip the blending.
+    void SetTransformInterpolation(bool interpolate);
+    bool IsTransformInterpolated() const;
+    void SaveInterpolationState();
+    sf::Transform ComputeInterpolatedTransform(float ratio) const;
+
     // Get the Element local bounds corners (based on its position and size) projected into global space.
     void GetGlobalCorners(Vector2f& topLeft, Vector2f& topRight, Vector2f& bottomLeft, Vector2f& bottomRight) const;
 
@@ -282,6 +290,15 @@ protected:
 
     bool m_showDebugBounds;
 
+    struct InterpolationState
+    {
+        Vector2f position;
+        sf::Angle rotation;
+        Vector2f scale;
+    };
+
+    InterpolationState* m_interpolationState;
+
     //sf::Shader* m_pShader;
 
     //----------------------------------------------
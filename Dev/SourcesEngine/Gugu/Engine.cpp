@@ -20,6 +20,7 @@
 #include "Gugu/System/Container.h"
 #include "Gugu/System/String.h"
 #include "Gugu/System/Path.h"
+#include "Gugu/System/ThreadPool.h"
 #include "Gugu/Math/MathUtility.h"
 #include "Gugu/Math/Random.h"
 #include "Gugu/Debug/Logger.h"
@@ -45,6 +46,7 @@ Engine::Engine()
     , m_managerAnimations(nullptr)
     , m_managerVisualEffects(nullptr)
     , m_managerScenes(nullptr)
+    , m_threadPool(nullptr)
     , m_logEngine(nullptr)
     , m_traceGroupMain(nullptr)
     , m_traceLifetime(0)
@@ -52,7 +54,7 @@ Engine::Engine()
     , m_gameWindow(nullptr)
     , m_defaultRenderer(nullptr)
     , m_stopLoop(false)
-    , m_timeSinceLastStep(sf::Time::Zero)
+    , m_stepInterpolation(1.f)
     , m_useSpeedMultiplier(false)
     , m_speedMultiplier(1.f)
     , m_pauseLoop(false)
@@ -108,6 +110,10 @@ void Engine::Init(const EngineConfig& config)
     NormalizePathSelf(m_engineConfig.pathAssets);
     NormalizePathSelf(m_engineConfig.pathScreenshots);
 
+    //-- Init Worker Threads --//
+    m_threadPool = new ThreadPool;
+    m_threadPool->Start(static_cast<size_t>(Max(0, m_engineConfig.workerThreadCount)));
+
     //-- Init Managers --//
     m_managerResources = new ManagerResources;
     m_managerInputs = new ManagerInputs;
@@ -173,6 +179,9 @@ void Engine::Release()
 
     SafeDelete(m_defaultRenderer);
 
+    // Pending background tasks are completed before releasing the managers.
+    m_threadPool->Stop();
+
     m_managerScenes->Release();
     m_managerInputs->Release();
     m_managerVisualEffects->Release();
@@ -188,6 +197,8 @@ void Engine::Release()
     SafeDelete(m_managerNetwork);
     SafeDelete(m_managerResources);
 
+    SafeDelete(m_threadPool);
+
     SafeDelete(m_traceGroupMain);
 
     GetLogEngine()->Print(ELog::Info, ELogEngine::Engine, "Gugu::Engine Stop");
@@ -216,7 +227,7 @@ void Engine::RunMainLoop()
 
     // Init loop variables.
     sf::Time loopTime = sf::Time::Zero;   //Time since last Loop.
-    m_timeSinceLastStep = sf::Time::Zero;   //Time since last Step.
+    m_stepAccumulator.Reset();
 
     // Loop !
     while (!m_stopLoop)
@@ -293,8 +304,7 @@ void Engine::RunSingleLoop(const sf::Time& loopTime)
         stepDeltaScale = 1.f;
     }
 
-    // Compute delta times.
-    DeltaTime dt_update(updateTimeScaled, updateTimeUnscaled, updateDeltaScale);
+    // Compute step delta time (update delta time will be computed after the steps, to include the interpolation ratio).
     DeltaTime dt_step(stepTimeScaled, stepTimeUnscaled, stepDeltaScale);
 
     // Prepare clocks for stats.
@@ -307,8 +317,37 @@ void Engine::RunSingleLoop(const sf::Time& loopTime)
     //-- Network Reception --//
     if (m_managerNetwork->IsListening())
     {
-        //m_managerNetwork->StepReception();
+        GUGU_SCOPE_TRACE_MAIN("Network Reception");
+        clockStatSection.restart();
+
         m_managerNetwork->ProcessWaitingPackets();
+
+        m_stats.networkTimes.push_front(static_cast<float>(static_cast<double>(clockStatSection.getElapsedTime().asMicroseconds()) / 1000.0));
+        if (m_stats.networkTimes.size() > m_stats.maxStatCount)
+        {
+            m_stats.networkTimes.pop_back();
+        }
+    }
+
+    //-- Asynchronous Loads --//
+    {
+        GUGU_SCOPE_TRACE_MAIN("Async Loads");
+
+        m_managerResources->ProcessAsyncLoads();
+    }
+
+    //-- Resources Eviction --//
+    {
+        GUGU_SCOPE_TRACE_MAIN("Resources Eviction");
+
+        m_managerResources->ProcessEvictions();
+    }
+
+    //-- Texture Streaming --//
+    {
+        GUGU_SCOPE_TRACE_MAIN("Texture Streaming");
+
+        m_managerResources->ProcessTextureStreaming();
     }
 
     //-- Events --//
@@ -346,20 +385,15 @@ void Engine::RunSingleLoop(const sf::Time& loopTime)
 
         //Step
         bool allowNextStep = true;
-        bool allowMultipleSteps = false;
         if (m_engineConfig.useConstantStep)
         {
-            m_timeSinceLastStep += updateTimeScaled;
-            allowNextStep = m_timeSinceLastStep >= stepTimeScaled;
-
-            // If app is running with modulated speed, we may need to compute several steps per loop.
-            // This will also happen if step time is lower than loop time, but for now I prefer to enforce a single step per loop.
-            // I could add some settings to allow multiple steps per loop (maybe with a limit setting).
-            allowMultipleSteps = m_useSpeedMultiplier;
+            // Accumulate the loop time, then consume it by constant steps.
+            // If the loop is too slow, or running with a speed multiplier, we may compute several steps to catch up.
+            m_stepAccumulator.BeginLoop(updateTimeScaled, stepTimeScaled, m_engineConfig.maxStepCountPerLoop, m_useSpeedMultiplier ? m_speedMultiplier : 1.f);
+            allowNextStep = m_stepAccumulator.ConsumeStep();
         }
 
         bool stepHappened = false;
-        bool multipleStepsHappened = false;
 
         //TODO: check m_managerNetwork->IsReadyForTurn() if running steps based on synchronized network clients.
         int stepCount = 0;
@@ -367,6 +401,9 @@ void Engine::RunSingleLoop(const sf::Time& loopTime)
         {
             GUGU_SCOPE_TRACE_MAIN_("Step", Step);
 
+            // Store the previous step state of interpolated elements before modifying them.
+            m_managerScenes->SaveInterpolationStates();
+
             TickTimers(dt_step);
 
             if (m_application)
@@ -378,35 +415,25 @@ void Engine::RunSingleLoop(const sf::Time& loopTime)
             m_managerNetwork->SetTurnPlayed();
 
             // Compute spent time.
-            multipleStepsHappened = stepHappened;
             stepHappened = true;
             ++stepCount;
 
             allowNextStep = false;
             if (m_engineConfig.useConstantStep)
             {
-                m_timeSinceLastStep -= stepTimeScaled;
-
-                if (allowMultipleSteps)
-                {
-                    allowNextStep = m_timeSinceLastStep >= stepTimeScaled;
-                }
-                else
-                {
-                    // Since we dont compensate, no need to keep exceeding step lag.
-                    m_timeSinceLastStep = Min(m_timeSinceLastStep, stepTimeScaled);
-                }
+                // Safety in case the steps take way too much time, to avoid freezing the application.
+                allowNextStep = clockStatSection.getElapsedTime() < sf::milliseconds(500) && m_stepAccumulator.ConsumeStep();
             }
+        }
 
-            // Safety in case the loop takes too much time.
-            // Either because we took longer than the simulated stepTimeScaled, or because we took way too much time.
-            if (allowNextStep
-                && (clockStatSection.getElapsedTime() >= stepTimeScaled
-                || clockStatSection.getElapsedTime() >= sf::milliseconds(500)))
-            {
-                m_timeSinceLastStep = sf::Time::Zero;
-                allowNextStep = false;
-            }
+        if (m_engineConfig.useConstantStep)
+        {
+            m_stepAccumulator.EndLoop();
+            m_stepInterpolation = m_stepAccumulator.GetInterpolation();
+        }
+        else
+        {
+            m_stepInterpolation = 1.f;
         }
 
         if (stepHappened)
@@ -452,6 +479,8 @@ void Engine::RunSingleLoop(const sf::Time& loopTime)
     //-- Update --//
     {
         GUGU_SCOPE_TRACE_MAIN("Update");
+
+        DeltaTime dt_update(updateTimeScaled, updateTimeUnscaled, updateDeltaScale, m_stepInterpolation);
         clockStatSection.restart();
 
         for (size_t i = 0; i < m_windows.size(); ++i)
@@ -495,9 +524,6 @@ void Engine::RunSingleLoop(const sf::Time& loopTime)
         }
     }
 
-    //-- Network Thread --//
-    m_managerNetwork->StartReceptionThread();
-
     //-- Render --//
     {
         GUGU_SCOPE_TRACE_MAIN("Render");
@@ -519,10 +545,6 @@ void Engine::RunSingleLoop(const sf::Time& loopTime)
             m_windows[i]->Display();
     }
 
-    //m_managerNetwork->StopReceptionThread();
-    //m_managerNetwork->Lock();
-    //m_managerNetwork->Unlock();
-
     // Loop Stats
     m_stats.loopTimes.push_front(static_cast<float>(static_cast<double>(clockStatLoop.getElapsedTime().asMicroseconds()) / 1000.0));
     if (m_stats.loopTimes.size() > m_stats.maxStatCount)
@@ -571,6 +593,11 @@ float Engine::GetLoopSpeed() const
     return m_speedMultiplier;
 }
 
+float Engine::GetStepInterpolation() const
+{
+    return m_stepInterpolation;
+}
+
 void Engine::SetShowImGui(bool showImGui)
 {
     m_showImGui = showImGui;
@@ -835,6 +862,11 @@ Renderer* Engine::GetDefaultRenderer() const
     return m_defaultRenderer;
 }
 
+ThreadPool* Engine::GetThreadPool() const
+{
+    return m_threadPool;
+}
+
 ManagerInputs* Engine::GetManagerInputs() const
 {
     return m_managerInputs;
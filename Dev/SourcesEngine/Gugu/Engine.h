@@ -4,6 +4,7 @@
 // Includes
 
 #include "Gugu/Core/EngineConfig.h"
+#include "Gugu/Core/StepAccumulator.h"
 #include "Gugu/Misc/Pattern/Singleton.h"
 #include "Gugu/System/Callback.h"
 #include "Gugu/System/Types.h"
@@ -35,6 +36,7 @@ namespace gugu
     class LoggerEngine;
     class TraceGroup;
     class DeltaTime;
+    class ThreadPool;
 }
 
 ////////////////////////////////////////////////////////////////
@@ -75,6 +77,9 @@ public:
     void ResetLoopSpeed();
     float GetLoopSpeed() const;
 
+    // Ratio [0, 1] of the time accumulated toward the next constant step (1 when constant step is disabled).
+    float GetStepInterpolation() const;
+
     void SetShowImGui(bool showImGui);
     bool IsImGuiVisible() const;
 
@@ -105,6 +110,8 @@ public:
     ManagerVisualEffects* GetManagerVisualEffects() const;
     ManagerScenes*      GetManagerScenes() const;
 
+    ThreadPool*         GetThreadPool() const;
+
     LoggerEngine*       GetLogEngine() const;
     TraceGroup*         GetTraceGroupMain() const;
 
@@ -128,6 +135,8 @@ private:
     ManagerVisualEffects* m_managerVisualEffects;
     ManagerScenes*      m_managerScenes;
 
+    ThreadPool*         m_threadPool;
+
     LoggerEngine*       m_logEngine;
     TraceGroup*         m_traceGroupMain;
     int                 m_traceLifetime;
@@ -135,7 +144,8 @@ private:
     Application*        m_application;
 
     bool                m_stopLoop;
-    sf::Time            m_timeSinceLastStep;
+    StepAccumulator     m_stepAccumulator;
+    float               m_stepInterpolation;
     bool                m_useSpeedMultiplier;
     float               m_speedMultiplier;
     bool                m_pauseLoop;
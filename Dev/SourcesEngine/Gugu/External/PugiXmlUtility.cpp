@@ -9,6 +9,11 @@
 
 #include "Gugu/System/Types.h"
 
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+
 ////////////////////////////////////////////////////////////////
 // File Implementation
 
@@ -16,6 +21,118 @@ namespace gugu {
 
 namespace xml {
 
+namespace impl {
+
+// Binary layout : header, string offsets, null-terminated strings (padded to 4 bytes), nodes data.
+// - Nodes are stored depth-first, starting with the document node : type, name index, value index, attribute count,
+//   attributes (name index, value index), end position (position of the next sibling), children.
+struct BinaryDocumentHeader
+{
+    char magic[4] = { 'G', 'X', 'M', 'L' };
+    uint32 version = 0;
+    uint32 stringCount = 0;
+    uint32 stringDataSize = 0;
+    uint32 nodeDataCount = 0;
+};
+
+constexpr uint32 BinaryDocumentVersion = 2;
+constexpr size_t BinaryDocumentMaxDepth = 1024;
+constexpr size_t BinaryNodeMinSize = 5;
+
+class BinaryDocumentWriter
+{
+public:
+
+    void WriteNode(const pugi::xml_node& node)
+    {
+        nodeData.push_back(static_cast<uint32>(node.type()));
+        nodeData.push_back(GetStringIndex(node.name()));
+        nodeData.push_back(GetStringIndex(node.value()));
+
+        size_t attributeCountPosition = nodeData.size();
+        nodeData.push_back(0);
+
+        for (pugi::xml_attribute attribute = node.first_attribute(); attribute; attribute = attribute.next_attribute())
+        {
+            nodeData.push_back(GetStringIndex(attribute.name()));
+            nodeData.push_back(GetStringIndex(attribute.value()));
+            ++nodeData[attributeCountPosition];
+        }
+
+        size_t endPosition = nodeData.size();
+        nodeData.push_back(0);
+
+        for (pugi::xml_node child = node.first_child(); child; child = child.next_sibling())
+        {
+            WriteNode(child);
+        }
+
+        nodeData[endPosition] = static_cast<uint32>(nodeData.size());
+    }
+
+    uint32 GetStringIndex(const char* value)
+    {
+        auto iteString = stringIndices.find(value);
+        if (iteString != stringIndices.end())
+            return iteString->second;
+
+        uint32 index = static_cast<uint32>(stringOffsets.size());
+        stringIndices.insert(iteString, std::make_pair(std::string_view(value), index));
+        stringOffsets.push_back(static_cast<uint32>(stringData.size()));
+
+        size_t length = std::strlen(value);
+        stringData.insert(stringData.end(), value, value + length + 1);
+        return index;
+    }
+
+public:
+
+    std::unordered_map<std::string_view, uint32> stringIndices;    // Views on the source document strings.
+    std::vector<uint32> stringOffsets;
+    std::vector<char> stringData;
+    std::vector<uint32> nodeData;
+};
+
+bool AppendBinaryChildNodes(pugi::xml_node parent, const BinaryNode& node)
+{
+    for (BinaryNode child = node.first_child(); child; child = child.next_sibling())
+    {
+        pugi::xml_node xmlNode = parent.append_child(child.type());
+        if (!xmlNode)
+            return false;
+
+        if (*child.name() != '\0')
+            xmlNode.set_name(child.name());
+
+        if (*child.value() != '\0')
+            xmlNode.set_value(child.value());
+
+        for (BinaryAttribute attribute = child.first_attribute(); attribute; attribute = attribute.next_attribute())
+        {
+            xmlNode.append_attribute(attribute.name()).set_value(attribute.value());
+        }
+
+        if (!AppendBinaryChildNodes(xmlNode, child))
+            return false;
+    }
+
+    return true;
+}
+
+int GetIntegerBase(const char* value)
+{
+    // Same rules as pugixml : decimal values, or hexadecimal values with a 0x prefix.
+    while (*value == ' ' || *value == '\t' || *value == '\r' || *value == '\n')
+        ++value;
+
+    if (*value == '-' || *value == '+')
+        ++value;
+
+    return (value[0] == '0' && (value[1] == 'x' || value[1] == 'X')) ? 16 : 10;
+}
+
+}   // namespace impl
+
 StringWriter::StringWriter(std::string* target)
 {
     m_target = target;
@@ -47,6 +164,383 @@ std::string SaveDocumentToString(const pugi::xml_document& document)
     return result;
 }
 
+void SaveDocumentToBinary(const pugi::xml_document& document, std::vector<uint8>& result)
+{
+    impl::BinaryDocumentWriter writer;
+    writer.GetStringIndex("");
+    writer.WriteNode(document);
+
+    // Pad strings to keep the nodes data aligned.
+    while (writer.stringData.size() % sizeof(uint32) != 0)
+    {
+        writer.stringData.push_back('\0');
+    }
+
+    impl::BinaryDocumentHeader header;
+    header.version = impl::BinaryDocumentVersion;
+    header.stringCount = static_cast<uint32>(writer.stringOffsets.size());
+    header.stringDataSize = static_cast<uint32>(writer.stringData.size());
+    header.nodeDataCount = static_cast<uint32>(writer.nodeData.size());
+
+    result.resize(sizeof(header) + writer.stringOffsets.size() * sizeof(uint32) + writer.stringData.size() + writer.nodeData.size() * sizeof(uint32));
+
+    uint8* target = result.data();
+    std::memcpy(target, &header, sizeof(header));
+    target += sizeof(header);
+    std::memcpy(target, writer.stringOffsets.data(), writer.stringOffsets.size() * sizeof(uint32));
+    target += writer.stringOffsets.size() * sizeof(uint32);
+    std::memcpy(target, writer.stringData.data(), writer.stringData.size());
+    target += writer.stringData.size();
+    std::memcpy(target, writer.nodeData.data(), writer.nodeData.size() * sizeof(uint32));
+}
+
+bool ParseDocumentFromBinary(const uint8* data, size_t size, pugi::xml_document& document)
+{
+    document.reset();
+
+    BinaryDocument binaryDocument;
+    return binaryDocument.Parse(data, size) && binaryDocument.ConvertToXml(document);
+}
+
+BinaryAttribute::BinaryAttribute(const BinaryDocument* document, size_t position, size_t remainingCount)
+    : m_document(document)
+    , m_position(position)
+    , m_remainingCount(remainingCount)
+{
+}
+
+const char* BinaryAttribute::name() const
+{
+    return m_document ? m_document->GetString(m_document->ReadNodeData(m_position)) : "";
+}
+
+const char* BinaryAttribute::value() const
+{
+    return m_document ? m_document->GetString(m_document->ReadNodeData(m_position + 1)) : "";
+}
+
+BinaryAttribute BinaryAttribute::next_attribute() const
+{
+    if (m_remainingCount <= 1)
+        return BinaryAttribute();
+
+    return BinaryAttribute(m_document, m_position + 2, m_remainingCount - 1);
+}
+
+const char* BinaryAttribute::as_string(const char* defaultValue) const
+{
+    return m_document ? value() : defaultValue;
+}
+
+int BinaryAttribute::as_int(int defaultValue) const
+{
+    if (!m_document)
+        return defaultValue;
+
+    const char* attributeValue = value();
+    return static_cast<int>(std::strtol(attributeValue, nullptr, impl::GetIntegerBase(attributeValue)));
+}
+
+unsigned int BinaryAttribute::as_uint(unsigned int defaultValue) const
+{
+    if (!m_document)
+        return defaultValue;
+
+    const char* attributeValue = value();
+    return static_cast<unsigned int>(std::strtoul(attributeValue, nullptr, impl::GetIntegerBase(attributeValue)));
+}
+
+float BinaryAttribute::as_float(float defaultValue) const
+{
+    if (!m_document)
+        return defaultValue;
+
+    return std::strtof(value(), nullptr);
+}
+
+bool BinaryAttribute::as_bool(bool defaultValue) const
+{
+    if (!m_document)
+        return defaultValue;
+
+    char first = *value();
+    return first == '1' || first == 't' || first == 'T' || first == 'y' || first == 'Y';
+}
+
+BinaryNode::BinaryNode(const BinaryDocument* document, size_t position, size_t parentEnd)
+    : m_document(document)
+    , m_position(position)
+    , m_parentEnd(parentEnd)
+{
+}
+
+size_t BinaryNode::GetAttributeCount() const
+{
+    return m_document->ReadNodeData(m_position + 3);
+}
+
+size_t BinaryNode::GetEnd() const
+{
+    return m_document->ReadNodeData(m_position + 4 + GetAttributeCount() * 2);
+}
+
+pugi::xml_node_type BinaryNode::type() const
+{
+    return m_document ? static_cast<pugi::xml_node_type>(m_document->ReadNodeData(m_position)) : pugi::node_null;
+}
+
+const char* BinaryNode::name() const
+{
+    return m_document ? m_document->GetString(m_document->ReadNodeData(m_position + 1)) : "";
+}
+
+const char* BinaryNode::value() const
+{
+    return m_document ? m_document->GetString(m_document->ReadNodeData(m_position + 2)) : "";
+}
+
+const char* BinaryNode::child_value() const
+{
+    for (BinaryNode child = first_child(); child; child = child.next_sibling())
+    {
+        pugi::xml_node_type childType = child.type();
+        if (childType == pugi::node_pcdata || childType == pugi::node_cdata)
+            return child.value();
+    }
+
+    return "";
+}
+
+BinaryAttribute BinaryNode::first_attribute() const
+{
+    if (!m_document)
+        return BinaryAttribute();
+
+    size_t attributeCount = GetAttributeCount();
+    if (attributeCount == 0)
+        return BinaryAttribute();
+
+    return BinaryAttribute(m_document, m_position + 4, attributeCount);
+}
+
+BinaryAttribute BinaryNode::attribute(const char* name) const
+{
+    for (BinaryAttribute attribute = first_attribute(); attribute; attribute = attribute.next_attribute())
+    {
+        if (std::strcmp(attribute.name(), name) == 0)
+            return attribute;
+    }
+
+    return BinaryAttribute();
+}
+
+BinaryNode BinaryNode::first_child() const
+{
+    if (!m_document)
+        return BinaryNode();
+
+    size_t childPosition = m_position + 5 + GetAttributeCount() * 2;
+    size_t end = GetEnd();
+    if (childPosition >= end)
+        return BinaryNode();
+
+    return BinaryNode(m_document, childPosition, end);
+}
+
+BinaryNode BinaryNode::child(const char* name) const
+{
+    for (BinaryNode child = first_child(); child; child = child.next_sibling())
+    {
+        if (std::strcmp(child.name(), name) == 0)
+            return child;
+    }
+
+    return BinaryNode();
+}
+
+BinaryNode BinaryNode::next_sibling() const
+{
+    if (!m_document)
+        return BinaryNode();
+
+    size_t end = GetEnd();
+    if (end >= m_parentEnd)
+        return BinaryNode();
+
+    return BinaryNode(m_document, end, m_parentEnd);
+}
+
+BinaryNode BinaryNode::next_sibling(const char* name) const
+{
+    for (BinaryNode sibling = next_sibling(); sibling; sibling = sibling.next_sibling())
+    {
+        if (std::strcmp(sibling.name(), name) == 0)
+            return sibling;
+    }
+
+    return BinaryNode();
+}
+
+bool BinaryDocument::Parse(const uint8* data, size_t size)
+{
+    Reset();
+
+    if (!ReadData(data, size))
+    {
+        Reset();
+        return false;
+    }
+
+    return true;
+}
+
+bool BinaryDocument::Parse(std::vector<uint8>&& buffer)
+{
+    Reset();
+
+    m_buffer = std::move(buffer);
+    if (!ReadData(m_buffer.data(), m_buffer.size()))
+    {
+        Reset();
+        return false;
+    }
+
+    return true;
+}
+
+void BinaryDocument::Reset()
+{
+    m_buffer.clear();
+    m_stringOffsets = nullptr;
+    m_stringCount = 0;
+    m_stringData = nullptr;
+    m_nodeData = nullptr;
+    m_nodeDataCount = 0;
+}
+
+BinaryNode BinaryDocument::GetRoot() const
+{
+    if (!m_nodeData)
+        return BinaryNode();
+
+    return BinaryNode(this, 0, m_nodeDataCount);
+}
+
+BinaryNode BinaryDocument::child(const char* name) const
+{
+    return GetRoot().child(name);
+}
+
+bool BinaryDocument::ConvertToXml(pugi::xml_document& document) const
+{
+    document.reset();
+
+    if (!m_nodeData || !impl::AppendBinaryChildNodes(document, GetRoot()))
+    {
+        document.reset();
+        return false;
+    }
+
+    return true;
+}
+
+bool BinaryDocument::ReadData(const uint8* data, size_t size)
+{
+    impl::BinaryDocumentHeader header;
+    if (!data || size < sizeof(header))
+        return false;
+
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, impl::BinaryDocumentHeader().magic, sizeof(header.magic)) != 0
+        || header.version != impl::BinaryDocumentVersion)
+        return false;
+
+    size_t expectedSize = sizeof(header) + static_cast<size_t>(header.stringCount) * sizeof(uint32) + header.stringDataSize + static_cast<size_t>(header.nodeDataCount) * sizeof(uint32);
+    if (size != expectedSize)
+        return false;
+
+    m_stringOffsets = data + sizeof(header);
+    m_stringCount = header.stringCount;
+    m_stringData = reinterpret_cast<const char*>(m_stringOffsets + m_stringCount * sizeof(uint32));
+    m_nodeData = reinterpret_cast<const uint8*>(m_stringData + header.stringDataSize);
+    m_nodeDataCount = header.nodeDataCount;
+
+    // All strings are null-terminated, any offset inside the strings data is safe to read.
+    if (header.stringDataSize == 0 || m_stringData[header.stringDataSize - 1] != '\0')
+        return false;
+
+    for (size_t i = 0; i < m_stringCount; ++i)
+    {
+        uint32 offset = 0;
+        std::memcpy(&offset, m_stringOffsets + i * sizeof(uint32), sizeof(uint32));
+        if (offset >= header.stringDataSize)
+            return false;
+    }
+
+    size_t end = 0;
+    return ValidateNode(0, m_nodeDataCount, 0, end) && end == m_nodeDataCount;
+}
+
+uint32 BinaryDocument::ReadNodeData(size_t position) const
+{
+    // The data may come from a memory mapped archive without alignment guarantees.
+    uint32 value = 0;
+    std::memcpy(&value, m_nodeData + position * sizeof(uint32), sizeof(uint32));
+    return value;
+}
+
+const char* BinaryDocument::GetString(uint32 index) const
+{
+    uint32 offset = 0;
+    std::memcpy(&offset, m_stringOffsets + index * sizeof(uint32), sizeof(uint32));
+    return m_stringData + offset;
+}
+
+bool BinaryDocument::ValidateNode(size_t position, size_t parentEnd, size_t depth, size_t& end) const
+{
+    if (position > parentEnd || parentEnd - position < impl::BinaryNodeMinSize)
+        return false;
+
+    // Only the root is a document node.
+    uint32 type = ReadNodeData(position);
+    if (depth == 0 ? type != pugi::node_document : (type <= pugi::node_document || type > pugi::node_doctype))
+        return false;
+
+    if (ReadNodeData(position + 1) >= m_stringCount || ReadNodeData(position + 2) >= m_stringCount)
+        return false;
+
+    size_t attributeCount = ReadNodeData(position + 3);
+    if (attributeCount > (parentEnd - position - impl::BinaryNodeMinSize) / 2)
+        return false;
+
+    for (size_t i = 0; i < attributeCount * 2; ++i)
+    {
+        if (ReadNodeData(position + 4 + i) >= m_stringCount)
+            return false;
+    }
+
+    size_t endPosition = position + 4 + attributeCount * 2;
+    end = ReadNodeData(endPosition);
+    if (end <= endPosition || end > parentEnd)
+        return false;
+
+    size_t childPosition = endPosition + 1;
+    if (childPosition < end && depth >= impl::BinaryDocumentMaxDepth)
+        return false;
+
+    // Each child end is strictly after its position, and never after the parent end.
+    while (childPosition < end)
+    {
+        size_t childEnd = 0;
+        if (!ValidateNode(childPosition, end, depth + 1, childEnd))
+            return false;
+
+        childPosition = childEnd;
+    }
+
+    return true;
+}
+
 bool TryParseAttribute(const pugi::xml_node& node, const std::string& attributeName, bool& value)
 {
     if (pugi::xml_attribute attribute = node.attribute(attributeName.c_str()))
@@ -164,6 +658,16 @@ bool TryParseVector2f(const pugi::xml_node& node, Vector2f& value)
     return true;
 }
 
+bool TryParseVector2f(const BinaryNode& node, Vector2f& value)
+{
+    if (!node)
+        return false;
+
+    value.x = node.attribute("x").as_float(value.x);
+    value.y = node.attribute("y").as_float(value.y);
+    return true;
+}
+
 sf::IntRect ReadRect(const pugi::xml_node& node, const sf::IntRect& defaultValue)
 {
     return sf::IntRect(
@@ -172,6 +676,14 @@ sf::IntRect ReadRect(const pugi::xml_node& node, const sf::IntRect& defaultValue
     );
 }
 
+sf::IntRect ReadRect(const BinaryNode& node, const sf::IntRect& defaultValue)
+{
+    return sf::IntRect(
+        { node.attribute("x").as_int(defaultValue.position.x), node.attribute("y").as_int(defaultValue.position.y) },
+        { node.attribute("w").as_int(defaultValue.size.x), node.attribute("h").as_int(defaultValue.size.y) }
+    );
+}
+
 void ParseRect(const pugi::xml_node& node, sf::IntRect& value, const sf::IntRect& defaultValue)
 {
     value.position.x = node.attribute("x").as_int(defaultValue.position.x);
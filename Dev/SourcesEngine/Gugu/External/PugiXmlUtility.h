@@ -5,12 +5,15 @@
 
 #include "Gugu/Math/Vector2.h"
 #include "Gugu/Math/UDim.h"
+#include "Gugu/System/Types.h"
 
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Color.hpp>
 
 #include <pugixml.hpp>
 
+#include <vector>
+
 ////////////////////////////////////////////////////////////////
 // File Declarations
 
@@ -35,6 +38,119 @@ pugi::xml_document ParseDocumentFromString(const std::string& source);
 bool ParseDocumentFromString(const std::string& source, pugi::xml_document& document);
 std::string SaveDocumentToString(const pugi::xml_document& document);
 
+// Binary serialization of a parsed document (used for cooked resources).
+// - Node and attribute names are shared in a string table, the text does not need to be tokenized again on load.
+// - The format is versioned, parsing will fail on data cooked with another version.
+void SaveDocumentToBinary(const pugi::xml_document& document, std::vector<uint8>& result);
+bool ParseDocumentFromBinary(const uint8* data, size_t size, pugi::xml_document& document);
+
+class BinaryDocument;
+
+// Read-only views on a BinaryDocument, all strings point directly into the binary data.
+// The methods follow the pugixml read api, so the same template code can load a resource from both formats.
+class BinaryAttribute
+{
+public:
+
+    BinaryAttribute() {}
+
+    explicit operator bool() const { return m_document != nullptr; }
+
+    const char* name() const;
+    const char* value() const;
+    BinaryAttribute next_attribute() const;
+
+    const char* as_string(const char* defaultValue = "") const;
+    int as_int(int defaultValue = 0) const;
+    unsigned int as_uint(unsigned int defaultValue = 0) const;
+    float as_float(float defaultValue = 0.f) const;
+    bool as_bool(bool defaultValue = false) const;
+
+private:
+
+    friend class BinaryNode;
+    BinaryAttribute(const BinaryDocument* document, size_t position, size_t remainingCount);
+
+    const BinaryDocument* m_document = nullptr;
+    size_t m_position = 0;
+    size_t m_remainingCount = 0;
+};
+
+class BinaryNode
+{
+public:
+
+    BinaryNode() {}
+
+    explicit operator bool() const { return m_document != nullptr; }
+
+    pugi::xml_node_type type() const;
+    const char* name() const;
+    const char* value() const;
+    const char* child_value() const;
+
+    BinaryAttribute first_attribute() const;
+    BinaryAttribute attribute(const char* name) const;
+
+    BinaryNode first_child() const;
+    BinaryNode child(const char* name) const;
+    BinaryNode next_sibling() const;
+    BinaryNode next_sibling(const char* name) const;
+
+private:
+
+    friend class BinaryDocument;
+    BinaryNode(const BinaryDocument* document, size_t position, size_t parentEnd);
+
+    size_t GetAttributeCount() const;
+    size_t GetEnd() const;
+
+    const BinaryDocument* m_document = nullptr;
+    size_t m_position = 0;
+    size_t m_parentEnd = 0;     // Used to detect the last sibling.
+};
+
+// Parsed binary document, read in place without building a dom.
+// - The data is fully validated by Parse, the views don't need to check it again.
+// - When parsed from a pointer, the data needs to stay alive as long as the document is used.
+class BinaryDocument
+{
+public:
+
+    BinaryDocument() {}
+    BinaryDocument(const BinaryDocument&) = delete;
+    BinaryDocument& operator = (const BinaryDocument&) = delete;
+
+    bool Parse(const uint8* data, size_t size);
+    bool Parse(std::vector<uint8>&& buffer);
+    void Reset();
+
+    BinaryNode GetRoot() const;
+    BinaryNode child(const char* name) const;
+
+    // Build an xml document, for resources reading their data through pugixml.
+    bool ConvertToXml(pugi::xml_document& document) const;
+
+private:
+
+    friend class BinaryNode;
+    friend class BinaryAttribute;
+
+    bool ReadData(const uint8* data, size_t size);
+    uint32 ReadNodeData(size_t position) const;
+    const char* GetString(uint32 index) const;
+    bool ValidateNode(size_t position, size_t parentEnd, size_t depth, size_t& end) const;
+
+private:
+
+    std::vector<uint8> m_buffer;
+    const uint8* m_stringOffsets = nullptr;
+    size_t m_stringCount = 0;
+    const char* m_stringData = nullptr;
+    const uint8* m_nodeData = nullptr;
+    size_t m_nodeDataCount = 0;
+};
+
 // Try to Parse a single value from a node's attribute (value will only be modified if the node and attribute exist).
 bool TryParseAttribute(const pugi::xml_node& node, const std::string& attributeName, bool& value);
 bool TryParseAttribute(const pugi::xml_node& node, const std::string& attributeName, int& value);
@@ -48,6 +164,7 @@ bool TryParseAttribute(const pugi::xml_node& node, const std::string& attributeN
 Vector2i ReadVector2i(const pugi::xml_node& node, const Vector2i& defaultValue = Vector2::Zero_i);
 Vector2f ReadVector2f(const pugi::xml_node& node, const Vector2f& defaultValue = Vector2::Zero_f);
 sf::IntRect ReadRect(const pugi::xml_node& node, const sf::IntRect& defaultValue = sf::IntRect());
+sf::IntRect ReadRect(const BinaryNode& node, const sf::IntRect& defaultValue = sf::IntRect());
 
 // Parse a data structure from a node's attributes (value will always be modified).
 void ParseVector2i(const pugi::xml_node& node, Vector2i& value, const Vector2i& defaultValue = Vector2::Zero_i);
@@ -59,6 +176,7 @@ void ParseColor(const pugi::xml_node& node, sf::Color& value, const sf::Color& d
 // Try to Parse a data structure from a node's attributes (value will only be modified if the node exists).
 bool TryParseVector2i(const pugi::xml_node& node, Vector2i& value);
 bool TryParseVector2f(const pugi::xml_node& node, Vector2f& value);
+bool TryParseVector2f(const BinaryNode& node, Vector2f& value);
 bool TryParseRect(const pugi::xml_node& node, sf::IntRect& value);
 bool TryParseUDim2(const pugi::xml_node& node, UDim2& value);
 bool TryParseColor(const pugi::xml_node& node, sf::Color& value);
@@ -24,6 +24,11 @@ public:
         return m_instance;
     }
 
+    static bool IsInstanciated()
+    {
+        return m_instance != 0;
+    }
+
     static void DeleteInstance()
     {
         if(m_instance)
@@ -7,6 +7,9 @@
 ////////////////////////////////////////////////////////////////
 // Includes
 
+#include "Gugu/Network/NetworkUdpChannel.h"
+#include "Gugu/System/Memory.h"
+
 #include <SFML/Network/TcpSocket.hpp>
 
 ////////////////////////////////////////////////////////////////
@@ -17,22 +20,30 @@ namespace gugu {
 ClientInfo::ClientInfo()
 {
     m_socket = nullptr;
+    m_handle = -1;
     m_port = 0;
+    m_udpChannel = nullptr;
 
     m_isHost = false;
     m_playerID = -1;
     m_lastTurnReceived = 0;
+
+    m_isDisconnecting = false;
 }
 
 ClientInfo::ClientInfo(uint32 _oIPAddress, uint16 _uiPort)
 {
     m_socket = nullptr;
+    m_handle = -1;
     m_ipAddress = _oIPAddress;
     m_port = _uiPort;
+    m_udpChannel = nullptr;
 
     m_isHost = false;
     m_playerID = -1;
     m_lastTurnReceived = 0;
+
+    m_isDisconnecting = false;
 }
 
 ClientInfo::~ClientInfo()
@@ -42,6 +53,8 @@ ClientInfo::~ClientInfo()
         m_socket->disconnect();
         delete m_socket;
     }
+
+    SafeDelete(m_udpChannel);
 }
 
 }   // namespace gugu
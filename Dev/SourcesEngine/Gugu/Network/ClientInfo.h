@@ -12,6 +12,11 @@
 ////////////////////////////////////////////////////////////////
 // Forward Declarations
 
+namespace gugu
+{
+    class NetworkUdpChannel;
+}
+
 namespace sf
 {
     class TcpSocket;
@@ -33,12 +38,16 @@ public:
 public:
 
     sf::TcpSocket* m_socket;
+    int m_handle;               // Connection handle, when accepted by the epoll server backend (-1 otherwise).
     uint32 m_ipAddress;
-    uint16 m_port;
+    uint16 m_port;              // Listening port of the peer, also used by its udp socket.
+    NetworkUdpChannel* m_udpChannel;    // Created on the first udp exchange, main thread only.
 
     bool m_isHost;
     int32 m_playerID;
     uint32 m_lastTurnReceived;
+
+    bool m_isDisconnecting;     // Removed from the clients list, waiting to be released by the reception thread.
 };
 
 }   // namespace gugu
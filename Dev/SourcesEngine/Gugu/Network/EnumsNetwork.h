@@ -25,4 +25,26 @@ namespace ENetPacket
     };
 }
 
+namespace ENetChannel
+{
+    enum Type
+    {
+        Tcp,                    // Default, reliable and ordered with all the other tcp packets.
+        ReliableOrdered,        // Udp, retransmitted until acked, only waits for the previous messages of this channel.
+        ReliableUnordered,      // Udp, retransmitted until acked, delivered as soon as received.
+        UnreliableSequenced,    // Udp, sent once, messages older than the last delivered one are dropped.
+
+        Count,
+    };
+}
+
+namespace ENetworkBackend
+{
+    enum Type
+    {
+        Selector,   // sf::SocketSelector, handles incoming and outgoing connections.
+        Epoll,      // Linux only, server mode for many incoming connections (no outgoing connections).
+    };
+}
+
 }   // namespace gugu
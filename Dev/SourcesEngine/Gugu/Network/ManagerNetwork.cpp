@@ -10,12 +10,16 @@
 #include "Gugu/Engine.h"
 #include "Gugu/System/Container.h"
 #include "Gugu/System/String.h"
+#include "Gugu/System/Time.h"
 #include "Gugu/Network/NetworkPacket.h"
+#include "Gugu/Network/NetworkServerEpoll.h"
+#include "Gugu/Network/NetworkUdpChannel.h"
 #include "Gugu/Core/Application.h"
 #include "Gugu/Debug/Logger.h"
 
 #include <SFML/Network/TcpSocket.hpp>
 #include <SFML/Network/TcpListener.hpp>
+#include <SFML/Network/UdpSocket.hpp>
 #include <SFML/Network/SocketSelector.hpp>
 #include <SFML/Network/Packet.hpp>
 
@@ -27,9 +31,18 @@
 namespace gugu {
 
 ManagerNetwork::ManagerNetwork()
+    : m_freeDatagrams(1024)
+    , m_sendWriter(NetworkUdpChannel::MaxDatagramSize)
+    , m_receptionEvents(4096)
+    , m_receptionCommands(256)
 {
     m_selector  = new sf::SocketSelector;
     m_listener  = new sf::TcpListener;
+    m_serverEpoll = nullptr;
+    m_udpSocket = new sf::UdpSocket;
+    m_isUdpBound = false;
+    m_receptionPacket = new sf::Packet;
+    m_linkSimulator = new NetworkLinkSimulator;
     m_clientInfoSelf = nullptr;
 
     m_isListening = false;
@@ -39,6 +52,7 @@ ManagerNetwork::ManagerNetwork()
     m_nbTurnsOffset = 2;
 
     m_receptionThread = nullptr;
+    m_isReceptionRunning = false;
     m_logNetwork = nullptr;
 }
 
@@ -53,11 +67,21 @@ ManagerNetwork::~ManagerNetwork()
     SafeDelete(m_clientInfoSelf);
     SafeDelete(m_selector);
     SafeDelete(m_listener);
+    SafeDelete(m_serverEpoll);
+    SafeDelete(m_udpSocket);
+    SafeDelete(m_receptionPacket);
+    SafeDelete(m_linkSimulator);
+
+    NetworkDatagram* datagram = nullptr;
+    while (m_freeDatagrams.TryPop(datagram))
+    {
+        SafeDelete(datagram);
+    }
 
     SafeDelete(m_logNetwork);
 }
 
-void ManagerNetwork::StartListening(uint16 _uiPort)
+void ManagerNetwork::StartListening(uint16 _uiPort, ENetworkBackend::Type _eBackend)
 {
     if (!m_logNetwork)
     {
@@ -72,13 +96,74 @@ void ManagerNetwork::StartListening(uint16 _uiPort)
 
         m_listeningPort = _uiPort;
 
-        if (m_listener->listen(m_listeningPort) == sf::Socket::Status::Done)
+        bool listening = false;
+        if (_eBackend == ENetworkBackend::Epoll)
+        {
+            if (!NetworkServerEpoll::IsAvailable())
+            {
+                GetLogNetwork()->Print(ELog::Error, ELogEngine::Network, "The epoll backend is not available on this platform");
+            }
+            else
+            {
+                if (!m_serverEpoll)
+                {
+                    // Delegates are called from the reception thread.
+                    m_serverEpoll = new NetworkServerEpoll(
+                        [this](int handle, uint32 ipAddress)
+                        {
+                            GetLogNetwork()->Print(ELog::Info, ELogEngine::Network, StringFormat("New client : {0}", sf::IpAddress(ipAddress).toString()));
+
+                            ClientInfo* pClient = new ClientInfo(ipAddress, 0);
+                            pClient->m_handle = handle;
+
+                            ReceptionEvent event;
+                            event.type = EReceptionEvent::ClientConnected;
+                            event.client = pClient;
+                            PushReceptionEvent(event);
+                            return pClient;
+                        },
+                        [this](ClientInfo* client, const uint8* data, size_t size)
+                        {
+                            ReadReceivedPacket(client, data, size);
+                        },
+                        [this](ClientInfo* client)
+                        {
+                            ReceptionEvent event;
+                            event.type = EReceptionEvent::ClientLost;
+                            event.client = client;
+                            PushReceptionEvent(event);
+                        });
+                }
+
+                listening = m_serverEpoll->Listen(m_listeningPort);
+            }
+        }
+        else if (m_listener->listen(m_listeningPort) == sf::Socket::Status::Done)
         {
             m_selector->add(*m_listener);
+            listening = true;
+
+            // Udp channels share the listening port, packets will use tcp if it can't be bound.
+            if (m_udpSocket->bind(m_listeningPort) == sf::Socket::Status::Done)
+            {
+                m_udpSocket->setBlocking(false);
+                m_selector->add(*m_udpSocket);
+                m_receptionDatagramBuffer.resize(NetworkUdpChannel::MaxDatagramSize + 1);
+                m_isUdpBound = true;
+            }
+            else
+            {
+                GetLogNetwork()->Print(ELog::Warning, ELogEngine::Network, "Can't bind the udp port, udp channels will fall back on tcp");
+            }
+        }
 
+        if (listening)
+        {
             m_isListening = true;
 
             GetLogNetwork()->Print(ELog::Info, ELogEngine::Network, "Listening...");
+
+            StartReceptionThread();
         }
         else
         {
@@ -107,6 +192,18 @@ void ManagerNetwork::StopListening()
         m_selector->clear();
         m_listener->close();
 
+        if (m_isUdpBound)
+        {
+            m_udpSocket->unbind();
+            m_linkSimulator->Reset();
+            m_isUdpBound = false;
+        }
+
+        if (m_serverEpoll)
+        {
+            m_serverEpoll->Close();
+        }
+
         GetLogNetwork()->Print(ELog::Info, ELogEngine::Network, "Stop listening");
     }
 }
@@ -118,75 +215,300 @@ bool ManagerNetwork::IsListening() const
 
 void ManagerNetwork::StartReceptionThread()
 {
-    StopReceptionThread();
+    if (!IsListening() || m_receptionThread)
+        return;
+
+    m_isReceptionRunning = true;
+    m_receptionThread = new std::thread(&ManagerNetwork::ReceptionLoop, this);
+}
+
+void ManagerNetwork::StopReceptionThread()
+{
+    if (m_receptionThread)
+    {
+        m_isReceptionRunning = false;
+        m_receptionThread->join();
+        SafeDelete(m_receptionThread);
+    }
 
-    //Lock();
+    // The main thread now owns the selector : remaining packets are discarded, remaining commands are applied directly.
+    ReceptionEvent event;
+    while (m_receptionEvents.TryPop(event))
+    {
+        ProcessReceptionEvent(event, false);
+    }
 
-    if (IsListening())
+    for (const ReceptionEvent& overflowEvent : m_overflowEvents)
     {
-        if (!m_receptionThread)
-            m_receptionThread = new std::thread(&ReceptionThread);
+        ProcessReceptionEvent(overflowEvent, false);
     }
 
-    //Unlock();
+    m_overflowEvents.clear();
+
+    ReceptionCommand command;
+    while (m_receptionCommands.TryPop(command))
+    {
+        ApplyReceptionCommand(command, true);
+    }
+
+    for (const ReceptionCommand& overflowCommand : m_overflowCommands)
+    {
+        ApplyReceptionCommand(overflowCommand, true);
+    }
+
+    m_overflowCommands.clear();
 }
 
-void ManagerNetwork::StopReceptionThread()
+void ManagerNetwork::ProcessWaitingPackets()
 {
-    //LogConsole("Wait thread");
+    FlushReceptionCommands();
 
-    if (m_receptionThread)
+    if (m_serverEpoll)
     {
-        m_receptionThread->join();
-        SafeDelete(m_receptionThread);
+        m_serverEpoll->FlushSends();
+    }
+
+    // Only process the events available when starting, the reception thread may keep pushing new ones.
+    ReceptionEvent event;
+    size_t maxEventCount = m_receptionEvents.Capacity();
+    for (size_t i = 0; i < maxEventCount && m_receptionEvents.TryPop(event); ++i)
+    {
+        ProcessReceptionEvent(event, true);
     }
 
-    //LogConsole("thread closed");
+    UpdateUdpChannels();
 }
 
-void ReceptionThread()
+void ManagerNetwork::ProcessReceptionEvent(const ReceptionEvent& event, bool dispatchPackets)
 {
-    //LogConsole("Start reception thread");
+    if (event.type == EReceptionEvent::Packet)
+    {
+        // A disconnecting client stays valid until its release event, but its packets are ignored.
+        if (!dispatchPackets || event.client->m_isDisconnecting || !ReceiveNetPacket(event.packet, event.client))
+        {
+            m_packetPool.Release(event.packet);
+        }
+    }
+    else if (event.type == EReceptionEvent::ClientConnected)
+    {
+        m_clients.push_back(event.client);
+    }
+    else if (event.type == EReceptionEvent::ClientLost)
+    {
+        Disconnect(event.client);
+    }
+    else if (event.type == EReceptionEvent::ClientReleased)
+    {
+        ClientInfo* client = event.client;
+        SafeDelete(client);
+    }
+    else if (event.type == EReceptionEvent::Datagram)
+    {
+        if (dispatchPackets)
+        {
+            ProcessReceivedDatagram(*event.datagram);
+        }
 
-    //while (GetNetwork()->IsListening())
+        ReleaseDatagram(event.datagram);
+    }
+}
+
+void ManagerNetwork::ReleaseDatagram(NetworkDatagram* datagram)
+{
+    // Datagrams beyond the recycling capacity are only kept during reception peaks.
+    if (!m_freeDatagrams.TryPush(datagram))
     {
-        GetNetwork()->Lock();
-        GetNetwork()->StepReception();
-        //GetNetwork()->StopReceptionThread();
-        GetNetwork()->Unlock();
+        SafeDelete(datagram);
     }
 }
 
-void ManagerNetwork::Lock()
+void ManagerNetwork::ProcessReceivedDatagram(const NetworkDatagram& datagram)
 {
-    m_mutexReception.lock();
+    // Datagrams are associated to the clients by their announced listening port.
+    ClientInfo* pClient = FindClient(datagram.ipAddress, datagram.port);
+    NetworkUdpChannel* pChannel = pClient ? GetUdpChannel(pClient) : nullptr;
+    if (!pChannel)
+        return;
+
+    bool valid = pChannel->ReceiveDatagram(GetElapsedMicroseconds(), datagram.data.data(), datagram.data.size(), [this, pClient](ENetChannel::Type channel, const uint8* data, size_t size)
+    {
+        // A disconnection received earlier in the datagram discards the next messages.
+        if (pClient->m_isDisconnecting)
+            return;
+
+        NetBufferReader reader(data, size);
+
+        NetPacket* pReceivedPacket = ReadNetPacket(reader);
+        if (pReceivedPacket && !ReceiveNetPacket(pReceivedPacket, pClient))
+        {
+            m_packetPool.Release(pReceivedPacket);
+        }
+    });
+
+    if (!valid)
+    {
+        GetLogNetwork()->Print(ELog::Info, ELogEngine::Network, "Error : Invalid datagram received.");
+    }
 }
 
-void ManagerNetwork::Unlock()
+NetworkUdpChannel* ManagerNetwork::GetUdpChannel(ClientInfo* _pClient) const
 {
-    m_mutexReception.unlock();
+    if (!m_isUdpBound || _pClient->m_port == 0 || _pClient->m_isDisconnecting)
+        return nullptr;
+
+    if (!_pClient->m_udpChannel)
+    {
+        _pClient->m_udpChannel = new NetworkUdpChannel;
+    }
+
+    return _pClient->m_udpChannel;
 }
 
-void ManagerNetwork::ProcessWaitingPackets()
+void ManagerNetwork::UpdateUdpChannels()
 {
-    Lock();
+    if (!m_isUdpBound)
+        return;
 
-    while (!m_waitingPackets.empty())
+    int64 timeUs = GetElapsedMicroseconds();
+    for (ClientInfo* pClient : m_clients)
     {
-        WaitingPacket oItem = m_waitingPackets.front();
-        m_waitingPackets.pop();
+        if (pClient->m_udpChannel)
+        {
+            pClient->m_udpChannel->Update(timeUs, [&](const uint8* data, size_t size)
+            {
+                SendDatagram(timeUs, pClient->m_ipAddress, pClient->m_port, data, size);
+            });
+        }
+    }
 
-        if (!ReceiveNetPacket(oItem.packet, oItem.sender))
+    NetworkDatagram delayedDatagram;
+    while (m_linkSimulator->Pop(timeUs, delayedDatagram))
+    {
+        m_udpSocket->send(delayedDatagram.data.data(), delayedDatagram.data.size(), sf::IpAddress(delayedDatagram.ipAddress), delayedDatagram.port);
+    }
+}
+
+void ManagerNetwork::SendDatagram(int64 timeUs, uint32 ipAddress, uint16 port, const uint8* data, size_t size)
+{
+    if (m_linkSimulator->IsActive())
+    {
+        m_linkSimulator->Push(timeUs, ipAddress, port, data, size);
+    }
+    else
+    {
+        // A datagram that can't be sent is handled as a lost datagram.
+        m_udpSocket->send(data, size, sf::IpAddress(ipAddress), port);
+    }
+}
+
+void ManagerNetwork::PushReceptionCommand(const ReceptionCommand& command)
+{
+    if (!m_receptionThread)
+    {
+        ApplyReceptionCommand(command, true);
+        return;
+    }
+
+    FlushReceptionCommands();
+
+    if (!m_overflowCommands.empty() || !m_receptionCommands.TryPush(command))
+    {
+        m_overflowCommands.push_back(command);
+    }
+}
+
+void ManagerNetwork::FlushReceptionCommands()
+{
+    size_t flushedCount = 0;
+    while (flushedCount < m_overflowCommands.size() && m_receptionCommands.TryPush(m_overflowCommands[flushedCount]))
+    {
+        ++flushedCount;
+    }
+
+    StdVectorRemoveAt(m_overflowCommands, 0, flushedCount);
+}
+
+void ManagerNetwork::ReceptionLoop()
+{
+    while (m_isReceptionRunning)
+    {
+        ReceptionCommand command;
+        while (m_receptionCommands.TryPop(command))
         {
-            SafeDelete(oItem.packet);
+            ApplyReceptionCommand(command, false);
         }
+
+        FlushReceptionEvents();
+        StepReception();
+    }
+}
+
+void ManagerNetwork::ApplyReceptionCommand(const ReceptionCommand& command, bool releaseImmediately)
+{
+    if (command.type == EReceptionCommand::AddClient)
+    {
+        m_selector->add(*command.client->m_socket);
+        m_receptionClients.push_back(command.client);
     }
+    else if (command.type == EReceptionCommand::RemoveClient)
+    {
+        if (command.client->m_handle >= 0)
+        {
+            m_serverEpoll->CloseConnection(command.client->m_handle);
+        }
+        else if (StdVectorContains(m_receptionClients, command.client))
+        {
+            // The client may already be removed from the selector after a reception error.
+            m_selector->remove(*command.client->m_socket);
+            StdVectorRemove(m_receptionClients, command.client);
+        }
 
-    Unlock();
+        if (releaseImmediately)
+        {
+            ClientInfo* client = command.client;
+            SafeDelete(client);
+        }
+        else
+        {
+            ReceptionEvent event;
+            event.type = EReceptionEvent::ClientReleased;
+            event.client = command.client;
+            PushReceptionEvent(event);
+        }
+    }
+}
+
+void ManagerNetwork::PushReceptionEvent(const ReceptionEvent& event)
+{
+    FlushReceptionEvents();
+
+    // Events are kept in order, the main thread will catch up on the next frames.
+    if (!m_overflowEvents.empty() || !m_receptionEvents.TryPush(event))
+    {
+        m_overflowEvents.push_back(event);
+    }
+}
+
+void ManagerNetwork::FlushReceptionEvents()
+{
+    size_t flushedCount = 0;
+    while (flushedCount < m_overflowEvents.size() && m_receptionEvents.TryPush(m_overflowEvents[flushedCount]))
+    {
+        ++flushedCount;
+    }
+
+    StdVectorRemoveAt(m_overflowEvents, 0, flushedCount);
 }
 
 void ManagerNetwork::StepReception()
 {
+    // The timeout bounds the delay to apply new commands or stop the thread.
+    if (m_serverEpoll && m_serverEpoll->IsListening())
+    {
+        m_serverEpoll->Poll(4);
+        return;
+    }
+
     if (!m_selector->wait(sf::milliseconds(4)))
         return;
 
@@ -200,88 +522,131 @@ void ManagerNetwork::StepReception()
         sf::IpAddress Address = *pSocketNewClient->getRemoteAddress();  // TODO: check IpAddress optional result.
         GetLogNetwork()->Print(ELog::Info, ELogEngine::Network, StringFormat("New client : {0}", Address.toString()));
 
-        //Add him to clients list & selector
+        //Add him to selector, the main thread will add him to clients list
         ClientInfo* pClient = new ClientInfo(Address.toInteger(), 0);
         pClient->m_socket = pSocketNewClient;
-        m_clients.push_back(pClient);
+        m_receptionClients.push_back(pClient);
 
         m_selector->add(*pSocketNewClient);
+
+        ReceptionEvent event;
+        event.type = EReceptionEvent::ClientConnected;
+        event.client = pClient;
+        PushReceptionEvent(event);
     }
 
-    auto iteCLient = m_clients.begin();
-    auto iteCLientEnd = m_clients.end();
-    while (iteCLient != iteCLientEnd)
+    if (m_isUdpBound && m_selector->isReady(*m_udpSocket))
     {
-        ClientInfo* pClient = *iteCLient;
-        ++iteCLient;
+        ReadReceivedDatagrams();
+    }
+
+    // Iterate backwards, a lost client is removed from the list.
+    for (size_t i = m_receptionClients.size(); i-- > 0;)
+    {
+        ClientInfo* pClient = m_receptionClients[i];
 
         sf::TcpSocket& oSocket = *pClient->m_socket;
 
         if (!m_selector->isReady(oSocket))
             continue;
 
-        sf::Packet oSFPacket;
-        if (oSocket.receive(oSFPacket) == sf::Socket::Status::Done)
+        if (oSocket.receive(*m_receptionPacket) == sf::Socket::Status::Done)
+        {
+            ReadReceivedPacket(pClient, static_cast<const uint8*>(m_receptionPacket->getData()), m_receptionPacket->getDataSize());
+        }
+        else
         {
-            uint32 iType;
-            oSFPacket >> iType;
+            // Stop polling this client, the main thread will handle the disconnection.
+            m_selector->remove(oSocket);
+            StdVectorRemoveAt(m_receptionClients, i);
+
+            ReceptionEvent event;
+            event.type = EReceptionEvent::ClientLost;
+            event.client = pClient;
+            PushReceptionEvent(event);
+        }
+    }
+}
 
-            ENetPacket::Type eType;
-            eType = static_cast< ENetPacket::Type >(iType);
+void ManagerNetwork::ReadReceivedPacket(ClientInfo* _pClient, const uint8* data, size_t size)
+{
+    NetBufferReader reader(data, size);
 
-            if(eType != ENetPacket::Undefined)
-            {
-                NetPacket* pReceivedPacket = nullptr;
+    NetPacket* pReceivedPacket = ReadNetPacket(reader);
+    if (pReceivedPacket)
+    {
+        ReceptionEvent event;
+        event.type = EReceptionEvent::Packet;
+        event.packet = pReceivedPacket;
+        event.client = _pClient;
+        PushReceptionEvent(event);
+    }
+}
 
-                if(eType == ENetPacket::Ping || eType == ENetPacket::Pong || eType == ENetPacket::ClientDisconnection)
-                {
-                    pReceivedPacket = new NetPacket(eType);
-                }
-                else if(eType == ENetPacket::ClientInfos)
-                {
-                    pReceivedPacket = new NetPacketClientConnection(oSFPacket);
-                }
-                else if (eType == ENetPacket::JoinGame)
-                {
-                    pReceivedPacket = new NetPacket(eType);
-                }
-                else if (eType == ENetPacket::AddPlayer)
-                {
-                    pReceivedPacket = new NetPacketAddPlayer(oSFPacket);
-                }
-                else if(eType == ENetPacket::TurnReady)
-                {
-                    pReceivedPacket = new NetPacketTurnReady(oSFPacket);
-                }
-                else if(eType == ENetPacket::Game)
-                {
-                    if (GetApplication())
-                        pReceivedPacket = GetApplication()->ReadGamePacket(&oSFPacket);
-                }
+void ManagerNetwork::ReadReceivedDatagrams()
+{
+    // The socket is non-blocking, all the waiting datagrams are read.
+    while (true)
+    {
+        size_t receivedSize = 0;
+        std::optional<sf::IpAddress> remoteAddress;
+        uint16 remotePort = 0;
+        if (m_udpSocket->receive(m_receptionDatagramBuffer.data(), m_receptionDatagramBuffer.size(), receivedSize, remoteAddress, remotePort) != sf::Socket::Status::Done)
+            break;
+
+        // Bigger datagrams are not sent by the udp channels.
+        if (!remoteAddress || receivedSize > NetworkUdpChannel::MaxDatagramSize)
+            continue;
 
-                if(pReceivedPacket)
-                {
-                    /*if(!ReceiveNetPacket(pReceivedPacket, pClient))
-                    {
-                        SafeDelete(pReceivedPacket);
-                    }*/
-
-                    WaitingPacket oItem;
-                    oItem.packet = pReceivedPacket;
-                    oItem.sender = pClient;
-                    m_waitingPackets.push(oItem);
-                }
-            }
-            else
-            {
-                GetLogNetwork()->Print(ELog::Info, ELogEngine::Network, "Error : Unknown Packet received.");
-            }
-        }
-        else
+        // Datagrams are recycled once processed by the main thread, new ones are only allocated until the pool is warm.
+        NetworkDatagram* datagram = nullptr;
+        if (!m_freeDatagrams.TryPop(datagram))
         {
-            Disconnect(pClient);
+            datagram = new NetworkDatagram;
+            datagram->data.reserve(NetworkUdpChannel::MaxDatagramSize);
         }
+
+        datagram->ipAddress = remoteAddress->toInteger();
+        datagram->port = remotePort;
+        datagram->data.assign(m_receptionDatagramBuffer.data(), m_receptionDatagramBuffer.data() + receivedSize);
+
+        ReceptionEvent event;
+        event.type = EReceptionEvent::Datagram;
+        event.datagram = datagram;
+        PushReceptionEvent(event);
+    }
+}
+
+NetPacket* ManagerNetwork::ReadNetPacket(NetBufferReader& reader)
+{
+    uint32 iType = 0;
+    reader.ReadVarUInt32(iType);
+
+    ENetPacket::Type eType;
+    eType = static_cast< ENetPacket::Type >(iType);
+
+    if (eType == ENetPacket::Game)
+    {
+        // Game packets are created and read by the application.
+        return GetApplication() ? GetApplication()->ReadGamePacket(reader) : nullptr;
     }
+
+    NetPacket* pReceivedPacket = m_packetPool.Acquire(eType);
+    if (!pReceivedPacket)
+    {
+        GetLogNetwork()->Print(ELog::Info, ELogEngine::Network, "Error : Unknown Packet received.");
+        return nullptr;
+    }
+
+    if (!pReceivedPacket->Deserialize(reader))
+    {
+        GetLogNetwork()->Print(ELog::Info, ELogEngine::Network, "Error : Invalid Packet received.");
+
+        m_packetPool.Release(pReceivedPacket);
+        return nullptr;
+    }
+
+    return pReceivedPacket;
 }
 
 void ManagerNetwork::ConnectToClient(sf::IpAddress _oIPAddress, uint16 _uiPort)
@@ -292,6 +657,12 @@ void ManagerNetwork::ConnectToClient(sf::IpAddress _oIPAddress, uint16 _uiPort)
         return;
     }
 
+    if (m_serverEpoll && m_serverEpoll->IsListening())
+    {
+        GetLogNetwork()->Print(ELog::Error, ELogEngine::Network, "Outgoing connections are not handled by the epoll backend");
+        return;
+    }
+
     if(FindClient(_oIPAddress.toInteger(), _uiPort))
     {
         GetLogNetwork()->Print(ELog::Info, ELogEngine::Network, "Already connected");
@@ -306,7 +677,11 @@ void ManagerNetwork::ConnectToClient(sf::IpAddress _oIPAddress, uint16 _uiPort)
     if (pClient->m_socket->connect(sf::IpAddress(pClient->m_ipAddress), pClient->m_port, sf::milliseconds(100)) == sf::Socket::Status::Done)
     {
         m_clients.push_back(pClient);
-        m_selector->add(*pClient->m_socket);
+
+        ReceptionCommand command;
+        command.type = EReceptionCommand::AddClient;
+        command.client = pClient;
+        PushReceptionCommand(command);
 
         GetLogNetwork()->Print(ELog::Info, ELogEngine::Network, StringFormat("Connected to {0}:{1}", pClient->m_ipAddress, pClient->m_port));
 
@@ -351,13 +726,22 @@ void ManagerNetwork::DisconnectAll()
 
 void ManagerNetwork::Disconnect(ClientInfo* _pClient)
 {
-    sf::TcpSocket* pSocket = _pClient->m_socket;
-
-    m_selector->remove(*pSocket);
-    pSocket->disconnect();
+    if (_pClient->m_isDisconnecting)
+        return;
 
+    _pClient->m_isDisconnecting = true;
     m_clients.remove(_pClient);
-    SafeDelete(_pClient);
+
+    if (_pClient->m_handle >= 0)
+    {
+        m_serverEpoll->DiscardSends(_pClient->m_handle);
+    }
+
+    // The socket is closed once the reception thread stops polling it.
+    ReceptionCommand command;
+    command.type = EReceptionCommand::RemoveClient;
+    command.client = _pClient;
+    PushReceptionCommand(command);
 
     GetLogNetwork()->Print(ELog::Info, ELogEngine::Network, "Disconnected from client");
 }
@@ -390,59 +774,98 @@ ClientInfo* ManagerNetwork::FindClient(uint32 _oIPAddress, uint16 _uiPort) const
     return nullptr;
 }
 
+size_t ManagerNetwork::GetClientCount() const
+{
+    return m_clients.size();
+}
+
 void ManagerNetwork::SendNetPacketToAll(NetPacket* _pPacket, bool _bIncludeSelf)
 {
+    SerializeNetPacket(*_pPacket);
+
     for (auto iteCurrent = m_clients.begin(); iteCurrent != m_clients.end(); ++iteCurrent)
     {
         ClientInfo* pClient = *iteCurrent;
         if (pClient->m_port != 0)
         {
-            SendNetPacket(pClient, *_pPacket);
+            SendSerializedPacket(pClient, _pPacket->m_type);
         }
     }
 
     if(!_bIncludeSelf || !ReceiveNetPacket(_pPacket, m_clientInfoSelf))
-        SafeDelete(_pPacket);
+        m_packetPool.Release(_pPacket);
 }
 
 void ManagerNetwork::SendNetPacketToAllPlayers(NetPacket* _pPacket, bool _bIncludeSelf)
 {
+    SerializeNetPacket(*_pPacket);
+
     for (auto iteCurrent = m_clients.begin(); iteCurrent != m_clients.end(); ++iteCurrent)
     {
         ClientInfo* pClient = *iteCurrent;
         if (pClient->m_playerID > -1 && pClient->m_port != 0)
         {
-            SendNetPacket(pClient, *_pPacket);
+            SendSerializedPacket(pClient, _pPacket->m_type);
         }
     }
 
     if(!_bIncludeSelf || m_clientInfoSelf->m_playerID == -1 || !ReceiveNetPacket(_pPacket, m_clientInfoSelf))
-        SafeDelete(_pPacket);
+        m_packetPool.Release(_pPacket);
 }
 
 void ManagerNetwork::SendGamePacketToAllPlayers(NetPacketGame* _pPacket, bool _bIncludeSelf)
 {
     _pPacket->m_turn = m_lastNetTurnProcessed + m_nbTurnsOffset + 1;    //m_uiLastNetTurnProcessed + 1 is being processed, and we want this action to be processed X turns later.
 
+    SerializeNetPacket(*_pPacket);
+
     for (auto iteCurrent = m_clients.begin(); iteCurrent != m_clients.end(); ++iteCurrent)
     {
         ClientInfo* pClient = *iteCurrent;
         if (pClient->m_playerID > -1 && pClient->m_port != 0)
         {
-            SendNetPacket(pClient, *_pPacket);
+            SendSerializedPacket(pClient, _pPacket->m_type);
         }
     }
 
     if(!_bIncludeSelf || !ReceiveNetPacket(_pPacket, m_clientInfoSelf))
-        SafeDelete(_pPacket);
+        m_packetPool.Release(_pPacket);
 }
 
 bool ManagerNetwork::SendNetPacket(ClientInfo* _pClient, NetPacket& _oPacket)
 {
-    sf::Packet oSFPacket;
-    _oPacket.FillSFPacket(oSFPacket);
+    SerializeNetPacket(_oPacket);
+    return SendSerializedPacket(_pClient, _oPacket.m_type);
+}
 
-    if(_pClient && _pClient->m_socket && _pClient->m_socket->send(oSFPacket) != sf::Socket::Status::Done)
+void ManagerNetwork::SerializeNetPacket(const NetPacket& _oPacket)
+{
+    // The header receives the payload size, tcp frames are compatible with sf::Packet.
+    m_sendWriter.Reset(sizeof(uint32));
+    _oPacket.Serialize(m_sendWriter);
+    m_sendWriter.WriteUInt32At(0, static_cast<uint32>(m_sendWriter.GetSize()));
+}
+
+bool ManagerNetwork::SendSerializedPacket(ClientInfo* _pClient, ENetPacket::Type _eType)
+{
+    bool sent = true;
+    ENetChannel::Type eChannel = GetPacketChannel(_eType);
+    NetworkUdpChannel* pUdpChannel = (_pClient && eChannel != ENetChannel::Tcp) ? GetUdpChannel(_pClient) : nullptr;
+
+    if (pUdpChannel)
+    {
+        sent = pUdpChannel->Send(eChannel, m_sendWriter.GetData(), m_sendWriter.GetSize());
+    }
+    else if (_pClient && _pClient->m_socket)
+    {
+        sent = _pClient->m_socket->send(m_sendWriter.GetFrameData(), m_sendWriter.GetFrameSize()) == sf::Socket::Status::Done;
+    }
+    else if (_pClient && _pClient->m_handle >= 0 && !_pClient->m_isDisconnecting)
+    {
+        sent = m_serverEpoll->Send(_pClient->m_handle, m_sendWriter.GetData(), m_sendWriter.GetSize());
+    }
+
+    if (!sent)
     {
         GetLogNetwork()->Print(ELog::Info, ELogEngine::Network, "Could not send a packet !");
         return false;
@@ -451,6 +874,44 @@ bool ManagerNetwork::SendNetPacket(ClientInfo* _pClient, NetPacket& _oPacket)
     return true;
 }
 
+NetPacket* ManagerNetwork::AcquireNetPacket(ENetPacket::Type _eType)
+{
+    return m_packetPool.Acquire(_eType);
+}
+
+void ManagerNetwork::ReleaseNetPacket(NetPacket* _pPacket)
+{
+    m_packetPool.Release(_pPacket);
+}
+
+void ManagerNetwork::SetPacketChannel(ENetPacket::Type _eType, ENetChannel::Type _eChannel)
+{
+    if (_eChannel == ENetChannel::Tcp)
+    {
+        m_packetChannels.erase(_eType);
+    }
+    else
+    {
+        m_packetChannels[_eType] = _eChannel;
+    }
+}
+
+ENetChannel::Type ManagerNetwork::GetPacketChannel(ENetPacket::Type _eType) const
+{
+    auto iteChannel = m_packetChannels.find(_eType);
+    return iteChannel != m_packetChannels.end() ? iteChannel->second : ENetChannel::Tcp;
+}
+
+bool ManagerNetwork::IsUdpAvailable() const
+{
+    return m_isUdpBound;
+}
+
+void ManagerNetwork::SetUdpLinkSimulation(float _fLossRatio, int64 _iLatencyMs, int64 _iJitterMs)
+{
+    m_linkSimulator->SetConditions(_fLossRatio, _iLatencyMs * 1000, _iJitterMs * 1000);
+}
+
 //return true if packet is stored
 bool ManagerNetwork::ReceiveNetPacket(NetPacket* _pPacketReceived, ClientInfo* _pSender)
 {
@@ -513,7 +974,10 @@ bool ManagerNetwork::ReceiveNetPacket(NetPacket* _pPacketReceived, ClientInfo* _
             //Set this ID to the new player, and inform everyone
             _pSender->m_playerID = iNewID;
 
-            NetPacketAddPlayer* pPacketNewPlayer = new NetPacketAddPlayer(_pSender->m_ipAddress, _pSender->m_port, iNewID);
+            NetPacketAddPlayer* pPacketNewPlayer = static_cast<NetPacketAddPlayer*>(m_packetPool.Acquire(ENetPacket::AddPlayer));
+            pPacketNewPlayer->m_ipAddress = _pSender->m_ipAddress;
+            pPacketNewPlayer->m_port = _pSender->m_port;
+            pPacketNewPlayer->m_playerID = iNewID;
             SendNetPacketToAllPlayers(pPacketNewPlayer, true);
 
             //Inform this new player of existing players
@@ -666,7 +1130,8 @@ void ManagerNetwork::SetTurnPlayed()
     {
         ++m_lastNetTurnProcessed;
 
-        NetPacketTurnReady* pPacket = new NetPacketTurnReady(m_lastNetTurnProcessed);
+        NetPacketTurnReady* pPacket = static_cast<NetPacketTurnReady*>(m_packetPool.Acquire(ENetPacket::TurnReady));
+        pPacket->m_turn = m_lastNetTurnProcessed;
         SendNetPacketToAll(pPacket, false);
     }
 }
@@ -7,13 +7,16 @@
 #include "Gugu/Network/EnumsNetwork.h"
 #include "Gugu/Network/ClientInfo.h"
 #include "Gugu/Network/NetworkPacket.h"
+#include "Gugu/Network/NetworkBuffer.h"
+#include "Gugu/System/SpscQueue.h"
 
 #include <SFML/Network/IpAddress.hpp>
 
-#include <mutex>
+#include <atomic>
 #include <list>
 #include <map>
-#include <queue>
+#include <thread>
+#include <vector>
 
 ////////////////////////////////////////////////////////////////
 // Macros
@@ -28,12 +31,18 @@
 namespace gugu
 {
     class LoggerEngine;
+    class NetworkServerEpoll;
+    class NetworkUdpChannel;
+    class NetworkLinkSimulator;
+    struct NetworkDatagram;
 }
 
 namespace sf
 {
+    class Packet;
     class SocketSelector;
     class TcpListener;
+    class UdpSocket;
 }
 
 ////////////////////////////////////////////////////////////////
@@ -41,6 +50,15 @@ namespace sf
 
 namespace gugu {
 
+// Sockets are polled by a persistent reception thread, started with the listening.
+// - Received packets and connection events are handed to the main thread through a lock-free queue, the main thread never waits on the sockets.
+// - While the reception thread is running, it owns the selector, clients are added and removed through commands.
+// - A disconnected client is deleted once the reception thread has released it.
+// - The epoll backend replaces the selector for servers with many clients (Linux only).
+// - Packet types can be sent through udp channels, bound on the listening port (selector backend only, both peers need the same setup).
+//   Udp packets are not ordered with tcp packets, their channels are updated once per frame by ProcessWaitingPackets.
+// - Engine packets are recycled by a pool, a packet sent to several clients is serialized once in a reused buffer.
+//   Received datagrams are recycled back to the reception thread once processed.
 class ManagerNetwork
 {
 public:
@@ -48,15 +66,12 @@ public:
     ManagerNetwork();
     ~ManagerNetwork();
 
-    void StartListening(uint16 _uiPort);
+    void StartListening(uint16 _uiPort, ENetworkBackend::Type _eBackend = ENetworkBackend::Selector);
     void StopListening();
     bool IsListening() const;
 
     void StartReceptionThread();
     void StopReceptionThread();
-    void StepReception();
-    void Lock();
-    void Unlock();
     void ProcessWaitingPackets();
 
     void ConnectToClient(sf::IpAddress _oIPAddress, uint16 _uiPort);
@@ -67,6 +82,7 @@ public:
 
     //ClientInfo* FindClient(sf::TcpSocket* _pSocket) const;
     ClientInfo* FindClient(uint32 _oIPAddress, uint16 _uiPort) const;
+    size_t GetClientCount() const;
 
     void SendNetPacketToAll         (NetPacket* _pPacket, bool _bIncludeSelf);
     void SendNetPacketToAllPlayers  (NetPacket* _pPacket, bool _bIncludeSelf);
@@ -74,6 +90,18 @@ public:
 
     bool SendNetPacket(ClientInfo* _pClient, NetPacket& _oPacket);
 
+    // Packets given to the SendNetPacketToAll methods can be acquired from the pool, they will be released to it.
+    NetPacket* AcquireNetPacket(ENetPacket::Type _eType);
+    void ReleaseNetPacket(NetPacket* _pPacket);
+
+    // Udp channels, packets fall back on tcp while the client udp port is unknown.
+    void SetPacketChannel(ENetPacket::Type _eType, ENetChannel::Type _eChannel);
+    ENetChannel::Type GetPacketChannel(ENetPacket::Type _eType) const;
+    bool IsUdpAvailable() const;
+
+    // Simulate a degraded link on the outgoing udp datagrams, for tests.
+    void SetUdpLinkSimulation(float _fLossRatio, int64 _iLatencyMs, int64 _iJitterMs);
+
     bool ReceiveNetPacket(NetPacket* _pPacket, ClientInfo* _pSender);
     void StoreGamePacket(NetPacketGame* _pPacket);
 
@@ -95,15 +123,83 @@ public:
 
 private:
 
+    enum class EReceptionEvent : uint8
+    {
+        Packet,
+        ClientConnected,    // Accepted by the reception thread.
+        ClientLost,         // The reception thread stopped polling the client after a reception error.
+        ClientReleased,     // The reception thread released the client, it can be deleted.
+        Datagram,           // Udp datagram, associated to its client by the main thread.
+    };
+
+    struct ReceptionEvent
+    {
+        EReceptionEvent type = EReceptionEvent::Packet;
+        NetPacket*  packet = nullptr;
+        ClientInfo* client = nullptr;
+        NetworkDatagram* datagram = nullptr;
+    };
+
+    enum class EReceptionCommand : uint8
+    {
+        AddClient,
+        RemoveClient,
+    };
+
+    struct ReceptionCommand
+    {
+        EReceptionCommand type = EReceptionCommand::AddClient;
+        ClientInfo* client = nullptr;
+    };
+
+    // Reception thread (or main thread when the reception thread is not running).
+    void ReceptionLoop();
+    void StepReception();
+    void ReadReceivedPacket(ClientInfo* _pClient, const uint8* data, size_t size);
+    void ReadReceivedDatagrams();
+    NetPacket* ReadNetPacket(NetBufferReader& reader);
+    void PushReceptionEvent(const ReceptionEvent& event);
+    void FlushReceptionEvents();
+    void ApplyReceptionCommand(const ReceptionCommand& command, bool releaseImmediately);
+
+    // Main thread.
+    void PushReceptionCommand(const ReceptionCommand& command);
+    void FlushReceptionCommands();
+    void ProcessReceptionEvent(const ReceptionEvent& event, bool dispatchPackets);
+    void ProcessReceivedDatagram(const NetworkDatagram& datagram);
+    void ReleaseDatagram(NetworkDatagram* datagram);
+    NetworkUdpChannel* GetUdpChannel(ClientInfo* _pClient) const;   // Null if udp can't be used with this client.
+    void UpdateUdpChannels();
+    void SendDatagram(int64 timeUs, uint32 ipAddress, uint16 port, const uint8* data, size_t size);
+    void SerializeNetPacket(const NetPacket& _oPacket);                     // Fill m_sendWriter, with a frame header for tcp.
+    bool SendSerializedPacket(ClientInfo* _pClient, ENetPacket::Type _eType);
+
     static bool ComparePlayerID(NetPacketGame* _pLeft, NetPacketGame* _pRight);
 
 private:
 
     sf::SocketSelector* m_selector;
     sf::TcpListener*    m_listener;
+    NetworkServerEpoll* m_serverEpoll;
+    sf::UdpSocket*      m_udpSocket;
+    bool                m_isUdpBound;
+    std::vector<uint8>  m_receptionDatagramBuffer;                  // Owned by the reception thread.
+    SpscQueue<NetworkDatagram*> m_freeDatagrams;                    // Processed datagrams, recycled from the main thread to the reception thread.
+    sf::Packet*         m_receptionPacket;                          // Owned by the reception thread.
+    std::map<ENetPacket::Type, ENetChannel::Type> m_packetChannels;
+    NetworkLinkSimulator* m_linkSimulator;
+
+    NetPacketPool       m_packetPool;
+    NetBufferWriter     m_sendWriter;                               // Owned by the main thread.
 
     std::thread*        m_receptionThread;
-    std::mutex          m_mutexReception;
+    std::atomic<bool>   m_isReceptionRunning;
+
+    SpscQueue<ReceptionEvent>       m_receptionEvents;      // Reception thread to main thread.
+    SpscQueue<ReceptionCommand>     m_receptionCommands;    // Main thread to reception thread.
+    std::vector<ReceptionEvent>     m_overflowEvents;       // Events waiting for room in the queue, owned by the reception thread.
+    std::vector<ReceptionCommand>   m_overflowCommands;     // Commands waiting for room in the queue, owned by the main thread.
+    std::vector<ClientInfo*>        m_receptionClients;     // Clients polled by the selector.
 
     bool                m_isListening;
     uint16              m_listeningPort;
@@ -118,18 +214,8 @@ private:
     std::map<uint32, std::list<NetPacketGame*>>    m_gamePackets;  //map <turn, packets>
     
     LoggerEngine*       m_logNetwork;
-
-    struct WaitingPacket
-    {
-        NetPacket*  packet;
-        ClientInfo* sender;
-    };
-
-    std::queue<WaitingPacket> m_waitingPackets;
 };
 
-void ReceptionThread();
-
 ManagerNetwork* GetNetwork();
 LoggerEngine* GetLogNetwork();
 
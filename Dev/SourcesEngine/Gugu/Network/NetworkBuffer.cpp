@@ -0,0 +1,415 @@
+////////////////////////////////////////////////////////////////
+// Header
+
+#include "Gugu/Common.h"
+#include "Gugu/Network/NetworkBuffer.h"
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include <algorithm>
+#include <cstring>
+
+////////////////////////////////////////////////////////////////
+// File Implementation
+
+namespace gugu {
+
+NetBufferWriter::NetBufferWriter(size_t capacity)
+    : m_headerSize(0)
+    , m_bitPosition(0)
+{
+    m_buffer.reserve(capacity);
+}
+
+void NetBufferWriter::Reset(size_t headerSize)
+{
+    m_buffer.clear();
+    m_buffer.resize(headerSize, 0);
+    m_headerSize = headerSize;
+    m_bitPosition = 0;
+}
+
+void NetBufferWriter::WriteUInt8(uint8 value)
+{
+    m_bitPosition = 0;
+    m_buffer.push_back(value);
+}
+
+void NetBufferWriter::WriteUInt16(uint16 value)
+{
+    m_bitPosition = 0;
+    m_buffer.push_back(static_cast<uint8>(value >> 8));
+    m_buffer.push_back(static_cast<uint8>(value));
+}
+
+void NetBufferWriter::WriteUInt32(uint32 value)
+{
+    WriteUInt16(static_cast<uint16>(value >> 16));
+    WriteUInt16(static_cast<uint16>(value));
+}
+
+void NetBufferWriter::WriteUInt64(uint64 value)
+{
+    WriteUInt32(static_cast<uint32>(value >> 32));
+    WriteUInt32(static_cast<uint32>(value));
+}
+
+void NetBufferWriter::WriteInt32(int32 value)
+{
+    WriteUInt32(static_cast<uint32>(value));
+}
+
+void NetBufferWriter::WriteFloat(float value)
+{
+    uint32 bits;
+    memcpy(&bits, &value, sizeof(bits));
+    WriteUInt32(bits);
+}
+
+void NetBufferWriter::WriteVarUInt32(uint32 value)
+{
+    WriteVarUInt64(value);
+}
+
+void NetBufferWriter::WriteVarUInt64(uint64 value)
+{
+    m_bitPosition = 0;
+
+    while (value >= 0x80)
+    {
+        m_buffer.push_back(static_cast<uint8>(value | 0x80));
+        value >>= 7;
+    }
+
+    m_buffer.push_back(static_cast<uint8>(value));
+}
+
+void NetBufferWriter::WriteVarInt32(int32 value)
+{
+    // Zigzag, small negative values are encoded on few bytes.
+    WriteVarUInt32((static_cast<uint32>(value) << 1) ^ static_cast<uint32>(value >> 31));
+}
+
+void NetBufferWriter::WriteVarInt64(int64 value)
+{
+    WriteVarUInt64((static_cast<uint64>(value) << 1) ^ static_cast<uint64>(value >> 63));
+}
+
+void NetBufferWriter::WriteBits(uint32 value, uint32 bitCount)
+{
+    bitCount = std::min<uint32>(bitCount, 32);
+
+    while (bitCount > 0)
+    {
+        if (m_bitPosition == 0)
+        {
+            m_buffer.push_back(0);
+        }
+
+        uint32 freeBits = 8 - m_bitPosition;
+        uint32 chunkBits = std::min(freeBits, bitCount);
+        uint32 chunk = (value >> (bitCount - chunkBits)) & ((1u << chunkBits) - 1);
+
+        m_buffer.back() |= static_cast<uint8>(chunk << (freeBits - chunkBits));
+
+        bitCount -= chunkBits;
+        m_bitPosition = (m_bitPosition + chunkBits) & 7;
+    }
+}
+
+void NetBufferWriter::WriteBool(bool value)
+{
+    WriteBits(value ? 1 : 0, 1);
+}
+
+void NetBufferWriter::WriteBytes(const void* data, size_t size)
+{
+    m_bitPosition = 0;
+
+    const uint8* bytes = static_cast<const uint8*>(data);
+    m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+}
+
+void NetBufferWriter::WriteString(std::string_view value)
+{
+    WriteVarUInt64(value.size());
+    WriteBytes(value.data(), value.size());
+}
+
+void NetBufferWriter::WriteUInt32At(size_t position, uint32 value)
+{
+    if (position + sizeof(uint32) > m_buffer.size())
+        return;
+
+    m_buffer[position] = static_cast<uint8>(value >> 24);
+    m_buffer[position + 1] = static_cast<uint8>(value >> 16);
+    m_buffer[position + 2] = static_cast<uint8>(value >> 8);
+    m_buffer[position + 3] = static_cast<uint8>(value);
+}
+
+const uint8* NetBufferWriter::GetData() const
+{
+    return m_buffer.data() + m_headerSize;
+}
+
+size_t NetBufferWriter::GetSize() const
+{
+    return m_buffer.size() - m_headerSize;
+}
+
+const uint8* NetBufferWriter::GetFrameData() const
+{
+    return m_buffer.data();
+}
+
+size_t NetBufferWriter::GetFrameSize() const
+{
+    return m_buffer.size();
+}
+
+size_t NetBufferWriter::GetHeaderSize() const
+{
+    return m_headerSize;
+}
+
+NetBufferReader::NetBufferReader(const void* data, size_t size)
+    : m_data(static_cast<const uint8*>(data))
+    , m_size(size)
+    , m_offset(0)
+    , m_bitPosition(0)
+    , m_isValid(true)
+{
+}
+
+bool NetBufferReader::ReadAligned(size_t size, const uint8*& data)
+{
+    m_bitPosition = 0;
+
+    if (!m_isValid || size > m_size - m_offset)
+        return Invalidate();
+
+    data = m_data + m_offset;
+    m_offset += size;
+    return true;
+}
+
+bool NetBufferReader::Invalidate()
+{
+    m_isValid = false;
+    m_offset = m_size;
+    return false;
+}
+
+bool NetBufferReader::ReadUInt8(uint8& value)
+{
+    const uint8* data = nullptr;
+    if (!ReadAligned(1, data))
+    {
+        value = 0;
+        return false;
+    }
+
+    value = data[0];
+    return true;
+}
+
+bool NetBufferReader::ReadUInt16(uint16& value)
+{
+    const uint8* data = nullptr;
+    if (!ReadAligned(2, data))
+    {
+        value = 0;
+        return false;
+    }
+
+    value = static_cast<uint16>((data[0] << 8) | data[1]);
+    return true;
+}
+
+bool NetBufferReader::ReadUInt32(uint32& value)
+{
+    uint16 high = 0;
+    uint16 low = 0;
+    bool result = ReadUInt16(high) && ReadUInt16(low);
+
+    value = (static_cast<uint32>(high) << 16) | low;
+    return result;
+}
+
+bool NetBufferReader::ReadUInt64(uint64& value)
+{
+    uint32 high = 0;
+    uint32 low = 0;
+    bool result = ReadUInt32(high) && ReadUInt32(low);
+
+    value = (static_cast<uint64>(high) << 32) | low;
+    return result;
+}
+
+bool NetBufferReader::ReadInt32(int32& value)
+{
+    uint32 bits = 0;
+    bool result = ReadUInt32(bits);
+
+    value = static_cast<int32>(bits);
+    return result;
+}
+
+bool NetBufferReader::ReadFloat(float& value)
+{
+    uint32 bits = 0;
+    bool result = ReadUInt32(bits);
+
+    memcpy(&value, &bits, sizeof(bits));
+    return result;
+}
+
+bool NetBufferReader::ReadVarUInt32(uint32& value)
+{
+    uint64 value64 = 0;
+    bool result = ReadVarUInt64(value64);
+    if (result && value64 > 0xFFFFFFFF)
+    {
+        result = Invalidate();
+    }
+
+    value = result ? static_cast<uint32>(value64) : 0;
+    return result;
+}
+
+bool NetBufferReader::ReadVarUInt64(uint64& value)
+{
+    value = 0;
+
+    // At most 10 bytes for 64 bits.
+    for (uint32 shift = 0; shift < 70; shift += 7)
+    {
+        uint8 byte = 0;
+        if (!ReadUInt8(byte))
+        {
+            value = 0;
+            return false;
+        }
+
+        value |= static_cast<uint64>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+            return true;
+    }
+
+    value = 0;
+    return Invalidate();
+}
+
+bool NetBufferReader::ReadVarInt32(int32& value)
+{
+    uint32 encoded = 0;
+    bool result = ReadVarUInt32(encoded);
+
+    value = static_cast<int32>((encoded >> 1) ^ (~(encoded & 1) + 1));
+    return result;
+}
+
+bool NetBufferReader::ReadVarInt64(int64& value)
+{
+    uint64 encoded = 0;
+    bool result = ReadVarUInt64(encoded);
+
+    value = static_cast<int64>((encoded >> 1) ^ (~(encoded & 1) + 1));
+    return result;
+}
+
+bool NetBufferReader::ReadBits(uint32& value, uint32 bitCount)
+{
+    value = 0;
+
+    if (!m_isValid || bitCount > 32)
+        return Invalidate();
+
+    while (bitCount > 0)
+    {
+        // The current byte is consumed when its first bit is read.
+        if (m_bitPosition == 0)
+        {
+            if (m_offset >= m_size)
+            {
+                value = 0;
+                return Invalidate();
+            }
+
+            ++m_offset;
+        }
+
+        uint8 byte = m_data[m_offset - 1];
+        uint32 availableBits = 8 - m_bitPosition;
+        uint32 chunkBits = std::min(availableBits, bitCount);
+        uint32 chunk = (byte >> (availableBits - chunkBits)) & ((1u << chunkBits) - 1);
+
+        value = (value << chunkBits) | chunk;
+
+        bitCount -= chunkBits;
+        m_bitPosition = (m_bitPosition + chunkBits) & 7;
+    }
+
+    return true;
+}
+
+bool NetBufferReader::ReadBool(bool& value)
+{
+    uint32 bit = 0;
+    bool result = ReadBits(bit, 1);
+
+    value = bit != 0;
+    return result;
+}
+
+bool NetBufferReader::ReadBytes(void* data, size_t size)
+{
+    const uint8* source = nullptr;
+    if (!ReadAligned(size, source))
+        return false;
+
+    if (size > 0)
+    {
+        memcpy(data, source, size);
+    }
+
+    return true;
+}
+
+bool NetBufferReader::ReadBytesView(const uint8*& data, size_t size)
+{
+    data = nullptr;
+    return ReadAligned(size, data);
+}
+
+bool NetBufferReader::ReadString(std::string& value)
+{
+    uint64 size = 0;
+    const uint8* source = nullptr;
+    if (!ReadVarUInt64(size) || !ReadAligned(static_cast<size_t>(size), source))
+    {
+        value.clear();
+        return false;
+    }
+
+    value.assign(reinterpret_cast<const char*>(source), static_cast<size_t>(size));
+    return true;
+}
+
+bool NetBufferReader::IsValid() const
+{
+    return m_isValid;
+}
+
+bool NetBufferReader::IsEnd() const
+{
+    return m_offset >= m_size;
+}
+
+size_t NetBufferReader::GetRemainingSize() const
+{
+    return m_size - m_offset;
+}
+
+}   // namespace gugu
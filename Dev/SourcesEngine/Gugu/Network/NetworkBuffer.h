@@ -0,0 +1,107 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/System/Types.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// File Declarations
+
+namespace gugu {
+
+// Serialization of the network packets in a flat byte buffer, which keeps its capacity between packets.
+// - Fixed size integers are written in big-endian, varints use 7 bits per byte (zigzag encoding for signed values).
+// - Bits are packed in the current byte, the next byte-aligned write starts a new byte.
+// - A header can be reserved before the payload, to write a frame size once the payload is known.
+class NetBufferWriter
+{
+public:
+
+    explicit NetBufferWriter(size_t capacity = 0);
+
+    void Reset(size_t headerSize = 0);
+
+    void WriteUInt8(uint8 value);
+    void WriteUInt16(uint16 value);
+    void WriteUInt32(uint32 value);
+    void WriteUInt64(uint64 value);
+    void WriteInt32(int32 value);
+    void WriteFloat(float value);
+
+    void WriteVarUInt32(uint32 value);
+    void WriteVarUInt64(uint64 value);
+    void WriteVarInt32(int32 value);
+    void WriteVarInt64(int64 value);
+
+    void WriteBits(uint32 value, uint32 bitCount);  // Up to 32 bits, most significant bits first.
+    void WriteBool(bool value);                     // Single bit.
+
+    void WriteBytes(const void* data, size_t size);
+    void WriteString(std::string_view value);
+
+    void WriteUInt32At(size_t position, uint32 value);  // Overwrite 4 bytes, the position is relative to the header start.
+
+    const uint8* GetData() const;       // Payload.
+    size_t GetSize() const;
+    const uint8* GetFrameData() const;  // Header and payload.
+    size_t GetFrameSize() const;
+    size_t GetHeaderSize() const;
+
+private:
+
+    std::vector<uint8> m_buffer;
+    size_t m_headerSize;
+    uint32 m_bitPosition;   // Bits used in the last byte, 0 when aligned.
+};
+
+// Reading of a flat byte buffer written by a NetBufferWriter, the data is not copied.
+// - Reading past the end invalidates the reader, all the next reads fail.
+class NetBufferReader
+{
+public:
+
+    NetBufferReader(const void* data, size_t size);
+
+    bool ReadUInt8(uint8& value);
+    bool ReadUInt16(uint16& value);
+    bool ReadUInt32(uint32& value);
+    bool ReadUInt64(uint64& value);
+    bool ReadInt32(int32& value);
+    bool ReadFloat(float& value);
+
+    bool ReadVarUInt32(uint32& value);
+    bool ReadVarUInt64(uint64& value);
+    bool ReadVarInt32(int32& value);
+    bool ReadVarInt64(int64& value);
+
+    bool ReadBits(uint32& value, uint32 bitCount);
+    bool ReadBool(bool& value);
+
+    bool ReadBytes(void* data, size_t size);
+    bool ReadBytesView(const uint8*& data, size_t size);    // No copy, the data stays owned by the buffer.
+    bool ReadString(std::string& value);
+
+    bool IsValid() const;
+    bool IsEnd() const;
+    size_t GetRemainingSize() const;
+
+private:
+
+    bool ReadAligned(size_t size, const uint8*& data);
+    bool Invalidate();
+
+private:
+
+    const uint8* m_data;
+    size_t m_size;
+    size_t m_offset;
+    uint32 m_bitPosition;   // Bits read in the previous byte, 0 when aligned.
+    bool m_isValid;
+};
+
+}   // namespace gugu
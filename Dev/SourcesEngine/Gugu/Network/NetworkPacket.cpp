@@ -7,7 +7,8 @@
 ////////////////////////////////////////////////////////////////
 // Includes
 
-#include <SFML/Network/Packet.hpp>
+#include "Gugu/Network/NetworkBuffer.h"
+#include "Gugu/System/Container.h"
 
 ////////////////////////////////////////////////////////////////
 // File Implementation
@@ -17,123 +18,132 @@ namespace gugu {
 NetPacket::NetPacket()
 {
     m_type = ENetPacket::Undefined;
+    m_isPooled = false;
 }
 
 NetPacket::NetPacket(ENetPacket::Type _eType)
 {
     m_type = _eType;
+    m_isPooled = false;
 }
 
 NetPacket::~NetPacket()
 {
 }
 
-void NetPacket::FillSFPacket(sf::Packet& _oSFPacket)
+void NetPacket::Serialize(NetBufferWriter& writer) const
 {
-    _oSFPacket << static_cast<uint32>(m_type);
+    writer.WriteVarUInt32(static_cast<uint32>(m_type));
 }
 
-void NetPacket::ReadSFPacket(sf::Packet& _oSFPacket)
+bool NetPacket::Deserialize(NetBufferReader& reader)
 {
+    return reader.IsValid();
 }
 
-NetPacketClientConnection::NetPacketClientConnection(uint32 _oIPAddress, uint16 _uiPort)
+NetPacketClientConnection::NetPacketClientConnection()
 {
     m_type = ENetPacket::ClientInfos;
 
-    m_ipAddress = _oIPAddress;
-    m_port      = _uiPort;
+    m_ipAddress = 0;
+    m_port      = 0;
 }
 
-NetPacketClientConnection::NetPacketClientConnection(sf::Packet& _oSFPacket)
+NetPacketClientConnection::NetPacketClientConnection(uint32 _oIPAddress, uint16 _uiPort)
 {
     m_type = ENetPacket::ClientInfos;
 
-    ReadSFPacket(_oSFPacket);
+    m_ipAddress = _oIPAddress;
+    m_port      = _uiPort;
 }
 
 NetPacketClientConnection::~NetPacketClientConnection()
 {
 }
 
-void NetPacketClientConnection::FillSFPacket(sf::Packet& _oSFPacket)
+void NetPacketClientConnection::Serialize(NetBufferWriter& writer) const
 {
-    NetPacket::FillSFPacket(_oSFPacket);
+    NetPacket::Serialize(writer);
 
-    _oSFPacket << m_ipAddress << m_port;
+    writer.WriteUInt32(m_ipAddress);
+    writer.WriteUInt16(m_port);
 }
 
-void NetPacketClientConnection::ReadSFPacket(sf::Packet& _oSFPacket)
+bool NetPacketClientConnection::Deserialize(NetBufferReader& reader)
 {
-    NetPacket::ReadSFPacket(_oSFPacket);
-
-    _oSFPacket >> m_ipAddress >> m_port;
+    return NetPacket::Deserialize(reader)
+        && reader.ReadUInt32(m_ipAddress)
+        && reader.ReadUInt16(m_port);
 }
 
-NetPacketAddPlayer::NetPacketAddPlayer(uint32 _oIPAddress, uint16 _uiPort, int32 _iPlayerID)
+NetPacketAddPlayer::NetPacketAddPlayer()
 {
     m_type = ENetPacket::AddPlayer;
 
-    m_ipAddress = _oIPAddress;
-    m_port      = _uiPort;
-    m_playerID      = _iPlayerID;
+    m_ipAddress = 0;
+    m_port      = 0;
+    m_playerID  = -1;
 }
 
-NetPacketAddPlayer::NetPacketAddPlayer(sf::Packet& _oSFPacket)
+NetPacketAddPlayer::NetPacketAddPlayer(uint32 _oIPAddress, uint16 _uiPort, int32 _iPlayerID)
 {
     m_type = ENetPacket::AddPlayer;
 
-    ReadSFPacket(_oSFPacket);
+    m_ipAddress = _oIPAddress;
+    m_port      = _uiPort;
+    m_playerID      = _iPlayerID;
 }
 
 NetPacketAddPlayer::~NetPacketAddPlayer()
 {
 }
 
-void NetPacketAddPlayer::FillSFPacket(sf::Packet& _oSFPacket)
+void NetPacketAddPlayer::Serialize(NetBufferWriter& writer) const
 {
-    NetPacket::FillSFPacket(_oSFPacket);
+    NetPacket::Serialize(writer);
 
-    _oSFPacket << m_ipAddress << m_port << m_playerID;
+    writer.WriteUInt32(m_ipAddress);
+    writer.WriteUInt16(m_port);
+    writer.WriteVarInt32(m_playerID);
 }
 
-void NetPacketAddPlayer::ReadSFPacket(sf::Packet& _oSFPacket)
+bool NetPacketAddPlayer::Deserialize(NetBufferReader& reader)
 {
-    NetPacket::ReadSFPacket(_oSFPacket);
-
-    _oSFPacket >> m_ipAddress >> m_port >> m_playerID;
+    return NetPacket::Deserialize(reader)
+        && reader.ReadUInt32(m_ipAddress)
+        && reader.ReadUInt16(m_port)
+        && reader.ReadVarInt32(m_playerID);
 }
 
-NetPacketTurnReady::NetPacketTurnReady(uint32 _uiNetTurn)
+NetPacketTurnReady::NetPacketTurnReady()
 {
     m_type = ENetPacket::TurnReady;
 
-    m_turn = _uiNetTurn;
+    m_turn = 0;
 }
 
-NetPacketTurnReady::NetPacketTurnReady(sf::Packet& _oSFPacket)
+NetPacketTurnReady::NetPacketTurnReady(uint32 _uiNetTurn)
 {
     m_type = ENetPacket::TurnReady;
 
-    ReadSFPacket(_oSFPacket);
+    m_turn = _uiNetTurn;
 }
 
 NetPacketTurnReady::~NetPacketTurnReady()
 {
 }
 
-void NetPacketTurnReady::FillSFPacket(sf::Packet& _oSFPacket)
+void NetPacketTurnReady::Serialize(NetBufferWriter& writer) const
 {
-    NetPacket::FillSFPacket(_oSFPacket);
+    NetPacket::Serialize(writer);
 
-    _oSFPacket << m_turn;
+    writer.WriteVarUInt32(m_turn);
 }
 
-void NetPacketTurnReady::ReadSFPacket(sf::Packet& _oSFPacket)
+bool NetPacketTurnReady::Deserialize(NetBufferReader& reader)
 {
-    NetPacket::ReadSFPacket(_oSFPacket);
-
-    _oSFPacket >> m_turn;
+    return NetPacket::Deserialize(reader)
+        && reader.ReadVarUInt32(m_turn);
 }
 
 NetPacketGame::NetPacketGame()
@@ -142,30 +152,111 @@ NetPacketGame::NetPacketGame()
     m_turn = 0;
 }
 
-NetPacketGame::NetPacketGame(sf::Packet& _oSFPacket)
+NetPacketGame::~NetPacketGame()
 {
-    m_type = ENetPacket::Game;
-    m_turn = 0;
+}
+
+void NetPacketGame::Serialize(NetBufferWriter& writer) const
+{
+    NetPacket::Serialize(writer);
 
-    ReadSFPacket(_oSFPacket);
+    writer.WriteVarUInt32(m_turn);
 }
 
-NetPacketGame::~NetPacketGame()
+bool NetPacketGame::Deserialize(NetBufferReader& reader)
 {
+    return NetPacket::Deserialize(reader)
+        && reader.ReadVarUInt32(m_turn);
 }
 
-void NetPacketGame::FillSFPacket(sf::Packet& _oSFPacket)
+NetPacketPool::NetPacketPool()
 {
-    NetPacket::FillSFPacket(_oSFPacket);
+}
+
+NetPacketPool::~NetPacketPool()
+{
+    for (std::vector<NetPacket*>& freePackets : m_freePackets)
+    {
+        ClearStdVector(freePackets);
+    }
+}
 
-    _oSFPacket << m_turn;
+NetPacket* NetPacketPool::Acquire(ENetPacket::Type type)
+{
+    if (type <= ENetPacket::Undefined || type >= ENetPacket::Game)
+        return nullptr;
+
+    NetPacket* packet = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        std::vector<NetPacket*>& freePackets = m_freePackets[type];
+        if (!freePackets.empty())
+        {
+            packet = freePackets.back();
+            freePackets.pop_back();
+        }
+    }
+
+    if (!packet)
+    {
+        if (type == ENetPacket::ClientInfos)
+        {
+            packet = new NetPacketClientConnection;
+        }
+        else if (type == ENetPacket::AddPlayer)
+        {
+            packet = new NetPacketAddPlayer;
+        }
+        else if (type == ENetPacket::TurnReady)
+        {
+            packet = new NetPacketTurnReady;
+        }
+        else
+        {
+            packet = new NetPacket(type);
+        }
+
+        packet->m_isPooled = true;
+    }
+
+    return packet;
+}
+
+void NetPacketPool::Release(NetPacket* packet)
+{
+    if (!packet)
+        return;
+
+    if (packet->m_isPooled && packet->m_type > ENetPacket::Undefined && packet->m_type < ENetPacket::Game)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // Free lists are reserved on their first release, the next releases don't allocate.
+        std::vector<NetPacket*>& freePackets = m_freePackets[packet->m_type];
+        if (freePackets.size() < MaxFreePacketsPerType)
+        {
+            if (freePackets.capacity() == 0)
+            {
+                freePackets.reserve(MaxFreePacketsPerType);
+            }
+
+            freePackets.push_back(packet);
+            return;
+        }
+    }
+
+    delete packet;
 }
 
-void NetPacketGame::ReadSFPacket(sf::Packet& _oSFPacket)
+size_t NetPacketPool::GetFreeCount(ENetPacket::Type type) const
 {
-    NetPacket::ReadSFPacket(_oSFPacket);
+    if (type <= ENetPacket::Undefined || type >= ENetPacket::Game)
+        return 0;
 
-    _oSFPacket >> m_turn;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_freePackets[type].size();
 }
 
 }   // namespace gugu
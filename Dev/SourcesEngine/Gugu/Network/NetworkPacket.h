@@ -6,14 +6,16 @@
 #include "Gugu/System/Types.h"
 #include "Gugu/Network/EnumsNetwork.h"
 
-#include <SFML/Network/IpAddress.hpp>
+#include <mutex>
+#include <vector>
 
 ////////////////////////////////////////////////////////////////
 // Forward Declarations
 
-namespace sf
+namespace gugu
 {
-    class Packet;
+    class NetBufferWriter;
+    class NetBufferReader;
 }
 
 ////////////////////////////////////////////////////////////////
@@ -29,24 +31,26 @@ public:
     NetPacket(ENetPacket::Type _eType);
     virtual ~NetPacket();
 
-    virtual void FillSFPacket(sf::Packet& _oSFPacket);
-    virtual void ReadSFPacket(sf::Packet& _oSFPacket);
+    // The type is written by Serialize, but is read by the network manager before calling Deserialize.
+    virtual void Serialize(NetBufferWriter& writer) const;
+    virtual bool Deserialize(NetBufferReader& reader);
 
 public:
 
     ENetPacket::Type m_type;
+    bool m_isPooled;            // Acquired from a NetPacketPool, and released to it.
 };
     
 class NetPacketClientConnection : public NetPacket
 {
 public:
 
+    NetPacketClientConnection();
     NetPacketClientConnection(uint32 _oIPAddress, uint16 _uiPort);
-    NetPacketClientConnection(sf::Packet& _oSFPacket);
     virtual ~NetPacketClientConnection();
 
-    virtual void FillSFPacket(sf::Packet& _oSFPacket) override;
-    virtual void ReadSFPacket(sf::Packet& _oSFPacket) override;
+    virtual void Serialize(NetBufferWriter& writer) const override;
+    virtual bool Deserialize(NetBufferReader& reader) override;
     
 public:
 
@@ -58,12 +62,12 @@ class NetPacketAddPlayer : public NetPacket
 {
 public:
 
+    NetPacketAddPlayer();
     NetPacketAddPlayer(uint32 _oIPAddress, uint16 _uiPort, int32 _iPlayerID);
-    NetPacketAddPlayer(sf::Packet& _oSFPacket);
     virtual ~NetPacketAddPlayer();
 
-    virtual void FillSFPacket(sf::Packet& _oSFPacket) override;
-    virtual void ReadSFPacket(sf::Packet& _oSFPacket) override;
+    virtual void Serialize(NetBufferWriter& writer) const override;
+    virtual bool Deserialize(NetBufferReader& reader) override;
 
 public:
 
@@ -76,12 +80,12 @@ class NetPacketTurnReady : public NetPacket
 {
 public:
 
+    NetPacketTurnReady();
     NetPacketTurnReady(uint32 _uiNetTurn);
-    NetPacketTurnReady(sf::Packet& _oSFPacket);
     virtual ~NetPacketTurnReady();
 
-    virtual void FillSFPacket(sf::Packet& _oSFPacket) override;
-    virtual void ReadSFPacket(sf::Packet& _oSFPacket) override;
+    virtual void Serialize(NetBufferWriter& writer) const override;
+    virtual bool Deserialize(NetBufferReader& reader) override;
     
 public:
 
@@ -93,15 +97,37 @@ class NetPacketGame : public NetPacket
 public:
 
     NetPacketGame();
-    NetPacketGame(sf::Packet& _oSFPacket);
     virtual ~NetPacketGame();
 
-    virtual void FillSFPacket(sf::Packet& _oSFPacket) override;
-    virtual void ReadSFPacket(sf::Packet& _oSFPacket) override;
+    virtual void Serialize(NetBufferWriter& writer) const override;
+    virtual bool Deserialize(NetBufferReader& reader) override;
     
 public:
 
     uint32  m_turn;
 };
 
+// Recycles the engine packets, to avoid an allocation per sent or received packet.
+// - Game packets are created by the application, they are never pooled.
+// - Packets are acquired by the reception thread and released by the main thread, the free lists are protected by a mutex.
+class NetPacketPool
+{
+public:
+
+    static constexpr size_t MaxFreePacketsPerType = 1024;
+
+    NetPacketPool();
+    ~NetPacketPool();
+
+    NetPacket* Acquire(ENetPacket::Type type);  // Null for game packets and unknown types, a recycled packet keeps its previous values.
+    void Release(NetPacket* packet);            // Packets not acquired from a pool are deleted.
+
+    size_t GetFreeCount(ENetPacket::Type type) const;
+
+private:
+
+    std::vector<NetPacket*> m_freePackets[ENetPacket::Game];
+    mutable std::mutex m_mutex;
+};
+
 }   // namespace gugu
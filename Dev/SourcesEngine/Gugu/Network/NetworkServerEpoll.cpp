@@ -0,0 +1,452 @@
+////////////////////////////////////////////////////////////////
+// Header
+
+#include "Gugu/Common.h"
+#include "Gugu/Network/NetworkServerEpoll.h"
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/System/Container.h"
+
+#if defined(GUGU_OS_LINUX)
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#endif
+
+////////////////////////////////////////////////////////////////
+// File Implementation
+
+namespace gugu {
+
+#if defined(GUGU_OS_LINUX)
+
+namespace impl {
+
+const size_t ReceiveChunkSize = 4096;
+const size_t MaxKeptReceiveBufferSize = 64 * 1024;     // Bigger buffers are released with their connection.
+const uint32 MaxFrameSize = 1024 * 1024;
+const size_t MaxPendingSendSize = 4 * 1024 * 1024;
+const int MaxEventsPerPoll = 256;
+
+void AppendFrame(std::vector<uint8>& buffer, const void* data, size_t size)
+{
+    uint32 frameSize = htonl(static_cast<uint32>(size));
+    const uint8* frameSizeBytes = reinterpret_cast<const uint8*>(&frameSize);
+    const uint8* dataBytes = static_cast<const uint8*>(data);
+
+    buffer.insert(buffer.end(), frameSizeBytes, frameSizeBytes + sizeof(frameSize));
+    buffer.insert(buffer.end(), dataBytes, dataBytes + size);
+}
+
+}   // namespace impl
+
+NetworkServerEpoll::NetworkServerEpoll(const DelegateAccepted& delegateAccepted, const DelegateReceived& delegateReceived, const DelegateLost& delegateLost)
+    : m_delegateAccepted(delegateAccepted)
+    , m_delegateReceived(delegateReceived)
+    , m_delegateLost(delegateLost)
+    , m_listenHandle(-1)
+    , m_epollHandle(-1)
+{
+}
+
+NetworkServerEpoll::~NetworkServerEpoll()
+{
+    Close();
+}
+
+bool NetworkServerEpoll::IsAvailable()
+{
+    return true;
+}
+
+bool NetworkServerEpoll::Listen(uint16 port)
+{
+    if (IsListening())
+        return false;
+
+    m_listenHandle = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    m_epollHandle = epoll_create1(EPOLL_CLOEXEC);
+    if (m_listenHandle < 0 || m_epollHandle < 0)
+    {
+        Close();
+        return false;
+    }
+
+    int reuseAddress = 1;
+    setsockopt(m_listenHandle, SOL_SOCKET, SO_REUSEADDR, &reuseAddress, sizeof(reuseAddress));
+
+    sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+
+    epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN | EPOLLET;
+    event.data.fd = m_listenHandle;
+
+    if (bind(m_listenHandle, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0
+        || listen(m_listenHandle, SOMAXCONN) != 0
+        || epoll_ctl(m_epollHandle, EPOLL_CTL_ADD, m_listenHandle, &event) != 0)
+    {
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+void NetworkServerEpoll::Close()
+{
+    if (m_listenHandle >= 0)
+    {
+        close(m_listenHandle);
+        m_listenHandle = -1;
+    }
+
+    if (m_epollHandle >= 0)
+    {
+        close(m_epollHandle);
+        m_epollHandle = -1;
+    }
+}
+
+bool NetworkServerEpoll::IsListening() const
+{
+    return m_listenHandle >= 0;
+}
+
+void NetworkServerEpoll::Poll(int timeoutMs)
+{
+    epoll_event events[impl::MaxEventsPerPoll];
+    int eventCount = epoll_wait(m_epollHandle, events, impl::MaxEventsPerPoll, timeoutMs);
+
+    for (int i = 0; i < eventCount; ++i)
+    {
+        if (events[i].data.fd == m_listenHandle)
+        {
+            AcceptConnections();
+        }
+        else
+        {
+            ReadConnection(events[i].data.fd);
+        }
+    }
+}
+
+void NetworkServerEpoll::AcceptConnections()
+{
+    // Edge-triggered : accept until the backlog is empty.
+    while (true)
+    {
+        sockaddr_in address;
+        socklen_t addressSize = sizeof(address);
+        int handle = accept4(m_listenHandle, reinterpret_cast<sockaddr*>(&address), &addressSize, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (handle < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            break;
+        }
+
+        int noDelay = 1;
+        setsockopt(handle, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+        if (static_cast<size_t>(handle) >= m_connections.size())
+        {
+            m_connections.resize(handle + 1);
+        }
+
+        Connection& connection = m_connections[handle];
+        connection.client = m_delegateAccepted(handle, ntohl(address.sin_addr.s_addr));
+        connection.receiveSize = 0;
+
+        epoll_event event;
+        memset(&event, 0, sizeof(event));
+        event.events = EPOLLIN | EPOLLRDHUP | EPOLLET;
+        event.data.fd = handle;
+
+        if (epoll_ctl(m_epollHandle, EPOLL_CTL_ADD, handle, &event) != 0)
+        {
+            LoseConnection(handle);
+        }
+    }
+}
+
+void NetworkServerEpoll::ReadConnection(int handle)
+{
+    Connection& connection = m_connections[handle];
+    if (!connection.client)
+        return;
+
+    // Edge-triggered : read until the socket is drained, frames are parsed after each read to bound the buffer size.
+    while (true)
+    {
+        if (connection.receiveBuffer.size() - connection.receiveSize < impl::ReceiveChunkSize)
+        {
+            connection.receiveBuffer.resize(connection.receiveSize + impl::ReceiveChunkSize);
+        }
+
+        ssize_t readSize = recv(handle, connection.receiveBuffer.data() + connection.receiveSize, connection.receiveBuffer.size() - connection.receiveSize, 0);
+        if (readSize > 0)
+        {
+            connection.receiveSize += static_cast<size_t>(readSize);
+
+            if (!ReadFrames(connection))
+            {
+                LoseConnection(handle);
+                return;
+            }
+        }
+        else if (readSize < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else if (readSize < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            return;
+        }
+        else
+        {
+            // Closed by the peer, or socket error.
+            LoseConnection(handle);
+            return;
+        }
+    }
+}
+
+bool NetworkServerEpoll::ReadFrames(Connection& connection)
+{
+    const size_t frameHeaderSize = sizeof(uint32);
+    const uint8* data = connection.receiveBuffer.data();
+
+    size_t offset = 0;
+    while (connection.receiveSize - offset >= frameHeaderSize)
+    {
+        uint32 frameSize;
+        memcpy(&frameSize, data + offset, frameHeaderSize);
+        frameSize = ntohl(frameSize);
+
+        if (frameSize > impl::MaxFrameSize)
+            return false;
+
+        if (connection.receiveSize - offset - frameHeaderSize < frameSize)
+            break;
+
+        m_delegateReceived(connection.client, data + offset + frameHeaderSize, frameSize);
+        offset += frameHeaderSize + frameSize;
+    }
+
+    if (offset > 0)
+    {
+        memmove(connection.receiveBuffer.data(), data + offset, connection.receiveSize - offset);
+        connection.receiveSize -= offset;
+    }
+
+    return true;
+}
+
+void NetworkServerEpoll::LoseConnection(int handle)
+{
+    epoll_ctl(m_epollHandle, EPOLL_CTL_DEL, handle, nullptr);
+
+    Connection& connection = m_connections[handle];
+    ClientInfo* client = connection.client;
+    connection.client = nullptr;
+    connection.receiveSize = 0;
+
+    m_delegateLost(client);
+}
+
+void NetworkServerEpoll::CloseConnection(int handle)
+{
+    if (handle < 0)
+        return;
+
+    if (m_epollHandle >= 0)
+    {
+        // The connection may already be removed after a reception error.
+        epoll_ctl(m_epollHandle, EPOLL_CTL_DEL, handle, nullptr);
+    }
+
+    if (static_cast<size_t>(handle) < m_connections.size())
+    {
+        Connection& connection = m_connections[handle];
+        connection.client = nullptr;
+        connection.receiveSize = 0;
+
+        if (connection.receiveBuffer.size() > impl::MaxKeptReceiveBufferSize)
+        {
+            std::vector<uint8>().swap(connection.receiveBuffer);
+        }
+    }
+
+    close(handle);
+}
+
+bool NetworkServerEpoll::Send(int handle, const void* data, size_t size)
+{
+    if (handle < 0)
+        return false;
+
+    if (static_cast<size_t>(handle) >= m_pendingSends.size())
+    {
+        m_pendingSends.resize(handle + 1);
+    }
+
+    // Keep the frames order if previous data is still pending.
+    std::vector<uint8>& pendingSend = m_pendingSends[handle];
+    if (!pendingSend.empty())
+    {
+        if (pendingSend.size() + size > impl::MaxPendingSendSize)
+            return false;
+
+        impl::AppendFrame(pendingSend, data, size);
+        return true;
+    }
+
+    m_sendBuffer.clear();
+    impl::AppendFrame(m_sendBuffer, data, size);
+
+    size_t sentSize = 0;
+    if (!SendData(handle, m_sendBuffer.data(), m_sendBuffer.size(), sentSize))
+        return false;
+
+    if (sentSize < m_sendBuffer.size())
+    {
+        pendingSend.assign(m_sendBuffer.begin() + sentSize, m_sendBuffer.end());
+        m_pendingSendHandles.push_back(handle);
+    }
+
+    return true;
+}
+
+void NetworkServerEpoll::FlushSends()
+{
+    for (size_t i = m_pendingSendHandles.size(); i-- > 0;)
+    {
+        int handle = m_pendingSendHandles[i];
+        std::vector<uint8>& pendingSend = m_pendingSends[handle];
+
+        // On errors, the data is dropped, the reception will detect the lost connection.
+        size_t sentSize = 0;
+        if (!SendData(handle, pendingSend.data(), pendingSend.size(), sentSize))
+        {
+            sentSize = pendingSend.size();
+        }
+
+        pendingSend.erase(pendingSend.begin(), pendingSend.begin() + sentSize);
+
+        if (pendingSend.empty())
+        {
+            StdVectorRemoveAt(m_pendingSendHandles, i);
+        }
+    }
+}
+
+void NetworkServerEpoll::DiscardSends(int handle)
+{
+    if (handle < 0 || static_cast<size_t>(handle) >= m_pendingSends.size())
+        return;
+
+    m_pendingSends[handle].clear();
+    StdVectorRemove(m_pendingSendHandles, handle);
+}
+
+bool NetworkServerEpoll::SendData(int handle, const uint8* data, size_t size, size_t& sentSize)
+{
+    sentSize = 0;
+    while (sentSize < size)
+    {
+        ssize_t result = send(handle, data + sentSize, size - sentSize, MSG_NOSIGNAL);
+        if (result > 0)
+        {
+            sentSize += static_cast<size_t>(result);
+        }
+        else if (result < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else if (result < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            return true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+#else
+
+NetworkServerEpoll::NetworkServerEpoll(const DelegateAccepted& delegateAccepted, const DelegateReceived& delegateReceived, const DelegateLost& delegateLost)
+    : m_delegateAccepted(delegateAccepted)
+    , m_delegateReceived(delegateReceived)
+    , m_delegateLost(delegateLost)
+    , m_listenHandle(-1)
+    , m_epollHandle(-1)
+{
+}
+
+NetworkServerEpoll::~NetworkServerEpoll()
+{
+}
+
+bool NetworkServerEpoll::IsAvailable()
+{
+    return false;
+}
+
+bool NetworkServerEpoll::Listen(uint16 port)
+{
+    return false;
+}
+
+void NetworkServerEpoll::Close()
+{
+}
+
+bool NetworkServerEpoll::IsListening() const
+{
+    return false;
+}
+
+void NetworkServerEpoll::Poll(int timeoutMs)
+{
+}
+
+void NetworkServerEpoll::CloseConnection(int handle)
+{
+}
+
+bool NetworkServerEpoll::Send(int handle, const void* data, size_t size)
+{
+    return false;
+}
+
+void NetworkServerEpoll::FlushSends()
+{
+}
+
+void NetworkServerEpoll::DiscardSends(int handle)
+{
+}
+
+#endif
+
+}   // namespace gugu
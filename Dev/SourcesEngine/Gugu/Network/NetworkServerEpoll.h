@@ -0,0 +1,86 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/System/Types.h"
+
+#include <functional>
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// Forward Declarations
+
+namespace gugu
+{
+    class ClientInfo;
+}
+
+////////////////////////////////////////////////////////////////
+// File Declarations
+
+namespace gugu {
+
+// Server backend for the ManagerNetwork, using an edge-triggered epoll (Linux only).
+// - Only incoming connections are handled, frames use the sf::Packet format (32 bits big-endian size, then the payload).
+// - Connections are indexed by their socket handle, their receive buffers are kept and reused by the next connections.
+// - Poll and CloseConnection are called from the reception thread, Send, FlushSends and DiscardSends from the main thread.
+class NetworkServerEpoll
+{
+public:
+
+    using DelegateAccepted = std::function<ClientInfo*(int handle, uint32 ipAddress)>;
+    using DelegateReceived = std::function<void(ClientInfo* client, const uint8* data, size_t size)>;
+    using DelegateLost = std::function<void(ClientInfo* client)>;
+
+    NetworkServerEpoll(const DelegateAccepted& delegateAccepted, const DelegateReceived& delegateReceived, const DelegateLost& delegateLost);
+    ~NetworkServerEpoll();
+
+    static bool IsAvailable();
+
+    bool Listen(uint16 port);
+    void Close();               // Open connections stay valid until they are closed.
+    bool IsListening() const;
+
+    // Reception thread.
+    void Poll(int timeoutMs);
+    void CloseConnection(int handle);   // A lost connection is not polled anymore, but its handle is kept until this call.
+
+    // Main thread.
+    bool Send(int handle, const void* data, size_t size);   // Data that can't be sent immediately is kept for the next FlushSends.
+    void FlushSends();
+    void DiscardSends(int handle);
+
+private:
+
+    struct Connection
+    {
+        ClientInfo* client = nullptr;
+        std::vector<uint8> receiveBuffer;
+        size_t receiveSize = 0;
+    };
+
+    void AcceptConnections();
+    void ReadConnection(int handle);
+    bool ReadFrames(Connection& connection);
+    void LoseConnection(int handle);
+
+    bool SendData(int handle, const uint8* data, size_t size, size_t& sentSize);
+
+private:
+
+    DelegateAccepted m_delegateAccepted;
+    DelegateReceived m_delegateReceived;
+    DelegateLost m_delegateLost;
+
+    int m_listenHandle;
+    int m_epollHandle;
+
+    std::vector<Connection> m_connections;          // Indexed by handle, owned by the reception thread.
+
+    std::vector<std::vector<uint8>> m_pendingSends; // Indexed by handle, owned by the main thread.
+    std::vector<int> m_pendingSendHandles;
+    std::vector<uint8> m_sendBuffer;
+};
+
+}   // namespace gugu
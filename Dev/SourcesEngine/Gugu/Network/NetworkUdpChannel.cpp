@@ -0,0 +1,672 @@
+////////////////////////////////////////////////////////////////
+// Header
+
+#include "Gugu/Common.h"
+#include "Gugu/Network/NetworkUdpChannel.h"
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/System/Container.h"
+
+#include <algorithm>
+#include <cstring>
+
+////////////////////////////////////////////////////////////////
+// File Implementation
+
+namespace gugu {
+
+namespace impl {
+
+const uint8 DatagramFlagHasAck = 0x01;
+
+const size_t SentDatagramHistorySize = 1024;
+
+const int64 DefaultRetransmitTimeoutUs = 200 * 1000;
+const int64 MinRetransmitTimeoutUs = 20 * 1000;
+const int64 MaxRetransmitTimeoutUs = 1000 * 1000;
+const int64 MaxRetransmitBackoffUs = 8 * 1000 * 1000;
+const uint8 MaxRetransmitBackoffShift = 8;
+
+// Unreliable sequenced : a reassembly further than this window from a received message is stale, its message id has wrapped around.
+const uint16 SequencedReassemblyWindow = 1024;
+
+// Sequences wrap around, a sequence is more recent if it is less than half the range ahead.
+bool IsSequenceMoreRecent(uint16 sequence, uint16 reference)
+{
+    return sequence != reference && static_cast<uint16>(sequence - reference) < 0x8000;
+}
+
+}   // namespace impl
+
+NetworkUdpChannel::NetworkUdpChannel()
+{
+    Reset();
+}
+
+NetworkUdpChannel::~NetworkUdpChannel()
+{
+}
+
+void NetworkUdpChannel::Reset()
+{
+    m_nextSequence = 0;
+    m_nextFragmentId = 0;
+    m_reliableFragments.clear();
+    m_unreliableFragments.clear();
+    m_sentDatagrams.assign(impl::SentDatagramHistorySize, SentDatagram());
+    m_datagram.Reset();
+    m_datagramFragmentIds.clear();
+
+    m_hasReceivedDatagram = false;
+    m_isAckPending = false;
+    m_remoteSequence = 0;
+    m_remoteSequenceBits = 0;
+
+    m_hasRoundTrip = false;
+    m_smoothedRoundTripUs = 0;
+    m_roundTripVariationUs = 0;
+    m_retransmitTimeoutUs = impl::DefaultRetransmitTimeoutUs;
+    m_resentFragmentCount = 0;
+
+    for (size_t channel = 0; channel < ENetChannel::Count; ++channel)
+    {
+        m_nextMessageIds[channel] = 0;
+        m_receiveStates[channel] = ReceiveState();
+    }
+
+    m_receiveStates[ENetChannel::ReliableUnordered].deliveredWindow.assign(MaxReliableMessagesInFlight, false);
+}
+
+bool NetworkUdpChannel::Send(ENetChannel::Type channel, const void* data, size_t size)
+{
+    if (channel <= ENetChannel::Tcp || channel >= ENetChannel::Count || size > MaxMessageSize)
+        return false;
+
+    uint16 messageId = m_nextMessageIds[channel];
+
+    if (channel == ENetChannel::UnreliableSequenced)
+    {
+        QueueMessage(m_unreliableFragments, channel, messageId, static_cast<const uint8*>(data), size);
+    }
+    else
+    {
+        // The receiver only tracks a window of messages after the oldest one it did not receive.
+        for (const Fragment& fragment : m_reliableFragments)
+        {
+            if (!fragment.acked && fragment.channel == channel)
+            {
+                if (static_cast<uint16>(messageId - fragment.messageId) >= MaxReliableMessagesInFlight)
+                    return false;
+
+                break;
+            }
+        }
+
+        QueueMessage(m_reliableFragments, channel, messageId, static_cast<const uint8*>(data), size);
+    }
+
+    m_nextMessageIds[channel] = messageId + 1;
+    return true;
+}
+
+void NetworkUdpChannel::QueueMessage(std::vector<Fragment>& queue, ENetChannel::Type channel, uint16 messageId, const uint8* data, size_t size)
+{
+    size_t fragmentCount = std::max<size_t>(1, (size + MaxFragmentSize - 1) / MaxFragmentSize);
+    for (size_t fragmentIndex = 0; fragmentIndex < fragmentCount; ++fragmentIndex)
+    {
+        size_t offset = fragmentIndex * MaxFragmentSize;
+        size_t fragmentSize = std::min(MaxFragmentSize, size - offset);
+
+        queue.emplace_back();
+        Fragment& fragment = queue.back();
+        fragment.id = m_nextFragmentId++;
+        fragment.channel = channel;
+        fragment.messageId = messageId;
+        fragment.fragmentIndex = static_cast<uint8>(fragmentIndex);
+        fragment.fragmentCount = static_cast<uint8>(fragmentCount);
+        fragment.data.assign(data + offset, data + offset + fragmentSize);
+    }
+}
+
+void NetworkUdpChannel::Update(int64 timeUs, const DelegateDatagram& delegateDatagram)
+{
+    StdVectorRemoveIf(m_reliableFragments, [](const Fragment& fragment) { return fragment.acked; });
+
+    BeginDatagram();
+
+    for (Fragment& fragment : m_reliableFragments)
+    {
+        if (fragment.lastSendTimeUs >= 0)
+        {
+            int64 retransmitTimeoutUs = std::min(m_retransmitTimeoutUs << fragment.resendCount, impl::MaxRetransmitBackoffUs);
+            if (timeUs - fragment.lastSendTimeUs < retransmitTimeoutUs)
+                continue;
+
+            fragment.resendCount = std::min<uint8>(fragment.resendCount + 1, impl::MaxRetransmitBackoffShift);
+            ++m_resentFragmentCount;
+        }
+
+        if (m_datagram.GetSize() + FragmentHeaderSize + fragment.data.size() > MaxDatagramSize)
+        {
+            EndDatagram(timeUs, delegateDatagram);
+            BeginDatagram();
+        }
+
+        WriteFragment(fragment);
+        m_datagramFragmentIds.push_back(fragment.id);
+        fragment.lastSendTimeUs = timeUs;
+    }
+
+    for (const Fragment& fragment : m_unreliableFragments)
+    {
+        if (m_datagram.GetSize() + FragmentHeaderSize + fragment.data.size() > MaxDatagramSize)
+        {
+            EndDatagram(timeUs, delegateDatagram);
+            BeginDatagram();
+        }
+
+        WriteFragment(fragment);
+    }
+
+    m_unreliableFragments.clear();
+
+    if (m_datagram.GetSize() > DatagramHeaderSize || m_isAckPending)
+    {
+        EndDatagram(timeUs, delegateDatagram);
+    }
+}
+
+void NetworkUdpChannel::BeginDatagram()
+{
+    m_datagram.Reset();
+    m_datagramFragmentIds.clear();
+
+    m_datagram.WriteUInt16(m_nextSequence);
+    m_datagram.WriteUInt8(m_hasReceivedDatagram ? impl::DatagramFlagHasAck : 0);
+    m_datagram.WriteUInt16(m_remoteSequence);
+    m_datagram.WriteUInt32(m_remoteSequenceBits);
+}
+
+void NetworkUdpChannel::EndDatagram(int64 timeUs, const DelegateDatagram& delegateDatagram)
+{
+    SentDatagram& sentDatagram = m_sentDatagrams[m_nextSequence % impl::SentDatagramHistorySize];
+    sentDatagram.valid = true;
+    sentDatagram.acked = false;
+    sentDatagram.sequence = m_nextSequence;
+    sentDatagram.sendTimeUs = timeUs;
+    sentDatagram.fragmentIds.assign(m_datagramFragmentIds.begin(), m_datagramFragmentIds.end());
+
+    delegateDatagram(m_datagram.GetData(), m_datagram.GetSize());
+
+    ++m_nextSequence;
+    m_isAckPending = false;
+}
+
+void NetworkUdpChannel::WriteFragment(const Fragment& fragment)
+{
+    m_datagram.WriteUInt8(static_cast<uint8>(fragment.channel));
+    m_datagram.WriteUInt16(fragment.messageId);
+    m_datagram.WriteUInt8(fragment.fragmentIndex);
+    m_datagram.WriteUInt8(fragment.fragmentCount);
+    m_datagram.WriteUInt16(static_cast<uint16>(fragment.data.size()));
+    m_datagram.WriteBytes(fragment.data.data(), fragment.data.size());
+}
+
+bool NetworkUdpChannel::ReceiveDatagram(int64 timeUs, const void* data, size_t size, const DelegateMessage& delegateMessage)
+{
+    if (size < DatagramHeaderSize || size > MaxDatagramSize)
+        return false;
+
+    NetBufferReader reader(data, size);
+    uint16 sequence = 0;
+    uint8 flags = 0;
+    uint16 ack = 0;
+    uint32 ackBits = 0;
+    reader.ReadUInt16(sequence);
+    reader.ReadUInt8(flags);
+    reader.ReadUInt16(ack);
+    reader.ReadUInt32(ackBits);
+
+    // Acks for the peer, a duplicated datagram is only used for its acks.
+    bool hadReceivedDatagram = m_hasReceivedDatagram;
+    uint16 previousRemoteSequence = m_remoteSequence;
+    uint32 previousRemoteSequenceBits = m_remoteSequenceBits;
+    bool isDuplicate = false;
+    if (!m_hasReceivedDatagram)
+    {
+        m_hasReceivedDatagram = true;
+        m_remoteSequence = sequence;
+        m_remoteSequenceBits = 0;
+    }
+    else if (impl::IsSequenceMoreRecent(sequence, m_remoteSequence))
+    {
+        uint16 shift = static_cast<uint16>(sequence - m_remoteSequence);
+        m_remoteSequenceBits = shift < 32 ? (m_remoteSequenceBits << shift) : 0;
+        if (shift <= 32)
+        {
+            m_remoteSequenceBits |= 1u << (shift - 1);
+        }
+
+        m_remoteSequence = sequence;
+    }
+    else
+    {
+        // Datagrams older than the bits field are still read, their messages are filtered by their channel.
+        uint16 distance = static_cast<uint16>(m_remoteSequence - sequence);
+        if (distance == 0)
+        {
+            isDuplicate = true;
+        }
+        else if (distance <= 32)
+        {
+            uint32 mask = 1u << (distance - 1);
+            isDuplicate = (m_remoteSequenceBits & mask) != 0;
+            m_remoteSequenceBits |= mask;
+        }
+    }
+
+    // Acks from the peer, only the latest one is a round trip sample : with backed off resends, a datagram can be acked
+    // by the bits field long after it was received, when the ack sent right after its reception was lost.
+    if (flags & impl::DatagramFlagHasAck)
+    {
+        AckDatagram(timeUs, ack, true);
+        for (uint16 i = 0; i < 32; ++i)
+        {
+            if (ackBits & (1u << i))
+            {
+                AckDatagram(timeUs, static_cast<uint16>(ack - 1 - i), false);
+            }
+        }
+    }
+
+    if (isDuplicate)
+        return true;
+
+    // Datagrams carrying only acks are not acked, to avoid an endless exchange.
+    if (!reader.IsEnd())
+    {
+        m_isAckPending = true;
+    }
+
+    bool isRefused = false;
+    while (!reader.IsEnd())
+    {
+        if (!ReadFragment(reader, delegateMessage, isRefused))
+            return false;
+    }
+
+    // A reliable fragment refused for lack of space has to be resent by the peer, the datagram is not acked.
+    // Its other fragments will be received again, and filtered as duplicates.
+    if (isRefused)
+    {
+        m_hasReceivedDatagram = hadReceivedDatagram;
+        m_remoteSequence = previousRemoteSequence;
+        m_remoteSequenceBits = previousRemoteSequenceBits;
+    }
+
+    return true;
+}
+
+void NetworkUdpChannel::AckDatagram(int64 timeUs, uint16 sequence, bool isRoundTripSample)
+{
+    SentDatagram& sentDatagram = m_sentDatagrams[sequence % impl::SentDatagramHistorySize];
+    if (!sentDatagram.valid || sentDatagram.acked || sentDatagram.sequence != sequence)
+        return;
+
+    sentDatagram.acked = true;
+
+    for (uint32 fragmentId : sentDatagram.fragmentIds)
+    {
+        AckFragment(fragmentId);
+    }
+
+    if (!isRoundTripSample)
+        return;
+
+    // Each datagram has its own sequence, resent fragments don't make the samples ambiguous (RFC 6298 smoothing).
+    int64 sampleUs = std::max<int64>(0, timeUs - sentDatagram.sendTimeUs);
+    if (!m_hasRoundTrip)
+    {
+        m_hasRoundTrip = true;
+        m_smoothedRoundTripUs = sampleUs;
+        m_roundTripVariationUs = sampleUs / 2;
+    }
+    else
+    {
+        int64 deltaUs = m_smoothedRoundTripUs > sampleUs ? m_smoothedRoundTripUs - sampleUs : sampleUs - m_smoothedRoundTripUs;
+        m_roundTripVariationUs = (3 * m_roundTripVariationUs + deltaUs) / 4;
+        m_smoothedRoundTripUs = (7 * m_smoothedRoundTripUs + sampleUs) / 8;
+    }
+
+    m_retransmitTimeoutUs = std::clamp(m_smoothedRoundTripUs + 4 * m_roundTripVariationUs, impl::MinRetransmitTimeoutUs, impl::MaxRetransmitTimeoutUs);
+}
+
+void NetworkUdpChannel::AckFragment(uint32 fragmentId)
+{
+    auto iteFragment = std::lower_bound(m_reliableFragments.begin(), m_reliableFragments.end(), fragmentId, [](const Fragment& fragment, uint32 id)
+    {
+        return fragment.id < id;
+    });
+
+    if (iteFragment != m_reliableFragments.end() && iteFragment->id == fragmentId)
+    {
+        iteFragment->acked = true;
+    }
+}
+
+bool NetworkUdpChannel::ReadFragment(NetBufferReader& reader, const DelegateMessage& delegateMessage, bool& isRefused)
+{
+    uint8 channelValue = 0;
+    uint16 messageId = 0;
+    uint8 fragmentIndexValue = 0;
+    uint8 fragmentCountValue = 0;
+    uint16 fragmentSizeValue = 0;
+    if (!reader.ReadUInt8(channelValue)
+        || !reader.ReadUInt16(messageId)
+        || !reader.ReadUInt8(fragmentIndexValue)
+        || !reader.ReadUInt8(fragmentCountValue)
+        || !reader.ReadUInt16(fragmentSizeValue))
+    {
+        return false;
+    }
+
+    size_t fragmentIndex = fragmentIndexValue;
+    size_t fragmentCount = fragmentCountValue;
+    size_t fragmentSize = fragmentSizeValue;
+
+    // Only the last fragment of a message can be smaller than MaxFragmentSize.
+    if (channelValue <= ENetChannel::Tcp || channelValue >= ENetChannel::Count
+        || fragmentIndex >= fragmentCount
+        || fragmentSize > reader.GetRemainingSize()
+        || fragmentSize > MaxFragmentSize
+        || (fragmentIndex + 1 < fragmentCount && fragmentSize != MaxFragmentSize))
+    {
+        return false;
+    }
+
+    ENetChannel::Type channel = static_cast<ENetChannel::Type>(channelValue);
+    const uint8* fragmentData = nullptr;
+    reader.ReadBytesView(fragmentData, fragmentSize);
+
+    ReceiveState& state = m_receiveStates[channel];
+    if (channel == ENetChannel::UnreliableSequenced)
+    {
+        if (state.hasDelivered && !impl::IsSequenceMoreRecent(messageId, state.lastMessageId))
+            return true;
+
+        // Only the most recent message is reassembled : older fragments are dropped, and any newer message drops the reassembly.
+        // A reassembly further ahead than the window is an old one, whose message id has wrapped around.
+        if (!state.reassemblies.empty() && state.reassemblies.begin()->first != messageId)
+        {
+            uint16 reassemblyLead = static_cast<uint16>(state.reassemblies.begin()->first - messageId);
+            if (reassemblyLead >= impl::SequencedReassemblyWindow)
+            {
+                ClearReassemblies(state);
+            }
+            else if (fragmentCount > 1)
+            {
+                return true;
+            }
+        }
+    }
+    else if (!IsReliableMessageExpected(channel, messageId))
+    {
+        return true;
+    }
+
+    if (fragmentCount == 1)
+    {
+        // Only an ordered message received before the previous ones is buffered.
+        if (channel == ENetChannel::ReliableOrdered && !CanBufferMessage(channel, messageId, fragmentSize))
+        {
+            isRefused = true;
+            return true;
+        }
+
+        DeliverMessage(channel, messageId, fragmentData, fragmentSize, delegateMessage);
+        return true;
+    }
+
+    auto iteReassembly = state.reassemblies.find(messageId);
+    if (iteReassembly == state.reassemblies.end())
+    {
+        size_t reassemblySize = fragmentCount * MaxFragmentSize;
+        if (!CanBufferMessage(channel, messageId, reassemblySize))
+        {
+            isRefused = channel != ENetChannel::UnreliableSequenced;
+            return true;
+        }
+
+        iteReassembly = state.reassemblies.emplace(messageId, Reassembly()).first;
+        iteReassembly->second.fragmentCount = fragmentCount;
+        iteReassembly->second.receivedFragments.assign(fragmentCount, false);
+        iteReassembly->second.data.resize(reassemblySize);
+        state.bufferedSize += reassemblySize;
+    }
+
+    Reassembly& reassembly = iteReassembly->second;
+    if (reassembly.fragmentCount != fragmentCount)
+    {
+        return false;
+    }
+
+    if (reassembly.receivedFragments[fragmentIndex])
+        return true;
+
+    reassembly.receivedFragments[fragmentIndex] = true;
+    ++reassembly.receivedCount;
+    memcpy(reassembly.data.data() + fragmentIndex * MaxFragmentSize, fragmentData, fragmentSize);
+
+    if (fragmentIndex + 1 == fragmentCount)
+    {
+        reassembly.lastFragmentSize = fragmentSize;
+    }
+
+    if (reassembly.receivedCount == fragmentCount)
+    {
+        std::vector<uint8> message;
+        message.swap(reassembly.data);
+        size_t messageSize = (fragmentCount - 1) * MaxFragmentSize + reassembly.lastFragmentSize;
+
+        state.bufferedSize -= fragmentCount * MaxFragmentSize;
+        state.reassemblies.erase(iteReassembly);
+        DeliverMessage(channel, messageId, message.data(), messageSize, delegateMessage);
+    }
+
+    return true;
+}
+
+void NetworkUdpChannel::DeliverMessage(ENetChannel::Type channel, uint16 messageId, const uint8* data, size_t size, const DelegateMessage& delegateMessage)
+{
+    ReceiveState& state = m_receiveStates[channel];
+
+    if (channel == ENetChannel::ReliableOrdered)
+    {
+        if (messageId != state.nextMessageId)
+        {
+            state.waitingMessages[messageId].assign(data, data + size);
+            state.bufferedSize += size;
+            return;
+        }
+
+        delegateMessage(channel, data, size);
+        ++state.nextMessageId;
+
+        auto iteWaiting = state.waitingMessages.find(state.nextMessageId);
+        while (iteWaiting != state.waitingMessages.end())
+        {
+            delegateMessage(channel, iteWaiting->second.data(), iteWaiting->second.size());
+            state.bufferedSize -= iteWaiting->second.size();
+            state.waitingMessages.erase(iteWaiting);
+
+            ++state.nextMessageId;
+            iteWaiting = state.waitingMessages.find(state.nextMessageId);
+        }
+    }
+    else if (channel == ENetChannel::ReliableUnordered)
+    {
+        state.deliveredWindow[messageId % MaxReliableMessagesInFlight] = true;
+        while (state.deliveredWindow[state.nextMessageId % MaxReliableMessagesInFlight])
+        {
+            state.deliveredWindow[state.nextMessageId % MaxReliableMessagesInFlight] = false;
+            ++state.nextMessageId;
+        }
+
+        delegateMessage(channel, data, size);
+    }
+    else
+    {
+        state.hasDelivered = true;
+        state.lastMessageId = messageId;
+
+        delegateMessage(channel, data, size);
+    }
+}
+
+bool NetworkUdpChannel::IsReliableMessageExpected(ENetChannel::Type channel, uint16 messageId) const
+{
+    const ReceiveState& state = m_receiveStates[channel];
+
+    if (static_cast<uint16>(messageId - state.nextMessageId) >= MaxReliableMessagesInFlight)
+        return false;
+
+    if (channel == ENetChannel::ReliableUnordered)
+        return !state.deliveredWindow[messageId % MaxReliableMessagesInFlight];
+
+    return !StdMapContainsKey(state.waitingMessages, messageId);
+}
+
+bool NetworkUdpChannel::CanBufferMessage(ENetChannel::Type channel, uint16 messageId, size_t size) const
+{
+    const ReceiveState& state = m_receiveStates[channel];
+
+    // The next ordered message is always accepted, it releases the waiting messages.
+    if (channel == ENetChannel::ReliableOrdered && messageId == state.nextMessageId)
+        return true;
+
+    return state.bufferedSize + size <= MaxBufferedSizePerChannel;
+}
+
+void NetworkUdpChannel::ClearReassemblies(ReceiveState& state)
+{
+    for (const auto& reassembly : state.reassemblies)
+    {
+        state.bufferedSize -= reassembly.second.fragmentCount * MaxFragmentSize;
+    }
+
+    state.reassemblies.clear();
+}
+
+int64 NetworkUdpChannel::GetRoundTripTimeUs() const
+{
+    return m_smoothedRoundTripUs;
+}
+
+int64 NetworkUdpChannel::GetRetransmitTimeoutUs() const
+{
+    return m_retransmitTimeoutUs;
+}
+
+size_t NetworkUdpChannel::GetPendingReliableCount() const
+{
+    size_t pendingCount = 0;
+    for (const Fragment& fragment : m_reliableFragments)
+    {
+        pendingCount += fragment.acked ? 0 : 1;
+    }
+
+    return pendingCount;
+}
+
+size_t NetworkUdpChannel::GetResentFragmentCount() const
+{
+    return m_resentFragmentCount;
+}
+
+size_t NetworkUdpChannel::GetBufferedSize() const
+{
+    size_t bufferedSize = 0;
+    for (const ReceiveState& state : m_receiveStates)
+    {
+        bufferedSize += state.bufferedSize;
+    }
+
+    return bufferedSize;
+}
+
+NetworkLinkSimulator::NetworkLinkSimulator()
+    : m_lossRatio(0.f)
+    , m_latencyUs(0)
+    , m_jitterUs(0)
+    , m_randomState(1)
+    , m_droppedCount(0)
+{
+}
+
+void NetworkLinkSimulator::SetConditions(float lossRatio, int64 latencyUs, int64 jitterUs, uint32 seed)
+{
+    m_lossRatio = std::clamp(lossRatio, 0.f, 1.f);
+    m_latencyUs = std::max<int64>(0, latencyUs);
+    m_jitterUs = std::max<int64>(0, jitterUs);
+    m_randomState = seed != 0 ? seed : 1;
+}
+
+void NetworkLinkSimulator::Reset()
+{
+    m_datagrams.clear();
+    m_droppedCount = 0;
+}
+
+bool NetworkLinkSimulator::IsActive() const
+{
+    return m_lossRatio > 0.f || m_latencyUs > 0 || m_jitterUs > 0 || !m_datagrams.empty();
+}
+
+void NetworkLinkSimulator::Push(int64 timeUs, uint32 ipAddress, uint16 port, const void* data, size_t size)
+{
+    // Xorshift, the simulation is reproducible for a given seed.
+    auto nextRandom = [this]()
+    {
+        m_randomState ^= m_randomState << 13;
+        m_randomState ^= m_randomState >> 17;
+        m_randomState ^= m_randomState << 5;
+        return m_randomState;
+    };
+
+    if (m_lossRatio > 0.f && static_cast<float>(nextRandom() % 10000) < m_lossRatio * 10000.f)
+    {
+        ++m_droppedCount;
+        return;
+    }
+
+    int64 delayUs = m_latencyUs;
+    if (m_jitterUs > 0)
+    {
+        delayUs += static_cast<int64>(nextRandom() % static_cast<uint32>(m_jitterUs + 1));
+    }
+
+    NetworkDatagram datagram;
+    datagram.ipAddress = ipAddress;
+    datagram.port = port;
+    datagram.data.assign(static_cast<const uint8*>(data), static_cast<const uint8*>(data) + size);
+    m_datagrams.emplace(timeUs + delayUs, std::move(datagram));
+}
+
+bool NetworkLinkSimulator::Pop(int64 timeUs, NetworkDatagram& datagram)
+{
+    if (m_datagrams.empty() || m_datagrams.begin()->first > timeUs)
+        return false;
+
+    datagram = std::move(m_datagrams.begin()->second);
+    m_datagrams.erase(m_datagrams.begin());
+    return true;
+}
+
+size_t NetworkLinkSimulator::GetDroppedCount() const
+{
+    return m_droppedCount;
+}
+
+}   // namespace gugu
@@ -0,0 +1,183 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/System/Types.h"
+#include "Gugu/Network/EnumsNetwork.h"
+#include "Gugu/Network/NetworkBuffer.h"
+
+#include <functional>
+#include <map>
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// File Declarations
+
+namespace gugu {
+
+struct NetworkDatagram
+{
+    uint32 ipAddress = 0;
+    uint16 port = 0;
+    std::vector<uint8> data;
+};
+
+// Reliability layer of a udp connection with a single peer, without any socket : datagrams are built by Update, and read by ReceiveDatagram.
+// - Each datagram carries its sequence number, and acks the last 33 datagrams received from the peer (latest sequence + 32 bits field).
+// - The round trip time is estimated from the acked datagrams, reliable fragments are resent when their retransmit timer expires.
+// - The retransmit timeout of a fragment doubles on each resend (exponential backoff), up to a few seconds.
+// - Received reassemblies and out of order messages are bounded per channel, a datagram refused for lack of space is not acked.
+// - Messages bigger than a datagram are split in fragments, a datagram never exceeds MaxDatagramSize.
+// - Times are in microseconds, from any monotonic clock.
+class NetworkUdpChannel
+{
+public:
+
+    using DelegateDatagram = std::function<void(const uint8* data, size_t size)>;
+    using DelegateMessage = std::function<void(ENetChannel::Type channel, const uint8* data, size_t size)>;
+
+    static constexpr size_t MaxDatagramSize = 1200;     // Fits in the minimum IPv6 MTU, with the ip and udp headers.
+    static constexpr size_t DatagramHeaderSize = 9;     // Sequence (16), flags (8), ack (16), ack bits (32).
+    static constexpr size_t FragmentHeaderSize = 7;     // Channel (8), message id (16), fragment index (8), fragment count (8), size (16).
+    static constexpr size_t MaxFragmentSize = MaxDatagramSize - DatagramHeaderSize - FragmentHeaderSize;
+    static constexpr size_t MaxFragmentCount = 255;
+    static constexpr size_t MaxMessageSize = MaxFragmentSize * MaxFragmentCount;
+    static constexpr size_t MaxReliableMessagesInFlight = 1024;    // Per channel, Send fails until older messages are acked.
+    static constexpr size_t MaxBufferedSizePerChannel = 4 * MaxMessageSize;     // Received bytes waiting for a reassembly or for older messages.
+
+    NetworkUdpChannel();
+    ~NetworkUdpChannel();
+
+    void Reset();
+
+    // Queue a message for the next Update.
+    bool Send(ENetChannel::Type channel, const void* data, size_t size);
+
+    // Send the queued messages, the expired reliable fragments, and the pending acks.
+    void Update(int64 timeUs, const DelegateDatagram& delegateDatagram);
+
+    // Received messages are delivered in the order required by their channel, possibly along with older messages completed by this datagram.
+    bool ReceiveDatagram(int64 timeUs, const void* data, size_t size, const DelegateMessage& delegateMessage);
+
+    int64 GetRoundTripTimeUs() const;   // Smoothed estimation, 0 until the first ack.
+    int64 GetRetransmitTimeoutUs() const;
+    size_t GetPendingReliableCount() const;
+    size_t GetResentFragmentCount() const;
+    size_t GetBufferedSize() const;     // Received bytes waiting for a reassembly or for older messages, on all channels.
+
+private:
+
+    struct Fragment
+    {
+        uint32 id = 0;                  // Send order, used by the sent datagrams to reference their reliable fragments.
+        ENetChannel::Type channel = ENetChannel::Tcp;
+        uint16 messageId = 0;
+        uint8 fragmentIndex = 0;
+        uint8 fragmentCount = 1;
+        std::vector<uint8> data;
+        int64 lastSendTimeUs = -1;
+        uint8 resendCount = 0;          // Exponential backoff of the retransmit timeout.
+        bool acked = false;
+    };
+
+    struct SentDatagram
+    {
+        bool valid = false;
+        bool acked = false;
+        uint16 sequence = 0;
+        int64 sendTimeUs = 0;
+        std::vector<uint32> fragmentIds;
+    };
+
+    struct Reassembly
+    {
+        size_t fragmentCount = 0;
+        size_t receivedCount = 0;
+        size_t lastFragmentSize = 0;
+        std::vector<bool> receivedFragments;
+        std::vector<uint8> data;
+    };
+
+    struct ReceiveState
+    {
+        uint16 nextMessageId = 0;                               // Ordered : next message to deliver, Unordered : all previous messages are delivered.
+        std::vector<bool> deliveredWindow;                      // Unordered : delivered messages from nextMessageId.
+        std::map<uint16, std::vector<uint8>> waitingMessages;   // Ordered : received messages waiting for the previous ones.
+        std::map<uint16, Reassembly> reassemblies;
+        size_t bufferedSize = 0;                                // Reassemblies and waiting messages, bounded by MaxBufferedSizePerChannel.
+        bool hasDelivered = false;                              // Sequenced : lastMessageId is valid.
+        uint16 lastMessageId = 0;
+    };
+
+    void QueueMessage(std::vector<Fragment>& queue, ENetChannel::Type channel, uint16 messageId, const uint8* data, size_t size);
+    void BeginDatagram();
+    void EndDatagram(int64 timeUs, const DelegateDatagram& delegateDatagram);
+    void WriteFragment(const Fragment& fragment);
+
+    void AckDatagram(int64 timeUs, uint16 sequence, bool isRoundTripSample);
+    void AckFragment(uint32 fragmentId);
+    bool ReadFragment(NetBufferReader& reader, const DelegateMessage& delegateMessage, bool& isRefused);
+    void DeliverMessage(ENetChannel::Type channel, uint16 messageId, const uint8* data, size_t size, const DelegateMessage& delegateMessage);
+    bool IsReliableMessageExpected(ENetChannel::Type channel, uint16 messageId) const;   // False if already received, or outside of the window.
+    bool CanBufferMessage(ENetChannel::Type channel, uint16 messageId, size_t size) const;
+    void ClearReassemblies(ReceiveState& state);
+
+private:
+
+    // Send.
+    uint16 m_nextSequence;
+    uint16 m_nextMessageIds[ENetChannel::Count];
+    uint32 m_nextFragmentId;
+    std::vector<Fragment> m_reliableFragments;      // Waiting for an ack, sorted by id.
+    std::vector<Fragment> m_unreliableFragments;    // Sent once by the next Update.
+    std::vector<SentDatagram> m_sentDatagrams;      // Indexed by sequence modulo the history size.
+    NetBufferWriter m_datagram;
+    std::vector<uint32> m_datagramFragmentIds;
+
+    // Acks.
+    bool m_hasReceivedDatagram;
+    bool m_isAckPending;
+    uint16 m_remoteSequence;
+    uint32 m_remoteSequenceBits;
+
+    // Round trip.
+    bool m_hasRoundTrip;
+    int64 m_smoothedRoundTripUs;
+    int64 m_roundTripVariationUs;
+    int64 m_retransmitTimeoutUs;
+    size_t m_resentFragmentCount;
+
+    // Receive.
+    ReceiveState m_receiveStates[ENetChannel::Count];
+};
+
+// Injects loss, latency and jitter on outgoing datagrams, to test the udp channels on a local network.
+// - Datagrams are kept until their delivery time, a jitter bigger than the send interval will reorder them.
+class NetworkLinkSimulator
+{
+public:
+
+    NetworkLinkSimulator();
+
+    void SetConditions(float lossRatio, int64 latencyUs, int64 jitterUs, uint32 seed = 0);
+    void Reset();
+    bool IsActive() const;
+
+    void Push(int64 timeUs, uint32 ipAddress, uint16 port, const void* data, size_t size);
+    bool Pop(int64 timeUs, NetworkDatagram& datagram);     // Return the next datagram whose delivery time is reached.
+
+    size_t GetDroppedCount() const;
+
+private:
+
+    float m_lossRatio;
+    int64 m_latencyUs;
+    int64 m_jitterUs;
+    uint32 m_randomState;
+    size_t m_droppedCount;
+
+    std::multimap<int64, NetworkDatagram> m_datagrams;
+};
+
+}   // namespace gugu
@@ -290,6 +290,18 @@ EResourceType::Type AnimSet::GetResourceType() const
     return EResourceType::AnimSet;
 }
 
+size_t AnimSet::GetMemorySize() const
+{
+    size_t memorySize = m_animations.size() * sizeof(Animation);
+
+    for (const Animation* animation : m_animations)
+    {
+        memorySize += animation->GetFrameCount() * sizeof(AnimationFrame);
+    }
+
+    return memorySize;
+}
+
 void AnimSet::GetDependencies(std::set<Resource*>& dependencies) const
 {
     if (m_imageSet)
@@ -340,15 +352,16 @@ void AnimSet::Unload()
     m_imageSet = nullptr;
 }
 
-bool AnimSet::LoadFromXml(const pugi::xml_document& document)
+template<typename TDocument>
+bool AnimSet::LoadFromDocument(const TDocument& document)
 {
     Unload();
     
-    pugi::xml_node oNodeAnimSet = document.child("AnimSet");
+    auto oNodeAnimSet = document.child("AnimSet");
     if (!oNodeAnimSet)
         return false;
 
-    pugi::xml_attribute oAttributeMainImageSet = oNodeAnimSet.attribute("imageSet");
+    auto oAttributeMainImageSet = oNodeAnimSet.attribute("imageSet");
     if (oAttributeMainImageSet)
         m_imageSet = GetResources()->GetImageSet(oAttributeMainImageSet.as_string());
 
@@ -358,9 +371,9 @@ bool AnimSet::LoadFromXml(const pugi::xml_document& document)
         m_defaultOriginOffset = defaultOriginOffset;
     }
 
-    for (pugi::xml_node oNodeAnimation = oNodeAnimSet.child("Animation"); oNodeAnimation; oNodeAnimation = oNodeAnimation.next_sibling("Animation"))
+    for (auto oNodeAnimation = oNodeAnimSet.child("Animation"); oNodeAnimation; oNodeAnimation = oNodeAnimation.next_sibling("Animation"))
     {
-        pugi::xml_attribute oAttributeAnimName = oNodeAnimation.attribute("name");
+        auto oAttributeAnimName = oNodeAnimation.attribute("name");
         if (oAttributeAnimName)
         {
             std::string strNameAnim = oAttributeAnimName.as_string();
@@ -369,22 +382,22 @@ bool AnimSet::LoadFromXml(const pugi::xml_document& document)
 
             Animation* pNewAnimation = AddAnimation(strNameAnim);
 
-            for (pugi::xml_node oNodeFrame = oNodeAnimation.child("Frame"); oNodeFrame; oNodeFrame = oNodeFrame.next_sibling("Frame"))
+            for (auto oNodeFrame = oNodeAnimation.child("Frame"); oNodeFrame; oNodeFrame = oNodeFrame.next_sibling("Frame"))
             {
                 AnimationFrame* pNewFrame = pNewAnimation->AddFrame();
 
-                pugi::xml_attribute oAttributeFrameTexture = oNodeFrame.attribute("texture");
+                auto oAttributeFrameTexture = oNodeFrame.attribute("texture");
                 if (oAttributeFrameTexture)
                     pNewFrame->SetTexture(GetResources()->GetTexture(oAttributeFrameTexture.as_string()));
 
-                pugi::xml_attribute oAttributeSubImage = oNodeFrame.attribute("subImage");
+                auto oAttributeSubImage = oNodeFrame.attribute("subImage");
                 if (oAttributeSubImage)
                 {
                     std::string strFrameSubImage = oAttributeSubImage.as_string();
                     ImageSet* pFrameImageSet = m_imageSet;
 
                     // TODO: deprecate multiple imagesets.
-                    pugi::xml_attribute oAttributeNameSet = oNodeFrame.attribute("nameSet");
+                    auto oAttributeNameSet = oNodeFrame.attribute("nameSet");
                     if (oAttributeNameSet)
                         pFrameImageSet = GetResources()->GetImageSet(oAttributeNameSet.as_string());
 
@@ -392,12 +405,12 @@ bool AnimSet::LoadFromXml(const pugi::xml_document& document)
                         pNewFrame->SetSubImage(pFrameImageSet->GetSubImage(strFrameSubImage));
                 }
 
-                pugi::xml_attribute oAttributeDuration = oNodeFrame.attribute("duration");
+                auto oAttributeDuration = oNodeFrame.attribute("duration");
                 if (oAttributeDuration)
                     pNewFrame->SetDuration(oAttributeDuration.as_float());
 
                 //TODO: Make this a child node instead of an attribute ?
-                pugi::xml_attribute oAttributeEvents = oNodeFrame.attribute("events");
+                auto oAttributeEvents = oNodeFrame.attribute("events");
                 if (oAttributeEvents)
                     pNewFrame->RegisterEvents(oAttributeEvents.as_string());
 
@@ -415,6 +428,21 @@ bool AnimSet::LoadFromXml(const pugi::xml_document& document)
     return true;
 }
 
+bool AnimSet::LoadFromXml(const pugi::xml_document& document)
+{
+    return LoadFromDocument(document);
+}
+
+bool AnimSet::LoadFromBinary(const xml::BinaryDocument& document)
+{
+    return LoadFromDocument(document);
+}
+
+bool AnimSet::CanLoadFromBinary() const
+{
+    return true;
+}
+
 bool AnimSet::SaveToXml(pugi::xml_document& document) const
 {
     pugi::xml_node nodeAnimSet = document.append_child("AnimSet");
@@ -136,6 +136,7 @@ public:
     const Vector2f& GetDefaultOriginOffset() const;
 
     virtual EResourceType::Type GetResourceType() const override;
+    virtual size_t GetMemorySize() const override;
 
     virtual void GetDependencies(std::set<Resource*>& dependencies) const override;
     virtual void OnDependencyRemoved(const Resource* removedDependency) override;
@@ -144,8 +145,14 @@ protected:
 
     virtual void Unload() override;
     virtual bool LoadFromXml(const pugi::xml_document& document) override;
+    virtual bool LoadFromBinary(const xml::BinaryDocument& document) override;
+    virtual bool CanLoadFromBinary() const override;
     virtual bool SaveToXml(pugi::xml_document& document) const override;
 
+    // Shared by the xml and binary loads.
+    template<typename TDocument>
+    bool LoadFromDocument(const TDocument& document);
+
 protected:
 
     ImageSet* m_imageSet;
@@ -8,6 +8,7 @@
 // Includes
 
 #include "Gugu/System/Memory.h"
+#include "Gugu/System/Platform.h"
 #include "Gugu/System/String.h"
 #include "Gugu/Debug/Logger.h"
 
@@ -22,6 +23,7 @@ namespace gugu {
 
 AudioClip::AudioClip()
     : m_sfSoundBuffer(nullptr)
+    , m_preparedSoundBuffer(nullptr)
     , m_duration(sf::Time::Zero)
 {
 }
@@ -29,6 +31,7 @@ AudioClip::AudioClip()
 AudioClip::~AudioClip()
 {
     Unload();
+    SafeDelete(m_preparedSoundBuffer);
 }
 
 sf::SoundBuffer* AudioClip::GetOrLoadSFSoundBuffer()
@@ -37,7 +40,19 @@ sf::SoundBuffer* AudioClip::GetOrLoadSFSoundBuffer()
     {
         m_sfSoundBuffer = new sf::SoundBuffer;
 
-        if (!m_sfSoundBuffer->loadFromFile(GetFileInfo().GetFileSystemPath()))
+        bool result = false;
+        if (IsArchived())
+        {
+            const uint8* data = nullptr;
+            size_t size = 0;
+            result = GetOrDecompressArchiveContent(data, size) && m_sfSoundBuffer->loadFromMemory(data, size);
+        }
+        else
+        {
+            result = m_sfSoundBuffer->loadFromFile(GetFileInfo().GetFileSystemPath());
+        }
+
+        if (!result)
         {
             GetLogEngine()->Print(ELog::Warning, ELogEngine::Resources, StringFormat("AudioClip buffer file could not be loaded : {0}", GetFileInfo().GetFilePath_utf8()));
             assert(false);
@@ -57,7 +72,20 @@ sf::Music* AudioClip::OpenSFMusicStream()
 {
     sf::Music* musicStream = new sf::Music;
 
-    if (!musicStream->openFromFile(GetFileInfo().GetFileSystemPath()))
+    bool result = false;
+    if (IsArchived())
+    {
+        // Streams will read the archive mapping (or the decompressed buffer) directly.
+        const uint8* data = nullptr;
+        size_t size = 0;
+        result = GetOrDecompressArchiveContent(data, size) && musicStream->openFromMemory(data, size);
+    }
+    else
+    {
+        result = musicStream->openFromFile(GetFileInfo().GetFileSystemPath());
+    }
+
+    if (!result)
     {
         GetLogEngine()->Print(ELog::Warning, ELogEngine::Resources, StringFormat("AudioClip stream file could not be loaded : {0}", GetFileInfo().GetFilePath_utf8()));
         assert(false);
@@ -78,7 +106,20 @@ sf::Time AudioClip::GetOrReadDuration()
     {
         //TODO: Check if I can/need to make this a bit cleaner.
         sf::InputSoundFile soundFile;
-        if (soundFile.openFromFile(GetFileInfo().GetFileSystemPath()))
+
+        bool result = false;
+        if (IsArchived())
+        {
+            const uint8* data = nullptr;
+            size_t size = 0;
+            result = GetOrDecompressArchiveContent(data, size) && soundFile.openFromMemory(data, size);
+        }
+        else
+        {
+            result = soundFile.openFromFile(GetFileInfo().GetFileSystemPath());
+        }
+
+        if (result)
         {
             m_duration = soundFile.getDuration();
         }
@@ -92,9 +133,35 @@ EResourceType::Type AudioClip::GetResourceType() const
     return EResourceType::AudioClip;
 }
 
+size_t AudioClip::GetMemorySize() const
+{
+    size_t memorySize = m_archiveBuffer.size();
+
+    if (m_sfSoundBuffer)
+    {
+        memorySize += static_cast<size_t>(m_sfSoundBuffer->getSampleCount()) * sizeof(int16);
+    }
+
+    return memorySize;
+}
+
 void AudioClip::Unload()
 {
     SafeDelete(m_sfSoundBuffer);
+    m_archiveBuffer.clear();
+}
+
+bool AudioClip::GetOrDecompressArchiveContent(const uint8*& data, size_t& size)
+{
+    // Compressed entries are only decompressed once, and kept alive for the music streams.
+    if (!m_archiveBuffer.empty())
+    {
+        data = m_archiveBuffer.data();
+        size = m_archiveBuffer.size();
+        return true;
+    }
+
+    return GetArchiveContent(data, size, m_archiveBuffer);
 }
 
 bool AudioClip::LoadFromFile()
@@ -105,4 +172,56 @@ bool AudioClip::LoadFromFile()
     return true;
 }
 
+bool AudioClip::PrepareLoadFromFile()
+{
+    // Asynchronous loads decode short clips on the worker thread, they will most likely be played as sounds.
+    // - Longer clips only have their duration read, they are decoded on their first use as a sound.
+    SafeDelete(m_preparedSoundBuffer);
+
+    const uint8* data = nullptr;
+    size_t size = 0;
+    std::vector<uint8> fileContent;
+    if (IsArchived())
+    {
+        if (!GetOrDecompressArchiveContent(data, size))
+            return false;
+    }
+    else
+    {
+        if (!ReadFileContent(GetFileInfo().GetFilePath_utf8(), fileContent))
+            return false;
+
+        data = fileContent.data();
+        size = fileContent.size();
+    }
+
+    sf::InputSoundFile soundFile;
+    if (!soundFile.openFromMemory(data, size))
+        return false;
+
+    m_duration = soundFile.getDuration();
+
+    if (soundFile.getSampleCount() * sizeof(int16) > resources::AudioClipPreparedBufferMaxSize)
+        return true;
+
+    sf::SoundBuffer* soundBuffer = new sf::SoundBuffer;
+    if (!soundBuffer->loadFromMemory(data, size))
+    {
+        SafeDelete(soundBuffer);
+        return false;
+    }
+
+    m_preparedSoundBuffer = soundBuffer;
+    return true;
+}
+
+bool AudioClip::FinalizeLoadFromFile()
+{
+    // The duration and the archive buffer filled during the preparation are kept, a failed preparation is retried on the first use.
+    SafeDelete(m_sfSoundBuffer);
+    m_sfSoundBuffer = m_preparedSoundBuffer;
+    m_preparedSoundBuffer = nullptr;
+    return true;
+}
+
 }   // namespace gugu
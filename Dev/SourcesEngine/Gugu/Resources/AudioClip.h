@@ -18,6 +18,12 @@ namespace sf
 
 namespace gugu {
 
+// Constants.
+namespace resources
+{
+    inline constexpr size_t AudioClipPreparedBufferMaxSize = 4 * 1024 * 1024;  // Clips decoding to a bigger buffer are expected to be streamed, asynchronous loads don't decode them.
+}
+
 class AudioClip : public Resource
 {
 public:
@@ -31,17 +37,24 @@ public:
     sf::Time GetOrReadDuration();
     
     virtual EResourceType::Type GetResourceType() const override;
+    virtual size_t GetMemorySize() const override;
 
     virtual bool LoadFromFile() override;
+    virtual bool PrepareLoadFromFile() override;
+    virtual bool FinalizeLoadFromFile() override;
 
 protected:
 
     virtual void Unload() override;
 
+    bool GetOrDecompressArchiveContent(const uint8*& data, size_t& size);
+
 protected:
 
     sf::SoundBuffer* m_sfSoundBuffer;
+    sf::SoundBuffer* m_preparedSoundBuffer;     // Short clips are decoded during the preparation, on a worker thread.
     sf::Time m_duration;
+    std::vector<uint8> m_archiveBuffer;     // Decompressed file content, streams need it to stay alive.
 };
 
 }   // namespace gugu
@@ -12,6 +12,8 @@
 #include "Gugu/Data/DatasheetObject.h"
 #include "Gugu/System/Container.h"
 #include "Gugu/System/String.h"
+#include "Gugu/System/Memory.h"
+#include "Gugu/External/PugiXmlUtility.h"
 #include "Gugu/Debug/Logger.h"
 
 ////////////////////////////////////////////////////////////////
@@ -19,8 +21,28 @@
 
 namespace gugu {
 
+namespace impl {
+
+// Datasheets owning a parsed document, the most recently used last.
+// - Datasheet objects are only loaded on the main thread.
+struct ParsedDocuments
+{
+    std::vector<const Datasheet*> owners;
+    int loadDepth = 0;
+};
+
+ParsedDocuments& GetParsedDocuments()
+{
+    static ParsedDocuments parsedDocuments;
+    return parsedDocuments;
+}
+
+}   // namespace impl
+
 Datasheet::Datasheet()
     : m_rootObject(nullptr)
+    , m_parentDatasheet(nullptr)
+    , m_parsedDocument(nullptr)
 {
 }
 
@@ -37,10 +59,23 @@ EResourceType::Type Datasheet::GetResourceType() const
 void Datasheet::Unload()
 {
     m_rootObject = nullptr;
+    m_parentDatasheet = nullptr;
     ClearStdMap(m_instanceObjects);
+    ReleaseParsedDocument();
 }
 
 bool Datasheet::LoadFromFile()
+{
+    return LoadRootObject(nullptr);
+}
+
+bool Datasheet::LoadFromXml(const pugi::xml_document& document)
+{
+    // Asynchronous loads parse the document on a worker thread, the objects are instantiated during the finalization.
+    return LoadRootObject(&document);
+}
+
+bool Datasheet::LoadRootObject(const pugi::xml_document* document)
 {
     Unload();
 
@@ -55,7 +90,36 @@ bool Datasheet::LoadFromFile()
     std::vector<Datasheet*> ancestors;
     ancestors.push_back(this);
 
-    return m_rootObject->LoadFromFile(GetFileInfo().GetFileSystemPath(), this, ancestors);
+    // Ancestors documents are in use during nested loads (parents, references), they are only trimmed once the outermost load is done.
+    impl::ParsedDocuments& parsedDocuments = impl::GetParsedDocuments();
+    parsedDocuments.loadDepth += 1;
+
+    bool result = document ? m_rootObject->LoadFromDocument(*document, this, ancestors) : m_rootObject->LoadFromFile(this, this, ancestors);
+
+    parsedDocuments.loadDepth -= 1;
+    if (parsedDocuments.loadDepth == 0)
+    {
+        TrimParsedDocuments();
+    }
+
+    return result;
+}
+
+void Datasheet::GetDependencies(std::set<Resource*>& dependencies) const
+{
+    // Inherited data depends on all the ancestors (a loop in the ancestors will stop on an already gathered parent).
+    if (m_parentDatasheet && dependencies.insert(m_parentDatasheet).second)
+    {
+        m_parentDatasheet->GetDependencies(dependencies);
+    }
+}
+
+void Datasheet::OnDependencyRemoved(const Resource* removedDependency)
+{
+    if (m_parentDatasheet == removedDependency)
+    {
+        m_parentDatasheet = nullptr;
+    }
 }
 
 const DatasheetObject* Datasheet::GetRootObject() const
@@ -63,4 +127,72 @@ const DatasheetObject* Datasheet::GetRootObject() const
     return m_rootObject;
 }
 
+const Datasheet* Datasheet::GetParentDatasheet() const
+{
+    return m_parentDatasheet;
+}
+
+const pugi::xml_document* Datasheet::GetParsedDocument() const
+{
+    std::vector<const Datasheet*>& parsedDocumentOwners = impl::GetParsedDocuments().owners;
+
+    if (m_parsedDocument)
+    {
+        StdVectorRemove(parsedDocumentOwners, static_cast<const Datasheet*>(this));
+        parsedDocumentOwners.push_back(this);
+        return m_parsedDocument;
+    }
+
+    m_parsedDocument = new pugi::xml_document;
+    if (!LoadXmlDocument(*m_parsedDocument))
+    {
+        SafeDelete(m_parsedDocument);
+        return nullptr;
+    }
+
+    parsedDocumentOwners.push_back(this);
+    return m_parsedDocument;
+}
+
+void Datasheet::ReleaseParsedDocument() const
+{
+    if (m_parsedDocument)
+    {
+        StdVectorRemove(impl::GetParsedDocuments().owners, static_cast<const Datasheet*>(this));
+        SafeDelete(m_parsedDocument);
+    }
+}
+
+void Datasheet::ReleaseParsedDocuments()
+{
+    std::vector<const Datasheet*> parsedDocumentOwners;
+    parsedDocumentOwners.swap(impl::GetParsedDocuments().owners);
+
+    for (const Datasheet* datasheet : parsedDocumentOwners)
+    {
+        SafeDelete(datasheet->m_parsedDocument);
+    }
+}
+
+void Datasheet::TrimParsedDocuments()
+{
+    // The least recently used documents are released, their datasheets will parse them again if needed.
+    std::vector<const Datasheet*>& parsedDocumentOwners = impl::GetParsedDocuments().owners;
+    if (parsedDocumentOwners.size() <= MaxParsedDocuments)
+        return;
+
+    size_t releasedCount = parsedDocumentOwners.size() - MaxParsedDocuments;
+    for (size_t i = 0; i < releasedCount; ++i)
+    {
+        SafeDelete(parsedDocumentOwners[i]->m_parsedDocument);
+    }
+
+    parsedDocumentOwners.erase(parsedDocumentOwners.begin(), parsedDocumentOwners.begin() + releasedCount);
+}
+
+size_t Datasheet::GetParsedDocumentCount()
+{
+    return impl::GetParsedDocuments().owners.size();
+}
+
 }   // namespace gugu
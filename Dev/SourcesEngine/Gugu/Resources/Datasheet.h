@@ -35,17 +35,40 @@ public:
 
     virtual bool LoadFromFile() override;
 
-    //TODO: Store reference to parent, at least a Getter
+    virtual void GetDependencies(std::set<Resource*>& dependencies) const override;
+    virtual void OnDependencyRemoved(const Resource* removedDependency) override;
+
     const DatasheetObject* GetRootObject() const;
+    const Datasheet* GetParentDatasheet() const;
+
+    // Parsed xml content, shared by all the datasheets inheriting from this one.
+    // - Parsed on first access, only the most recently used documents are kept once a load is done (see MaxParsedDocuments).
+    const pugi::xml_document* GetParsedDocument() const;
+
+    // Release all the parsed documents, once a batch of datasheets has been loaded.
+    static void ReleaseParsedDocuments();
+    static size_t GetParsedDocumentCount();
+
+    static constexpr size_t MaxParsedDocuments = 16;    // Enough for the ancestors of consecutive loads in a deep hierarchy.
 
 protected:
 
     virtual void Unload() override;
+    virtual bool LoadFromXml(const pugi::xml_document& document) override;
+
+private:
+
+    bool LoadRootObject(const pugi::xml_document* document);
+    void ReleaseParsedDocument() const;
+
+    static void TrimParsedDocuments();
 
 private:
 
     DatasheetObject* m_rootObject;
+    Datasheet* m_parentDatasheet;
     std::map<UUID, DataObject*> m_instanceObjects;
+    mutable pugi::xml_document* m_parsedDocument;
 };
 
 }   // namespace gugu
@@ -27,6 +27,7 @@ namespace EResourceType
         Datasheet,
         ElementWidget,
         LocalizationTable,
+        PreloadManifest,
 
         Custom,
     };
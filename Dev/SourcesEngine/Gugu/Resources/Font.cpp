@@ -18,12 +18,14 @@ namespace gugu {
     
 Font::Font()
 : m_sfFont(nullptr)
+, m_preparedFont(nullptr)
 {
 }
 
 Font::~Font()
 {
     Unload();
+    SafeDelete(m_preparedFont);
 }
 
 void Font::SetSFFont(sf::Font* _pSFFont)
@@ -41,23 +43,73 @@ EResourceType::Type Font::GetResourceType() const
     return EResourceType::Font;
 }
 
+size_t Font::GetMemorySize() const
+{
+    // Glyph pages are generated on demand and not accounted for.
+    return m_archiveBuffer.size();
+}
+
 void Font::Unload()
 {
     SafeDelete(m_sfFont);
+    m_archiveBuffer.clear();
 }
 
 bool Font::LoadFromFile()
 {
     Unload();
 
-    m_sfFont = new sf::Font;
-    if (!m_sfFont->openFromFile(GetFileInfo().GetFileSystemPath()))
+    if (!PrepareLoadFromFile())
     {
         GetLogEngine()->Print(ELog::Warning, ELogEngine::Resources, StringFormat("Font file could not be loaded : {0}", GetFileInfo().GetFilePath_utf8()));
         assert(false);
         return false;
     }
 
+    return FinalizeLoadFromFile();
+}
+
+bool Font::PrepareLoadFromFile()
+{
+    // Opening the font face reads and parses the file, glyphs are only rasterized on demand from the main thread.
+    SafeDelete(m_preparedFont);
+
+    sf::Font* font = new sf::Font;
+
+    bool result = false;
+    if (IsArchived())
+    {
+        // Uncompressed entries are read directly from the archive mapping.
+        const uint8* data = nullptr;
+        size_t size = 0;
+        result = GetArchiveContent(data, size, m_archiveBuffer) && font->openFromMemory(data, size);
+    }
+    else
+    {
+        result = font->openFromFile(GetFileInfo().GetFileSystemPath());
+    }
+
+    if (!result)
+    {
+        SafeDelete(font);
+        return false;
+    }
+
+    m_preparedFont = font;
+    return true;
+}
+
+bool Font::FinalizeLoadFromFile()
+{
+    if (!m_preparedFont)
+    {
+        return LoadFromFile();
+    }
+
+    // The archive buffer filled during the preparation is kept alive with the font.
+    SafeDelete(m_sfFont);
+    m_sfFont = m_preparedFont;
+    m_preparedFont = nullptr;
     return true;
 }
 
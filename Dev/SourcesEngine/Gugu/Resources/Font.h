@@ -23,8 +23,11 @@ public:
     sf::Font*   GetSFFont() const;
     
     virtual EResourceType::Type GetResourceType() const override;
+    virtual size_t GetMemorySize() const override;
 
     virtual bool LoadFromFile() override;
+    virtual bool PrepareLoadFromFile() override;
+    virtual bool FinalizeLoadFromFile() override;
 
 protected:
 
@@ -33,6 +36,8 @@ protected:
 protected:
 
     sf::Font* m_sfFont;
+    sf::Font* m_preparedFont;               // The font face is opened during the preparation, on a worker thread.
+    std::vector<uint8> m_archiveBuffer;     // Decompressed file content, sfml needs it to stay alive with the font.
 };
 
 }   // namespace gugu
@@ -146,6 +146,11 @@ EResourceType::Type ImageSet::GetResourceType() const
     return EResourceType::ImageSet;
 }
 
+size_t ImageSet::GetMemorySize() const
+{
+    return m_subImages.size() * sizeof(SubImage);
+}
+
 void ImageSet::GetDependencies(std::set<Resource*>& dependencies) const
 {
     if (m_texture)
@@ -168,30 +173,46 @@ void ImageSet::Unload()
     m_texture = nullptr;
 }
 
-bool ImageSet::LoadFromXml(const pugi::xml_document& document)
+template<typename TDocument>
+bool ImageSet::LoadFromDocument(const TDocument& document)
 {
     Unload();
 
-    pugi::xml_node nodeRoot = document.child("ImageSet");
+    auto nodeRoot = document.child("ImageSet");
     if (!nodeRoot)
         return false;
 
-    pugi::xml_attribute oAttributeTexture = nodeRoot.attribute("texture");
+    auto oAttributeTexture = nodeRoot.attribute("texture");
     if (oAttributeTexture)
         m_texture = GetResources()->GetTexture(oAttributeTexture.as_string());
 
-    for (pugi::xml_node oNodeSubImage = nodeRoot.child("SubImage"); oNodeSubImage; oNodeSubImage = oNodeSubImage.next_sibling("SubImage"))
+    for (auto oNodeSubImage = nodeRoot.child("SubImage"); oNodeSubImage; oNodeSubImage = oNodeSubImage.next_sibling("SubImage"))
     {
-        std::string strNameSubImage = oNodeSubImage.attribute("name").as_string();
-        if (!strNameSubImage.empty())
+        const char* nameSubImage = oNodeSubImage.attribute("name").as_string();
+        if (*nameSubImage != '\0')
         {
-            m_subImages.push_back(new SubImage(this, strNameSubImage, xml::ReadRect(oNodeSubImage)));
+            m_subImages.push_back(new SubImage(this, nameSubImage, xml::ReadRect(oNodeSubImage)));
         }
     }
 
     return true;
 }
 
+bool ImageSet::LoadFromXml(const pugi::xml_document& document)
+{
+    return LoadFromDocument(document);
+}
+
+bool ImageSet::LoadFromBinary(const xml::BinaryDocument& document)
+{
+    return LoadFromDocument(document);
+}
+
+bool ImageSet::CanLoadFromBinary() const
+{
+    return true;
+}
+
 bool ImageSet::SaveToXml(pugi::xml_document& document) const
 {
     pugi::xml_node nodeRoot = document.append_child("ImageSet");
@@ -71,6 +71,7 @@ public:
     size_t GetSubImageCount() const;
 
     virtual EResourceType::Type GetResourceType() const override;
+    virtual size_t GetMemorySize() const override;
 
     virtual void GetDependencies(std::set<Resource*>& dependencies) const override;
     virtual void OnDependencyRemoved(const Resource* removedDependency) override;
@@ -79,8 +80,14 @@ protected:
 
     virtual void Unload() override;
     virtual bool LoadFromXml(const pugi::xml_document& document) override;
+    virtual bool LoadFromBinary(const xml::BinaryDocument& document) override;
+    virtual bool CanLoadFromBinary() const override;
     virtual bool SaveToXml(pugi::xml_document& document) const override;
 
+    // Shared by the xml and binary loads.
+    template<typename TDocument>
+    bool LoadFromDocument(const TDocument& document);
+
 protected:
 
     Texture*                m_texture;
@@ -7,26 +7,153 @@
 ////////////////////////////////////////////////////////////////
 // Includes
 
+#include "Gugu/Engine.h"
 #include "Gugu/Resources/ManagerResources.h"
 #include "Gugu/System/String.h"
+#include "Gugu/System/ThreadPool.h"
 #include "Gugu/External/PugiXmlUtility.h"
+#include "Gugu/Debug/Logger.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
 
 ////////////////////////////////////////////////////////////////
 // File Implementation
 
 namespace gugu {
 
+namespace impl {
+
+// The key of the entry is checked, another key with the same hash is not found.
+template<typename TKey>
+const LocalizationTableEntry* FindLocalizationEntry(const LocalizationLanguageTable& languageTable, const Hash& keyHash, const TKey& key)
+{
+    const uint32* entryIndex = languageTable.entryIndices.Find(keyHash);
+    return entryIndex && languageTable.keys[*entryIndex] == key ? &languageTable.entries[*entryIndex] : nullptr;
+}
+
+void StoreLocalizationText(LocalizationLanguageTable& languageTable, std::string_view text, LocalizationTableEntry& entry)
+{
+    entry.textSize = (uint32)text.size();
+
+    // Identical texts are stored once, a hash collision between different texts only results in a copy.
+    Hash textHash(text);
+    if (const uint32* textOffset = languageTable.textOffsets.Find(textHash))
+    {
+        if (std::string_view(languageTable.texts.data() + *textOffset) == text)
+        {
+            entry.textOffset = *textOffset;
+            return;
+        }
+    }
+
+    entry.textOffset = (uint32)languageTable.texts.size();
+    languageTable.texts.insert(languageTable.texts.end(), text.begin(), text.end());
+    languageTable.texts.push_back('\0');
+    languageTable.textOffsets.Insert(textHash, entry.textOffset);
+}
+
+bool ParseLocalizationLanguageTables(const pugi::xml_document& document, const LocalizationLanguageCode& languageFilter, std::map<LocalizationLanguageCode, LocalizationLanguageTable>& languageTables)
+{
+    pugi::xml_node rootNode = document.child("LocalizationTable");
+    if (!rootNode)
+        return false;
+
+    for (pugi::xml_node languageNode = rootNode.child("LanguageTable"); languageNode; languageNode = languageNode.next_sibling("LanguageTable"))
+    {
+        std::string languageCode = languageNode.attribute("code").as_string();
+        if (languageCode.empty())
+            continue;
+
+        if (!languageFilter.empty() && languageCode != languageFilter)
+            continue;
+
+        LocalizationLanguageTable& languageTable = languageTables[languageCode];
+
+        size_t entryCount = 0;
+        size_t textsSize = 0;
+        for (pugi::xml_node entryNode = languageNode.child("Entry"); entryNode; entryNode = entryNode.next_sibling("Entry"))
+        {
+            ++entryCount;
+            textsSize += std::strlen(entryNode.attribute("text").as_string()) + 1;
+        }
+
+        languageTable.keys.reserve(entryCount);
+        languageTable.entries.reserve(entryCount);
+        languageTable.entryIndices.Reserve(entryCount);
+        languageTable.texts.reserve(textsSize);
+
+        for (pugi::xml_node entryNode = languageNode.child("Entry"); entryNode; entryNode = entryNode.next_sibling("Entry"))
+        {
+            std::string_view key = entryNode.attribute("key").as_string();
+            if (key.empty())
+                continue;
+
+            // The first entry is kept for duplicated keys.
+            Hash keyHash(key);
+            if (!languageTable.entryIndices.Insert(keyHash, (uint32)languageTable.entries.size()))
+            {
+                const InternedString& existingKey = languageTable.keys[*languageTable.entryIndices.Find(keyHash)];
+                if (existingKey != key)
+                {
+                    GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("Localization key hash collision : {0} and {1} ({2})", key, existingKey, languageCode));
+                }
+
+                continue;
+            }
+
+            LocalizationTableEntry entry;
+            entry.timestamp = entryNode.attribute("timestamp").as_llong();
+            StoreLocalizationText(languageTable, entryNode.attribute("text").as_string(), entry);
+
+            languageTable.keys.push_back(InternedString(key));
+            languageTable.entries.push_back(entry);
+        }
+
+        // The reserved size is an upper bound, identical texts are only stored once.
+        languageTable.texts.shrink_to_fit();
+    }
+
+    return true;
+}
+
+}   // namespace impl
+
+LocalizationHashedKey::LocalizationHashedKey(std::string_view value)
+    : hash(value)
+    , key(value)
+{
+}
+
+std::string_view LocalizationLanguageTable::GetText(const LocalizationTableEntry& entry) const
+{
+    return std::string_view(texts.data() + entry.textOffset, entry.textSize);
+}
+
 LocalizationKey GenerateLocalizationKeyForDatasheetMember(const std::string& datasheetId, const std::string& objectUuid, const std::string& memberName)
 {
     return StringFormat("{0}/{1}/{2}", datasheetId, objectUuid, memberName);
 }
 
 LocalizationTable::LocalizationTable()
+    : m_activeLanguageTable(nullptr)
+    , m_hasRequestedLanguage(false)
+    , m_isLoadingLanguage(false)
+    , m_hasPreparedLanguage(false)
+    , m_preparedLanguageFailed(false)
 {
 }
 
 LocalizationTable::~LocalizationTable()
 {
+    // The worker task accesses the table, it needs to be completed before the destruction.
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_hasRequestedLanguage = false;
+        m_conditionLanguageLoaded.wait(lock, [this]() { return !m_isLoadingLanguage; });
+    }
+
     Unload();
 }
 
@@ -37,143 +164,344 @@ LocalizationRegisterResult LocalizationTable::TryRegisterEntry(const Localizatio
         return LocalizationRegisterResult::Refused_EmptyText;
     }
 
-    auto itLanguage = m_languageTables.find(language);
-    if (itLanguage == m_languageTables.end())
+    LocalizationLanguageTable& languageTable = m_languageTables[language];
+    if (language == m_activeLanguage)
     {
-        itLanguage = m_languageTables.insert(itLanguage, std::make_pair(language, LocalizationLanguageTable()));
+        m_activeLanguageTable = &languageTable;
     }
 
-    auto itEntry = itLanguage->second.entries.find(key);
-    if (itEntry == itLanguage->second.entries.end())
+    Hash keyHash(key);
+
+    const uint32* entryIndex = languageTable.entryIndices.Find(keyHash);
+    if (!entryIndex)
     {
-        itEntry = itLanguage->second.entries.insert(itEntry, std::make_pair(key, entry));
+        LocalizationTableEntry newEntry;
+        newEntry.timestamp = entry.timestamp;
+        impl::StoreLocalizationText(languageTable, entry.text, newEntry);
+
+        languageTable.entryIndices.Insert(keyHash, (uint32)languageTable.entries.size());
+        languageTable.keys.push_back(InternedString(key));
+        languageTable.entries.push_back(newEntry);
         return LocalizationRegisterResult::Accepted;
     }
-    else
+
+    if (languageTable.keys[*entryIndex] != key)
     {
-        if (itEntry->second.timestamp > entry.timestamp)
+        GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("Localization key hash collision : {0} and {1}", key, languageTable.keys[*entryIndex]));
+        return LocalizationRegisterResult::Refused_HashCollision;
+    }
+
+    LocalizationTableEntry& currentEntry = languageTable.entries[*entryIndex];
+    bool identicalText = languageTable.GetText(currentEntry) == entry.text;
+
+    if (currentEntry.timestamp > entry.timestamp)
+    {
+        return LocalizationRegisterResult::Refused_Outdated;
+    }
+    else if (currentEntry.timestamp == entry.timestamp)
+    {
+        if (identicalText)
         {
-            return LocalizationRegisterResult::Refused_Outdated;
+            return LocalizationRegisterResult::Refused_Identical;
         }
-        else if (itEntry->second.timestamp == entry.timestamp)
+        else    // if (currentEntry.text != entry.text)
         {
-            if (itEntry->second.text == entry.text)
-            {
-                return LocalizationRegisterResult::Refused_Identical;
-            }
-            else    // if (itEntry->second.text != entry.text)
-            {
-                itEntry->second = entry;
-                return LocalizationRegisterResult::Accepted_IdenticalTimestamp;
-            }
+            impl::StoreLocalizationText(languageTable, entry.text, currentEntry);
+            return LocalizationRegisterResult::Accepted_IdenticalTimestamp;
         }
-        else    // if (itEntry->second.timestamp < entry.timestamp)
+    }
+    else    // if (currentEntry.timestamp < entry.timestamp)
+    {
+        currentEntry.timestamp = entry.timestamp;
+
+        if (identicalText)
         {
-            if (itEntry->second.text == entry.text)
-            {
-                itEntry->second = entry;
-                return LocalizationRegisterResult::Accepted_IdenticalText;
-            }
-            else    // if (itEntry->second.text != entry.text)
-            {
-                itEntry->second = entry;
-                return LocalizationRegisterResult::Accepted;
-            }
+            return LocalizationRegisterResult::Accepted_IdenticalText;
+        }
+        else    // if (currentEntry.text != entry.text)
+        {
+            impl::StoreLocalizationText(languageTable, entry.text, currentEntry);
+            return LocalizationRegisterResult::Accepted;
         }
     }
 }
 
-const LocalizationTextEntry* LocalizationTable::GetEntry(const LocalizationLanguageCode& language, const LocalizationKey& key) const
+const LocalizationTableEntry* LocalizationTable::GetEntry(const LocalizationLanguageCode& language, const LocalizationKey& key) const
 {
     auto itLanguage = m_languageTables.find(language);
     if (itLanguage != m_languageTables.end())
     {
-        auto itEntry = itLanguage->second.entries.find(key);
-        if (itEntry != itLanguage->second.entries.end())
-        {
-            return &itEntry->second;
-        }
+        return impl::FindLocalizationEntry(itLanguage->second, Hash(key), std::string_view(key));
     }
 
     return nullptr;
 }
 
-const std::string& LocalizationTable::GetText(const LocalizationLanguageCode& language, const LocalizationKey& key) const
+std::string_view LocalizationTable::GetText(const LocalizationLanguageCode& language, const LocalizationKey& key) const
 {
     auto itLanguage = m_languageTables.find(language);
     if (itLanguage != m_languageTables.end())
     {
-        auto itEntry = itLanguage->second.entries.find(key);
-        if (itEntry != itLanguage->second.entries.end())
+        if (const LocalizationTableEntry* entry = impl::FindLocalizationEntry(itLanguage->second, Hash(key), std::string_view(key)))
         {
-            return itEntry->second.text;
+            return itLanguage->second.GetText(*entry);
         }
     }
 
-    static const std::string defaultValue = "";
-    return defaultValue;
+    return std::string_view();
 }
 
-EResourceType::Type LocalizationTable::GetResourceType() const
+std::string_view LocalizationTable::GetText(const LocalizationHashedKey& key) const
 {
-    return EResourceType::LocalizationTable;
+    if (m_activeLanguageTable)
+    {
+        if (const LocalizationTableEntry* entry = impl::FindLocalizationEntry(*m_activeLanguageTable, key.hash, key.key))
+        {
+            return m_activeLanguageTable->GetText(*entry);
+        }
+    }
+
+    return std::string_view();
 }
 
-void LocalizationTable::Unload()
+std::string_view LocalizationTable::GetText(const LocalizedString& localizedString) const
 {
-    m_languageTables.clear();
+    if (m_activeLanguageTable && !localizedString.key.IsEmpty())
+    {
+        if (const LocalizationTableEntry* entry = impl::FindLocalizationEntry(*m_activeLanguageTable, Hash(localizedString.key.GetView()), localizedString.key))
+        {
+            return m_activeLanguageTable->GetText(*entry);
+        }
+    }
+
+    return localizedString.workstring.GetView();
 }
 
-bool LocalizationTable::LoadFromXml(const pugi::xml_document& document)
+const LocalizationLanguageCode& LocalizationTable::GetActiveLanguage() const
 {
-    Unload();
+    return m_activeLanguage;
+}
 
-    pugi::xml_node rootNode = document.child("LocalizationTable");
-    if (!rootNode)
+bool LocalizationTable::HasLanguage(const LocalizationLanguageCode& language) const
+{
+    return m_languageTables.find(language) != m_languageTables.end();
+}
+
+bool LocalizationTable::LoadLanguage(const LocalizationLanguageCode& language)
+{
+    if (!m_resourceInfos)
         return false;
 
-    for (pugi::xml_node languageNode = rootNode.child("LanguageTable"); languageNode; languageNode = languageNode.next_sibling("LanguageTable"))
+    pugi::xml_document document;
+    LanguageTables languageTables;
+    if (!LoadXmlDocument(document) || !impl::ParseLocalizationLanguageTables(document, language, languageTables))
+        return false;
+
+    ApplyLanguageTables(languageTables, language);
+    return true;
+}
+
+bool LocalizationTable::LoadLanguageAsync(const LocalizationLanguageCode& language)
+{
+    if (!m_resourceInfos)
+        return false;
+
+    bool startLoading = false;
+
     {
-        std::string languageCode = languageNode.attribute("code").as_string();
-        if (languageCode.empty())
-            continue;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_requestedLanguage = language;
+        m_hasRequestedLanguage = true;
 
-        auto kvpLanguageInsert = m_languageTables.insert(std::make_pair(languageCode, LocalizationLanguageTable()));
-        auto itLanguage = kvpLanguageInsert.first;
+        if (!m_isLoadingLanguage)
+        {
+            m_isLoadingLanguage = true;
+            startLoading = true;
+        }
+    }
 
-        for (pugi::xml_node entryNode = languageNode.child("Entry"); entryNode; entryNode = entryNode.next_sibling("Entry"))
+    // A single task processes the requests, successive switches only prepare the last requested language.
+    if (startLoading)
+    {
+        GetEngine()->GetThreadPool()->PushTask([this]()
         {
-            std::string key = entryNode.attribute("key").as_string();
-            if (key.empty())
-                continue;
+            ProcessLanguageLoads();
+        });
+    }
 
-            LocalizationTextEntry entry;
-            entry.timestamp = entryNode.attribute("timestamp").as_llong();
-            entry.text = entryNode.attribute("text").as_string();
+    return true;
+}
+
+void LocalizationTable::ProcessLanguageLoads()
+{
+    while (true)
+    {
+        LocalizationLanguageCode language;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_hasRequestedLanguage)
+            {
+                // The table may be destroyed as soon as the lock is released, it should not be accessed anymore.
+                m_isLoadingLanguage = false;
+                m_conditionLanguageLoaded.notify_all();
+                return;
+            }
 
-            itLanguage->second.entries.insert(std::make_pair(key, entry));
+            language = m_requestedLanguage;
+            m_hasRequestedLanguage = false;
         }
+
+        pugi::xml_document document;
+        LanguageTables languageTables;
+        bool failed = false;
+        if (!LoadXmlDocument(document) || !impl::ParseLocalizationLanguageTables(document, language, languageTables))
+        {
+            // The current texts are kept, the failure will be reported by the finalization.
+            languageTables.clear();
+            failed = true;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_preparedLanguageTables.swap(languageTables);
+        m_preparedLanguage = language;
+        m_hasPreparedLanguage = true;
+        m_preparedLanguageFailed = failed;
+    }
+}
+
+bool LocalizationTable::IsLanguageLoadPending() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_isLoadingLanguage || m_hasPreparedLanguage;
+}
+
+bool LocalizationTable::FinalizeLanguageLoad()
+{
+    LanguageTables languageTables;
+    LocalizationLanguageCode language;
+    bool failed = false;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_hasPreparedLanguage)
+            return false;
+
+        languageTables.swap(m_preparedLanguageTables);
+        language = m_preparedLanguage;
+        failed = m_preparedLanguageFailed;
+        m_hasPreparedLanguage = false;
+        m_preparedLanguageFailed = false;
     }
 
+    // An empty language is valid (all languages are loaded), failures are tracked separately.
+    if (failed)
+    {
+        GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("Could not load the localization language : {0}", GetID()));
+        return false;
+    }
+
+    ApplyLanguageTables(languageTables, language);
+    return true;
+}
+
+void LocalizationTable::CompleteLanguageLoad()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_conditionLanguageLoaded.wait(lock, [this]() { return !m_isLoadingLanguage; });
+    }
+
+    FinalizeLanguageLoad();
+}
+
+void LocalizationTable::ApplyLanguageTables(LanguageTables& languageTables, const LocalizationLanguageCode& activeLanguage)
+{
+    m_languageTables.swap(languageTables);
+    m_activeLanguage = activeLanguage;
+
+    auto itLanguage = m_languageTables.find(m_activeLanguage);
+    m_activeLanguageTable = itLanguage != m_languageTables.end() ? &itLanguage->second : nullptr;
+}
+
+EResourceType::Type LocalizationTable::GetResourceType() const
+{
+    return EResourceType::LocalizationTable;
+}
+
+size_t LocalizationTable::GetMemorySize() const
+{
+    size_t memorySize = 0;
+    for (const auto& kvpLanguage : m_languageTables)
+    {
+        const LocalizationLanguageTable& languageTable = kvpLanguage.second;
+        memorySize += kvpLanguage.first.capacity()
+            + languageTable.keys.capacity() * sizeof(InternedString)
+            + languageTable.entries.capacity() * sizeof(LocalizationTableEntry)
+            + languageTable.entryIndices.Capacity() * (sizeof(HashMap<uint32>::Entry) + sizeof(uint8))
+            + languageTable.texts.capacity()
+            + languageTable.textOffsets.Capacity() * (sizeof(HashMap<uint32>::Entry) + sizeof(uint8));
+    }
+
+    return memorySize;
+}
+
+void LocalizationTable::Unload()
+{
+    m_languageTables.clear();
+    m_activeLanguage.clear();
+    m_activeLanguageTable = nullptr;
+}
+
+bool LocalizationTable::LoadFromXml(const pugi::xml_document& document)
+{
+    Unload();
+
+    // At runtime, only the active language is kept in memory.
+    LocalizationLanguageCode language = GetResources()->GetLocalizationLanguage();
+
+    LanguageTables languageTables;
+    if (!impl::ParseLocalizationLanguageTables(document, language, languageTables))
+        return false;
+
+    ApplyLanguageTables(languageTables, language);
     return true;
 }
 
 bool LocalizationTable::SaveToXml(pugi::xml_document& document) const
 {
+    if (!m_activeLanguage.empty())
+    {
+        GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, "A LocalizationTable with a single loaded language can not be saved");
+        return false;
+    }
+
     pugi::xml_node rootNode = document.append_child("LocalizationTable");
     rootNode.append_attribute("serializationVersion") = 1;
 
     for (const auto& kvpLanguage : m_languageTables)
     {
+        const LocalizationLanguageTable& languageTable = kvpLanguage.second;
+
         pugi::xml_node languageNode = rootNode.append_child("LanguageTable");
         languageNode.append_attribute("code").set_value(kvpLanguage.first.c_str());
 
-        for (const auto& kvpEntry : kvpLanguage.second.entries)
+        // Entries are sorted by key, to keep the file stable between edits.
+        std::vector<uint32> sortedIndices(languageTable.entries.size());
+        std::iota(sortedIndices.begin(), sortedIndices.end(), 0);
+        std::sort(sortedIndices.begin(), sortedIndices.end(), [&](uint32 left, uint32 right)
         {
+            return languageTable.keys[left] < languageTable.keys[right];
+        });
+
+        for (uint32 entryIndex : sortedIndices)
+        {
+            const LocalizationTableEntry& entry = languageTable.entries[entryIndex];
+
             pugi::xml_node entryNode = languageNode.append_child("Entry");
-            entryNode.append_attribute("key").set_value(kvpEntry.first.c_str());
-            entryNode.append_attribute("timestamp").set_value(kvpEntry.second.timestamp);
-            entryNode.append_attribute("text").set_value(kvpEntry.second.text.c_str());
+            entryNode.append_attribute("key").set_value(languageTable.keys[entryIndex].GetCString());
+            entryNode.append_attribute("timestamp").set_value(entry.timestamp);
+            entryNode.append_attribute("text").set_value(languageTable.texts.data() + entry.textOffset);
         }
     }
 
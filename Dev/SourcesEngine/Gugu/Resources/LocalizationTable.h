@@ -4,9 +4,16 @@
 // Includes
 
 #include "Gugu/Resources/Resource.h"
+#include "Gugu/Data/LocalizedString.h"
+#include "Gugu/System/Hash.h"
+#include "Gugu/System/HashMap.h"
+#include "Gugu/System/StringTable.h"
 #include "Gugu/System/UUID.h"
 
+#include <condition_variable>
 #include <map>
+#include <mutex>
+#include <vector>
 
 ////////////////////////////////////////////////////////////////
 // File Declarations
@@ -22,9 +29,29 @@ struct LocalizationTextEntry
     std::string text;
 };
 
+// Entry stored in a language table, its text is stored in the texts buffer of the table.
+struct LocalizationTableEntry
+{
+    int64 timestamp = 0;
+    uint32 textOffset = 0;
+    uint32 textSize = 0;
+};
+
+// Entries of a language, stored contiguously and indexed by the hash of their key.
+// - Keys are interned, they are shared with the datasheets, and checked by the lookups (a key colliding with an entry is not found).
+// - Two keys with the same hash can not be stored in a table, the second one is refused with an error.
+// - Texts are owned by the table and released with it, identical texts of a language are stored once.
+// - A replaced text stays in the buffer until the table is reloaded.
 struct LocalizationLanguageTable
 {
-    std::map<LocalizationKey, LocalizationTextEntry> entries;
+    std::vector<InternedString> keys;
+    std::vector<LocalizationTableEntry> entries;
+    HashMap<uint32> entryIndices;
+
+    std::vector<char> texts;            // Null-terminated texts.
+    HashMap<uint32> textOffsets;
+
+    std::string_view GetText(const LocalizationTableEntry& entry) const;
 };
 
 enum class LocalizationRegisterResult : uint8
@@ -37,10 +64,24 @@ enum class LocalizationRegisterResult : uint8
     Refused_Identical,              // The new entry has the same text and timestamp as the current entry (loca is up to date).
     Refused_EmptyText,              // The new entry has an empty text (invalid).
     Refused_Outdated,               // The new entry is older than the current entry (outdated).
+    Refused_HashCollision,          // The new entry key has the same hash as another key (one of the keys should be renamed).
+};
+
+// Key hashed once by the caller, for repeated lookups.
+struct LocalizationHashedKey
+{
+    Hash hash;
+    InternedString key;     // Checked against the key of the entry found by the hash.
+
+    LocalizationHashedKey() = default;
+    explicit LocalizationHashedKey(std::string_view value);
 };
 
 LocalizationKey GenerateLocalizationKeyForDatasheetMember(const std::string& datasheetId, const std::string& objectUuid, const std::string& memberName);
 
+// Localized texts of all the languages, stored in a single file.
+// - When a localization language is set on the ManagerResources, only this language is loaded (all languages are loaded otherwise, for edition).
+// - A language switch is parsed on a worker thread, the previous texts stay available until the switch is finalized on the main thread.
 class LocalizationTable : public Resource
 {
 public:
@@ -49,10 +90,25 @@ public:
     virtual ~LocalizationTable();
 
     LocalizationRegisterResult TryRegisterEntry(const LocalizationLanguageCode& language, const LocalizationKey& key, const LocalizationTextEntry& entry);
-    const LocalizationTextEntry* GetEntry(const LocalizationLanguageCode& language, const LocalizationKey& key) const;
-    const std::string& GetText(const LocalizationLanguageCode& language, const LocalizationKey& key) const;
+    const LocalizationTableEntry* GetEntry(const LocalizationLanguageCode& language, const LocalizationKey& key) const;
+    std::string_view GetText(const LocalizationLanguageCode& language, const LocalizationKey& key) const;
+
+    // Lookups in the active language, keys can be hashed once and stored by the caller.
+    std::string_view GetText(const LocalizationHashedKey& key) const;
+    std::string_view GetText(const LocalizedString& localizedString) const;   // Return the workstring if the key is not localized.
+
+    const LocalizationLanguageCode& GetActiveLanguage() const;
+    bool HasLanguage(const LocalizationLanguageCode& language) const;
+
+    // Language switch, only the new language will be kept in memory.
+    bool LoadLanguage(const LocalizationLanguageCode& language);
+    bool LoadLanguageAsync(const LocalizationLanguageCode& language);
+    bool IsLanguageLoadPending() const;
+    bool FinalizeLanguageLoad();        // Return true if a prepared language has been applied.
+    void CompleteLanguageLoad();        // Block until the pending language is prepared, and apply it.
 
     virtual EResourceType::Type GetResourceType() const override;
+    virtual size_t GetMemorySize() const override;  // Keys are accounted in the StringTable.
 
 protected:
 
@@ -60,9 +116,32 @@ protected:
     virtual bool LoadFromXml(const pugi::xml_document& document) override;
     virtual bool SaveToXml(pugi::xml_document& document) const override;
 
+private:
+
+    using LanguageTables = std::map<LocalizationLanguageCode, LocalizationLanguageTable>;
+
+    void ApplyLanguageTables(LanguageTables& languageTables, const LocalizationLanguageCode& activeLanguage);
+    void ProcessLanguageLoads();
+
 protected:
 
-    std::map<LocalizationLanguageCode, LocalizationLanguageTable> m_languageTables;
+    LanguageTables m_languageTables;
+    LocalizationLanguageCode m_activeLanguage;                  // Empty when all languages are loaded.
+    const LocalizationLanguageTable* m_activeLanguageTable;
+
+private:
+
+    // Language switch, protected by m_mutex.
+    LocalizationLanguageCode m_requestedLanguage;
+    bool m_hasRequestedLanguage;
+    bool m_isLoadingLanguage;
+    LanguageTables m_preparedLanguageTables;
+    LocalizationLanguageCode m_preparedLanguage;
+    bool m_hasPreparedLanguage;
+    bool m_preparedLanguageFailed;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_conditionLanguageLoaded;
 };
 
 }   // namespace gugu
@@ -10,6 +10,7 @@
 #include "Gugu/Engine.h"
 #include "Gugu/Core/EngineConfig.h"
 #include "Gugu/Resources/ResourceInfo.h"
+#include "Gugu/Resources/ResourceArchive.h"
 #include "Gugu/Resources/Resource.h"
 #include "Gugu/Resources/Texture.h"
 #include "Gugu/Resources/Font.h"
@@ -22,19 +23,70 @@
 #include "Gugu/Resources/Datasheet.h"
 #include "Gugu/Resources/ElementWidget.h"
 #include "Gugu/Resources/LocalizationTable.h"
+#include "Gugu/Resources/PreloadManifest.h"
 #include "Gugu/Data/DataBindingUtility.h"
+#include "Gugu/Math/MathUtility.h"
 #include "Gugu/System/Container.h"
 #include "Gugu/System/Path.h"
 #include "Gugu/System/Platform.h"
 #include "Gugu/System/String.h"
+#include "Gugu/System/ThreadPool.h"
+#include "Gugu/System/Time.h"
 #include "Gugu/Debug/Logger.h"
 #include "Gugu/Debug/Trace.h"
 
+#include <SFML/System/Clock.hpp>
+
+#include <algorithm>
+
 ////////////////////////////////////////////////////////////////
 // File Implementation
 
 namespace gugu {
 
+namespace impl {
+
+void ParallelFor(size_t count, const std::function<void(size_t)>& body)
+{
+    ThreadPool* threadPool = GetEngine()->GetThreadPool();
+    if (threadPool && count > 1)
+    {
+        threadPool->ParallelFor(count, body);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            body(i);
+        }
+    }
+}
+
+// Resources of a layer may only depend on resources of a lower layer.
+int GetPreloadLayer(EResourceType::Type resourceType)
+{
+    switch (resourceType)
+    {
+    case EResourceType::Texture:
+    case EResourceType::Font:
+    case EResourceType::AudioClip:
+        return 0;
+    case EResourceType::ImageSet:
+    case EResourceType::AudioMixerGroup:
+        return 1;
+    case EResourceType::AnimSet:
+    case EResourceType::SoundCue:
+    case EResourceType::ParticleEffect:
+        return 2;
+    case EResourceType::ElementWidget:
+        return 3;
+    default:
+        return 4;
+    }
+}
+
+}   // namespace impl
+
 ManagerResources::ManagerResources()
 {
     m_pathAssets = "";
@@ -44,6 +96,17 @@ ManagerResources::ManagerResources()
     m_useFullPath = false;
     m_defaultTextureSmooth = false;
     m_handleResourceDependencies = false;
+    m_maxAsyncLoadTimePerLoopMs = 0;
+    m_nextAsyncLoadId = 0;
+    m_resourceInfosGeneration = 1;
+    m_residencyTick = 1;
+    m_textureStreamingMinSize = 0;
+    m_textureStreamingDropDelay = 0.f;
+    m_resourceCacheDirty = false;
+    m_dependencyUpdateStamp = 0;
+    m_nextPrefetchId = 0;
+    m_onDemandLoadDepth = 0;
+    m_recordingLoads = false;
 }
 
 ManagerResources::~ManagerResources()
@@ -59,18 +122,91 @@ bool ManagerResources::Init(const EngineConfig& config)
     m_debugFont = config.debugFont;
     m_defaultTextureSmooth = config.defaultTextureSmooth;
     m_handleResourceDependencies = config.handleResourceDependencies;
+    m_maxAsyncLoadTimePerLoopMs = config.maxAsyncLoadTimePerLoopMs;
+
+    SetMemoryBudget(static_cast<size_t>(Max(0, config.resourceMemoryBudgetMb)) * 1024 * 1024);
+
+    SetTextureStreamingMinSize(static_cast<unsigned int>(Max(0, config.textureStreamingMinSize)));
+    SetTextureStreamingDropDelay(config.textureStreamingDropDelayMs);
+    SetTextureStreamingBudget(static_cast<size_t>(Max(0, config.textureStreamingBudgetMb)) * 1024 * 1024);
+
+    if (!config.pathResourceCache.empty())
+    {
+        LoadResourceCache(config.pathResourceCache);
+    }
+
+    if (!config.pathAssetsArchive.empty() && MountArchive(config.pathAssetsArchive))
+    {
+        return true;
+    }
 
     return ParseDirectory(m_pathAssets);
 }
 
 void ManagerResources::Release()
 {
-    m_resourceDependencies.clear();
+    // The cache needs to be saved while resources are still registered.
+    if (m_resourceCacheDirty)
+    {
+        SaveResourceCache();
+    }
+
+    m_resourceCachePath.clear();
+    m_resourceCacheEntries.Clear();
+    m_resourceCacheDirty = false;
+
+    // Pending asynchronous loads are discarded, but we still need to wait for their worker tasks.
+    for (const auto& entry : m_asyncLoadRequests)
+    {
+        AsyncLoadRequest* request = entry.second;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutexAsyncLoads);
+            m_conditionAsyncLoadPrepared.wait(lock, [request]() { return request->prepared; });
+        }
+
+        SafeDelete(request->resource);
+        SafeDelete(request);
+    }
+
+    m_asyncLoadRequests.clear();
+    m_asyncLoadRequestsByResource.clear();
+    m_prefetchRequests.clear();
+
+    m_recordingLoads = false;
+    m_recordedLoads.clear();
+    m_recordedLoadIds.Clear();
+
+    // Pending texture streaming requests are discarded the same way.
+    for (StreamedTexture& streamedTexture : m_streamedTextures)
+    {
+        TextureStreamingRequest* request = streamedTexture.request;
+        if (request)
+        {
+            std::unique_lock<std::mutex> lock(m_mutexAsyncLoads);
+            m_conditionAsyncLoadPrepared.wait(lock, [request]() { return request->prepared; });
+        }
+
+        SafeDelete(streamedTexture.request);
+
+        // The texture will not need to unregister itself when it is deleted.
+        streamedTexture.texture->m_streamed = false;
+    }
+
+    m_streamedTextures.clear();
+
+    m_dependencyNodes.clear();
+    m_freeDependencyNodes.clear();
+    m_dependencyNodeStamps.clear();
     m_dataObjectFactories.clear();
 
-    ClearStdMap(m_dataEnumInfos);
-    ClearStdMap(m_customTextures);
-    ClearStdMap(m_resources);
+    ClearHashMap(m_dataEnumInfos);
+    ClearHashMap(m_customTextures);
+    ClearHashMap(m_resources);
+    InvalidateResourceRefs();
+
+    // Archives need to be closed after the resources, some of them may still read their mapped memory.
+    ClearStdVector(m_archives);
 }
 
 bool ManagerResources::ParseDirectory(std::string_view rootPath_utf8)
@@ -85,18 +221,86 @@ bool ManagerResources::ParseDirectory(std::string_view rootPath_utf8)
         return false;
     }
 
+    // Each directory is scanned separately, to spread the files listing on the worker threads.
+    std::vector<std::string> directories;
+    directories.push_back(std::string(rootPath_utf8));
+    GetDirectories(rootPath_utf8, directories, true);
+
+    std::vector<std::vector<FileInfo>> directoryFiles(directories.size());
+    impl::ParallelFor(directories.size(), [&directories, &directoryFiles](size_t index)
+    {
+        GetFiles(directories[index], directoryFiles[index], false);
+    });
+
     std::vector<FileInfo> files;
-    GetFiles(rootPath_utf8, files, true);
+    for (std::vector<FileInfo>& localFiles : directoryFiles)
+    {
+        files.insert(files.end(), std::make_move_iterator(localFiles.begin()), std::make_move_iterator(localFiles.end()));
+    }
+
+    directoryFiles.clear();
+
+    // Resource IDs, map keys and types are computed on the worker threads.
+    struct ParsedFile
+    {
+        std::string resourceId;
+        ResourceMapKey mapKey;
+        EResourceType::Type resourceType = EResourceType::Unknown;
+        bool cooked = false;
+        int64 fileTime = 0;     // Only retrieved when the resource cache is used.
+        uint64 fileSize = 0;    // Only retrieved when the resource cache is used.
+    };
+
+    bool useResourceCache = !m_resourceCachePath.empty();
+
+    std::vector<ParsedFile> parsedFiles(files.size());
+    impl::ParallelFor(files.size(), [this, &files, &parsedFiles, rootPath_utf8, useResourceCache](size_t index)
+    {
+        const FileInfo& fileInfos = files[index];
+        ParsedFile& parsedFile = parsedFiles[index];
+
+        parsedFile.resourceId = (!m_useFullPath) ? std::string(fileInfos.GetFileName_utf8()) : std::string(fileInfos.GetFilePath_utf8().substr(rootPath_utf8.length()));
+        parsedFile.mapKey = ResourceMapKey(parsedFile.resourceId);
+        parsedFile.cooked = fileInfos.HasExtension(resources::CookedFileExtension);
+
+        if (!parsedFile.cooked)
+        {
+            parsedFile.resourceType = GetResourceType(fileInfos);
+
+            if (useResourceCache)
+            {
+                GetFileStats(fileInfos.GetFilePath_utf8(), parsedFile.fileTime, parsedFile.fileSize);
+            }
+        }
+    });
+
+    m_resources.Reserve(m_resources.Size() + files.size());
 
     size_t fileCount = 0;
     for (size_t i = 0; i < files.size(); ++i)
     {
-        const FileInfo& fileInfos = files[i];
-        std::string resourceId = (!m_useFullPath) ? std::string(fileInfos.GetFileName_utf8()) : std::string(fileInfos.GetFilePath_utf8().substr(rootPath_utf8.length()));
-
-        if (RegisterResourceInfo(resourceId, fileInfos))
+        const ParsedFile& parsedFile = parsedFiles[i];
+        if (!parsedFile.cooked && RegisterResourceInfo(parsedFile.resourceId, parsedFile.mapKey, files[i], parsedFile.resourceType))
         {
             ++fileCount;
+
+            // Cached types and dependencies are restored if the file did not change since they were recorded.
+            if (useResourceCache)
+            {
+                ResourceInfo* resourceInfo = FindResourceInfo(parsedFile.mapKey, parsedFile.resourceId);
+                resourceInfo->fileTime = parsedFile.fileTime;
+                resourceInfo->fileSize = parsedFile.fileSize;
+                RestoreResourceCacheEntry(resourceInfo);
+            }
+        }
+    }
+
+    // Cooked files are attached to their source resources once all of them are registered.
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        if (parsedFiles[i].cooked)
+        {
+            RegisterCookedFile(parsedFiles[i].resourceId, files[i], nullptr);
         }
     }
 
@@ -116,16 +320,15 @@ const std::string& ManagerResources::GetPathScreenshots() const
 
 bool ManagerResources::HasResource(const std::string& resourceId) const
 {
-    auto iteElement = m_resources.find(resourceId);
-    return (iteElement != m_resources.end());
+    return FindResourceInfo(resourceId) != nullptr;
 }
 
 bool ManagerResources::IsResourceLoaded(const std::string& resourceId) const
 {
-    auto iteElement = m_resources.find(resourceId);
-    if (iteElement != m_resources.end())
+    ResourceInfo* resourceInfo = FindResourceInfo(resourceId);
+    if (resourceInfo)
     {
-        return (*iteElement).second->resource != nullptr;
+        return resourceInfo->resource != nullptr;
     }
 
     return false;
@@ -133,11 +336,11 @@ bool ManagerResources::IsResourceLoaded(const std::string& resourceId) const
 
 bool ManagerResources::GetResourceFileInfo(const std::string& resourceId, FileInfo& fileInfo) const
 {
-    auto iteElement = m_resources.find(resourceId);
-    if (iteElement != m_resources.end())
+    ResourceInfo* resourceInfo = FindResourceInfo(resourceId);
+    if (resourceInfo)
     {
         // This will return a copy.
-        fileInfo = (*iteElement).second->fileInfo;
+        fileInfo = resourceInfo->fileInfo;
         return true;
     }
 
@@ -146,10 +349,10 @@ bool ManagerResources::GetResourceFileInfo(const std::string& resourceId, FileIn
 
 const FileInfo& ManagerResources::GetResourceFileInfo(const std::string& resourceId) const
 {
-    auto iteElement = m_resources.find(resourceId);
-    if (iteElement != m_resources.end())
+    ResourceInfo* resourceInfo = FindResourceInfo(resourceId);
+    if (resourceInfo)
     {
-        return (*iteElement).second->fileInfo;
+        return resourceInfo->fileInfo;
     }
 
     static const FileInfo defaultValue;
@@ -158,23 +361,106 @@ const FileInfo& ManagerResources::GetResourceFileInfo(const std::string& resourc
 
 void ManagerResources::PreloadAll()
 {
-    auto iteCurrent = m_resources.begin();
-    while (iteCurrent != m_resources.end())
+    // Loading resources should not register new ones, but we still avoid iterating the map while loading.
+    std::vector<ResourceInfo*> resourceInfos;
+    resourceInfos.reserve(m_resources.Size());
+
+    for (const auto& entry : m_resources)
+    {
+        if (!entry.value->resource)
+        {
+            resourceInfos.push_back(entry.value);
+        }
+    }
+
+    // Dependencies are finalized before their referencers, this avoids blocking loads during the finalization of a referencer.
+    // - Dependencies inside a same layer (datasheets inheritance for instance) will complete their pending load when requested.
+    // - Inside a same layer, resources are ordered by the depth of their cached dependencies, when the resource cache is used.
+    struct PreloadOrder
     {
-        GetResource((*iteCurrent).second->resourceID);
-        ++iteCurrent;
+        ResourceInfo* resourceInfo = nullptr;
+        int layer = 0;
+        uint32 depth = 0;
+    };
+
+    std::vector<PreloadOrder> preloadOrders(resourceInfos.size());
+    std::map<const ResourceInfo*, uint32> dependencyDepths;
+
+    for (size_t i = 0; i < resourceInfos.size(); ++i)
+    {
+        preloadOrders[i].resourceInfo = resourceInfos[i];
+        preloadOrders[i].layer = impl::GetPreloadLayer(resourceInfos[i]->resourceType);
+        preloadOrders[i].depth = m_resourceCachePath.empty() ? 0 : GetCachedDependencyDepth(resourceInfos[i], dependencyDepths);
+    }
+
+    std::stable_sort(preloadOrders.begin(), preloadOrders.end(), [](const PreloadOrder& left, const PreloadOrder& right)
+    {
+        return left.layer < right.layer || (left.layer == right.layer && left.depth < right.depth);
+    });
+
+    for (size_t i = 0; i < preloadOrders.size(); ++i)
+    {
+        resourceInfos[i] = preloadOrders[i].resourceInfo;
     }
+
+    LoadResourcesInParallel(resourceInfos, EResourceType::Unknown);
+
+    // All the datasheets inheriting from a parent are loaded at this point.
+    Datasheet::ReleaseParsedDocuments();
 }
 
 void ManagerResources::SaveAll()
 {
-    auto iteCurrent = m_resources.begin();
-    while (iteCurrent != m_resources.end())
+    for (const auto& entry : m_resources)
+    {
+        if (entry.value->resource)
+            entry.value->resource->SaveToFile();
+    }
+}
+
+ResourceInfo* ManagerResources::FindResourceInfo(const std::string& resourceId) const
+{
+    return FindResourceInfo(ResourceMapKey(resourceId), resourceId);
+}
+
+ResourceInfo* ManagerResources::FindResourceInfo(const ResourceMapKey& mapKey, const std::string& resourceId) const
+{
+    ResourceInfo* const* resourceInfo = m_resources.Find(mapKey);
+    if (!resourceInfo)
+        return nullptr;
+
+#if defined(GUGU_DEBUG)
+    if ((*resourceInfo)->resourceID != resourceId)
+    {
+        GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("Resource ID hash collision : {0}, {1}", resourceId, (*resourceInfo)->resourceID));
+        return nullptr;
+    }
+#endif
+
+    return *resourceInfo;
+}
+
+bool ManagerResources::CheckResourceMapKey(const ResourceMapKey& mapKey, std::string_view name) const
+{
+#if defined(GUGU_DEBUG)
+    auto iteName = m_debugMapKeyNames.find(mapKey);
+    if (iteName == m_debugMapKeyNames.end())
+    {
+        m_debugMapKeyNames.insert(iteName, std::make_pair(mapKey, std::string(name)));
+    }
+    else if (iteName->second != name)
     {
-        if ((*iteCurrent).second->resource)
-            (*iteCurrent).second->resource->SaveToFile();
-        ++iteCurrent;
+        GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("Resource map key hash collision : {0}, {1}", std::string(name), iteName->second));
+        return false;
     }
+#endif
+
+    return true;
+}
+
+void ManagerResources::InvalidateResourceRefs()
+{
+    ++m_resourceInfosGeneration;
 }
 
 EResourceType::Type ManagerResources::GetResourceType(const FileInfo& fileInfo) const
@@ -231,6 +517,10 @@ EResourceType::Type ManagerResources::GetResourceType(const FileInfo& fileInfo)
     {
         return EResourceType::LocalizationTable;
     }
+    else if (fileInfo.HasExtension("manifest.xml") || fileInfo.HasExtension("manifest"))
+    {
+        return EResourceType::PreloadManifest;
+    }
     else
     {
         return EResourceType::Unknown;
@@ -298,19 +588,39 @@ LocalizationTable* ManagerResources::GetLocalizationTable(const std::string& res
     return dynamic_cast<LocalizationTable*>(GetResource(resourceId, EResourceType::LocalizationTable));
 }
 
+PreloadManifest* ManagerResources::GetPreloadManifest(const std::string& resourceId)
+{
+    return dynamic_cast<PreloadManifest*>(GetResource(resourceId, EResourceType::PreloadManifest));
+}
+
 Resource* ManagerResources::GetResource(const std::string& resourceId, EResourceType::Type explicitType)
 {
     if (resourceId.empty())
         return nullptr;
 
     //Check Resource already loaded
-    auto iteResource = m_resources.find(resourceId);
-    if (iteResource != m_resources.end())
+    ResourceInfo* resourceInfo = FindResourceInfo(resourceId);
+    if (resourceInfo)
     {
-        if (iteResource->second->resource)
-            return iteResource->second->resource;
+        resourceInfo->lastUseTick = m_residencyTick;
+
+        if (resourceInfo->resource)
+        {
+            if (resourceInfo->prefetched)
+            {
+                OnPrefetchedResourceAccessed(resourceInfo);
+            }
+
+            ++resourceInfo->pinCount;
+            return resourceInfo->resource;
+        }
+
+        Resource* resource = LoadResource(resourceInfo, explicitType);
+        if (resource)
+        {
+            ++resourceInfo->pinCount;
+        }
 
-        Resource* resource = LoadResource(iteResource->second, explicitType);
         return resource;
     }
 
@@ -323,118 +633,220 @@ bool ManagerResources::LoadResource(const std::string& resourceId, EResourceType
     if (resourceId.empty())
         return false;
 
-    auto iteElement = m_resources.find(resourceId);
-    if (iteElement == m_resources.end())
+    ResourceInfo* resourceInfo = FindResourceInfo(resourceId);
+    if (!resourceInfo)
     {
         GetLogEngine()->Print(ELog::Warning, ELogEngine::Resources, StringFormat("LoadResource failed, unknown resource : {0}", resourceId));
         return false;
     }
 
-    return LoadResource(iteElement->second, explicitType) != nullptr;
+    return LoadResource(resourceInfo, explicitType) != nullptr;
 }
 
-Resource* ManagerResources::LoadResource(ResourceInfo* resourceInfo, EResourceType::Type explicitType)
+Resource* ManagerResources::InstanciateResource(EResourceType::Type resourceType, const FileInfo& fileInfo) const
 {
-    if (!resourceInfo)
-        return nullptr;
-
-    if (resourceInfo->resource)
+    if (resourceType == EResourceType::Unknown)
     {
-        GetLogEngine()->Print(ELog::Warning, ELogEngine::Resources, StringFormat("LoadResource ignored, resource already loaded : {0}", resourceInfo->resourceID));
-        return resourceInfo->resource;
+        resourceType = GetResourceType(fileInfo);
     }
 
-    GUGU_SCOPE_TRACE_MAIN("Load Resource");
-
-    FileInfo fileInfo = resourceInfo->fileInfo;
     Resource* resource = nullptr;
 
-    if (explicitType == EResourceType::Unknown)
-    {
-        explicitType = GetResourceType(fileInfo);
-    }
-
-    if (explicitType == EResourceType::Texture)
+    if (resourceType == EResourceType::Texture)
     {
         resource = new Texture;
     }
-    else if (explicitType == EResourceType::Font)
+    else if (resourceType == EResourceType::Font)
     {
         resource = new Font;
     }
-    else if (explicitType == EResourceType::AudioClip)
+    else if (resourceType == EResourceType::AudioClip)
     {
         resource = new AudioClip;
     }
-    else if (explicitType == EResourceType::AudioMixerGroup)
+    else if (resourceType == EResourceType::AudioMixerGroup)
     {
         resource = new AudioMixerGroup;
     }
-    else if (explicitType == EResourceType::SoundCue)
+    else if (resourceType == EResourceType::SoundCue)
     {
         resource = new SoundCue;
     }
-    else if (explicitType == EResourceType::ImageSet)
+    else if (resourceType == EResourceType::ImageSet)
     {
         resource = new ImageSet;
     }
-    else if (explicitType == EResourceType::AnimSet)
+    else if (resourceType == EResourceType::AnimSet)
     {
         resource = new AnimSet;
     }
-    else if (explicitType == EResourceType::ParticleEffect)
+    else if (resourceType == EResourceType::ParticleEffect)
     {
         resource = new ParticleEffect;
     }
-    else if (explicitType == EResourceType::Datasheet)
+    else if (resourceType == EResourceType::Datasheet)
     {
         resource = new Datasheet;
     }
-    else if (explicitType == EResourceType::ElementWidget)
+    else if (resourceType == EResourceType::ElementWidget)
     {
         resource = new ElementWidget;
     }
-    else if (explicitType == EResourceType::LocalizationTable)
+    else if (resourceType == EResourceType::LocalizationTable)
     {
         resource = new LocalizationTable;
     }
+    else if (resourceType == EResourceType::PreloadManifest)
+    {
+        resource = new PreloadManifest;
+    }
     else
     {
         GetLogEngine()->Print(ELog::Warning, ELogEngine::Resources, StringFormat("LoadResource failed, unknown resource extension : {0}", fileInfo.GetFilePath_utf8()));
     }
 
-    if (resource)
+    return resource;
+}
+
+Resource* ManagerResources::LoadResource(ResourceInfo* resourceInfo, EResourceType::Type explicitType)
+{
+    if (!resourceInfo)
+        return nullptr;
+
+    if (resourceInfo->resource)
+    {
+        GetLogEngine()->Print(ELog::Warning, ELogEngine::Resources, StringFormat("LoadResource ignored, resource already loaded : {0}", resourceInfo->resourceID));
+        return resourceInfo->resource;
+    }
+
+    GUGU_SCOPE_TRACE_MAIN("Load Resource");
+
+    // Loads done on the main thread are measured as potential hitches.
+    sf::Clock clock;
+    ++m_onDemandLoadDepth;
+
+    Resource* resource = nullptr;
+
+    // If an asynchronous load is pending, we complete it immediately instead of loading the resource twice.
+    if (CompleteAsyncLoad(resourceInfo))
+    {
+        resource = resourceInfo->resource;
+        resourceInfo->prefetched = false;
+    }
+    else
     {
-        resourceInfo->resource = resource;
-        RegisterResourceDependencies(resource);
+        resource = InstanciateResource(explicitType != EResourceType::Unknown ? explicitType : resourceInfo->resourceType, resourceInfo->fileInfo);
+        if (resource)
+        {
+            resourceInfo->resource = resource;
+            resourceInfo->loadedFromFile = true;
+            resourceInfo->lastUseTick = m_residencyTick;
+            resourceInfo->prefetched = false;
+            RegisterResourceDependencies(resource);
+
+            resource->Init(resourceInfo);
+            bool loaded = resource->LoadFromFile();
 
-        resource->Init(resourceInfo);
-        resource->LoadFromFile();
+            UpdateResourceDependencies(resource);
+
+            if (RecordLoadResult(resourceInfo, loaded))
+            {
+                GetLogEngine()->Print(ELog::Debug, ELogEngine::Resources, StringFormat("Resource loaded : {0}", resourceInfo->resourceID));
+            }
+        }
+    }
 
-        UpdateResourceDependencies(resource);
+    --m_onDemandLoadDepth;
 
-        GetLogEngine()->Print(ELog::Debug, ELogEngine::Resources, StringFormat("Resource loaded : {0}", resourceInfo->resourceID));
+    if (m_onDemandLoadDepth == 0)
+    {
+        float loadTimeMs = clock.getElapsedTime().asSeconds() * 1000.f;
+        ++m_prefetchStats.onDemandLoadCount;
+        m_prefetchStats.onDemandLoadTimeMs += loadTimeMs;
+        m_prefetchStats.maxOnDemandLoadTimeMs = Max(m_prefetchStats.maxOnDemandLoadTimeMs, loadTimeMs);
     }
 
     return resource;
 }
 
+void ManagerResources::SetLocalizationLanguage(const std::string& languageCode)
+{
+    if (m_localizationLanguage == languageCode)
+        return;
+
+    m_localizationLanguage = languageCode;
+
+    // Tables loaded afterwards will directly use the new language.
+    for (const auto& entry : m_resources)
+    {
+        LocalizationTable* localizationTable = dynamic_cast<LocalizationTable*>(entry.value->resource);
+        if (localizationTable && localizationTable->LoadLanguageAsync(m_localizationLanguage))
+        {
+            if (!StdVectorContains(m_pendingLocalizationTableIds, entry.value->resourceID))
+            {
+                m_pendingLocalizationTableIds.push_back(entry.value->resourceID);
+            }
+        }
+    }
+}
+
+const std::string& ManagerResources::GetLocalizationLanguage() const
+{
+    return m_localizationLanguage;
+}
+
+bool ManagerResources::IsLocalizationLanguagePending() const
+{
+    return !m_pendingLocalizationTableIds.empty();
+}
+
+void ManagerResources::ProcessLocalizationLanguage(bool waitPendingLoads)
+{
+    for (size_t i = 0; i < m_pendingLocalizationTableIds.size(); )
+    {
+        // The table may have been removed since the language switch.
+        ResourceInfo* resourceInfo = FindResourceInfo(m_pendingLocalizationTableIds[i]);
+        LocalizationTable* localizationTable = resourceInfo ? dynamic_cast<LocalizationTable*>(resourceInfo->resource) : nullptr;
+
+        if (localizationTable)
+        {
+            if (waitPendingLoads)
+            {
+                localizationTable->CompleteLanguageLoad();
+            }
+            else
+            {
+                localizationTable->FinalizeLanguageLoad();
+            }
+        }
+
+        if (localizationTable && localizationTable->IsLanguageLoadPending())
+        {
+            ++i;
+        }
+        else
+        {
+            StdVectorRemoveAt(m_pendingLocalizationTableIds, i);
+        }
+    }
+}
+
 bool ManagerResources::InjectResource(const std::string& resourceId, Resource* resource)
 {
     if (resourceId.empty())
         return false;
 
-    ResourceMapKey mapKey(resourceId);
-
-    auto iteAsset = m_resources.find(mapKey);
-    if (iteAsset != m_resources.end())
+    ResourceInfo* resourceInfo = FindResourceInfo(resourceId);
+    if (resourceInfo)
     {
-        if (iteAsset->second->resource == nullptr)
+        CompleteAsyncLoad(resourceInfo);
+
+        if (resourceInfo->resource == nullptr)
         {
-            iteAsset->second->resource = resource;
+            resourceInfo->resource = resource;
             RegisterResourceDependencies(resource);
 
-            resource->Init(iteAsset->second);
+            resource->Init(resourceInfo);
             resource->LoadFromFile();
 
             UpdateResourceDependencies(resource);
@@ -459,12 +871,10 @@ const std::string& ManagerResources::GetResourceID(const Resource* resource) con
 {
     if (resource)
     {
-        auto iteCurrent = m_resources.begin();
-        while (iteCurrent != m_resources.end())
+        for (const auto& entry : m_resources)
         {
-            if (iteCurrent->second->resource == resource)
-                return iteCurrent->second->resourceID;
-            ++iteCurrent;
+            if (entry.value->resource == resource)
+                return entry.value->resourceID;
         }
     }
 
@@ -475,12 +885,10 @@ const std::string& ManagerResources::GetResourceID(const Resource* resource) con
 const std::string& ManagerResources::GetResourceID(const FileInfo& fileInfo) const
 {
     // TODO: I should be able to deduce an ID from a FileInfo.
-    auto iteCurrent = m_resources.begin();
-    while (iteCurrent != m_resources.end())
+    for (const auto& entry : m_resources)
     {
-        if (iteCurrent->second->fileInfo == fileInfo)
-            return iteCurrent->second->resourceID;
-        ++iteCurrent;
+        if (entry.value->fileInfo == fileInfo)
+            return entry.value->resourceID;
     }
 
     static const std::string defaultValue;
@@ -488,22 +896,25 @@ const std::string& ManagerResources::GetResourceID(const FileInfo& fileInfo) con
 }
 
 bool ManagerResources::RegisterResourceInfo(const std::string& resourceId, const FileInfo& fileInfo)
+{
+    return RegisterResourceInfo(resourceId, ResourceMapKey(resourceId), fileInfo, GetResourceType(fileInfo));
+}
+
+bool ManagerResources::RegisterResourceInfo(const std::string& resourceId, const ResourceMapKey& mapKey, const FileInfo& fileInfo, EResourceType::Type resourceType)
 {
     if (resourceId.empty())
         return false;
 
-    ResourceMapKey mapKey(resourceId);
-
-    auto iteAsset = m_resources.find(mapKey);
-    if (iteAsset == m_resources.end())
+    ResourceInfo** registeredResourceInfo = m_resources.Find(mapKey);
+    if (!registeredResourceInfo)
     {
         ResourceInfo* resourceInfo = new ResourceInfo;
         resourceInfo->resourceID = resourceId;
         resourceInfo->fileInfo = fileInfo;
+        resourceInfo->resourceType = resourceType;
         resourceInfo->resource = nullptr;
 
-        // TODO: investigate the use of hint iterator here, seems like a bad usage.
-        m_resources.insert(iteAsset, std::make_pair(mapKey, resourceInfo));
+        m_resources.Insert(mapKey, resourceInfo);
         
         GetLogEngine()->Print(ELog::Debug, ELogEngine::Resources, StringFormat("Registered Resource : ID = {0}, Path = {1}"
             , resourceId
@@ -511,11 +922,20 @@ bool ManagerResources::RegisterResourceInfo(const std::string& resourceId, const
         
         return true;
     }
+
+    if ((*registeredResourceInfo)->resourceID != resourceId)
+    {
+        GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("A Resource ID hash collides with a registered Resource ID : ID = {0}, Registered ID = {1}"
+            , resourceId
+            , (*registeredResourceInfo)->resourceID));
+
+        return false;
+    }
     
     GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("A Resource ID is already registered : ID = {0}, New Path = {1}, Registered Path = {2}"
         , resourceId
         , fileInfo.GetFilePath_utf8()
-        , iteAsset->second->fileInfo.GetFilePath_utf8()));
+        , (*registeredResourceInfo)->fileInfo.GetFilePath_utf8()));
         
     return false;
 }
@@ -538,8 +958,8 @@ bool ManagerResources::AddResource(Resource* resource, const FileInfo& fileInfo)
     if (m_useFullPath)
         resourceId = resourcePath.substr(m_pathAssets.length());
 
-    auto iteResource = m_resources.find(resourceId);
-    if (iteResource != m_resources.end())
+    ResourceMapKey mapKey(resourceId);
+    if (m_resources.Contains(mapKey))
     {
         GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("AddResource failed, Resource already exists : {0}", resourceName));
         return false;
@@ -548,9 +968,10 @@ bool ManagerResources::AddResource(Resource* resource, const FileInfo& fileInfo)
     ResourceInfo* resourceInfo = new ResourceInfo;
     resourceInfo->resourceID = resourceId;
     resourceInfo->fileInfo = fileInfo;
+    resourceInfo->resourceType = GetResourceType(fileInfo);
     resourceInfo->resource = resource;
 
-    m_resources.insert(iteResource, std::make_pair(resourceId, resourceInfo));
+    m_resources.Insert(mapKey, resourceInfo);
     RegisterResourceDependencies(resource);
 
     resource->Init(resourceInfo);
@@ -582,8 +1003,8 @@ bool ManagerResources::MoveResource(Resource* resource, const FileInfo& fileInfo
     if (m_useFullPath)
         resourceId = resourcePath.substr(m_pathAssets.length());
 
-    auto iteNewResource = m_resources.find(resourceId);
-    if (iteNewResource != m_resources.end())
+    ResourceMapKey newMapKey(resourceId);
+    if (m_resources.Contains(newMapKey))
     {
         GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("RenameResource failed, Resource already exists : {0}", resourceName));
         return false;
@@ -591,20 +1012,21 @@ bool ManagerResources::MoveResource(Resource* resource, const FileInfo& fileInfo
 
     FileInfo previousFileInfo = resource->GetFileInfo();
 
-    auto itePreviousResource = m_resources.find(resource->GetID());
-    if (itePreviousResource == m_resources.end())
+    ResourceInfo* resourceInfo = FindResourceInfo(resource->GetID());
+    if (!resourceInfo)
     {
         GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("RenameResource failed, Resource not found : {0}", previousFileInfo.GetFilePath_utf8()));
         return false;
     }
 
-    ResourceInfo* resourceInfo = itePreviousResource->second;
-    m_resources.erase(itePreviousResource);
+    m_resources.Remove(ResourceMapKey(resourceInfo->resourceID));
+    InvalidateResourceRefs();
 
     resourceInfo->resourceID = resourceId;
     resourceInfo->fileInfo = fileInfo;
+    resourceInfo->resourceType = GetResourceType(fileInfo);
 
-    m_resources.insert(iteNewResource, std::make_pair(resourceId, resourceInfo));
+    m_resources.Insert(newMapKey, resourceInfo);
 
     //Delete old file, save new file
     if (resource->SaveToFile())
@@ -630,13 +1052,15 @@ bool ManagerResources::RemoveResource(Resource* resource, bool unloadResource)
 
 bool ManagerResources::RemoveResource(const std::string& resourceId, bool unloadResource)
 {
-    auto iteResource = m_resources.find(resourceId);
-    if (iteResource != m_resources.end())
+    ResourceInfo* resourceInfo = FindResourceInfo(resourceId);
+    if (resourceInfo)
     {
-        Resource* resource = iteResource->second->resource;
+        CompleteAsyncLoad(resourceInfo);
 
-        ResourceInfo* resourceInfo = iteResource->second;
-        m_resources.erase(iteResource);
+        Resource* resource = resourceInfo->resource;
+
+        m_resources.Remove(ResourceMapKey(resourceId));
+        InvalidateResourceRefs();
 
         if (resource)
         {
@@ -665,10 +1089,10 @@ bool ManagerResources::DeleteResource(Resource* resource)
 
 bool ManagerResources::DeleteResource(const std::string& resourceId)
 {
-    auto iteResource = m_resources.find(resourceId);
-    if (iteResource != m_resources.end())
+    ResourceInfo* resourceInfo = FindResourceInfo(resourceId);
+    if (resourceInfo)
     {
-        FileInfo fileInfo = iteResource->second->fileInfo;
+        FileInfo fileInfo = resourceInfo->fileInfo;
 
         if (RemoveResource(resourceId, true))
         {
@@ -684,17 +1108,20 @@ void ManagerResources::RemoveResourcesFromPath(const std::string& path, bool unl
     if (path.empty())
         return;
 
-    auto it = m_resources.begin();
-    while (it != m_resources.end())
+    // Removals invalidate the map iteration, resources are gathered first.
+    std::vector<std::string> resourceIds;
+    for (const auto& entry : m_resources)
     {
-        auto iteResource = it;
-        ++it;
-
-        if (PathStartsWith(iteResource->second->fileInfo.GetDirectoryPath_utf8(), path))
+        if (PathStartsWith(entry.value->fileInfo.GetDirectoryPath_utf8(), path))
         {
-            RemoveResource(iteResource->first, unloadResources);
+            resourceIds.push_back(entry.value->resourceID);
         }
     }
+
+    for (const std::string& resourceId : resourceIds)
+    {
+        RemoveResource(resourceId, unloadResources);
+    }
 }
 
 Texture* ManagerResources::GetCustomTexture(const std::string& name)
@@ -702,10 +1129,14 @@ Texture* ManagerResources::GetCustomTexture(const std::string& name)
     if (name.empty())
         return nullptr;
 
-    auto iteElement = m_customTextures.find(name);
-    if (iteElement != m_customTextures.end())
+    ResourceMapKey mapKey(name);
+    if (!CheckResourceMapKey(mapKey, name))
+        return nullptr;
+
+    Texture** customTexture = m_customTextures.Find(mapKey);
+    if (customTexture)
     {
-        return (iteElement->second);
+        return *customTexture;
     }
 
     sf::Texture* newSFTexture = new sf::Texture;
@@ -713,7 +1144,7 @@ Texture* ManagerResources::GetCustomTexture(const std::string& name)
     Texture* newTexture = new Texture;
     newTexture->SetSFTexture(newSFTexture);
 
-    iteElement = m_customTextures.insert(iteElement, std::make_pair(name, newTexture));
+    m_customTextures.Insert(mapKey, newTexture);
     return newTexture;
 }
 
@@ -735,27 +1166,38 @@ Font* ManagerResources::GetDebugFont()
 void ManagerResources::GetAllResourceInfos(std::vector<const ResourceInfo*>& resourceInfos) const
 {
     resourceInfos.clear();
-    resourceInfos.reserve(m_resources.size());
+    resourceInfos.reserve(m_resources.Size());
 
-    auto iteCurrent = m_resources.begin();
-    while (iteCurrent != m_resources.end())
+    for (const auto& entry : m_resources)
     {
-        resourceInfos.push_back(iteCurrent->second);
-        ++iteCurrent;
+        resourceInfos.push_back(entry.value);
     }
+
+    // Keep a stable order, sorted by ID.
+    std::sort(resourceInfos.begin(), resourceInfos.end(), ResourceInfo::CompareID);
 }
 
 void ManagerResources::GetAllDatasheetsByType(std::string_view dataType, std::vector<Datasheet*>& datasheets)
 {
-    for (const auto& kvp : m_resources)
+    std::vector<ResourceInfo*> resourceInfos;
+    for (const auto& entry : m_resources)
     {
-        if (kvp.second->fileInfo.HasExtension(dataType))
+        if (entry.value->fileInfo.HasExtension(dataType))
         {
-            Datasheet* datasheet = GetResources()->GetDatasheet(kvp.first);
-            if (datasheet)
-            {
-                datasheets.push_back(datasheet);
-            }
+            resourceInfos.push_back(entry.value);
+        }
+    }
+
+    // Documents are parsed on the worker threads, objects are instantiated on the main thread in the gathering order.
+    // - Datasheet extensions are user defined, the type needs to be explicit (as with GetDatasheet).
+    LoadResourcesInParallel(resourceInfos, EResourceType::Datasheet);
+
+    for (ResourceInfo* resourceInfo : resourceInfos)
+    {
+        Datasheet* datasheet = GetDatasheet(resourceInfo->resourceID);
+        if (datasheet)
+        {
+            datasheets.push_back(datasheet);
         }
     }
 }
@@ -788,276 +1230,26 @@ DataObject* ManagerResources::InstanciateDataObject(std::string_view dataType)
 
 void ManagerResources::RegisterDataEnumInfos(const std::string& name, const DataEnumInfos* enumInfos)
 {
-    auto iteElement = m_dataEnumInfos.find(name);
-    if (iteElement != m_dataEnumInfos.end())
+    ResourceMapKey mapKey(name);
+    if (!CheckResourceMapKey(mapKey, name) || !m_dataEnumInfos.Insert(mapKey, enumInfos))
     {
         GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, "Data Enum already registered");
         SafeDelete(enumInfos);
     }
-    else
-    {
-        m_dataEnumInfos[name] = enumInfos;
-    }
 }
 
-const DataEnumInfos* ManagerResources::GetDataEnumInfos(const std::string& name)
+const DataEnumInfos* ManagerResources::GetDataEnumInfos(std::string_view name)
 {
-    auto iteElement = m_dataEnumInfos.find(name);
-    if (iteElement != m_dataEnumInfos.end())
+    ResourceMapKey mapKey(name);
+    const DataEnumInfos* const* enumInfos = m_dataEnumInfos.Find(mapKey);
+    if (enumInfos && CheckResourceMapKey(mapKey, name))
     {
-        return (iteElement->second);
+        return *enumInfos;
     }
 
     return nullptr;
 }
 
-void ManagerResources::RegisterResourceDependencies(Resource* resource)
-{
-    if (!m_handleResourceDependencies)
-        return;
-
-    auto it = m_resourceDependencies.find(resource);
-    if (it == m_resourceDependencies.end())
-    {
-        it = m_resourceDependencies.insert(it, std::make_pair(resource, ResourceDependencies()));
-    }
-    else
-    {
-        GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("RegisterResourceDependencies failed, Resource already registered : {0}", resource->GetID()));
-    }
-}
-
-void ManagerResources::UpdateResourceDependencies(Resource* resource)
-{
-    if (!m_handleResourceDependencies)
-        return;
-
-    auto it = m_resourceDependencies.find(resource);
-    if (it != m_resourceDependencies.end())
-    {
-        bool updatedDependencies = false;
-
-        // Gather resource dependencies.
-        if (it->second.dependencies.empty())
-        {
-            resource->GetDependencies(it->second.dependencies);
-
-            updatedDependencies = !it->second.dependencies.empty();
-        }
-        else
-        {
-            std::set<Resource*> newDependencies;
-            resource->GetDependencies(newDependencies);
-
-            // Remove resource from its previous dependencies referencers.
-            std::vector<Resource*> difference;
-            std::set_difference(it->second.dependencies.begin(), it->second.dependencies.end(),
-                newDependencies.begin(), newDependencies.end(), std::back_inserter(difference));
-
-            for (const auto& dependency : difference)
-            {
-                auto itDependency = m_resourceDependencies.find(dependency);
-                if (itDependency != m_resourceDependencies.end())
-                {
-                    itDependency->second.referencers.erase(resource);
-                }
-            }
-
-            std::swap(it->second.dependencies, newDependencies);
-
-            updatedDependencies = !difference.empty();
-        }
-
-        // Register resource to its dependencies referencers.
-        for (const auto& dependency : it->second.dependencies)
-        {
-            auto itDependency = m_resourceDependencies.find(dependency);
-            if (itDependency != m_resourceDependencies.end())
-            {
-                itDependency->second.referencers.insert(resource);
-            }
-        }
-
-        if (updatedDependencies)
-        {
-            // If dependencies changed, we need to inform referencers in case they were depending on them too.
-            for (const auto& referencer : it->second.referencers)
-            {
-                UpdateResourceDependencies(referencer);
-            }
-        }
-    }
-    else
-    {
-        GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("UpdateResourceDependencies failed, Unregistered Resource : {0}", resource->GetID()));
-    }
-}
-
-void ManagerResources::UnregisterResourceDependencies(Resource* resource)
-{
-    auto it = m_resourceDependencies.find(resource);
-    if (it != m_resourceDependencies.end())
-    {
-        // Remove resource from its dependencies referencers.
-        for (const auto& dependency : it->second.dependencies)
-        {
-            auto itDependency = m_resourceDependencies.find(dependency);
-            if (itDependency != m_resourceDependencies.end())
-            {
-                itDependency->second.referencers.erase(resource);
-            }
-        }
-
-        // Remove resource from its referencers dependencies.
-        for (const auto& referencer : it->second.referencers)
-        {
-            auto itReferencer = m_resourceDependencies.find(referencer);
-            if (itReferencer != m_resourceDependencies.end())
-            {
-                itReferencer->second.dependencies.erase(resource);
-            }
-        }
-
-        // Remove resource from cache.
-        m_resourceDependencies.erase(it);
-    }
-}
-
-bool ManagerResources::RegisterResourceListener(const Resource* resource, const Handle& handle, const DelegateResourceEvent& delegateResourceEvent)
-{
-    if (!resource || !handle.IsValid())
-        return false;
-
-    auto it = m_resourceDependencies.find(resource);
-    if (it != m_resourceDependencies.end())
-    {
-        ResourceListener resourceListener;
-        resourceListener.handle = handle;
-        resourceListener.delegateResourceEvent = delegateResourceEvent;
-
-        it->second.listeners.push_back(resourceListener);
-        return true;
-    }
-    else
-    {
-        GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("RegisterResourceListener failed, Resource not loaded : {0}", resource->GetID()));
-        return false;
-    }
-}
-
-void ManagerResources::UnregisterResourceListeners(const Resource* resource, const Handle& handle)
-{
-    auto it = m_resourceDependencies.find(resource);
-    if (it != m_resourceDependencies.end())
-    {
-        size_t i = 0;
-        while (i < it->second.listeners.size())
-        {
-            if (it->second.listeners[i].handle == handle)
-            {
-                StdVectorRemoveAt(it->second.listeners, i);
-            }
-            else
-            {
-                ++i;
-            }
-        }
-    }
-}
-
-void ManagerResources::UnregisterResourceListeners(const Handle& handle)
-{
-    // Remove all listeners originating from this handle.
-    for (auto& kvp : m_resourceDependencies)
-    {
-        size_t i = 0;
-        while (i < kvp.second.listeners.size())
-        {
-            if (kvp.second.listeners[i].handle == handle)
-            {
-                StdVectorRemoveAt(kvp.second.listeners, i);
-            }
-            else
-            {
-                ++i;
-            }
-        }
-    }
-}
-
-void ManagerResources::NotifyResourceUpdated(const Resource* resource)
-{
-    auto it = m_resourceDependencies.find(resource);
-    if (it != m_resourceDependencies.end())
-    {
-        // Notify referencers that a dependency has been updated.
-        std::set<Resource*> referencers = it->second.referencers;
-        for (const auto& referencer : referencers)
-        {
-            referencer->OnDependencyUpdated(resource);
-        }
-
-        for (const auto& referencer : referencers)
-        {
-            auto itReferencer = m_resourceDependencies.find(referencer);
-            if (itReferencer != m_resourceDependencies.end())
-            {
-                std::vector<ResourceListener> listeners = itReferencer->second.listeners;
-                for (const auto& resourceListener : listeners)
-                {
-                    resourceListener.delegateResourceEvent(referencer, EResourceEvent::DependencyUpdated, resource);
-                }
-            }
-        }
-
-        // Notify the resource itself being updated.
-        std::vector<ResourceListener> listeners = it->second.listeners;
-        for (const auto& resourceListener : listeners)
-        {
-            resourceListener.delegateResourceEvent(resource, EResourceEvent::ResourceUpdated, nullptr);
-        }
-    }
-}
-
-void ManagerResources::NotifyResourceRemoved(const Resource* resource)
-{
-    auto it = m_resourceDependencies.find(resource);
-    if (it != m_resourceDependencies.end())
-    {
-        // Notify referencers that a dependency has been removed.
-        std::set<Resource*> referencers = it->second.referencers;
-        for (const auto& referencer : referencers)
-        {
-            referencer->OnDependencyRemoved(resource);
-        }
-
-        for (const auto& referencer : referencers)
-        {
-            auto itReferencer = m_resourceDependencies.find(referencer);
-            if (itReferencer != m_resourceDependencies.end())
-            {
-                std::vector<ResourceListener> listeners = itReferencer->second.listeners;
-                for (const auto& resourceListener : listeners)
-                {
-                    resourceListener.delegateResourceEvent(referencer, EResourceEvent::DependencyRemoved, resource);
-                }
-            }
-        }
-
-        // Notify the resource itself being removed.
-        std::vector<ResourceListener> listeners = it->second.listeners;
-        for (const auto& resourceListener : listeners)
-        {
-            resourceListener.delegateResourceEvent(resource, EResourceEvent::ResourceRemoved, nullptr);
-        }
-    }
-}
-
-const std::map<const Resource*, ManagerResources::ResourceDependencies>& ManagerResources::GetResourceDependencies() const
-{
-    return m_resourceDependencies;
-}
-
 ManagerResources* GetResources()
 {
     return GetEngine()->GetManagerResources();
@@ -5,7 +5,8 @@
 
 #include "Gugu/System/Callback.h"
 #include "Gugu/System/Types.h"
-//#include "Gugu/System/Hash.h"
+#include "Gugu/System/Hash.h"
+#include "Gugu/System/HashMap.h"
 #include "Gugu/System/FileInfo.h"
 #include "Gugu/System/Handle.h"
 #include "Gugu/Resources/EnumsResources.h"
@@ -13,6 +14,8 @@
 #include <map>
 #include <vector>
 #include <set>
+#include <mutex>
+#include <condition_variable>
 
 ////////////////////////////////////////////////////////////////
 // Forward Declarations
@@ -20,6 +23,9 @@
 namespace gugu
 {
     class ResourceInfo;
+    class ResourceArchive;
+    struct ResourceArchiveEntry;
+    class ResourceRef;
     class Resource;
     class Texture;
     class Font;
@@ -34,6 +40,8 @@ namespace gugu
     class DatasheetObject;
     class ElementWidget;
     class LocalizationTable;
+    class PreloadManifest;
+    struct PreloadManifestEntry;
     struct DataEnumInfos;
     struct EngineConfig;
 }
@@ -43,12 +51,19 @@ namespace gugu
 
 namespace gugu {
 
+// The implementation is split by subsystem : archives and cooking, resource cache, async loads, prefetches, residency,
+// texture streaming and dependencies each have their own ManagerResources*.cpp file.
 class ManagerResources
 {
+    friend class ResourceRef;
+    friend class Texture;
+
 public:
 
     using DelegateDataObjectFactory = std::function<DataObject* (std::string_view)>;
     using DelegateResourceEvent = std::function<void(const Resource* resource, EResourceEvent event, const Resource* dependency)>;    // TODO: Is dependency reference necessary ?
+    using DelegateResourceLoaded = std::function<void(Resource* resource)>;
+    using DelegatePrefetchProgress = std::function<void(size_t loadedCount, size_t resourceCount)>;
 
     struct ResourceListener
     {
@@ -56,13 +71,51 @@ public:
         DelegateResourceEvent delegateResourceEvent = nullptr;
     };
 
+    // Node of the dependencies graph, nodes are stored contiguously and referenced by their index.
     struct ResourceDependencies
     {
-        std::set<Resource*> dependencies;
-        std::set<Resource*> referencers;
+        Resource* resource = nullptr;           // Null for unused nodes.
+        std::vector<uint32> dependencies;       // Sorted node indices.
+        std::vector<uint32> referencers;        // Node indices.
         std::vector<ResourceListener> listeners;
     };
 
+    struct ResidencyStats
+    {
+        size_t memoryBudget = 0;
+        size_t residentMemory = 0;          // Measured during the last eviction pass.
+        size_t residentResourceCount = 0;   // Measured during the last eviction pass.
+        size_t evictedResourceCount = 0;
+        size_t evictedMemory = 0;
+    };
+
+    struct TextureStreamingStats
+    {
+        size_t memoryBudget = 0;
+        size_t streamedTextureCount = 0;
+        size_t fullResolutionTextureCount = 0;  // Measured during the last streaming pass.
+        size_t fullResolutionMemory = 0;        // Measured during the last streaming pass (includes pending loads).
+        size_t pendingLoadCount = 0;            // Measured during the last streaming pass.
+        size_t droppedTextureCount = 0;
+    };
+
+    struct ResourceCacheStats
+    {
+        size_t loadedEntryCount = 0;        // Entries read from the cache file.
+        size_t restoredEntryCount = 0;      // Entries applied to parsed resources.
+        size_t invalidatedEntryCount = 0;   // Entries ignored because their file has been modified.
+        size_t recordedEntryCount = 0;      // Entries added or modified by resource loads.
+    };
+
+    struct PrefetchStats
+    {
+        size_t prefetchedResourceCount = 0;     // Resources loaded by a prefetch.
+        size_t avoidedHitchCount = 0;           // Prefetched resources accessed once loaded, instead of being loaded on demand.
+        size_t onDemandLoadCount = 0;           // Resources loaded on the main thread when accessed (potential hitches).
+        float onDemandLoadTimeMs = 0.f;
+        float maxOnDemandLoadTimeMs = 0.f;
+    };
+
 public:
 
     ManagerResources();
@@ -80,7 +133,29 @@ public:
     bool GetResourceFileInfo(const std::string& resourceId, FileInfo& fileInfo) const;
     const FileInfo& GetResourceFileInfo(const std::string& resourceId) const;
 
+    // Directories are scanned and files are classified on the worker threads, registration is done on the calling thread.
     bool ParseDirectory(std::string_view rootPath_utf8);
+
+    // Register all the resources packed in an archive, with virtual paths in the assets directory.
+    // - The archive stays mapped in memory until the manager is released.
+    bool MountArchive(const std::string& archivePath_utf8);
+
+    // Cook all the xml resources contained in a directory into a binary form, written next to their source file.
+    // - Cooked files are used at load time instead of the xml files, unless they are older than their source file.
+    bool CookResources(std::string_view rootPath_utf8);
+    void RemoveCookedResources(std::string_view rootPath_utf8);
+
+    // The resource cache persists the types and dependencies of loaded resources between runs, keyed by file path.
+    // - Entries are restored during ParseDirectory when their file modification time and size are unchanged.
+    // - Restored types allow datasheets to be identified without reading their file.
+    // - Restored dependencies are used to order PreloadAll, and to prefetch the dependencies of asynchronous loads.
+    // - The cache is saved during Release if it has been modified, only entries of registered resources are kept.
+    bool LoadResourceCache(const std::string& cachePath_utf8);
+    bool SaveResourceCache();
+    const ResourceCacheStats& GetResourceCacheStats() const;
+
+    // Load all the registered resources : files are read and decoded on the worker threads, and finalized on the main thread.
+    // - Finalization follows the resource types dependency order (textures before imagesets, imagesets before animsets, etc).
     void PreloadAll();
     void SaveAll();
 
@@ -97,6 +172,7 @@ public:
     Datasheet* GetDatasheet(const std::string& resourceId);
     ElementWidget* GetElementWidget(const std::string& resourceId);
     LocalizationTable* GetLocalizationTable(const std::string& resourceId);
+    PreloadManifest* GetPreloadManifest(const std::string& resourceId);
 
     template<typename T>
     const T* GetDatasheetObject(const std::string& resourceId)
@@ -108,6 +184,68 @@ public:
     bool LoadResource(const std::string& resourceId, EResourceType::Type explicitType = EResourceType::Unknown);
     bool InjectResource(const std::string& resourceId, Resource* resource);
 
+    // Asynchronous loads will read and decode files on worker threads, then finalize the resources on the main thread.
+    // - The finalization is done during ProcessAsyncLoads, called by the engine loop, and limited by maxAsyncLoadTimePerLoopMs.
+    // - The delegate is called from the main thread once the resource is loaded (immediately if it was already loaded).
+    // - Getting a resource while its asynchronous load is pending will complete the load immediately.
+    Handle LoadResourceAsync(const std::string& resourceId, const DelegateResourceLoaded& delegateResourceLoaded = nullptr, EResourceType::Type explicitType = EResourceType::Unknown);
+    bool IsAsyncLoadPending(const Handle& loadHandle) const;
+    size_t GetPendingAsyncLoadCount() const;
+    void ProcessAsyncLoads();
+    void CompleteAsyncLoads();
+
+    // LocalizationTables only keep the texts of the localization language (all languages are kept if the language is empty).
+    // - Changing the language reloads the loaded tables on the worker threads, the previous texts are used until the reload is finalized.
+    // - The finalization is done during ProcessAsyncLoads, CompleteAsyncLoads will wait for pending reloads.
+    void SetLocalizationLanguage(const std::string& languageCode);
+    const std::string& GetLocalizationLanguage() const;
+    bool IsLocalizationLanguagePending() const;
+
+    // Prefetches load a list of resources asynchronously ahead of their use (before a scene switch for instance).
+    // - The delegate is called from the main thread each time one of the resources is loaded (or failed to load).
+    // - Prefetched resources accessed afterwards are counted as avoided hitches, resources loaded on demand are measured as potential hitches.
+    Handle PrefetchResources(const std::vector<PreloadManifestEntry>& entries, const DelegatePrefetchProgress& delegatePrefetchProgress = nullptr);
+    Handle PrefetchManifest(const std::string& manifestId, const DelegatePrefetchProgress& delegatePrefetchProgress = nullptr);
+    bool IsPrefetchPending(const Handle& prefetchHandle) const;
+    float GetPrefetchProgress(const Handle& prefetchHandle) const;  // Completed prefetches return 1.
+    const PrefetchStats& GetPrefetchStats() const;
+    void ResetPrefetchStats();
+
+    // Record the resources loaded from their file (in load order), to generate a preload manifest from a play session.
+    void StartLoadsRecording();
+    void StopLoadsRecording(std::vector<PreloadManifestEntry>& entries);
+    bool IsRecordingLoads() const;
+
+    // When the resident memory exceeds the budget, unreferenced resources are unloaded in least recently used order.
+    // - Pointers returned by a ResourceRef should not be kept after its release.
+    // - Each raw pointer returned by GetResource, GetTexture (and the other Get* accessors) or a LoadResourceAsync delegate pins the resource.
+    // - A pin is released by ReleaseResource, holders keeping their pointer for the application lifetime don't need to release it.
+    // - A resource is referenced while a ResourceRef holds its ID, while it is pinned, or while another loaded resource depends on it.
+    // - Only resources loaded from their file are evicted, they will be reloaded on their next access.
+    // - ProcessEvictions is called by the engine loop, a budget of zero disables the eviction.
+    void SetMemoryBudget(size_t memoryBudget);
+    size_t GetMemoryBudget() const;
+    uint32 GetResourceRefCount(const std::string& resourceId) const;
+    void ReleaseResource(const std::string& resourceId);
+    uint32 GetResourcePinCount(const std::string& resourceId) const;
+    const ResidencyStats& GetResidencyStats() const;
+    void ProcessEvictions();
+
+    // Textures with a dimension reaching textureStreamingMinSize are streamed, only their downscaled fallback is loaded at first.
+    // - The fallback is read from the cooked texture file when available, or generated when the texture is loaded.
+    // - The full resolution is decoded on the worker threads when the texture is rendered at a scale requiring it.
+    // - The full resolution is dropped once the texture has not been rendered for textureStreamingDropDelayMs.
+    // - Full resolutions are kept within the streaming budget, least recently rendered textures are dropped first.
+    // - ProcessTextureStreaming is called by the engine loop, a budget of zero disables the limit.
+    // - Changing the min size only applies to textures loaded afterwards, a min size of zero disables the streaming.
+    void SetTextureStreamingMinSize(unsigned int minSize);
+    unsigned int GetTextureStreamingMinSize() const;
+    void SetTextureStreamingDropDelay(int dropDelayMs);
+    void SetTextureStreamingBudget(size_t memoryBudget);
+    size_t GetTextureStreamingBudget() const;
+    const TextureStreamingStats& GetTextureStreamingStats() const;
+    void ProcessTextureStreaming();
+
     // TODO: Obsolete editor getters ?
     const std::string& GetResourceID(const Resource* resource) const;
     const std::string& GetResourceID(const FileInfo& fileInfo) const;
@@ -125,6 +263,7 @@ public:
     void RemoveResourcesFromPath(const std::string& path, bool unloadResources);
 
     void GetAllResourceInfos(std::vector<const ResourceInfo*>& resourceInfos) const;
+    // Datasheets of the given type are loaded in parallel (see PreloadAll).
     void GetAllDatasheetsByType(std::string_view dataType, std::vector<Datasheet*>& datasheets);
 
     //TODO: Refactor with ResourceContext
@@ -139,32 +278,125 @@ public:
     DataObject* InstanciateDataObject(std::string_view dataType);
 
     void RegisterDataEnumInfos(const std::string& name, const DataEnumInfos* enumInfos);
-    const DataEnumInfos* GetDataEnumInfos(const std::string& name);
+    const DataEnumInfos* GetDataEnumInfos(std::string_view name);
 
     bool RegisterResourceListener(const Resource* resource, const Handle& handle, const DelegateResourceEvent& delegateResourceEvent);
     void UnregisterResourceListeners(const Resource* resource, const Handle& handle);
     void UnregisterResourceListeners(const Handle& handle);
 
+    // Dependencies tracking can be toggled at runtime (see EngineConfig::handleResourceDependencies).
+    // - Enabling it registers the resources already loaded, disabling it clears the graph along with its listeners.
+    void SetHandleResourceDependencies(bool handleResourceDependencies);
+    bool IsHandlingResourceDependencies() const;
+
+    // Dependencies are refreshed incrementally, referencers are only refreshed when the resource dependencies changed.
     void UpdateResourceDependencies(Resource* resource);
-    const std::map<const Resource*, ResourceDependencies>& GetResourceDependencies() const;
+    const std::vector<ResourceDependencies>& GetResourceDependencies() const;
+    const ResourceDependencies* FindResourceDependencies(const Resource* resource) const;
 
     void NotifyResourceUpdated(const Resource* resource);
 
 private:
 
+    struct AsyncLoadRequest
+    {
+        uint64 id = 0;
+        ResourceInfo* resourceInfo = nullptr;
+        Resource* resource = nullptr;
+        std::vector<DelegateResourceLoaded> delegates;
+        bool prefetch = false;
+        uint32 pinCount = 0;    // Delegates receiving the resource pointer (internal prefetch delegates don't).
+        bool prepared = false;  // Protected by m_mutexAsyncLoads.
+    };
+
+    struct TextureStreamingRequest
+    {
+        Texture* texture = nullptr;
+        bool prepared = false;  // Protected by m_mutexAsyncLoads.
+    };
+
+    struct StreamedTexture
+    {
+        Texture* texture = nullptr;
+        TextureStreamingRequest* request = nullptr;
+        bool requestPrepared = false;
+        float lastRenderTime = 0.f;
+    };
+
+    struct PrefetchRequest
+    {
+        size_t resourceCount = 0;
+        size_t loadedCount = 0;
+        bool queuing = false;   // Prevents the completion while the resources are being queued.
+        DelegatePrefetchProgress delegatePrefetchProgress;
+    };
+
+    struct ResourceCacheEntry
+    {
+        std::string resourceId;
+        std::string filePath;
+        int64 fileTime = 0;
+        uint64 fileSize = 0;
+        EResourceType::Type resourceType = EResourceType::Unknown;
+        std::vector<std::string> dependencies;  // Sorted resource IDs.
+    };
+
+private:
+
+    using ResourceMapKey = Hash;
+
+private:
+
+    ResourceInfo* FindResourceInfo(const std::string& resourceId) const;
+    ResourceInfo* FindResourceInfo(const ResourceMapKey& mapKey, const std::string& resourceId) const;
+    bool CheckResourceMapKey(const ResourceMapKey& mapKey, std::string_view name) const;
+    bool RegisterResourceInfo(const std::string& resourceId, const ResourceMapKey& mapKey, const FileInfo& fileInfo, EResourceType::Type resourceType);
+    bool RegisterCookedFile(const std::string& cookedResourceId, const FileInfo& cookedFileInfo, const ResourceArchiveEntry* cookedArchiveEntry);
+    void InvalidateResourceRefs();
+
+    void AcquireResourceRef(const ResourceMapKey& mapKey);
+    void ReleaseResourceRef(const ResourceMapKey& mapKey);
+    void EvictResource(ResourceInfo* resourceInfo);
+
+    void RegisterStreamedTexture(Texture* texture);
+    void UnregisterStreamedTexture(Texture* texture);
+    void StopTextureStreaming(Texture* texture);
+    void QueueTextureStreamingRequest(StreamedTexture& streamedTexture);
+    bool ReserveTextureStreamingMemory(size_t& residentMemory, size_t requiredMemory, float currentTime);
+
+    bool RecordLoadResult(ResourceInfo* resourceInfo, bool loaded);
+    void RestoreResourceCacheEntry(ResourceInfo* resourceInfo);
+    void RecordResourceCacheEntry(ResourceInfo* resourceInfo);
+    uint32 GetCachedDependencyDepth(const ResourceInfo* resourceInfo, std::map<const ResourceInfo*, uint32>& depths) const;
+    void PrefetchCachedDependencies(const ResourceInfo* resourceInfo, size_t depth);
+    void RestoreCachedDependencies(const std::vector<ResourceInfo*>& resourceInfos);
+
+    void OnPrefetchResourceLoaded(const Handle& prefetchHandle);
+    void OnPrefetchedResourceAccessed(ResourceInfo* resourceInfo);
+    void RecordLoad(const ResourceInfo* resourceInfo);
+
+    Resource* InstanciateResource(EResourceType::Type resourceType, const FileInfo& fileInfo) const;
     Resource* LoadResource(ResourceInfo* resourceInfo, EResourceType::Type explicitType = EResourceType::Unknown);
 
+    Handle RequestAsyncLoad(const std::string& resourceId, const DelegateResourceLoaded& delegateResourceLoaded, EResourceType::Type explicitType, bool sharePointer);
+    AsyncLoadRequest* QueueAsyncLoad(ResourceInfo* resourceInfo, EResourceType::Type explicitType);
+    AsyncLoadRequest* FindAsyncLoadRequest(const ResourceInfo* resourceInfo) const;
+    bool CompleteAsyncLoad(const ResourceInfo* resourceInfo);
+    void FinalizeAsyncLoad(AsyncLoadRequest* request);
+    void LoadResourcesInParallel(const std::vector<ResourceInfo*>& resourceInfos, EResourceType::Type explicitType);
+
+    void ProcessLocalizationLanguage(bool waitPendingLoads);
+
     const DatasheetObject* GetDatasheetRootObject(const std::string& resourceId);
 
     void RegisterResourceDependencies(Resource* resource);
     void UnregisterResourceDependencies(Resource* resource);
+    size_t GetDependencyNodeIndex(const Resource* resource) const;
+    bool RefreshDependencyNode(size_t nodeIndex);
     void NotifyResourceRemoved(const Resource* resource);
 
 private:
 
-    //typedef Hash ResourceMapKey;
-    typedef std::string ResourceMapKey;
-
     std::string m_pathAssets;
     std::string m_pathScreenshots;
     std::string m_defaultFont;
@@ -173,13 +405,57 @@ private:
     bool m_defaultTextureSmooth;
     bool m_handleResourceDependencies;
 
-    std::map<ResourceMapKey, ResourceInfo*> m_resources;
-    std::map<ResourceMapKey, Texture*> m_customTextures;
+    HashMap<ResourceInfo*> m_resources;
+    HashMap<Texture*> m_customTextures;
+    uint32 m_resourceInfosGeneration;   // Incremented when ResourceInfos are removed or moved, to invalidate ResourceRefs.
 
-    std::vector<DelegateDataObjectFactory> m_dataObjectFactories;
-    std::map<ResourceMapKey, const DataEnumInfos*> m_dataEnumInfos;
+    HashMap<uint32> m_resourceRefCounts;    // Counted by resource ID, refs may outlive their ResourceInfo.
+    uint32 m_residencyTick;
+    ResidencyStats m_residencyStats;
+
+    unsigned int m_textureStreamingMinSize;
+    float m_textureStreamingDropDelay;
+    TextureStreamingStats m_textureStreamingStats;
+    std::vector<StreamedTexture> m_streamedTextures;
 
-    std::map<const Resource*, ResourceDependencies> m_resourceDependencies;
+    std::string m_resourceCachePath;
+    HashMap<ResourceCacheEntry> m_resourceCacheEntries;     // Keyed by file path.
+    bool m_resourceCacheDirty;
+    ResourceCacheStats m_resourceCacheStats;
+
+    std::vector<DelegateDataObjectFactory> m_dataObjectFactories;
+    HashMap<const DataEnumInfos*> m_dataEnumInfos;
+
+#if defined(GUGU_DEBUG)
+    mutable std::map<ResourceMapKey, std::string> m_debugMapKeyNames;  // Used to detect hash collisions.
+#endif
+
+    std::vector<ResourceDependencies> m_dependencyNodes;
+    std::vector<uint32> m_freeDependencyNodes;
+    std::vector<uint32> m_dependencyNodeStamps;     // Used to refresh each node once per update.
+    uint32 m_dependencyUpdateStamp;
+    std::vector<uint32> m_dependencyWorklist;       // Kept to avoid allocations between updates.
+    std::vector<uint32> m_dependencyScratch;        // Kept to avoid allocations between updates.
+
+    std::vector<ResourceArchive*> m_archives;
+
+    int m_maxAsyncLoadTimePerLoopMs;
+    uint64 m_nextAsyncLoadId;
+    std::map<uint64, AsyncLoadRequest*> m_asyncLoadRequests;     // Sorted by id (submission order).
+    std::map<const ResourceInfo*, AsyncLoadRequest*> m_asyncLoadRequestsByResource;
+    uint64 m_nextPrefetchId;
+    std::map<Handle, PrefetchRequest> m_prefetchRequests;
+    PrefetchStats m_prefetchStats;
+    uint32 m_onDemandLoadDepth;         // Nested loads of dependencies are measured with their referencer.
+
+    bool m_recordingLoads;
+    std::vector<PreloadManifestEntry> m_recordedLoads;
+    HashMap<bool> m_recordedLoadIds;
+    std::mutex m_mutexAsyncLoads;
+    std::condition_variable m_conditionAsyncLoadPrepared;
+
+    std::string m_localizationLanguage;
+    std::vector<std::string> m_pendingLocalizationTableIds;
 };
 
 ManagerResources* GetResources();
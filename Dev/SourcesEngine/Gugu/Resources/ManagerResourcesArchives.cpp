@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////////
+// Header
+
+#include "Gugu/Common.h"
+#include "Gugu/Resources/ManagerResources.h"
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/Resources/ResourceInfo.h"
+#include "Gugu/Resources/ResourceArchive.h"
+#include "Gugu/Resources/Texture.h"
+#include "Gugu/System/Path.h"
+#include "Gugu/System/Platform.h"
+#include "Gugu/System/String.h"
+#include "Gugu/Debug/Logger.h"
+#include "Gugu/External/PugiXmlUtility.h"
+
+////////////////////////////////////////////////////////////////
+// File Implementation
+
+namespace gugu {
+
+bool ManagerResources::MountArchive(const std::string& archivePath_utf8)
+{
+    GetLogEngine()->Print(ELog::Info, ELogEngine::Resources, "Mounting Resources Archive...");
+    GetLogEngine()->Print(ELog::Info, ELogEngine::Resources, StringFormat("Archive : {0}", archivePath_utf8));
+
+    ResourceArchive* archive = new ResourceArchive;
+    if (!archive->Open(archivePath_utf8))
+    {
+        SafeDelete(archive);
+        return false;
+    }
+
+    m_archives.push_back(archive);
+
+    std::vector<std::pair<std::string, const ResourceArchiveEntry*>> cookedEntries;
+
+    size_t fileCount = 0;
+    for (size_t i = 0; i < archive->GetEntryCount(); ++i)
+    {
+        const ResourceArchiveEntry* entry = archive->GetEntry(i);
+
+        // Resource IDs follow the same policy as ParseDirectory on the assets directory.
+        FileInfo fileInfos = FileInfo::FromString_utf8(CombinePaths(m_pathAssets, archive->GetEntryPath(entry)));
+        std::string resourceId = (!m_useFullPath) ? std::string(fileInfos.GetFileName_utf8()) : std::string(fileInfos.GetFilePath_utf8().substr(m_pathAssets.length()));
+
+        if (fileInfos.HasExtension(resources::CookedFileExtension))
+        {
+            cookedEntries.push_back(std::make_pair(resourceId, entry));
+        }
+        else if (RegisterResourceInfo(resourceId, fileInfos))
+        {
+            ResourceInfo* resourceInfo = FindResourceInfo(resourceId);
+            resourceInfo->archive = archive;
+            resourceInfo->archiveEntry = entry;
+
+            ++fileCount;
+        }
+    }
+
+    for (const auto& cookedEntry : cookedEntries)
+    {
+        FileInfo cookedFileInfo = FileInfo::FromString_utf8(CombinePaths(m_pathAssets, archive->GetEntryPath(cookedEntry.second)));
+        RegisterCookedFile(cookedEntry.first, cookedFileInfo, cookedEntry.second);
+    }
+
+    GetLogEngine()->Print(ELog::Info, ELogEngine::Resources, StringFormat("Finished Mounting Resources Archive (Found {0})", fileCount));
+    return true;
+}
+
+bool ManagerResources::RegisterCookedFile(const std::string& cookedResourceId, const FileInfo& cookedFileInfo, const ResourceArchiveEntry* cookedArchiveEntry)
+{
+    // The cooked file is named after its source file, with an additional extension.
+    size_t extensionSize = resources::CookedFileExtension.size() + 1;
+    std::string resourceId = cookedResourceId.substr(0, cookedResourceId.size() - extensionSize);
+
+    ResourceInfo* resourceInfo = FindResourceInfo(resourceId);
+    if (!resourceInfo || resourceInfo->GetCookedFilePath_utf8() != cookedFileInfo.GetFilePath_utf8())
+    {
+        GetLogEngine()->Print(ELog::Warning, ELogEngine::Resources, StringFormat("Cooked resource file ignored, no matching source file : {0}", cookedFileInfo.GetFilePath_utf8()));
+        return false;
+    }
+
+    if (!cookedArchiveEntry && IsFileNewer(resourceInfo->fileInfo.GetFilePath_utf8(), cookedFileInfo.GetFilePath_utf8()))
+    {
+        GetLogEngine()->Print(ELog::Warning, ELogEngine::Resources, StringFormat("Cooked resource file ignored, the source file is more recent : {0}", cookedFileInfo.GetFilePath_utf8()));
+        return false;
+    }
+
+    resourceInfo->hasCookedFile = true;
+    resourceInfo->cookedArchiveEntry = cookedArchiveEntry;
+    return true;
+}
+
+bool ManagerResources::CookResources(std::string_view rootPath_utf8)
+{
+    GetLogEngine()->Print(ELog::Info, ELogEngine::Resources, "Cooking Resources...");
+    GetLogEngine()->Print(ELog::Info, ELogEngine::Resources, StringFormat("Root directory : {0}", rootPath_utf8));
+
+    size_t cookedCount = 0;
+    size_t failedCount = 0;
+
+    for (const auto& entry : m_resources)
+    {
+        ResourceInfo* resourceInfo = entry.value;
+        if (resourceInfo->archive || !PathStartsWith(resourceInfo->fileInfo.GetFilePath_utf8(), rootPath_utf8))
+            continue;
+
+        EResourceType::Type resourceType = GetResourceType(resourceInfo->fileInfo);
+        if (resourceType == EResourceType::Font
+            || resourceType == EResourceType::AudioClip)
+            continue;
+
+        std::vector<uint8> cookedData;
+
+        if (resourceType == EResourceType::Texture)
+        {
+            // Large textures are cooked with their streaming fallback.
+            if (!Texture::CookTextureFile(resourceInfo->fileInfo, cookedData))
+                continue;
+        }
+        else
+        {
+            // Any file parsed as a valid xml document will be cooked (this includes datasheets, which are not identified by their extension).
+            pugi::xml_document document;
+            if (!document.load_file(resourceInfo->fileInfo.GetFileSystemPath().c_str()) || !document.document_element())
+                continue;
+
+            xml::SaveDocumentToBinary(document, cookedData);
+        }
+
+        if (!WriteFileContent(resourceInfo->GetCookedFilePath_utf8(), cookedData))
+        {
+            GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("Cooked resource file could not be written : {0}", resourceInfo->GetCookedFilePath_utf8()));
+            ++failedCount;
+            continue;
+        }
+
+        resourceInfo->hasCookedFile = true;
+        resourceInfo->cookedArchiveEntry = nullptr;
+        ++cookedCount;
+    }
+
+    GetLogEngine()->Print(ELog::Info, ELogEngine::Resources, StringFormat("Finished Cooking Resources (Cooked {0}, Failed {1})", cookedCount, failedCount));
+    return failedCount == 0;
+}
+
+void ManagerResources::RemoveCookedResources(std::string_view rootPath_utf8)
+{
+    for (const auto& entry : m_resources)
+    {
+        ResourceInfo* resourceInfo = entry.value;
+        if (resourceInfo->hasCookedFile && !resourceInfo->cookedArchiveEntry && PathStartsWith(resourceInfo->fileInfo.GetFilePath_utf8(), rootPath_utf8))
+        {
+            resourceInfo->hasCookedFile = false;
+        }
+    }
+
+    std::vector<FileInfo> files;
+    GetFiles(rootPath_utf8, files, true);
+
+    for (const FileInfo& fileInfo : files)
+    {
+        if (fileInfo.HasExtension(resources::CookedFileExtension))
+        {
+            RemoveFile(fileInfo.GetFilePath_utf8());
+        }
+    }
+}
+
+}   // namespace gugu
@@ -0,0 +1,274 @@
+////////////////////////////////////////////////////////////////
+// Header
+
+#include "Gugu/Common.h"
+#include "Gugu/Resources/ManagerResources.h"
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/Engine.h"
+#include "Gugu/Resources/ResourceInfo.h"
+#include "Gugu/Resources/Resource.h"
+#include "Gugu/System/String.h"
+#include "Gugu/System/ThreadPool.h"
+#include "Gugu/Debug/Logger.h"
+#include "Gugu/Debug/Trace.h"
+
+#include <SFML/System/Clock.hpp>
+
+#include <algorithm>
+
+////////////////////////////////////////////////////////////////
+// File Implementation
+
+namespace gugu {
+
+void ManagerResources::LoadResourcesInParallel(const std::vector<ResourceInfo*>& resourceInfos, EResourceType::Type explicitType)
+{
+    // Resources are queued on the worker threads with a limited window, to bound the memory used by prepared resources.
+    ThreadPool* threadPool = GetEngine()->GetThreadPool();
+    size_t maxQueuedCount = (threadPool ? threadPool->GetThreadCount() : 0) * 4 + 1;
+
+    size_t queuedIndex = 0;
+    for (size_t finalizedIndex = 0; finalizedIndex < resourceInfos.size(); ++finalizedIndex)
+    {
+        while (queuedIndex < resourceInfos.size() && queuedIndex - finalizedIndex < maxQueuedCount)
+        {
+            ResourceInfo* resourceInfo = resourceInfos[queuedIndex++];
+            if (!resourceInfo->resource && !FindAsyncLoadRequest(resourceInfo))
+            {
+                QueueAsyncLoad(resourceInfo, explicitType);
+            }
+        }
+
+        // The resource may have already been loaded as a dependency of another resource.
+        CompleteAsyncLoad(resourceInfos[finalizedIndex]);
+    }
+
+    RestoreCachedDependencies(resourceInfos);
+}
+
+Handle ManagerResources::LoadResourceAsync(const std::string& resourceId, const DelegateResourceLoaded& delegateResourceLoaded, EResourceType::Type explicitType)
+{
+    return RequestAsyncLoad(resourceId, delegateResourceLoaded, explicitType, delegateResourceLoaded != nullptr);
+}
+
+Handle ManagerResources::RequestAsyncLoad(const std::string& resourceId, const DelegateResourceLoaded& delegateResourceLoaded, EResourceType::Type explicitType, bool sharePointer)
+{
+    if (resourceId.empty())
+        return Handle();
+
+    ResourceInfo* resourceInfo = FindResourceInfo(resourceId);
+    if (!resourceInfo)
+    {
+        GetLogEngine()->Print(ELog::Warning, ELogEngine::Resources, StringFormat("LoadResourceAsync failed, unknown resource : {0}", resourceId));
+
+        if (delegateResourceLoaded)
+            delegateResourceLoaded(nullptr);
+
+        return Handle();
+    }
+
+    if (resourceInfo->resource)
+    {
+        if (sharePointer)
+        {
+            ++resourceInfo->pinCount;
+        }
+
+        if (delegateResourceLoaded)
+            delegateResourceLoaded(resourceInfo->resource);
+
+        return Handle();
+    }
+
+    if (AsyncLoadRequest* pendingRequest = FindAsyncLoadRequest(resourceInfo))
+    {
+        pendingRequest->pinCount += sharePointer ? 1 : 0;
+
+        if (delegateResourceLoaded)
+            pendingRequest->delegates.push_back(delegateResourceLoaded);
+
+        return Handle(pendingRequest->id);
+    }
+
+    // Dependencies known from the resource cache are prepared on the worker threads alongside the resource.
+    PrefetchCachedDependencies(resourceInfo, 0);
+
+    AsyncLoadRequest* request = QueueAsyncLoad(resourceInfo, explicitType);
+    if (!request)
+    {
+        if (delegateResourceLoaded)
+            delegateResourceLoaded(nullptr);
+
+        return Handle();
+    }
+
+    request->pinCount = sharePointer ? 1 : 0;
+
+    if (delegateResourceLoaded)
+        request->delegates.push_back(delegateResourceLoaded);
+
+    return Handle(request->id);
+}
+
+ManagerResources::AsyncLoadRequest* ManagerResources::QueueAsyncLoad(ResourceInfo* resourceInfo, EResourceType::Type explicitType)
+{
+    Resource* resource = InstanciateResource(explicitType != EResourceType::Unknown ? explicitType : resourceInfo->resourceType, resourceInfo->fileInfo);
+    if (!resource)
+        return nullptr;
+
+    resource->Init(resourceInfo);
+
+    AsyncLoadRequest* request = new AsyncLoadRequest;
+    request->id = ++m_nextAsyncLoadId;
+    request->resourceInfo = resourceInfo;
+    request->resource = resource;
+
+    m_asyncLoadRequests.insert(std::make_pair(request->id, request));
+    m_asyncLoadRequestsByResource.insert(std::make_pair(resourceInfo, request));
+
+    // The request will stay alive until its finalization on the main thread, which can only happen once it is prepared.
+    GetEngine()->GetThreadPool()->PushTask([this, request]()
+    {
+        request->resource->PrepareLoadFromFile();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutexAsyncLoads);
+            request->prepared = true;
+        }
+
+        m_conditionAsyncLoadPrepared.notify_all();
+    });
+
+    return request;
+}
+
+bool ManagerResources::IsAsyncLoadPending(const Handle& loadHandle) const
+{
+    auto iteRequest = m_asyncLoadRequests.find(loadHandle.GetUint64());
+    return iteRequest != m_asyncLoadRequests.end() && Handle(iteRequest->first) == loadHandle;
+}
+
+size_t ManagerResources::GetPendingAsyncLoadCount() const
+{
+    return m_asyncLoadRequests.size();
+}
+
+void ManagerResources::ProcessAsyncLoads()
+{
+    ProcessLocalizationLanguage(false);
+
+    if (m_asyncLoadRequests.empty())
+        return;
+
+    // Gather prepared requests, in submission order.
+    std::vector<AsyncLoadRequest*> preparedRequests;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutexAsyncLoads);
+
+        for (const auto& entry : m_asyncLoadRequests)
+        {
+            if (entry.second->prepared)
+            {
+                preparedRequests.push_back(entry.second);
+            }
+        }
+    }
+
+    // Finalize requests until the time budget is exceeded (at least one request is finalized per call).
+    sf::Clock clock;
+    sf::Time maxTime = sf::milliseconds(m_maxAsyncLoadTimePerLoopMs);
+
+    for (AsyncLoadRequest* request : preparedRequests)
+    {
+        // A previous finalization may have already completed this request (through a dependency).
+        auto iteRequest = m_asyncLoadRequests.find(request->id);
+        if (iteRequest == m_asyncLoadRequests.end() || iteRequest->second != request)
+            continue;
+
+        FinalizeAsyncLoad(request);
+
+        if (clock.getElapsedTime() >= maxTime)
+            break;
+    }
+}
+
+void ManagerResources::CompleteAsyncLoads()
+{
+    while (!m_asyncLoadRequests.empty())
+    {
+        CompleteAsyncLoad(m_asyncLoadRequests.begin()->second->resourceInfo);
+    }
+
+    ProcessLocalizationLanguage(true);
+}
+
+ManagerResources::AsyncLoadRequest* ManagerResources::FindAsyncLoadRequest(const ResourceInfo* resourceInfo) const
+{
+    auto iteRequest = m_asyncLoadRequestsByResource.find(resourceInfo);
+    if (iteRequest == m_asyncLoadRequestsByResource.end())
+        return nullptr;
+
+    return iteRequest->second;
+}
+
+bool ManagerResources::CompleteAsyncLoad(const ResourceInfo* resourceInfo)
+{
+    AsyncLoadRequest* request = FindAsyncLoadRequest(resourceInfo);
+    if (!request)
+        return false;
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutexAsyncLoads);
+        m_conditionAsyncLoadPrepared.wait(lock, [request]() { return request->prepared; });
+    }
+
+    FinalizeAsyncLoad(request);
+    return true;
+}
+
+void ManagerResources::FinalizeAsyncLoad(AsyncLoadRequest* request)
+{
+    GUGU_SCOPE_TRACE_MAIN("Finalize Async Load");
+
+    m_asyncLoadRequests.erase(request->id);
+    m_asyncLoadRequestsByResource.erase(request->resourceInfo);
+
+    ResourceInfo* resourceInfo = request->resourceInfo;
+    Resource* resource = request->resource;
+
+    resourceInfo->resource = resource;
+    resourceInfo->loadedFromFile = true;
+    resourceInfo->lastUseTick = m_residencyTick;
+    resourceInfo->prefetched = request->prefetch;
+    resourceInfo->pinCount += request->pinCount;
+    RegisterResourceDependencies(resource);
+
+    bool loaded = resource->FinalizeLoadFromFile();
+
+    UpdateResourceDependencies(resource);
+
+    if (RecordLoadResult(resourceInfo, loaded))
+    {
+        if (request->prefetch)
+        {
+            ++m_prefetchStats.prefetchedResourceCount;
+        }
+
+        GetLogEngine()->Print(ELog::Debug, ELogEngine::Resources, StringFormat("Resource loaded asynchronously : {0}", resourceInfo->resourceID));
+    }
+
+    std::vector<DelegateResourceLoaded> delegates;
+    std::swap(delegates, request->delegates);
+    SafeDelete(request);
+
+    for (const auto& delegateResourceLoaded : delegates)
+    {
+        delegateResourceLoaded(resource);
+    }
+}
+
+}   // namespace gugu
@@ -0,0 +1,384 @@
+////////////////////////////////////////////////////////////////
+// Header
+
+#include "Gugu/Common.h"
+#include "Gugu/Resources/ManagerResources.h"
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/Resources/ResourceInfo.h"
+#include "Gugu/Resources/Resource.h"
+#include "Gugu/Math/MathUtility.h"
+#include "Gugu/System/Path.h"
+#include "Gugu/System/Platform.h"
+#include "Gugu/System/String.h"
+#include "Gugu/Debug/Logger.h"
+
+#include <algorithm>
+#include <cstring>
+
+////////////////////////////////////////////////////////////////
+// File Implementation
+
+namespace gugu {
+
+namespace impl {
+
+// Resource cache file layout : header, then entries (strings are stored with their uint32 size, in native endianness).
+struct ResourceCacheHeader
+{
+    uint32 magic = 0;
+    uint32 version = 0;
+    uint32 entryCount = 0;
+    uint32 reserved = 0;
+};
+
+constexpr uint32 ResourceCacheMagic = 0x49435247;     // "GRCI".
+constexpr uint32 ResourceCacheVersion = 1;
+constexpr size_t MaxPrefetchDepth = 16;
+
+template<typename T>
+void WriteCacheValue(std::vector<uint8>& data, const T& value)
+{
+    const uint8* bytes = reinterpret_cast<const uint8*>(&value);
+    data.insert(data.end(), bytes, bytes + sizeof(T));
+}
+
+void WriteCacheString(std::vector<uint8>& data, std::string_view value)
+{
+    WriteCacheValue(data, static_cast<uint32>(value.size()));
+    data.insert(data.end(), value.begin(), value.end());
+}
+
+template<typename T>
+bool ReadCacheValue(const std::vector<uint8>& data, size_t& position, T& value)
+{
+    if (data.size() - position < sizeof(T))
+        return false;
+
+    std::memcpy(&value, data.data() + position, sizeof(T));
+    position += sizeof(T);
+    return true;
+}
+
+bool ReadCacheString(const std::vector<uint8>& data, size_t& position, std::string& value)
+{
+    uint32 size = 0;
+    if (!ReadCacheValue(data, position, size) || data.size() - position < size)
+        return false;
+
+    value.assign(reinterpret_cast<const char*>(data.data() + position), size);
+    position += size;
+    return true;
+}
+
+}   // namespace impl
+
+bool ManagerResources::LoadResourceCache(const std::string& cachePath_utf8)
+{
+    m_resourceCachePath = cachePath_utf8;
+    m_resourceCacheEntries.Clear();
+    m_resourceCacheDirty = false;
+    m_resourceCacheStats = ResourceCacheStats();
+
+    if (m_resourceCachePath.empty())
+        return false;
+
+    std::vector<uint8> data;
+    if (!FileExists(m_resourceCachePath) || !ReadFileContent(m_resourceCachePath, data))
+    {
+        GetLogEngine()->Print(ELog::Info, ELogEngine::Resources, StringFormat("Resource cache not found, it will be created : {0}", m_resourceCachePath));
+        return false;
+    }
+
+    size_t position = 0;
+    impl::ResourceCacheHeader header;
+    bool valid = impl::ReadCacheValue(data, position, header)
+        && header.magic == impl::ResourceCacheMagic
+        && header.version == impl::ResourceCacheVersion;
+
+    for (uint32 i = 0; valid && i < header.entryCount; ++i)
+    {
+        ResourceCacheEntry entry;
+        uint32 resourceType = 0;
+        uint32 dependencyCount = 0;
+
+        valid = impl::ReadCacheString(data, position, entry.resourceId)
+            && impl::ReadCacheString(data, position, entry.filePath)
+            && impl::ReadCacheValue(data, position, entry.fileTime)
+            && impl::ReadCacheValue(data, position, entry.fileSize)
+            && impl::ReadCacheValue(data, position, resourceType)
+            && impl::ReadCacheValue(data, position, dependencyCount);
+
+        for (uint32 j = 0; valid && j < dependencyCount; ++j)
+        {
+            entry.dependencies.push_back(std::string());
+            valid = impl::ReadCacheString(data, position, entry.dependencies.back());
+        }
+
+        if (valid)
+        {
+            entry.resourceType = resourceType < EResourceType::Custom ? static_cast<EResourceType::Type>(resourceType) : EResourceType::Unknown;
+            m_resourceCacheEntries.Insert(Hash(entry.filePath), entry);
+        }
+    }
+
+    if (!valid)
+    {
+        GetLogEngine()->Print(ELog::Warning, ELogEngine::Resources, StringFormat("Resource cache is invalid, it will be rebuilt : {0}", m_resourceCachePath));
+        m_resourceCacheEntries.Clear();
+        return false;
+    }
+
+    m_resourceCacheStats.loadedEntryCount = m_resourceCacheEntries.Size();
+
+    GetLogEngine()->Print(ELog::Info, ELogEngine::Resources, StringFormat("Resource cache loaded (Entries {0})", m_resourceCacheStats.loadedEntryCount));
+    return true;
+}
+
+bool ManagerResources::SaveResourceCache()
+{
+    if (m_resourceCachePath.empty())
+        return false;
+
+    // Entries of resources that are not registered anymore, or whose file has been modified since, are discarded.
+    std::vector<const ResourceCacheEntry*> entries;
+    entries.reserve(m_resourceCacheEntries.Size());
+
+    for (const auto& entry : m_resourceCacheEntries)
+    {
+        const ResourceCacheEntry& cacheEntry = entry.value;
+        const ResourceInfo* resourceInfo = FindResourceInfo(cacheEntry.resourceId);
+        if (resourceInfo
+            && !resourceInfo->archive
+            && resourceInfo->fileInfo.GetFilePath_utf8() == cacheEntry.filePath
+            && (resourceInfo->fileTime == 0 || (resourceInfo->fileTime == cacheEntry.fileTime && resourceInfo->fileSize == cacheEntry.fileSize)))
+        {
+            entries.push_back(&cacheEntry);
+        }
+    }
+
+    impl::ResourceCacheHeader header;
+    header.magic = impl::ResourceCacheMagic;
+    header.version = impl::ResourceCacheVersion;
+    header.entryCount = static_cast<uint32>(entries.size());
+
+    std::vector<uint8> data;
+    impl::WriteCacheValue(data, header);
+
+    for (const ResourceCacheEntry* entry : entries)
+    {
+        impl::WriteCacheString(data, entry->resourceId);
+        impl::WriteCacheString(data, entry->filePath);
+        impl::WriteCacheValue(data, entry->fileTime);
+        impl::WriteCacheValue(data, entry->fileSize);
+        impl::WriteCacheValue(data, static_cast<uint32>(entry->resourceType));
+        impl::WriteCacheValue(data, static_cast<uint32>(entry->dependencies.size()));
+
+        for (const std::string& dependency : entry->dependencies)
+        {
+            impl::WriteCacheString(data, dependency);
+        }
+    }
+
+    std::string directoryPath = DirectoryPartFromPath(m_resourceCachePath);
+    if ((!directoryPath.empty() && !EnsureDirectoryExists(directoryPath)) || !WriteFileContent(m_resourceCachePath, data))
+    {
+        GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("Resource cache could not be saved : {0}", m_resourceCachePath));
+        return false;
+    }
+
+    m_resourceCacheDirty = false;
+
+    GetLogEngine()->Print(ELog::Info, ELogEngine::Resources, StringFormat("Resource cache saved (Entries {0})", entries.size()));
+    return true;
+}
+
+const ManagerResources::ResourceCacheStats& ManagerResources::GetResourceCacheStats() const
+{
+    return m_resourceCacheStats;
+}
+
+void ManagerResources::RestoreResourceCacheEntry(ResourceInfo* resourceInfo)
+{
+    if (resourceInfo->fileTime == 0)
+        return;
+
+    std::string_view filePath = resourceInfo->fileInfo.GetFilePath_utf8();
+
+    const ResourceCacheEntry* entry = m_resourceCacheEntries.Find(Hash(filePath));
+    if (!entry || entry->filePath != filePath)
+        return;
+
+    if (entry->resourceId != resourceInfo->resourceID
+        || entry->fileTime != resourceInfo->fileTime
+        || entry->fileSize != resourceInfo->fileSize)
+    {
+        ++m_resourceCacheStats.invalidatedEntryCount;
+        return;
+    }
+
+    // Types deduced from the file extension are kept, the cache only completes unknown types.
+    if (resourceInfo->resourceType == EResourceType::Unknown)
+    {
+        resourceInfo->resourceType = entry->resourceType;
+    }
+
+    resourceInfo->cachedDependencies = entry->dependencies;
+    ++m_resourceCacheStats.restoredEntryCount;
+}
+
+bool ManagerResources::RecordLoadResult(ResourceInfo* resourceInfo, bool loaded)
+{
+    if (!loaded)
+    {
+        // The resource stays available as an empty resource, but it can't be evicted and reloaded, and it should not be
+        // recorded in the cache or the load history.
+        resourceInfo->loadedFromFile = false;
+        resourceInfo->prefetched = false;
+
+        GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("Resource load failed : {0}", resourceInfo->resourceID));
+        return false;
+    }
+
+    RecordResourceCacheEntry(resourceInfo);
+    RecordLoad(resourceInfo);
+    return true;
+}
+
+void ManagerResources::RecordResourceCacheEntry(ResourceInfo* resourceInfo)
+{
+    if (m_resourceCachePath.empty() || resourceInfo->archive || !resourceInfo->resource)
+        return;
+
+    // Resources parsed before the cache was loaded don't have their file stats yet.
+    std::string filePath(resourceInfo->fileInfo.GetFilePath_utf8());
+    if (resourceInfo->fileTime == 0 && !GetFileStats(filePath, resourceInfo->fileTime, resourceInfo->fileSize))
+        return;
+
+    std::set<Resource*> dependencies;
+    resourceInfo->resource->GetDependencies(dependencies);
+
+    std::vector<std::string> dependencyIds;
+    dependencyIds.reserve(dependencies.size());
+
+    for (const Resource* dependency : dependencies)
+    {
+        // Resources without ResourceInfo (custom textures for instance) can't be found again by ID.
+        if (dependency && dependency->m_resourceInfos)
+        {
+            dependencyIds.push_back(dependency->m_resourceInfos->resourceID);
+        }
+    }
+
+    std::sort(dependencyIds.begin(), dependencyIds.end());
+    resourceInfo->cachedDependencies = dependencyIds;
+
+    EResourceType::Type resourceType = resourceInfo->resource->GetResourceType();
+
+    Hash key(filePath);
+    ResourceCacheEntry* entry = m_resourceCacheEntries.Find(key);
+    if (entry
+        && entry->resourceId == resourceInfo->resourceID
+        && entry->filePath == filePath
+        && entry->fileTime == resourceInfo->fileTime
+        && entry->fileSize == resourceInfo->fileSize
+        && entry->resourceType == resourceType
+        && entry->dependencies == dependencyIds)
+    {
+        return;
+    }
+
+    ResourceCacheEntry newEntry;
+    newEntry.resourceId = resourceInfo->resourceID;
+    newEntry.filePath = std::move(filePath);
+    newEntry.fileTime = resourceInfo->fileTime;
+    newEntry.fileSize = resourceInfo->fileSize;
+    newEntry.resourceType = resourceType;
+    newEntry.dependencies = std::move(dependencyIds);
+
+    if (entry)
+    {
+        *entry = std::move(newEntry);
+    }
+    else
+    {
+        m_resourceCacheEntries.Insert(key, newEntry);
+    }
+
+    m_resourceCacheDirty = true;
+    ++m_resourceCacheStats.recordedEntryCount;
+}
+
+uint32 ManagerResources::GetCachedDependencyDepth(const ResourceInfo* resourceInfo, std::map<const ResourceInfo*, uint32>& depths) const
+{
+    auto iteDepth = depths.find(resourceInfo);
+    if (iteDepth != depths.end())
+        return iteDepth->second;
+
+    // The node is registered before visiting its dependencies, to stop on cyclic dependencies.
+    depths.insert(std::make_pair(resourceInfo, 0));
+
+    uint32 depth = 0;
+    for (const std::string& dependencyId : resourceInfo->cachedDependencies)
+    {
+        if (const ResourceInfo* dependencyInfo = FindResourceInfo(dependencyId))
+        {
+            depth = Max(depth, GetCachedDependencyDepth(dependencyInfo, depths) + 1);
+        }
+    }
+
+    depths[resourceInfo] = depth;
+    return depth;
+}
+
+void ManagerResources::PrefetchCachedDependencies(const ResourceInfo* resourceInfo, size_t depth)
+{
+    // The depth is limited to stop on cyclic dependencies.
+    if (depth >= impl::MaxPrefetchDepth)
+        return;
+
+    for (const std::string& dependencyId : resourceInfo->cachedDependencies)
+    {
+        ResourceInfo* dependencyInfo = FindResourceInfo(dependencyId);
+        if (!dependencyInfo || dependencyInfo->resource || dependencyInfo->resourceType == EResourceType::Unknown || FindAsyncLoadRequest(dependencyInfo))
+            continue;
+
+        // Dependencies are queued before their referencers, to be finalized first.
+        PrefetchCachedDependencies(dependencyInfo, depth + 1);
+
+        if (!FindAsyncLoadRequest(dependencyInfo))
+        {
+            QueueAsyncLoad(dependencyInfo, EResourceType::Unknown);
+        }
+    }
+}
+
+void ManagerResources::RestoreCachedDependencies(const std::vector<ResourceInfo*>& resourceInfos)
+{
+    if (!m_handleResourceDependencies || m_resourceCachePath.empty())
+        return;
+
+    // Edges are only linked to registered dependencies, a referencer finalized before one of its cached dependencies is refreshed once the batch is loaded.
+    for (const ResourceInfo* resourceInfo : resourceInfos)
+    {
+        size_t nodeIndex = GetDependencyNodeIndex(resourceInfo->resource);
+        if (nodeIndex == system::InvalidIndex)
+            continue;
+
+        const std::vector<uint32>& dependencies = m_dependencyNodes[nodeIndex].dependencies;
+        for (const std::string& dependencyId : resourceInfo->cachedDependencies)
+        {
+            const ResourceInfo* dependencyInfo = FindResourceInfo(dependencyId);
+            size_t dependencyIndex = dependencyInfo ? GetDependencyNodeIndex(dependencyInfo->resource) : system::InvalidIndex;
+            if (dependencyIndex != system::InvalidIndex && !std::binary_search(dependencies.begin(), dependencies.end(), static_cast<uint32>(dependencyIndex)))
+            {
+                UpdateResourceDependencies(resourceInfo->resource);
+                break;
+            }
+        }
+    }
+}
+
+}   // namespace gugu
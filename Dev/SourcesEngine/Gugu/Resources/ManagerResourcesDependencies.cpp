@@ -0,0 +1,402 @@
+////////////////////////////////////////////////////////////////
+// Header
+
+#include "Gugu/Common.h"
+#include "Gugu/Resources/ManagerResources.h"
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/Resources/ResourceInfo.h"
+#include "Gugu/Resources/Resource.h"
+#include "Gugu/System/String.h"
+#include "Gugu/Debug/Logger.h"
+
+#include <algorithm>
+
+////////////////////////////////////////////////////////////////
+// File Implementation
+
+namespace gugu {
+
+void ManagerResources::RegisterResourceDependencies(Resource* resource)
+{
+    if (!m_handleResourceDependencies)
+        return;
+
+    if (GetDependencyNodeIndex(resource) != system::InvalidIndex)
+    {
+        GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("RegisterResourceDependencies failed, Resource already registered : {0}", resource->GetID()));
+        return;
+    }
+
+    // Unused nodes are recycled, their containers keep their capacity.
+    uint32 nodeIndex = 0;
+    if (!m_freeDependencyNodes.empty())
+    {
+        nodeIndex = m_freeDependencyNodes.back();
+        m_freeDependencyNodes.pop_back();
+    }
+    else
+    {
+        nodeIndex = static_cast<uint32>(m_dependencyNodes.size());
+        m_dependencyNodes.push_back(ResourceDependencies());
+        m_dependencyNodeStamps.push_back(0);
+    }
+
+    m_dependencyNodes[nodeIndex].resource = resource;
+    resource->m_dependencyNodeId = nodeIndex + 1;
+}
+
+void ManagerResources::SetHandleResourceDependencies(bool handleResourceDependencies)
+{
+    if (m_handleResourceDependencies == handleResourceDependencies)
+        return;
+
+    m_handleResourceDependencies = handleResourceDependencies;
+
+    if (handleResourceDependencies)
+    {
+        // All the loaded resources are registered before linking them, dependencies may be gathered in any order.
+        std::vector<Resource*> loadedResources;
+        for (const auto& entry : m_resources)
+        {
+            if (entry.value->resource)
+            {
+                loadedResources.push_back(entry.value->resource);
+                RegisterResourceDependencies(entry.value->resource);
+            }
+        }
+
+        for (Resource* resource : loadedResources)
+        {
+            UpdateResourceDependencies(resource);
+        }
+    }
+    else
+    {
+        for (const ResourceDependencies& node : m_dependencyNodes)
+        {
+            if (node.resource)
+            {
+                node.resource->m_dependencyNodeId = 0;
+            }
+        }
+
+        m_dependencyNodes.clear();
+        m_freeDependencyNodes.clear();
+        m_dependencyNodeStamps.clear();
+    }
+}
+
+bool ManagerResources::IsHandlingResourceDependencies() const
+{
+    return m_handleResourceDependencies;
+}
+
+void ManagerResources::UpdateResourceDependencies(Resource* resource)
+{
+    if (!m_handleResourceDependencies)
+        return;
+
+    size_t nodeIndex = GetDependencyNodeIndex(resource);
+    if (nodeIndex == system::InvalidIndex)
+    {
+        GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("UpdateResourceDependencies failed, Unregistered Resource : {0}", resource->GetID()));
+        return;
+    }
+
+    // Referencers may gather the dependencies of their own dependencies, they need to be refreshed when those change.
+    // - A worklist is used instead of a recursion, and each node is refreshed at most once per update (this also protects against loops).
+    ++m_dependencyUpdateStamp;
+
+    m_dependencyWorklist.clear();
+    m_dependencyWorklist.push_back(static_cast<uint32>(nodeIndex));
+    m_dependencyNodeStamps[nodeIndex] = m_dependencyUpdateStamp;
+
+    for (size_t i = 0; i < m_dependencyWorklist.size(); ++i)
+    {
+        uint32 currentIndex = m_dependencyWorklist[i];
+        if (!RefreshDependencyNode(currentIndex))
+            continue;
+
+        for (uint32 referencerIndex : m_dependencyNodes[currentIndex].referencers)
+        {
+            if (m_dependencyNodeStamps[referencerIndex] != m_dependencyUpdateStamp)
+            {
+                m_dependencyNodeStamps[referencerIndex] = m_dependencyUpdateStamp;
+                m_dependencyWorklist.push_back(referencerIndex);
+            }
+        }
+    }
+}
+
+bool ManagerResources::RefreshDependencyNode(size_t nodeIndex)
+{
+    std::set<Resource*> dependencies;
+    m_dependencyNodes[nodeIndex].resource->GetDependencies(dependencies);
+
+    // Only registered dependencies are kept in the graph.
+    std::vector<uint32>& newDependencies = m_dependencyScratch;
+    newDependencies.clear();
+
+    for (const Resource* dependency : dependencies)
+    {
+        size_t dependencyIndex = GetDependencyNodeIndex(dependency);
+        if (dependencyIndex != system::InvalidIndex && dependencyIndex != nodeIndex)
+        {
+            newDependencies.push_back(static_cast<uint32>(dependencyIndex));
+        }
+    }
+
+    std::sort(newDependencies.begin(), newDependencies.end());
+
+    // Both lists are sorted, only the edges that differ are added or removed.
+    std::vector<uint32>& currentDependencies = m_dependencyNodes[nodeIndex].dependencies;
+    bool updatedDependencies = false;
+
+    size_t currentPosition = 0;
+    size_t newPosition = 0;
+    while (currentPosition < currentDependencies.size() || newPosition < newDependencies.size())
+    {
+        if (newPosition == newDependencies.size()
+            || (currentPosition < currentDependencies.size() && currentDependencies[currentPosition] < newDependencies[newPosition]))
+        {
+            StdVectorRemoveFirst(m_dependencyNodes[currentDependencies[currentPosition]].referencers, static_cast<uint32>(nodeIndex));
+            ++currentPosition;
+            updatedDependencies = true;
+        }
+        else if (currentPosition == currentDependencies.size() || newDependencies[newPosition] < currentDependencies[currentPosition])
+        {
+            m_dependencyNodes[newDependencies[newPosition]].referencers.push_back(static_cast<uint32>(nodeIndex));
+            ++newPosition;
+            updatedDependencies = true;
+        }
+        else
+        {
+            ++currentPosition;
+            ++newPosition;
+        }
+    }
+
+    if (updatedDependencies)
+    {
+        currentDependencies.assign(newDependencies.begin(), newDependencies.end());
+    }
+
+    return updatedDependencies;
+}
+
+void ManagerResources::UnregisterResourceDependencies(Resource* resource)
+{
+    size_t nodeIndex = GetDependencyNodeIndex(resource);
+    if (nodeIndex == system::InvalidIndex)
+        return;
+
+    ResourceDependencies& node = m_dependencyNodes[nodeIndex];
+
+    // Remove resource from its dependencies referencers.
+    for (uint32 dependencyIndex : node.dependencies)
+    {
+        StdVectorRemoveFirst(m_dependencyNodes[dependencyIndex].referencers, static_cast<uint32>(nodeIndex));
+    }
+
+    // Remove resource from its referencers dependencies.
+    for (uint32 referencerIndex : node.referencers)
+    {
+        StdVectorRemoveFirst(m_dependencyNodes[referencerIndex].dependencies, static_cast<uint32>(nodeIndex));
+    }
+
+    node.resource = nullptr;
+    node.dependencies.clear();
+    node.referencers.clear();
+    node.listeners.clear();
+
+    resource->m_dependencyNodeId = 0;
+    m_freeDependencyNodes.push_back(static_cast<uint32>(nodeIndex));
+}
+
+size_t ManagerResources::GetDependencyNodeIndex(const Resource* resource) const
+{
+    if (!resource || resource->m_dependencyNodeId == 0)
+        return system::InvalidIndex;
+
+    // The node is checked, in case the resource was registered in another manager.
+    size_t nodeIndex = resource->m_dependencyNodeId - 1;
+    if (nodeIndex >= m_dependencyNodes.size() || m_dependencyNodes[nodeIndex].resource != resource)
+        return system::InvalidIndex;
+
+    return nodeIndex;
+}
+
+bool ManagerResources::RegisterResourceListener(const Resource* resource, const Handle& handle, const DelegateResourceEvent& delegateResourceEvent)
+{
+    if (!resource || !handle.IsValid())
+        return false;
+
+    size_t nodeIndex = GetDependencyNodeIndex(resource);
+    if (nodeIndex != system::InvalidIndex)
+    {
+        ResourceListener resourceListener;
+        resourceListener.handle = handle;
+        resourceListener.delegateResourceEvent = delegateResourceEvent;
+
+        m_dependencyNodes[nodeIndex].listeners.push_back(resourceListener);
+        return true;
+    }
+    else
+    {
+        GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("RegisterResourceListener failed, Resource not loaded : {0}", resource->GetID()));
+        return false;
+    }
+}
+
+void ManagerResources::UnregisterResourceListeners(const Resource* resource, const Handle& handle)
+{
+    size_t nodeIndex = GetDependencyNodeIndex(resource);
+    if (nodeIndex != system::InvalidIndex)
+    {
+        std::vector<ResourceListener>& listeners = m_dependencyNodes[nodeIndex].listeners;
+
+        size_t i = 0;
+        while (i < listeners.size())
+        {
+            if (listeners[i].handle == handle)
+            {
+                StdVectorRemoveAt(listeners, i);
+            }
+            else
+            {
+                ++i;
+            }
+        }
+    }
+}
+
+void ManagerResources::UnregisterResourceListeners(const Handle& handle)
+{
+    // Remove all listeners originating from this handle.
+    for (ResourceDependencies& node : m_dependencyNodes)
+    {
+        size_t i = 0;
+        while (i < node.listeners.size())
+        {
+            if (node.listeners[i].handle == handle)
+            {
+                StdVectorRemoveAt(node.listeners, i);
+            }
+            else
+            {
+                ++i;
+            }
+        }
+    }
+}
+
+void ManagerResources::NotifyResourceUpdated(const Resource* resource)
+{
+    size_t nodeIndex = GetDependencyNodeIndex(resource);
+    if (nodeIndex != system::InvalidIndex)
+    {
+        // Callbacks may modify the graph, referencers are gathered first.
+        std::vector<uint32> referencerIndices = m_dependencyNodes[nodeIndex].referencers;
+        std::vector<Resource*> referencers;
+        for (uint32 referencerIndex : referencerIndices)
+        {
+            referencers.push_back(m_dependencyNodes[referencerIndex].resource);
+        }
+
+        // Notify referencers that a dependency has been updated.
+        for (const auto& referencer : referencers)
+        {
+            referencer->OnDependencyUpdated(resource);
+        }
+
+        for (size_t i = 0; i < referencers.size(); ++i)
+        {
+            Resource* referencer = referencers[i];
+            uint32 referencerIndex = referencerIndices[i];
+            if (referencerIndex < m_dependencyNodes.size() && m_dependencyNodes[referencerIndex].resource == referencer)
+            {
+                std::vector<ResourceListener> listeners = m_dependencyNodes[referencerIndex].listeners;
+                for (const auto& resourceListener : listeners)
+                {
+                    resourceListener.delegateResourceEvent(referencer, EResourceEvent::DependencyUpdated, resource);
+                }
+            }
+        }
+
+        // Notify the resource itself being updated.
+        nodeIndex = GetDependencyNodeIndex(resource);
+        if (nodeIndex != system::InvalidIndex)
+        {
+            std::vector<ResourceListener> listeners = m_dependencyNodes[nodeIndex].listeners;
+            for (const auto& resourceListener : listeners)
+            {
+                resourceListener.delegateResourceEvent(resource, EResourceEvent::ResourceUpdated, nullptr);
+            }
+        }
+    }
+}
+
+void ManagerResources::NotifyResourceRemoved(const Resource* resource)
+{
+    size_t nodeIndex = GetDependencyNodeIndex(resource);
+    if (nodeIndex != system::InvalidIndex)
+    {
+        // Callbacks may modify the graph, referencers are gathered first.
+        std::vector<uint32> referencerIndices = m_dependencyNodes[nodeIndex].referencers;
+        std::vector<Resource*> referencers;
+        for (uint32 referencerIndex : referencerIndices)
+        {
+            referencers.push_back(m_dependencyNodes[referencerIndex].resource);
+        }
+
+        // Notify referencers that a dependency has been removed.
+        for (const auto& referencer : referencers)
+        {
+            referencer->OnDependencyRemoved(resource);
+        }
+
+        for (size_t i = 0; i < referencers.size(); ++i)
+        {
+            Resource* referencer = referencers[i];
+            uint32 referencerIndex = referencerIndices[i];
+            if (referencerIndex < m_dependencyNodes.size() && m_dependencyNodes[referencerIndex].resource == referencer)
+            {
+                // The referencer may have dropped other dependencies along with the removed one (like the ancestors of a datasheet).
+                UpdateResourceDependencies(referencer);
+
+                std::vector<ResourceListener> listeners = m_dependencyNodes[referencerIndex].listeners;
+                for (const auto& resourceListener : listeners)
+                {
+                    resourceListener.delegateResourceEvent(referencer, EResourceEvent::DependencyRemoved, resource);
+                }
+            }
+        }
+
+        // Notify the resource itself being removed.
+        nodeIndex = GetDependencyNodeIndex(resource);
+        if (nodeIndex != system::InvalidIndex)
+        {
+            std::vector<ResourceListener> listeners = m_dependencyNodes[nodeIndex].listeners;
+            for (const auto& resourceListener : listeners)
+            {
+                resourceListener.delegateResourceEvent(resource, EResourceEvent::ResourceRemoved, nullptr);
+            }
+        }
+    }
+}
+
+const std::vector<ManagerResources::ResourceDependencies>& ManagerResources::GetResourceDependencies() const
+{
+    return m_dependencyNodes;
+}
+
+const ManagerResources::ResourceDependencies* ManagerResources::FindResourceDependencies(const Resource* resource) const
+{
+    size_t nodeIndex = GetDependencyNodeIndex(resource);
+    return nodeIndex != system::InvalidIndex ? &m_dependencyNodes[nodeIndex] : nullptr;
+}
+
+}   // namespace gugu
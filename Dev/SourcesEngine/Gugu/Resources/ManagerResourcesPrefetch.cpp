@@ -0,0 +1,165 @@
+////////////////////////////////////////////////////////////////
+// Header
+
+#include "Gugu/Common.h"
+#include "Gugu/Resources/ManagerResources.h"
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/Resources/ResourceInfo.h"
+#include "Gugu/Resources/Resource.h"
+#include "Gugu/Resources/PreloadManifest.h"
+#include "Gugu/System/String.h"
+#include "Gugu/Debug/Logger.h"
+
+////////////////////////////////////////////////////////////////
+// File Implementation
+
+namespace gugu {
+
+Handle ManagerResources::PrefetchResources(const std::vector<PreloadManifestEntry>& entries, const DelegatePrefetchProgress& delegatePrefetchProgress)
+{
+    Handle prefetchHandle(++m_nextPrefetchId);
+
+    PrefetchRequest& request = m_prefetchRequests[prefetchHandle];
+    request.resourceCount = entries.size();
+    request.queuing = true;
+    request.delegatePrefetchProgress = delegatePrefetchProgress;
+
+    for (const PreloadManifestEntry& entry : entries)
+    {
+        ResourceInfo* resourceInfo = FindResourceInfo(entry.resourceId);
+        bool queueLoad = resourceInfo && !resourceInfo->resource && !FindAsyncLoadRequest(resourceInfo);
+
+        // Already loaded resources will immediately call the delegate.
+        RequestAsyncLoad(entry.resourceId, [this, prefetchHandle](Resource*)
+        {
+            OnPrefetchResourceLoaded(prefetchHandle);
+        }, entry.resourceType, false);
+
+        if (queueLoad)
+        {
+            if (AsyncLoadRequest* loadRequest = FindAsyncLoadRequest(resourceInfo))
+            {
+                loadRequest->prefetch = true;
+            }
+        }
+    }
+
+    // The request may already be complete, if all the resources were already loaded.
+    request.queuing = false;
+
+    if (request.loadedCount >= request.resourceCount)
+    {
+        if (request.resourceCount == 0 && request.delegatePrefetchProgress)
+        {
+            request.delegatePrefetchProgress(0, 0);
+        }
+
+        m_prefetchRequests.erase(prefetchHandle);
+    }
+
+    return prefetchHandle;
+}
+
+Handle ManagerResources::PrefetchManifest(const std::string& manifestId, const DelegatePrefetchProgress& delegatePrefetchProgress)
+{
+    // Manifests are small, they are loaded immediately.
+    PreloadManifest* manifest = GetPreloadManifest(manifestId);
+    if (!manifest)
+    {
+        GetLogEngine()->Print(ELog::Warning, ELogEngine::Resources, StringFormat("PrefetchManifest failed, unknown manifest : {0}", manifestId));
+        return PrefetchResources(std::vector<PreloadManifestEntry>(), delegatePrefetchProgress);
+    }
+
+    return PrefetchResources(manifest->GetEntries(), delegatePrefetchProgress);
+}
+
+bool ManagerResources::IsPrefetchPending(const Handle& prefetchHandle) const
+{
+    return m_prefetchRequests.find(prefetchHandle) != m_prefetchRequests.end();
+}
+
+float ManagerResources::GetPrefetchProgress(const Handle& prefetchHandle) const
+{
+    auto iteRequest = m_prefetchRequests.find(prefetchHandle);
+    if (iteRequest == m_prefetchRequests.end() || iteRequest->second.resourceCount == 0)
+        return 1.f;
+
+    return static_cast<float>(iteRequest->second.loadedCount) / static_cast<float>(iteRequest->second.resourceCount);
+}
+
+const ManagerResources::PrefetchStats& ManagerResources::GetPrefetchStats() const
+{
+    return m_prefetchStats;
+}
+
+void ManagerResources::ResetPrefetchStats()
+{
+    m_prefetchStats = PrefetchStats();
+}
+
+void ManagerResources::OnPrefetchResourceLoaded(const Handle& prefetchHandle)
+{
+    auto iteRequest = m_prefetchRequests.find(prefetchHandle);
+    if (iteRequest == m_prefetchRequests.end())
+        return;
+
+    PrefetchRequest& request = iteRequest->second;
+    ++request.loadedCount;
+
+    if (request.delegatePrefetchProgress)
+    {
+        request.delegatePrefetchProgress(request.loadedCount, request.resourceCount);
+    }
+
+    if (!request.queuing && request.loadedCount >= request.resourceCount)
+    {
+        m_prefetchRequests.erase(iteRequest);
+    }
+}
+
+void ManagerResources::OnPrefetchedResourceAccessed(ResourceInfo* resourceInfo)
+{
+    resourceInfo->prefetched = false;
+    ++m_prefetchStats.avoidedHitchCount;
+}
+
+void ManagerResources::StartLoadsRecording()
+{
+    m_recordingLoads = true;
+    m_recordedLoads.clear();
+    m_recordedLoadIds.Clear();
+}
+
+void ManagerResources::StopLoadsRecording(std::vector<PreloadManifestEntry>& entries)
+{
+    entries = std::move(m_recordedLoads);
+
+    m_recordingLoads = false;
+    m_recordedLoads.clear();
+    m_recordedLoadIds.Clear();
+}
+
+bool ManagerResources::IsRecordingLoads() const
+{
+    return m_recordingLoads;
+}
+
+void ManagerResources::RecordLoad(const ResourceInfo* resourceInfo)
+{
+    if (!m_recordingLoads || !resourceInfo->resource || resourceInfo->resource->GetResourceType() == EResourceType::PreloadManifest)
+        return;
+
+    // Resources are only recorded once, even if they are evicted and reloaded.
+    if (!m_recordedLoadIds.Insert(Hash(resourceInfo->resourceID), true))
+        return;
+
+    PreloadManifestEntry entry;
+    entry.resourceId = resourceInfo->resourceID;
+    entry.resourceType = resourceInfo->resource->GetResourceType();
+    m_recordedLoads.push_back(entry);
+}
+
+}   // namespace gugu
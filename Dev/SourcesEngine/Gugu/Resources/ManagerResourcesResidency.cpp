@@ -0,0 +1,193 @@
+////////////////////////////////////////////////////////////////
+// Header
+
+#include "Gugu/Common.h"
+#include "Gugu/Resources/ManagerResources.h"
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/Resources/ResourceInfo.h"
+#include "Gugu/Resources/Resource.h"
+#include "Gugu/System/String.h"
+#include "Gugu/Debug/Logger.h"
+#include "Gugu/Debug/Trace.h"
+
+#include <algorithm>
+
+////////////////////////////////////////////////////////////////
+// File Implementation
+
+namespace gugu {
+
+void ManagerResources::AcquireResourceRef(const ResourceMapKey& mapKey)
+{
+    uint32* refCount = m_resourceRefCounts.Find(mapKey);
+    if (refCount)
+    {
+        ++(*refCount);
+    }
+    else
+    {
+        m_resourceRefCounts.Insert(mapKey, 1);
+    }
+}
+
+void ManagerResources::ReleaseResourceRef(const ResourceMapKey& mapKey)
+{
+    uint32* refCount = m_resourceRefCounts.Find(mapKey);
+    if (!refCount)
+        return;
+
+    if (*refCount > 1)
+    {
+        --(*refCount);
+    }
+    else
+    {
+        m_resourceRefCounts.Remove(mapKey);
+    }
+}
+
+void ManagerResources::SetMemoryBudget(size_t memoryBudget)
+{
+    m_residencyStats.memoryBudget = memoryBudget;
+}
+
+size_t ManagerResources::GetMemoryBudget() const
+{
+    return m_residencyStats.memoryBudget;
+}
+
+uint32 ManagerResources::GetResourceRefCount(const std::string& resourceId) const
+{
+    const uint32* refCount = m_resourceRefCounts.Find(ResourceMapKey(resourceId));
+    return refCount ? *refCount : 0;
+}
+
+void ManagerResources::ReleaseResource(const std::string& resourceId)
+{
+    ResourceInfo* resourceInfo = FindResourceInfo(resourceId);
+    if (!resourceInfo)
+        return;
+
+    if (resourceInfo->pinCount == 0)
+    {
+        GetLogEngine()->Print(ELog::Warning, ELogEngine::Resources, StringFormat("ReleaseResource failed, resource is not pinned : {0}", resourceId));
+        return;
+    }
+
+    --resourceInfo->pinCount;
+}
+
+uint32 ManagerResources::GetResourcePinCount(const std::string& resourceId) const
+{
+    const ResourceInfo* resourceInfo = FindResourceInfo(resourceId);
+    return resourceInfo ? resourceInfo->pinCount : 0;
+}
+
+const ManagerResources::ResidencyStats& ManagerResources::GetResidencyStats() const
+{
+    return m_residencyStats;
+}
+
+void ManagerResources::ProcessEvictions()
+{
+    if (m_residencyStats.memoryBudget == 0)
+        return;
+
+    GUGU_SCOPE_TRACE_MAIN("Process Evictions");
+
+    // Resources accessed since the previous pass are stamped with the current tick.
+    uint32 currentTick = m_residencyTick++;
+
+    // Memory is measured on each pass, some resources allocate their data lazily (sound buffers).
+    size_t residentMemory = 0;
+    size_t residentResourceCount = 0;
+    for (const auto& entry : m_resources)
+    {
+        ResourceInfo* resourceInfo = entry.value;
+        if (resourceInfo->resource)
+        {
+            resourceInfo->memorySize = resourceInfo->resource->GetMemorySize();
+            residentMemory += resourceInfo->memorySize;
+            ++residentResourceCount;
+        }
+    }
+
+    m_residencyStats.residentMemory = residentMemory;
+    m_residencyStats.residentResourceCount = residentResourceCount;
+
+    if (residentMemory <= m_residencyStats.memoryBudget)
+        return;
+
+    // Dependencies are gathered from the loaded resources, the dependencies cache may be disabled.
+    std::set<Resource*> dependencies;
+    for (const auto& entry : m_resources)
+    {
+        if (entry.value->resource)
+        {
+            entry.value->resource->GetDependencies(dependencies);
+        }
+    }
+
+    std::vector<ResourceInfo*> evictableResourceInfos;
+    for (const auto& entry : m_resources)
+    {
+        ResourceInfo* resourceInfo = entry.value;
+        if (!resourceInfo->resource
+            || !resourceInfo->loadedFromFile
+            || resourceInfo->memorySize == 0
+            || resourceInfo->lastUseTick == currentTick
+            || resourceInfo->resourceID == m_defaultFont
+            || resourceInfo->resourceID == m_debugFont
+            || resourceInfo->pinCount > 0
+            || m_resourceRefCounts.Contains(entry.key)
+            || dependencies.find(resourceInfo->resource) != dependencies.end())
+        {
+            continue;
+        }
+
+        // Resources observed by listeners (editor documents for instance) are kept.
+        const ResourceDependencies* resourceDependencies = FindResourceDependencies(resourceInfo->resource);
+        if (resourceDependencies && !resourceDependencies->listeners.empty())
+            continue;
+
+        evictableResourceInfos.push_back(resourceInfo);
+    }
+
+    std::stable_sort(evictableResourceInfos.begin(), evictableResourceInfos.end(), [](const ResourceInfo* left, const ResourceInfo* right)
+    {
+        return left->lastUseTick < right->lastUseTick;
+    });
+
+    for (ResourceInfo* resourceInfo : evictableResourceInfos)
+    {
+        if (m_residencyStats.residentMemory <= m_residencyStats.memoryBudget)
+            break;
+
+        EvictResource(resourceInfo);
+    }
+}
+
+void ManagerResources::EvictResource(ResourceInfo* resourceInfo)
+{
+    Resource* resource = resourceInfo->resource;
+
+    UnregisterResourceDependencies(resource);
+
+    m_residencyStats.residentMemory -= resourceInfo->memorySize;
+    m_residencyStats.residentResourceCount -= 1;
+    m_residencyStats.evictedResourceCount += 1;
+    m_residencyStats.evictedMemory += resourceInfo->memorySize;
+
+    GetLogEngine()->Print(ELog::Debug, ELogEngine::Resources, StringFormat("Resource evicted : {0}", resourceInfo->resourceID));
+
+    // The ResourceInfo stays registered, the resource will be reloaded on its next access.
+    resourceInfo->resource = nullptr;
+    resourceInfo->loadedFromFile = false;
+    resourceInfo->memorySize = 0;
+    SafeDelete(resource);
+}
+
+}   // namespace gugu
@@ -0,0 +1,281 @@
+////////////////////////////////////////////////////////////////
+// Header
+
+#include "Gugu/Common.h"
+#include "Gugu/Resources/ManagerResources.h"
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/Engine.h"
+#include "Gugu/Resources/Texture.h"
+#include "Gugu/Math/MathUtility.h"
+#include "Gugu/System/String.h"
+#include "Gugu/System/ThreadPool.h"
+#include "Gugu/System/Time.h"
+#include "Gugu/Debug/Logger.h"
+#include "Gugu/Debug/Trace.h"
+
+#include <algorithm>
+
+////////////////////////////////////////////////////////////////
+// File Implementation
+
+namespace gugu {
+
+namespace impl {
+
+size_t GetTextureMemorySize(const Vector2u& size)
+{
+    // Textures are stored as 32 bits pixels.
+    return static_cast<size_t>(size.x) * size.y * 4;
+}
+
+}   // namespace impl
+
+void ManagerResources::SetTextureStreamingMinSize(unsigned int minSize)
+{
+    m_textureStreamingMinSize = minSize;
+}
+
+unsigned int ManagerResources::GetTextureStreamingMinSize() const
+{
+    return m_textureStreamingMinSize;
+}
+
+void ManagerResources::SetTextureStreamingDropDelay(int dropDelayMs)
+{
+    m_textureStreamingDropDelay = Max(0, dropDelayMs) * 0.001f;
+}
+
+void ManagerResources::SetTextureStreamingBudget(size_t memoryBudget)
+{
+    m_textureStreamingStats.memoryBudget = memoryBudget;
+}
+
+size_t ManagerResources::GetTextureStreamingBudget() const
+{
+    return m_textureStreamingStats.memoryBudget;
+}
+
+const ManagerResources::TextureStreamingStats& ManagerResources::GetTextureStreamingStats() const
+{
+    return m_textureStreamingStats;
+}
+
+void ManagerResources::ProcessTextureStreaming()
+{
+    if (m_streamedTextures.empty())
+        return;
+
+    GUGU_SCOPE_TRACE_MAIN("Process Texture Streaming");
+
+    // Textures rendered since the previous pass are stamped with the current time.
+    float currentTime = GetElapsedSeconds();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutexAsyncLoads);
+
+        for (StreamedTexture& streamedTexture : m_streamedTextures)
+        {
+            streamedTexture.requestPrepared = streamedTexture.request && streamedTexture.request->prepared;
+        }
+    }
+
+    size_t fullResolutionMemory = 0;
+    for (StreamedTexture& streamedTexture : m_streamedTextures)
+    {
+        Texture* texture = streamedTexture.texture;
+
+        if (streamedTexture.requestPrepared)
+        {
+            streamedTexture.requestPrepared = false;
+            SafeDelete(streamedTexture.request);
+
+            texture->FinalizeFullResolution();
+        }
+
+        if (texture->m_streamingRendered)
+        {
+            texture->m_streamingRendered = false;
+            streamedTexture.lastRenderTime = currentTime;
+        }
+        else if (texture->m_sfTexture && currentTime - streamedTexture.lastRenderTime >= m_textureStreamingDropDelay)
+        {
+            texture->DropFullResolution();
+            m_textureStreamingStats.droppedTextureCount += 1;
+        }
+
+        if (texture->m_sfTexture || streamedTexture.request)
+        {
+            fullResolutionMemory += impl::GetTextureMemorySize(texture->m_fullSize);
+        }
+    }
+
+    // Requests are renewed on each render, a request exceeding the budget will be retried on the next pass.
+    for (StreamedTexture& streamedTexture : m_streamedTextures)
+    {
+        Texture* texture = streamedTexture.texture;
+        if (!texture->m_fullResolutionRequested)
+            continue;
+
+        texture->m_fullResolutionRequested = false;
+
+        if (texture->m_sfTexture || streamedTexture.request)
+            continue;
+
+        size_t requiredMemory = impl::GetTextureMemorySize(texture->m_fullSize);
+        if (!ReserveTextureStreamingMemory(fullResolutionMemory, requiredMemory, currentTime))
+            continue;
+
+        QueueTextureStreamingRequest(streamedTexture);
+    }
+
+    m_textureStreamingStats.streamedTextureCount = m_streamedTextures.size();
+    m_textureStreamingStats.fullResolutionTextureCount = 0;
+    m_textureStreamingStats.fullResolutionMemory = fullResolutionMemory;
+    m_textureStreamingStats.pendingLoadCount = 0;
+
+    for (const StreamedTexture& streamedTexture : m_streamedTextures)
+    {
+        m_textureStreamingStats.fullResolutionTextureCount += streamedTexture.texture->m_sfTexture ? 1 : 0;
+        m_textureStreamingStats.pendingLoadCount += streamedTexture.request ? 1 : 0;
+    }
+}
+
+bool ManagerResources::ReserveTextureStreamingMemory(size_t& residentMemory, size_t requiredMemory, float currentTime)
+{
+    size_t memoryBudget = m_textureStreamingStats.memoryBudget;
+    if (memoryBudget == 0 || residentMemory + requiredMemory <= memoryBudget)
+    {
+        residentMemory += requiredMemory;
+        return true;
+    }
+
+    // Only textures which have not been rendered during this pass can be dropped.
+    std::vector<StreamedTexture*> droppableTextures;
+    size_t droppableMemory = 0;
+    for (StreamedTexture& streamedTexture : m_streamedTextures)
+    {
+        if (streamedTexture.texture->m_sfTexture && streamedTexture.lastRenderTime < currentTime)
+        {
+            droppableTextures.push_back(&streamedTexture);
+            droppableMemory += impl::GetTextureMemorySize(streamedTexture.texture->m_fullSize);
+        }
+    }
+
+    // We avoid dropping textures if the request cannot fit anyway.
+    if (residentMemory - droppableMemory + requiredMemory > memoryBudget)
+        return false;
+
+    std::stable_sort(droppableTextures.begin(), droppableTextures.end(), [](const StreamedTexture* left, const StreamedTexture* right)
+    {
+        return left->lastRenderTime < right->lastRenderTime;
+    });
+
+    for (StreamedTexture* streamedTexture : droppableTextures)
+    {
+        if (residentMemory + requiredMemory <= memoryBudget)
+            break;
+
+        residentMemory -= impl::GetTextureMemorySize(streamedTexture->texture->m_fullSize);
+        streamedTexture->texture->DropFullResolution();
+        m_textureStreamingStats.droppedTextureCount += 1;
+    }
+
+    residentMemory += requiredMemory;
+    return true;
+}
+
+void ManagerResources::QueueTextureStreamingRequest(StreamedTexture& streamedTexture)
+{
+    TextureStreamingRequest* request = new TextureStreamingRequest;
+    request->texture = streamedTexture.texture;
+    streamedTexture.request = request;
+
+    // The request will stay alive until it is prepared, even if the texture is unloaded in the meantime.
+    GetEngine()->GetThreadPool()->PushTask([this, request]()
+    {
+        request->texture->PrepareFullResolution();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutexAsyncLoads);
+            request->prepared = true;
+        }
+
+        m_conditionAsyncLoadPrepared.notify_all();
+    });
+}
+
+void ManagerResources::RegisterStreamedTexture(Texture* texture)
+{
+    StreamedTexture streamedTexture;
+    streamedTexture.texture = texture;
+    streamedTexture.lastRenderTime = GetElapsedSeconds();
+    m_streamedTextures.push_back(streamedTexture);
+}
+
+void ManagerResources::UnregisterStreamedTexture(Texture* texture)
+{
+    for (size_t i = 0; i < m_streamedTextures.size(); ++i)
+    {
+        if (m_streamedTextures[i].texture != texture)
+            continue;
+
+        // A pending request is discarded, but we still need to wait for its worker task.
+        TextureStreamingRequest* request = m_streamedTextures[i].request;
+        if (request)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_mutexAsyncLoads);
+                m_conditionAsyncLoadPrepared.wait(lock, [request]() { return request->prepared; });
+            }
+
+            SafeDelete(texture->m_preparedImage);
+            SafeDelete(request);
+        }
+
+        StdVectorRemoveAt(m_streamedTextures, i);
+        return;
+    }
+}
+
+void ManagerResources::StopTextureStreaming(Texture* texture)
+{
+    for (size_t i = 0; i < m_streamedTextures.size(); ++i)
+    {
+        if (m_streamedTextures[i].texture != texture)
+            continue;
+
+        // A pending request is completed immediately, instead of decoding the full resolution twice.
+        TextureStreamingRequest* request = m_streamedTextures[i].request;
+        if (request)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_mutexAsyncLoads);
+                m_conditionAsyncLoadPrepared.wait(lock, [request]() { return request->prepared; });
+            }
+
+            SafeDelete(request);
+            texture->FinalizeFullResolution();
+        }
+        else if (!texture->m_sfTexture)
+        {
+            texture->PrepareFullResolution();
+            texture->FinalizeFullResolution();
+        }
+
+        StdVectorRemoveAt(m_streamedTextures, i);
+        break;
+    }
+
+    texture->m_streamed = false;
+    texture->m_streamingRendered = false;
+    texture->m_fullResolutionRequested = false;
+    SafeDelete(texture->m_sfFallbackTexture);
+    ++texture->m_residencyVersion;
+
+    GetLogEngine()->Print(ELog::Debug, ELogEngine::Resources, StringFormat("Texture streaming stopped : {0}", texture->GetID()));
+}
+
+}   // namespace gugu
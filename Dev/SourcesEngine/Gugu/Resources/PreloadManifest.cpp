@@ -0,0 +1,144 @@
+////////////////////////////////////////////////////////////////
+// Header
+
+#include "Gugu/Common.h"
+#include "Gugu/Resources/PreloadManifest.h"
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/External/PugiXmlUtility.h"
+
+#include <string_view>
+
+////////////////////////////////////////////////////////////////
+// File Implementation
+
+namespace gugu {
+
+namespace impl {
+
+struct ResourceTypeName
+{
+    EResourceType::Type resourceType;
+    std::string_view name;
+};
+
+const ResourceTypeName ResourceTypeNames[] =
+{
+    { EResourceType::Texture, "Texture" },
+    { EResourceType::Font, "Font" },
+    { EResourceType::AudioClip, "AudioClip" },
+    { EResourceType::AudioMixerGroup, "AudioMixerGroup" },
+    { EResourceType::SoundCue, "SoundCue" },
+    { EResourceType::ImageSet, "ImageSet" },
+    { EResourceType::AnimSet, "AnimSet" },
+    { EResourceType::ParticleEffect, "ParticleEffect" },
+    { EResourceType::Datasheet, "Datasheet" },
+    { EResourceType::ElementWidget, "ElementWidget" },
+    { EResourceType::LocalizationTable, "LocalizationTable" },
+    { EResourceType::PreloadManifest, "PreloadManifest" },
+};
+
+EResourceType::Type ResourceTypeFromName(std::string_view name)
+{
+    for (const ResourceTypeName& resourceTypeName : ResourceTypeNames)
+    {
+        if (resourceTypeName.name == name)
+            return resourceTypeName.resourceType;
+    }
+
+    return EResourceType::Unknown;
+}
+
+std::string_view ResourceTypeToName(EResourceType::Type resourceType)
+{
+    for (const ResourceTypeName& resourceTypeName : ResourceTypeNames)
+    {
+        if (resourceTypeName.resourceType == resourceType)
+            return resourceTypeName.name;
+    }
+
+    return "";
+}
+
+}   // namespace impl
+
+PreloadManifest::PreloadManifest()
+{
+}
+
+PreloadManifest::~PreloadManifest()
+{
+    Unload();
+}
+
+void PreloadManifest::SetEntries(const std::vector<PreloadManifestEntry>& entries)
+{
+    m_entries = entries;
+}
+
+void PreloadManifest::AddEntry(const std::string& resourceId, EResourceType::Type resourceType)
+{
+    PreloadManifestEntry entry;
+    entry.resourceId = resourceId;
+    entry.resourceType = resourceType;
+    m_entries.push_back(entry);
+}
+
+const std::vector<PreloadManifestEntry>& PreloadManifest::GetEntries() const
+{
+    return m_entries;
+}
+
+EResourceType::Type PreloadManifest::GetResourceType() const
+{
+    return EResourceType::PreloadManifest;
+}
+
+void PreloadManifest::Unload()
+{
+    m_entries.clear();
+}
+
+bool PreloadManifest::LoadFromXml(const pugi::xml_document& document)
+{
+    Unload();
+
+    pugi::xml_node rootNode = document.child("PreloadManifest");
+    if (!rootNode)
+        return false;
+
+    for (pugi::xml_node resourceNode = rootNode.child("Resource"); resourceNode; resourceNode = resourceNode.next_sibling("Resource"))
+    {
+        std::string resourceId = resourceNode.attribute("source").as_string();
+        if (resourceId.empty())
+            continue;
+
+        AddEntry(resourceId, impl::ResourceTypeFromName(resourceNode.attribute("type").as_string()));
+    }
+
+    return true;
+}
+
+bool PreloadManifest::SaveToXml(pugi::xml_document& document) const
+{
+    pugi::xml_node rootNode = document.append_child("PreloadManifest");
+    rootNode.append_attribute("serializationVersion") = 1;
+
+    for (const PreloadManifestEntry& entry : m_entries)
+    {
+        pugi::xml_node resourceNode = rootNode.append_child("Resource");
+        resourceNode.append_attribute("source").set_value(entry.resourceId.c_str());
+
+        std::string_view typeName = impl::ResourceTypeToName(entry.resourceType);
+        if (!typeName.empty())
+        {
+            resourceNode.append_attribute("type").set_value(std::string(typeName).c_str());
+        }
+    }
+
+    return true;
+}
+
+}   // namespace gugu
@@ -0,0 +1,49 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/Resources/Resource.h"
+
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// File Declarations
+
+namespace gugu {
+
+struct PreloadManifestEntry
+{
+    std::string resourceId;
+    EResourceType::Type resourceType = EResourceType::Unknown;  // Explicit type used by the prefetch (required for datasheets).
+};
+
+// List of resources needed by a scene or a game phase, to be prefetched asynchronously before they are used.
+// - Entries only reference resources by ID, a manifest does not keep its resources loaded.
+// - A manifest can be generated by recording the loads of a play session (see ManagerResources::StartLoadsRecording).
+class PreloadManifest : public Resource
+{
+public:
+
+    PreloadManifest();
+    virtual ~PreloadManifest();
+
+    void SetEntries(const std::vector<PreloadManifestEntry>& entries);
+    void AddEntry(const std::string& resourceId, EResourceType::Type resourceType);
+    const std::vector<PreloadManifestEntry>& GetEntries() const;
+
+    virtual EResourceType::Type GetResourceType() const override;
+
+protected:
+
+    virtual void Unload() override;
+    virtual bool LoadFromXml(const pugi::xml_document& document) override;
+    virtual bool SaveToXml(pugi::xml_document& document) const override;
+
+protected:
+
+    std::vector<PreloadManifestEntry> m_entries;
+};
+
+}   // namespace gugu
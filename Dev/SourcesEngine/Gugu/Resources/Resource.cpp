@@ -9,6 +9,9 @@
 
 #include "Gugu/Resources/ManagerResources.h"
 #include "Gugu/Resources/ResourceInfo.h"
+#include "Gugu/Resources/ResourceArchive.h"
+#include "Gugu/System/Memory.h"
+#include "Gugu/System/Platform.h"
 #include "Gugu/System/String.h"
 #include "Gugu/Debug/Logger.h"
 #include "Gugu/External/PugiXmlUtility.h"
@@ -21,10 +24,15 @@ namespace gugu {
 Resource::Resource()
 {
     m_resourceInfos = nullptr;
+    m_preparedDocument = nullptr;
+    m_preparedBinaryDocument = nullptr;
+    m_dependencyNodeId = 0;
 }
 
 Resource::~Resource()
 {
+    SafeDelete(m_preparedDocument);
+    SafeDelete(m_preparedBinaryDocument);
 }
 
 void Resource::Init(ResourceInfo* _pResourceInfos)
@@ -42,11 +50,21 @@ const FileInfo& Resource::GetFileInfo() const
     return m_resourceInfos->fileInfo;
 }
 
+bool Resource::IsArchived() const
+{
+    return m_resourceInfos && m_resourceInfos->archive;
+}
+
 EResourceType::Type Resource::GetResourceType() const
 {
     return EResourceType::Unknown;
 }
 
+size_t Resource::GetMemorySize() const
+{
+    return 0;
+}
+
 bool Resource::LoadFromFile()
 {
     if (!m_resourceInfos)
@@ -63,6 +81,71 @@ bool Resource::LoadFromString(const std::string& source)
     return LoadFromXmlString(source);
 }
 
+bool Resource::PrepareLoadFromFile()
+{
+    if (!m_resourceInfos)
+        return false;
+
+    SafeDelete(m_preparedDocument);
+    SafeDelete(m_preparedBinaryDocument);
+
+    if (m_resourceInfos->hasCookedFile)
+    {
+        xml::BinaryDocument* binaryDocument = new xml::BinaryDocument;
+        if (LoadCookedDocument(*binaryDocument))
+        {
+            if (CanLoadFromBinary())
+            {
+                m_preparedBinaryDocument = binaryDocument;
+                return true;
+            }
+
+            // The conversion is as costly as the parsing, it should not be left to the main thread (this is the case for datasheets).
+            pugi::xml_document* convertedDocument = new pugi::xml_document;
+            if (binaryDocument->ConvertToXml(*convertedDocument))
+            {
+                SafeDelete(binaryDocument);
+                m_preparedDocument = convertedDocument;
+                return true;
+            }
+
+            SafeDelete(convertedDocument);
+        }
+
+        SafeDelete(binaryDocument);
+        GetLogEngine()->Print(ELog::Warning, ELogEngine::Resources, StringFormat("Cooked resource file could not be loaded, fallback on the source file : {0}", m_resourceInfos->resourceID));
+    }
+
+    pugi::xml_document* document = new pugi::xml_document;
+    if (!LoadSourceXmlDocument(*document))
+    {
+        SafeDelete(document);
+        return false;
+    }
+
+    m_preparedDocument = document;
+    return true;
+}
+
+bool Resource::FinalizeLoadFromFile()
+{
+    if (m_preparedBinaryDocument)
+    {
+        bool result = LoadFromBinary(*m_preparedBinaryDocument);
+        SafeDelete(m_preparedBinaryDocument);
+        return result;
+    }
+
+    if (!m_preparedDocument)
+    {
+        return LoadFromFile();
+    }
+
+    bool result = LoadFromXml(*m_preparedDocument);
+    SafeDelete(m_preparedDocument);
+    return result;
+}
+
 bool Resource::SaveToFile() const
 {
     if (!m_resourceInfos)
@@ -81,14 +164,85 @@ bool Resource::SaveToString(std::string& result) const
 
 bool Resource::LoadFromXmlFile()
 {
+    if (m_resourceInfos->hasCookedFile)
+    {
+        xml::BinaryDocument binaryDocument;
+        if (LoadCookedDocument(binaryDocument))
+            return LoadFromBinary(binaryDocument);
+
+        GetLogEngine()->Print(ELog::Warning, ELogEngine::Resources, StringFormat("Cooked resource file could not be loaded, fallback on the source file : {0}", m_resourceInfos->resourceID));
+    }
+
     pugi::xml_document doc;
-    pugi::xml_parse_result result = doc.load_file(GetFileInfo().GetFileSystemPath().c_str());
-    if (!result)
+    if (!LoadSourceXmlDocument(doc))
         return false;
 
     return LoadFromXml(doc);
 }
 
+bool Resource::LoadXmlDocument(pugi::xml_document& document) const
+{
+    if (m_resourceInfos && m_resourceInfos->hasCookedFile)
+    {
+        xml::BinaryDocument binaryDocument;
+        if (LoadCookedDocument(binaryDocument) && binaryDocument.ConvertToXml(document))
+            return true;
+
+        GetLogEngine()->Print(ELog::Warning, ELogEngine::Resources, StringFormat("Cooked resource file could not be loaded, fallback on the source file : {0}", m_resourceInfos->resourceID));
+    }
+
+    return LoadSourceXmlDocument(document);
+}
+
+bool Resource::LoadSourceXmlDocument(pugi::xml_document& document) const
+{
+    if (IsArchived())
+    {
+        // The mapped memory is read-only, pugixml will parse its own copy of the buffer.
+        const uint8* data = nullptr;
+        size_t size = 0;
+        std::vector<uint8> buffer;
+        if (!GetArchiveContent(data, size, buffer))
+            return false;
+
+        return document.load_buffer(data, size);
+    }
+
+    return document.load_file(GetFileInfo().GetFileSystemPath().c_str());
+}
+
+bool Resource::LoadCookedDocument(xml::BinaryDocument& document) const
+{
+    std::vector<uint8> buffer;
+
+    if (m_resourceInfos->cookedArchiveEntry)
+    {
+        const uint8* data = nullptr;
+        size_t size = 0;
+        if (!m_resourceInfos->archive->GetEntryContent(m_resourceInfos->cookedArchiveEntry, data, size, buffer))
+            return false;
+
+        // Uncompressed entries are read directly from the mapped archive, which outlives its resources.
+        if (buffer.empty())
+            return document.Parse(data, size);
+
+        return document.Parse(std::move(buffer));
+    }
+
+    if (!ReadFileContent(m_resourceInfos->GetCookedFilePath_utf8(), buffer))
+        return false;
+
+    return document.Parse(std::move(buffer));
+}
+
+bool Resource::GetArchiveContent(const uint8*& data, size_t& size, std::vector<uint8>& buffer) const
+{
+    if (!IsArchived())
+        return false;
+
+    return m_resourceInfos->archive->GetEntryContent(m_resourceInfos->archiveEntry, data, size, buffer);
+}
+
 bool Resource::LoadFromXmlString(const std::string& source)
 {
     pugi::xml_document doc;
@@ -105,7 +259,17 @@ bool Resource::SaveToXmlFile() const
     if (!SaveToXml(doc))
         return false;
 
-    return doc.save_file(GetFileInfo().GetFileSystemPath().c_str(), PUGIXML_TEXT("\t"), pugi::format_default, pugi::encoding_utf8);
+    if (!doc.save_file(GetFileInfo().GetFileSystemPath().c_str(), PUGIXML_TEXT("\t"), pugi::format_default, pugi::encoding_utf8))
+        return false;
+
+    // The cooked file is now outdated.
+    if (m_resourceInfos->hasCookedFile && !m_resourceInfos->cookedArchiveEntry)
+    {
+        RemoveFile(m_resourceInfos->GetCookedFilePath_utf8());
+        m_resourceInfos->hasCookedFile = false;
+    }
+
+    return true;
 }
 
 bool Resource::SaveToXmlString(std::string& result) const
@@ -124,6 +288,20 @@ void Resource::Unload()
     GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("Unload is not supported for this type of resource : {0}", m_resourceInfos->fileInfo.GetFilePath_utf8()));
 }
 
+bool Resource::LoadFromBinary(const xml::BinaryDocument& document)
+{
+    pugi::xml_document xmlDocument;
+    if (!document.ConvertToXml(xmlDocument))
+        return false;
+
+    return LoadFromXml(xmlDocument);
+}
+
+bool Resource::CanLoadFromBinary() const
+{
+    return false;
+}
+
 bool Resource::LoadFromXml(const pugi::xml_document& document)
 {
     GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("LoadFromXml is not supported for this type of resource : {0}", m_resourceInfos->fileInfo.GetFilePath_utf8()));
@@ -4,9 +4,11 @@
 // Includes
 
 #include "Gugu/System/FileInfo.h"
+#include "Gugu/System/Types.h"
 #include "Gugu/Resources/EnumsResources.h"
 
 #include <set>
+#include <vector>
 
 ////////////////////////////////////////////////////////////////
 // Forward Declarations
@@ -14,6 +16,11 @@
 namespace gugu
 {
     class ResourceInfo;
+
+    namespace xml
+    {
+        class BinaryDocument;
+    }
 }
 
 namespace pugi
@@ -28,6 +35,8 @@ namespace gugu {
     
 class Resource
 {
+    friend class ManagerResources;
+
 public:
 
     Resource();
@@ -37,12 +46,23 @@ public:
 
     const std::string& GetID() const;
     const FileInfo& GetFileInfo() const;
+    bool IsArchived() const;
 
     virtual EResourceType::Type GetResourceType() const;
 
+    // Estimation of the memory used by the loaded resource data (used by the resources eviction).
+    virtual size_t GetMemorySize() const;
+
     virtual bool LoadFromFile();
     virtual bool LoadFromString(const std::string& source);
 
+    // Asynchronous loads are split in two phases :
+    // - PrepareLoadFromFile is called from a worker thread, it should only read and decode the file, without accessing other resources.
+    // - FinalizeLoadFromFile is called from the main thread, to complete the load (gpu upload, dependencies).
+    // By default, xml documents are parsed during the preparation, and resources with a specific LoadFromFile will be loaded during the finalization.
+    virtual bool PrepareLoadFromFile();
+    virtual bool FinalizeLoadFromFile();
+
     virtual bool SaveToFile() const;
     virtual bool SaveToString(std::string& result) const;
 
@@ -50,8 +70,18 @@ public:
     virtual void OnDependencyUpdated(const Resource* dependency);
     virtual void OnDependencyRemoved(const Resource* dependency);
 
+    // Parse the resource file as an xml document, either from its archive or from the disk.
+    // - The cooked version of the file is used when available, with a fallback on the xml file.
+    bool LoadXmlDocument(pugi::xml_document& document) const;
+
 protected:
 
+    // Retrieve the resource file content from its archive (the buffer is only used for compressed entries).
+    bool GetArchiveContent(const uint8*& data, size_t& size, std::vector<uint8>& buffer) const;
+
+    bool LoadSourceXmlDocument(pugi::xml_document& document) const;
+    bool LoadCookedDocument(xml::BinaryDocument& document) const;
+
     bool LoadFromXmlFile();
     bool LoadFromXmlString(const std::string& source);
     bool SaveToXmlFile() const;
@@ -61,9 +91,20 @@ protected:
     virtual bool LoadFromXml(const pugi::xml_document& document);
     virtual bool SaveToXml(pugi::xml_document& document) const;
 
+    // Cooked files are read in place by the resources overriding this, the default implementation rebuilds an xml document.
+    // - Resources without an in-place implementation have their xml document rebuilt during the preparation, on the worker thread.
+    virtual bool LoadFromBinary(const xml::BinaryDocument& document);
+    virtual bool CanLoadFromBinary() const;
+
 protected:
 
     ResourceInfo* m_resourceInfos;
+    pugi::xml_document* m_preparedDocument;
+    xml::BinaryDocument* m_preparedBinaryDocument;
+
+private:
+
+    uint32 m_dependencyNodeId;      // Node in the ManagerResources dependencies graph (node index + 1, zero when unregistered).
 };
 
 }   // namespace gugu
@@ -0,0 +1,433 @@
+////////////////////////////////////////////////////////////////
+// Header
+
+#include "Gugu/Common.h"
+#include "Gugu/Resources/ResourceArchive.h"
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/System/Compression.h"
+#include "Gugu/System/Path.h"
+#include "Gugu/System/Platform.h"
+#include "Gugu/System/String.h"
+#include "Gugu/Debug/Logger.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#if defined(GUGU_OS_WINDOWS)
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+////////////////////////////////////////////////////////////////
+// File Implementation
+
+namespace gugu {
+
+namespace impl {
+
+// Archive layout : header, entries data, table of contents, paths table.
+struct ResourceArchiveHeader
+{
+    char magic[4] = { 'G', 'P', 'A', 'K' };
+    uint32 version = 1;
+    uint32 entryCount = 0;
+    uint32 reserved = 0;
+    uint64 tocOffset = 0;
+    uint64 pathsOffset = 0;
+};
+
+static_assert(sizeof(ResourceArchiveHeader) == 32, "ResourceArchiveHeader layout is part of the archive format");
+static_assert(sizeof(ResourceArchiveEntry) == 40, "ResourceArchiveEntry layout is part of the archive format");
+
+constexpr uint32 ResourceArchiveVersion = 1;
+constexpr size_t ResourceArchiveDataAlignment = 16;
+
+size_t AlignOffset(size_t offset, size_t alignment)
+{
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+void WritePadding(std::ofstream& file, size_t& offset, size_t alignment)
+{
+    static const char padding[ResourceArchiveDataAlignment] = {};
+
+    size_t alignedOffset = AlignOffset(offset, alignment);
+    file.write(padding, alignedOffset - offset);
+    offset = alignedOffset;
+}
+
+}   // namespace impl
+
+ResourceArchive::ResourceArchive()
+    : m_data(nullptr)
+    , m_size(0)
+    , m_entries(nullptr)
+    , m_entryCount(0)
+    , m_paths(nullptr)
+    , m_pathsSize(0)
+    , m_fileHandle(nullptr)
+    , m_mappingHandle(nullptr)
+{
+}
+
+ResourceArchive::~ResourceArchive()
+{
+    Close();
+}
+
+bool ResourceArchive::Open(const std::string& archivePath_utf8)
+{
+    Close();
+
+    if (!MapFile(archivePath_utf8))
+    {
+        GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("Resource archive could not be mapped : {0}", archivePath_utf8));
+        return false;
+    }
+
+    impl::ResourceArchiveHeader header;
+    bool validArchive = m_size >= sizeof(header);
+
+    if (validArchive)
+    {
+        std::memcpy(&header, m_data, sizeof(header));
+
+        // The table of contents is read in place, it needs to be properly aligned.
+        validArchive = std::memcmp(header.magic, impl::ResourceArchiveHeader().magic, sizeof(header.magic)) == 0
+            && header.version == impl::ResourceArchiveVersion
+            && header.tocOffset % alignof(ResourceArchiveEntry) == 0
+            && header.tocOffset <= m_size
+            && header.entryCount <= (m_size - header.tocOffset) / sizeof(ResourceArchiveEntry)
+            && header.pathsOffset <= m_size;
+    }
+
+    if (validArchive)
+    {
+        m_entries = reinterpret_cast<const ResourceArchiveEntry*>(m_data + header.tocOffset);
+        m_entryCount = header.entryCount;
+        m_paths = reinterpret_cast<const char*>(m_data + header.pathsOffset);
+        m_pathsSize = m_size - static_cast<size_t>(header.pathsOffset);
+
+        for (size_t i = 0; i < m_entryCount && validArchive; ++i)
+        {
+            const ResourceArchiveEntry& entry = m_entries[i];
+            validArchive = static_cast<size_t>(entry.pathOffset) + entry.pathSize <= m_pathsSize
+                && entry.dataOffset <= m_size
+                && entry.storedSize <= m_size - entry.dataOffset
+                && (IsEntryCompressed(&entry) || entry.storedSize == entry.size);
+        }
+    }
+
+    if (!validArchive)
+    {
+        GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("Resource archive is invalid : {0}", archivePath_utf8));
+        Close();
+        return false;
+    }
+
+    m_archivePath = archivePath_utf8;
+
+    GetLogEngine()->Print(ELog::Info, ELogEngine::Resources, StringFormat("Resource archive opened : {0} (Entries : {1})", archivePath_utf8, m_entryCount));
+    return true;
+}
+
+void ResourceArchive::Close()
+{
+    UnmapFile();
+
+    m_archivePath.clear();
+    m_entries = nullptr;
+    m_entryCount = 0;
+    m_paths = nullptr;
+    m_pathsSize = 0;
+}
+
+bool ResourceArchive::IsOpen() const
+{
+    return m_data != nullptr;
+}
+
+const std::string& ResourceArchive::GetArchivePath() const
+{
+    return m_archivePath;
+}
+
+size_t ResourceArchive::GetEntryCount() const
+{
+    return m_entryCount;
+}
+
+const ResourceArchiveEntry* ResourceArchive::GetEntry(size_t index) const
+{
+    return index < m_entryCount ? &m_entries[index] : nullptr;
+}
+
+const ResourceArchiveEntry* ResourceArchive::FindEntry(std::string_view path) const
+{
+    const ResourceArchiveEntry* entriesEnd = m_entries + m_entryCount;
+    const ResourceArchiveEntry* entry = std::lower_bound(m_entries, entriesEnd, path, [this](const ResourceArchiveEntry& left, std::string_view right)
+    {
+        return GetEntryPath(&left) < right;
+    });
+
+    if (entry != entriesEnd && GetEntryPath(entry) == path)
+        return entry;
+
+    return nullptr;
+}
+
+std::string_view ResourceArchive::GetEntryPath(const ResourceArchiveEntry* entry) const
+{
+    return std::string_view(m_paths + entry->pathOffset, entry->pathSize);
+}
+
+bool ResourceArchive::IsEntryCompressed(const ResourceArchiveEntry* entry) const
+{
+    return (entry->flags & EResourceArchiveEntryFlag::Compressed) != 0;
+}
+
+bool ResourceArchive::GetEntryContent(const ResourceArchiveEntry* entry, const uint8*& data, size_t& size, std::vector<uint8>& buffer) const
+{
+    if (!IsOpen() || !entry)
+        return false;
+
+    const uint8* storedData = m_data + entry->dataOffset;
+
+    if (!IsEntryCompressed(entry))
+    {
+        data = storedData;
+        size = static_cast<size_t>(entry->size);
+        return true;
+    }
+
+    buffer.resize(static_cast<size_t>(entry->size));
+    if (!DecompressLZ(storedData, static_cast<size_t>(entry->storedSize), buffer.data(), buffer.size()))
+    {
+        GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("Resource archive entry could not be decompressed : {0}", GetEntryPath(entry)));
+        return false;
+    }
+
+    data = buffer.data();
+    size = buffer.size();
+    return true;
+}
+
+bool ResourceArchive::PackDirectory(const std::string& directoryPath_utf8, const std::string& archivePath_utf8, bool compressEntries)
+{
+    std::string rootPath = NormalizePath(directoryPath_utf8);
+    if (!DirectoryExists(rootPath))
+    {
+        GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("Resource archive source directory could not be found : {0}", directoryPath_utf8));
+        return false;
+    }
+
+    std::vector<FileInfo> files;
+    GetFiles(rootPath, files, true);
+
+    // Sort entries by relative path, the table of contents relies on it for its binary searches.
+    std::vector<std::pair<std::string, const FileInfo*>> sortedFiles;
+    sortedFiles.reserve(files.size());
+
+    FileInfo archiveFileInfo = FileInfo::FromString_utf8(archivePath_utf8);
+
+    for (const FileInfo& fileInfo : files)
+    {
+        std::string_view filePath = fileInfo.GetFilePath_utf8();
+        if (!rootPath.empty() && PathStartsWith(filePath, rootPath))
+        {
+            filePath = filePath.substr(rootPath.size());
+        }
+
+        while (!filePath.empty() && filePath.front() == system::PathSeparator)
+        {
+            filePath.remove_prefix(1);
+        }
+
+        // Ignore the archive itself if it lies in the packed directory.
+        if (fileInfo == archiveFileInfo)
+            continue;
+
+        sortedFiles.push_back(std::make_pair(std::string(filePath), &fileInfo));
+    }
+
+    std::sort(sortedFiles.begin(), sortedFiles.end());
+
+    std::ofstream file(std::filesystem::u8path(archivePath_utf8), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("Resource archive could not be created : {0}", archivePath_utf8));
+        return false;
+    }
+
+    // The header is written last, once all offsets are known.
+    impl::ResourceArchiveHeader header;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    size_t offset = sizeof(header);
+
+    std::vector<ResourceArchiveEntry> entries;
+    entries.reserve(sortedFiles.size());
+
+    std::string paths;
+    std::vector<uint8> content;
+    std::vector<uint8> compressedContent;
+    size_t compressedEntryCount = 0;
+
+    for (const auto& sortedFile : sortedFiles)
+    {
+        if (!ReadFileContent(sortedFile.second->GetFilePath_utf8(), content))
+        {
+            GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("Resource archive could not read file : {0}", sortedFile.second->GetFilePath_utf8()));
+            return false;
+        }
+
+        impl::WritePadding(file, offset, impl::ResourceArchiveDataAlignment);
+
+        ResourceArchiveEntry entry;
+        entry.pathOffset = static_cast<uint32>(paths.size());
+        entry.pathSize = static_cast<uint32>(sortedFile.first.size());
+        entry.dataOffset = offset;
+        entry.size = content.size();
+
+        const std::vector<uint8>* storedContent = &content;
+
+        if (compressEntries)
+        {
+            // Only keep compression when it saves at least an eighth of the entry size.
+            CompressLZ(content.data(), content.size(), compressedContent);
+            if (compressedContent.size() < content.size() - content.size() / 8)
+            {
+                entry.flags |= EResourceArchiveEntryFlag::Compressed;
+                storedContent = &compressedContent;
+                ++compressedEntryCount;
+            }
+        }
+
+        entry.storedSize = storedContent->size();
+        file.write(reinterpret_cast<const char*>(storedContent->data()), storedContent->size());
+        offset += storedContent->size();
+
+        paths += sortedFile.first;
+        entries.push_back(entry);
+    }
+
+    impl::WritePadding(file, offset, alignof(ResourceArchiveEntry));
+    header.tocOffset = offset;
+    header.entryCount = static_cast<uint32>(entries.size());
+    file.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(ResourceArchiveEntry));
+    offset += entries.size() * sizeof(ResourceArchiveEntry);
+
+    header.pathsOffset = offset;
+    file.write(paths.data(), paths.size());
+
+    file.seekp(0, std::ios::beg);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    if (!file.good())
+    {
+        GetLogEngine()->Print(ELog::Error, ELogEngine::Resources, StringFormat("Resource archive could not be written : {0}", archivePath_utf8));
+        return false;
+    }
+
+    GetLogEngine()->Print(ELog::Info, ELogEngine::Resources, StringFormat("Resource archive packed : {0} (Entries : {1}, Compressed : {2})", archivePath_utf8, entries.size(), compressedEntryCount));
+    return true;
+}
+
+bool ResourceArchive::MapFile(const std::string& archivePath_utf8)
+{
+#if defined(GUGU_OS_WINDOWS)
+
+    std::wstring archivePath = std::filesystem::u8path(archivePath_utf8).wstring();
+
+    HANDLE fileHandle = CreateFileW(archivePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+    {
+        CloseHandle(fileHandle);
+        return false;
+    }
+
+    HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mappingHandle)
+    {
+        CloseHandle(fileHandle);
+        return false;
+    }
+
+    void* data = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (!data)
+    {
+        CloseHandle(mappingHandle);
+        CloseHandle(fileHandle);
+        return false;
+    }
+
+    m_fileHandle = fileHandle;
+    m_mappingHandle = mappingHandle;
+    m_data = static_cast<const uint8*>(data);
+    m_size = static_cast<size_t>(fileSize.QuadPart);
+    return true;
+
+#else
+
+    int fileDescriptor = open(std::filesystem::u8path(archivePath_utf8).c_str(), O_RDONLY);
+    if (fileDescriptor < 0)
+        return false;
+
+    struct stat fileStatus;
+    if (fstat(fileDescriptor, &fileStatus) != 0 || fileStatus.st_size <= 0)
+    {
+        close(fileDescriptor);
+        return false;
+    }
+
+    // The mapping stays valid once the file descriptor is closed.
+    void* data = mmap(nullptr, static_cast<size_t>(fileStatus.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    close(fileDescriptor);
+
+    if (data == MAP_FAILED)
+        return false;
+
+    m_data = static_cast<const uint8*>(data);
+    m_size = static_cast<size_t>(fileStatus.st_size);
+    return true;
+
+#endif
+}
+
+void ResourceArchive::UnmapFile()
+{
+    if (!m_data)
+        return;
+
+#if defined(GUGU_OS_WINDOWS)
+
+    UnmapViewOfFile(m_data);
+    CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+    CloseHandle(static_cast<HANDLE>(m_fileHandle));
+
+    m_mappingHandle = nullptr;
+    m_fileHandle = nullptr;
+
+#else
+
+    munmap(const_cast<uint8*>(m_data), m_size);
+
+#endif
+
+    m_data = nullptr;
+    m_size = 0;
+}
+
+}   // namespace gugu
@@ -0,0 +1,89 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/System/Types.h"
+
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// File Declarations
+
+namespace gugu {
+
+namespace EResourceArchiveEntryFlag
+{
+    enum Type : uint32
+    {
+        None        = 0,
+        Compressed  = 1 << 0,
+    };
+}
+
+// Table of contents entry, as stored in the archive file (little endian).
+struct ResourceArchiveEntry
+{
+    uint32 pathOffset = 0;      // Offset of the entry path in the path table.
+    uint32 pathSize = 0;
+    uint64 dataOffset = 0;      // Offset of the entry data in the archive.
+    uint64 storedSize = 0;      // Size of the entry data in the archive.
+    uint64 size = 0;            // Size of the entry data once decompressed.
+    uint32 flags = 0;
+    uint32 reserved = 0;
+};
+
+// Packed archive of resource files, memory-mapped and read without intermediate copies.
+// - Entries are sorted by path (relative to the packed directory, using '/' separators), to allow binary searches.
+// - Entries may be individually compressed, in which case their content needs to be decompressed in a buffer.
+class ResourceArchive
+{
+public:
+
+    ResourceArchive();
+    ~ResourceArchive();
+
+    bool Open(const std::string& archivePath_utf8);
+    void Close();
+
+    bool IsOpen() const;
+    const std::string& GetArchivePath() const;
+
+    size_t GetEntryCount() const;
+    const ResourceArchiveEntry* GetEntry(size_t index) const;
+    const ResourceArchiveEntry* FindEntry(std::string_view path) const;
+
+    std::string_view GetEntryPath(const ResourceArchiveEntry* entry) const;
+    bool IsEntryCompressed(const ResourceArchiveEntry* entry) const;
+
+    // Retrieve the entry content, directly from the mapped memory when the entry is not compressed, or decompressed into the buffer.
+    // - Mapped memory stays valid as long as the archive is open.
+    bool GetEntryContent(const ResourceArchiveEntry* entry, const uint8*& data, size_t& size, std::vector<uint8>& buffer) const;
+
+    // Pack all the files contained in a directory.
+    // - Compression is only kept for entries where it is worth it (already compressed formats will be stored as is).
+    static bool PackDirectory(const std::string& directoryPath_utf8, const std::string& archivePath_utf8, bool compressEntries);
+
+private:
+
+    bool MapFile(const std::string& archivePath_utf8);
+    void UnmapFile();
+
+private:
+
+    std::string m_archivePath;
+
+    const uint8* m_data;
+    size_t m_size;
+
+    const ResourceArchiveEntry* m_entries;
+    size_t m_entryCount;
+    const char* m_paths;
+    size_t m_pathsSize;
+
+    void* m_fileHandle;         // Only used on Windows.
+    void* m_mappingHandle;      // Only used on Windows.
+};
+
+}   // namespace gugu
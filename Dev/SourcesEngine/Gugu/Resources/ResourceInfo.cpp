@@ -9,6 +9,7 @@
 
 #include "Gugu/Resources/Resource.h"
 #include "Gugu/System/Memory.h"
+#include "Gugu/System/Path.h"
 
 ////////////////////////////////////////////////////////////////
 // File Implementation
@@ -17,7 +18,19 @@ namespace gugu {
     
 ResourceInfo::ResourceInfo()
 {
+    resourceType = EResourceType::Unknown;
     resource = nullptr;
+    loadedFromFile = false;
+    memorySize = 0;
+    lastUseTick = 0;
+    pinCount = 0;
+    prefetched = false;
+    archive = nullptr;
+    archiveEntry = nullptr;
+    hasCookedFile = false;
+    cookedArchiveEntry = nullptr;
+    fileTime = 0;
+    fileSize = 0;
 }
 
 ResourceInfo::~ResourceInfo()
@@ -30,4 +43,12 @@ bool ResourceInfo::CompareID(const ResourceInfo* pLeft, const ResourceInfo* pRig
     return pLeft->resourceID < pRight->resourceID;
 }
 
+std::string ResourceInfo::GetCookedFilePath_utf8() const
+{
+    std::string path(fileInfo.GetFilePath_utf8());
+    path += system::ExtensionSeparator;
+    path += resources::CookedFileExtension;
+    return path;
+}
+
 }   // namespace gugu
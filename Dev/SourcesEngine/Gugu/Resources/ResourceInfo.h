@@ -4,6 +4,12 @@
 // Includes
 
 #include "Gugu/System/FileInfo.h"
+#include "Gugu/System/Types.h"
+#include "Gugu/Resources/EnumsResources.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
 
 ////////////////////////////////////////////////////////////////
 // Forward Declarations
@@ -11,6 +17,8 @@
 namespace gugu
 {
     class Resource;
+    class ResourceArchive;
+    struct ResourceArchiveEntry;
 }
 
 ////////////////////////////////////////////////////////////////
@@ -18,6 +26,12 @@ namespace gugu
 
 namespace gugu {
 
+// Constants.
+namespace resources
+{
+    inline constexpr std::string_view CookedFileExtension = "cooked";
+}
+
 class ResourceInfo
 {
 public:
@@ -28,12 +42,38 @@ public:
     // TODO: seems unused, remove ?
     static bool CompareID(const ResourceInfo* pLeft, const ResourceInfo* pRight);
 
+    // Path of the cooked file, next to the resource file.
+    std::string GetCookedFilePath_utf8() const;
+
 public:
 
     // TODO: proper accessors + ctor ?
     std::string resourceID;
     FileInfo fileInfo;
+    EResourceType::Type resourceType;   // Type deduced from the file extension, or restored from the resource cache.
     Resource* resource;
+
+    // Residency tracking, used by the resources eviction.
+    bool loadedFromFile;    // Only resources loaded from their file can be evicted, since they can be reloaded.
+    size_t memorySize;      // Last measured memory size of the loaded resource.
+    uint32 lastUseTick;     // Last eviction pass in which the resource was accessed.
+    uint32 pinCount;        // Raw pointers returned by the Get* accessors, until their holders call ReleaseResource. Pinned resources can't be evicted.
+
+    // Set when the resource has been loaded by a prefetch, until its first access.
+    bool prefetched;
+
+    // Set when the resource file is packed in a mounted archive.
+    const ResourceArchive* archive;
+    const ResourceArchiveEntry* archiveEntry;
+
+    // Set when a cooked version of the resource file is available (next to the file, or in the same archive).
+    bool hasCookedFile;
+    const ResourceArchiveEntry* cookedArchiveEntry;
+
+    // Resource cache state, an entry is only restored while the file keeps the same modification time and size.
+    int64 fileTime;
+    uint64 fileSize;
+    std::vector<std::string> cachedDependencies;    // Dependencies IDs recorded during the last load (in this run or a previous one).
 };
 
 }   // namespace gugu
@@ -0,0 +1,151 @@
+////////////////////////////////////////////////////////////////
+// Header
+
+#include "Gugu/Common.h"
+#include "Gugu/Resources/ResourceRef.h"
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/Engine.h"
+#include "Gugu/Resources/ManagerResources.h"
+#include "Gugu/Resources/ResourceInfo.h"
+#include "Gugu/System/String.h"
+#include "Gugu/Debug/Logger.h"
+
+////////////////////////////////////////////////////////////////
+// File Implementation
+
+namespace gugu {
+
+namespace impl {
+
+// Refs may be destroyed after the engine release, in which case there is no manager left to notify.
+ManagerResources* GetResourcesIfInstanciated()
+{
+    return Engine::IsInstanciated() ? GetEngine()->GetManagerResources() : nullptr;
+}
+
+}   // namespace impl
+
+ResourceRef::ResourceRef()
+    : m_resourceInfo(nullptr)
+    , m_generation(0)
+{
+}
+
+ResourceRef::ResourceRef(const std::string& resourceId)
+    : m_resourceInfo(nullptr)
+    , m_generation(0)
+{
+    SetResourceID(resourceId);
+}
+
+ResourceRef::ResourceRef(const ResourceRef& right)
+    : m_resourceInfo(nullptr)
+    , m_generation(0)
+{
+    SetResourceID(right.m_resourceId);
+}
+
+ResourceRef::~ResourceRef()
+{
+    SetResourceID("");
+}
+
+ResourceRef& ResourceRef::operator = (const ResourceRef& right)
+{
+    if (this != &right)
+    {
+        SetResourceID(right.m_resourceId);
+    }
+
+    return *this;
+}
+
+void ResourceRef::SetResourceID(const std::string& resourceId)
+{
+    if (m_resourceId.empty() && resourceId.empty())
+        return;
+
+    ManagerResources* manager = impl::GetResourcesIfInstanciated();
+
+    if (!m_resourceId.empty() && manager)
+    {
+        manager->ReleaseResourceRef(m_key);
+    }
+
+    m_resourceId = resourceId;
+    m_key = Hash(resourceId);
+    m_resourceInfo = nullptr;
+    m_generation = 0;
+
+    if (!m_resourceId.empty() && manager)
+    {
+        manager->AcquireResourceRef(m_key);
+    }
+}
+
+const std::string& ResourceRef::GetResourceID() const
+{
+    return m_resourceId;
+}
+
+bool ResourceRef::IsRegistered() const
+{
+    return GetResourceInfo() != nullptr;
+}
+
+bool ResourceRef::IsLoaded() const
+{
+    ResourceInfo* resourceInfo = GetResourceInfo();
+    return resourceInfo && resourceInfo->resource;
+}
+
+ResourceInfo* ResourceRef::GetResourceInfo() const
+{
+    if (m_resourceId.empty())
+        return nullptr;
+
+    ManagerResources* manager = GetResources();
+
+    // The generation is never zero on the manager side, an unresolved ref will always look up the map.
+    if (m_generation != manager->m_resourceInfosGeneration)
+    {
+        m_resourceInfo = manager->FindResourceInfo(m_key, m_resourceId);
+        m_generation = m_resourceInfo ? manager->m_resourceInfosGeneration : 0;
+    }
+
+    return m_resourceInfo;
+}
+
+Resource* ResourceRef::GetResource(EResourceType::Type explicitType) const
+{
+    ResourceInfo* resourceInfo = GetResourceInfo();
+    if (!resourceInfo)
+    {
+        if (!m_resourceId.empty())
+        {
+            GetLogEngine()->Print(ELog::Warning, ELogEngine::Resources, StringFormat("GetResource failed, unknown resource : {0}", m_resourceId));
+        }
+
+        return nullptr;
+    }
+
+    ManagerResources* manager = GetResources();
+    resourceInfo->lastUseTick = manager->m_residencyTick;
+
+    if (resourceInfo->resource)
+    {
+        if (resourceInfo->prefetched)
+        {
+            manager->OnPrefetchedResourceAccessed(resourceInfo);
+        }
+
+        return resourceInfo->resource;
+    }
+
+    return manager->LoadResource(resourceInfo, explicitType);
+}
+
+}   // namespace gugu
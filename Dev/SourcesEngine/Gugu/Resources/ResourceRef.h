@@ -0,0 +1,64 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/Resources/EnumsResources.h"
+#include "Gugu/System/Hash.h"
+
+#include <string>
+
+////////////////////////////////////////////////////////////////
+// Forward Declarations
+
+namespace gugu
+{
+    class ResourceInfo;
+    class Resource;
+}
+
+////////////////////////////////////////////////////////////////
+// File Declarations
+
+namespace gugu {
+
+// Handle on a resource, storing its hashed ID and caching its ResourceInfo.
+// - Repeated accesses skip the ID hashing and the resource map lookup.
+// - The cache is invalidated when the ManagerResources removes or moves resources.
+// - A ResourceRef holding an ID prevents the eviction of the resource.
+class ResourceRef
+{
+public:
+
+    ResourceRef();
+    ResourceRef(const std::string& resourceId);
+    ResourceRef(const ResourceRef& right);
+    ~ResourceRef();
+
+    ResourceRef& operator = (const ResourceRef& right);
+
+    void SetResourceID(const std::string& resourceId);
+    const std::string& GetResourceID() const;
+
+    bool IsRegistered() const;
+    bool IsLoaded() const;
+
+    ResourceInfo* GetResourceInfo() const;
+    Resource* GetResource(EResourceType::Type explicitType = EResourceType::Unknown) const;
+
+    template<typename T>
+    T* Get(EResourceType::Type explicitType = EResourceType::Unknown) const
+    {
+        return dynamic_cast<T*>(GetResource(explicitType));
+    }
+
+private:
+
+    std::string m_resourceId;
+    Hash m_key;
+
+    mutable ResourceInfo* m_resourceInfo;
+    mutable uint32 m_generation;
+};
+
+}   // namespace gugu
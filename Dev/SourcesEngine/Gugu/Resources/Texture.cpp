@@ -8,27 +8,141 @@
 // Includes
 
 #include "Gugu/Resources/ManagerResources.h"
+#include "Gugu/Resources/ResourceInfo.h"
+#include "Gugu/Resources/ResourceArchive.h"
+#include "Gugu/Math/MathUtility.h"
+#include "Gugu/System/Compression.h"
 #include "Gugu/System/Memory.h"
+#include "Gugu/System/Platform.h"
 #include "Gugu/System/String.h"
 #include "Gugu/Debug/Logger.h"
 
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/Image.hpp>
 
+#include <cstring>
+
 ////////////////////////////////////////////////////////////////
 // File Implementation
 
 namespace gugu {
 
+namespace impl {
+
+// Cooked texture layout : header, followed by the compressed pixels of the fallback (32 bits rgba).
+struct CookedTextureHeader
+{
+    uint32 magic = 0;
+    uint32 version = 0;
+    uint32 width = 0;
+    uint32 height = 0;
+    uint32 fallbackWidth = 0;
+    uint32 fallbackHeight = 0;
+};
+
+constexpr uint32 CookedTextureMagic = 0x58544743;   // "CGTX".
+constexpr uint32 CookedTextureVersion = 1;
+
+bool IsStreamedSize(const Vector2u& size, unsigned int streamingMinSize)
+{
+    return streamingMinSize > 0 && (size.x >= streamingMinSize || size.y >= streamingMinSize);
+}
+
+void DownscaleImage(const sf::Image& source, unsigned int divider, sf::Image& result)
+{
+    Vector2u sourceSize = source.getSize();
+    Vector2u resultSize(Max(1u, (sourceSize.x + divider - 1) / divider), Max(1u, (sourceSize.y + divider - 1) / divider));
+
+    const uint8* sourcePixels = source.getPixelsPtr();
+    std::vector<uint8> pixels(static_cast<size_t>(resultSize.x) * resultSize.y * 4);
+
+    // Box filter, colors are weighted by their alpha to avoid bleeding the color of transparent pixels.
+    for (unsigned int y = 0; y < resultSize.y; ++y)
+    {
+        unsigned int sourceTop = y * divider;
+        unsigned int sourceBottom = Min(sourceTop + divider, sourceSize.y);
+
+        for (unsigned int x = 0; x < resultSize.x; ++x)
+        {
+            unsigned int sourceLeft = x * divider;
+            unsigned int sourceRight = Min(sourceLeft + divider, sourceSize.x);
+
+            uint64 sumColor[3] = { 0, 0, 0 };
+            uint64 sumAlpha = 0;
+            uint64 count = 0;
+
+            for (unsigned int sourceY = sourceTop; sourceY < sourceBottom; ++sourceY)
+            {
+                const uint8* sourcePixel = sourcePixels + (static_cast<size_t>(sourceY) * sourceSize.x + sourceLeft) * 4;
+                for (unsigned int sourceX = sourceLeft; sourceX < sourceRight; ++sourceX, sourcePixel += 4)
+                {
+                    uint64 alpha = sourcePixel[3];
+                    sumColor[0] += sourcePixel[0] * alpha;
+                    sumColor[1] += sourcePixel[1] * alpha;
+                    sumColor[2] += sourcePixel[2] * alpha;
+                    sumAlpha += alpha;
+                    ++count;
+                }
+            }
+
+            uint8* pixel = pixels.data() + (static_cast<size_t>(y) * resultSize.x + x) * 4;
+            for (size_t channel = 0; channel < 3; ++channel)
+            {
+                pixel[channel] = sumAlpha > 0 ? static_cast<uint8>((sumColor[channel] + sumAlpha / 2) / sumAlpha) : 0;
+            }
+
+            pixel[3] = static_cast<uint8>((sumAlpha + count / 2) / count);
+        }
+    }
+
+    result = sf::Image(resultSize, pixels.data());
+}
+
+bool ParseCookedTexture(const uint8* data, size_t size, sf::Image& fallbackImage, Vector2u& fullSize)
+{
+    CookedTextureHeader header;
+    if (size < sizeof(header))
+        return false;
+
+    std::memcpy(&header, data, sizeof(header));
+    if (header.magic != CookedTextureMagic
+        || header.version != CookedTextureVersion
+        || header.fallbackWidth == 0
+        || header.fallbackHeight == 0)
+    {
+        return false;
+    }
+
+    std::vector<uint8> pixels(static_cast<size_t>(header.fallbackWidth) * header.fallbackHeight * 4);
+    if (!DecompressLZ(data + sizeof(header), size - sizeof(header), pixels.data(), pixels.size()))
+        return false;
+
+    fallbackImage = sf::Image(Vector2u(header.fallbackWidth, header.fallbackHeight), pixels.data());
+    fullSize = Vector2u(header.width, header.height);
+    return true;
+}
+
+}   // namespace impl
+
 Texture::Texture()
 : m_sfTexture(nullptr)
+, m_sfFallbackTexture(nullptr)
+, m_preparedImage(nullptr)
+, m_preparedFallbackImage(nullptr)
+, m_residencyVersion(0)
+, m_streamed(false)
+, m_streamingRendered(false)
+, m_fullResolutionRequested(false)
 {
 }
 
 Texture::~Texture()
 {
     Unload();
+    SafeDelete(m_preparedImage);
+    SafeDelete(m_preparedFallbackImage);
 }
 
 void Texture::SetSFTexture(sf::Texture* _pSFTexture)
@@ -36,17 +150,82 @@ void Texture::SetSFTexture(sf::Texture* _pSFTexture)
     m_sfTexture = _pSFTexture;
 }
 
-sf::Texture* Texture::GetSFTexture() const
+sf::Texture* Texture::GetSFTexture()
 {
+    if (m_streamed)
+    {
+        GetResources()->StopTextureStreaming(this);
+    }
+
     return m_sfTexture;
 }
 
+sf::Texture* Texture::GetRenderSFTexture(float renderScale)
+{
+    if (!m_streamed)
+        return m_sfTexture;
+
+    m_streamingRendered = true;
+
+    if (m_sfTexture)
+        return m_sfTexture;
+
+    Vector2f residentScale = GetResidentScale();
+    if (renderScale > Min(residentScale.x, residentScale.y))
+    {
+        m_fullResolutionRequested = true;
+    }
+
+    return m_sfFallbackTexture;
+}
+
+bool Texture::IsStreamed() const
+{
+    return m_streamed;
+}
+
+bool Texture::IsFullResolutionResident() const
+{
+    return m_sfTexture != nullptr;
+}
+
+Vector2f Texture::GetResidentScale() const
+{
+    if (!m_streamed || m_sfTexture || !m_sfFallbackTexture || m_fullSize.x == 0 || m_fullSize.y == 0)
+        return Vector2f(1.f, 1.f);
+
+    Vector2u fallbackSize = m_sfFallbackTexture->getSize();
+    return Vector2f(static_cast<float>(fallbackSize.x) / m_fullSize.x, static_cast<float>(fallbackSize.y) / m_fullSize.y);
+}
+
+uint32 Texture::GetResidencyVersion() const
+{
+    return m_residencyVersion;
+}
+
+void Texture::ComputeResidentVertices(const sf::Vertex* vertices, size_t count, std::vector<sf::Vertex>& residentVertices) const
+{
+    Vector2f residentScale = GetResidentScale();
+
+    residentVertices.assign(vertices, vertices + count);
+    for (sf::Vertex& vertex : residentVertices)
+    {
+        vertex.texCoords.x *= residentScale.x;
+        vertex.texCoords.y *= residentScale.y;
+    }
+}
+
 void Texture::SetSmooth(bool smooth)
 {
     if (m_sfTexture)
     {
         m_sfTexture->setSmooth(smooth);
     }
+
+    if (m_sfFallbackTexture)
+    {
+        m_sfFallbackTexture->setSmooth(smooth);
+    }
 }
 
 bool Texture::IsSmooth() const
@@ -56,6 +235,11 @@ bool Texture::IsSmooth() const
         return m_sfTexture->isSmooth();
     }
 
+    if (m_sfFallbackTexture)
+    {
+        return m_sfFallbackTexture->isSmooth();
+    }
+
     return false;
 }
 
@@ -65,6 +249,11 @@ void Texture::SetRepeated(bool repeated)
     {
         m_sfTexture->setRepeated(repeated);
     }
+
+    if (m_sfFallbackTexture)
+    {
+        m_sfFallbackTexture->setRepeated(repeated);
+    }
 }
 
 bool Texture::IsRepeated() const
@@ -74,17 +263,25 @@ bool Texture::IsRepeated() const
         return m_sfTexture->isRepeated();
     }
 
+    if (m_sfFallbackTexture)
+    {
+        return m_sfFallbackTexture->isRepeated();
+    }
+
     return false;
 }
 
 Vector2u Texture::GetSize() const
 {
+    if (m_streamed)
+        return m_fullSize;
+
     return m_sfTexture ? m_sfTexture->getSize() : Vector2u();
 }
 
 sf::IntRect Texture::GetRect() const
 {
-    return m_sfTexture ? sf::IntRect(Vector2i(), Vector2i(m_sfTexture->getSize())) : sf::IntRect();
+    return sf::IntRect(Vector2i(), Vector2i(GetSize()));
 }
 
 EResourceType::Type Texture::GetResourceType() const
@@ -92,26 +289,250 @@ EResourceType::Type Texture::GetResourceType() const
     return EResourceType::Texture;
 }
 
+size_t Texture::GetMemorySize() const
+{
+    // Textures are stored as 32 bits pixels.
+    size_t memorySize = 0;
+
+    if (m_sfTexture)
+    {
+        Vector2u size = m_sfTexture->getSize();
+        memorySize += static_cast<size_t>(size.x) * size.y * 4;
+    }
+
+    if (m_sfFallbackTexture)
+    {
+        Vector2u size = m_sfFallbackTexture->getSize();
+        memorySize += static_cast<size_t>(size.x) * size.y * 4;
+    }
+
+    return memorySize;
+}
+
 void Texture::Unload()
 {
+    if (m_streamed)
+    {
+        GetResources()->UnregisterStreamedTexture(this);
+        m_streamed = false;
+    }
+
     SafeDelete(m_sfTexture);
+    SafeDelete(m_sfFallbackTexture);
+    m_fullSize = Vector2u();
+    m_streamingRendered = false;
+    m_fullResolutionRequested = false;
+    ++m_residencyVersion;
 }
 
 bool Texture::LoadFromFile()
 {
     Unload();
 
-    m_sfTexture = new sf::Texture;
-    if (!m_sfTexture->loadFromFile(GetFileInfo().GetFileSystemPath()))
+    if (!PrepareLoadFromFile())
     {
         GetLogEngine()->Print(ELog::Warning, ELogEngine::Resources, StringFormat("Texture file could not be loaded : {0}", GetFileInfo().GetFilePath_utf8()));
         assert(false);
         return false;
     }
 
-    m_sfTexture->setSmooth(GetResources()->IsDefaultTextureSmooth());
-    m_sfTexture->setRepeated(false);
+    return FinalizeLoadFromFile();
+}
+
+bool Texture::PrepareLoadFromFile()
+{
+    // Image decoding can be done on a worker thread, only the gpu upload needs to be done on the main thread.
+    SafeDelete(m_preparedImage);
+    SafeDelete(m_preparedFallbackImage);
+
+    unsigned int streamingMinSize = GetResources()->GetTextureStreamingMinSize();
+
+    // The cooked fallback of a streamed texture avoids decoding its full resolution.
+    if (streamingMinSize > 0 && m_resourceInfos && m_resourceInfos->hasCookedFile)
+    {
+        sf::Image* fallbackImage = new sf::Image;
+        if (LoadCookedFallback(*fallbackImage, m_fullSize) && impl::IsStreamedSize(m_fullSize, streamingMinSize))
+        {
+            m_preparedFallbackImage = fallbackImage;
+            return true;
+        }
+
+        SafeDelete(fallbackImage);
+    }
+
+    sf::Image* image = new sf::Image;
+    if (!DecodeImage(*image))
+    {
+        SafeDelete(image);
+        return false;
+    }
+
+    if (impl::IsStreamedSize(image->getSize(), streamingMinSize))
+    {
+        m_fullSize = image->getSize();
+        m_preparedFallbackImage = new sf::Image;
+        impl::DownscaleImage(*image, resources::TextureStreamingFallbackDivider, *m_preparedFallbackImage);
+        SafeDelete(image);
+        return true;
+    }
+
+    m_preparedImage = image;
+    return true;
+}
+
+bool Texture::FinalizeLoadFromFile()
+{
+    if (!m_preparedImage && !m_preparedFallbackImage)
+    {
+        return LoadFromFile();
+    }
+
+    // The full size is set during the preparation.
+    Vector2u fullSize = m_fullSize;
+    Unload();
+
+    bool result = false;
+    if (m_preparedFallbackImage)
+    {
+        m_sfFallbackTexture = CreateSFTexture(*m_preparedFallbackImage);
+        SafeDelete(m_preparedFallbackImage);
+
+        if (m_sfFallbackTexture)
+        {
+            m_fullSize = fullSize;
+            m_streamed = true;
+            GetResources()->RegisterStreamedTexture(this);
+            result = true;
+        }
+    }
+    else
+    {
+        m_sfTexture = CreateSFTexture(*m_preparedImage);
+        SafeDelete(m_preparedImage);
+        result = m_sfTexture != nullptr;
+    }
+
+    if (!result)
+    {
+        GetLogEngine()->Print(ELog::Warning, ELogEngine::Resources, StringFormat("Texture file could not be loaded : {0}", GetFileInfo().GetFilePath_utf8()));
+        return false;
+    }
+
+    return true;
+}
+
+bool Texture::DecodeImage(sf::Image& image) const
+{
+    if (IsArchived())
+    {
+        const uint8* data = nullptr;
+        size_t size = 0;
+        std::vector<uint8> buffer;
+        return GetArchiveContent(data, size, buffer) && image.loadFromMemory(data, size);
+    }
+
+    return image.loadFromFile(GetFileInfo().GetFileSystemPath());
+}
+
+bool Texture::LoadCookedFallback(sf::Image& fallbackImage, Vector2u& fullSize) const
+{
+    std::vector<uint8> buffer;
+
+    if (m_resourceInfos->cookedArchiveEntry)
+    {
+        const uint8* data = nullptr;
+        size_t size = 0;
+        if (!m_resourceInfos->archive->GetEntryContent(m_resourceInfos->cookedArchiveEntry, data, size, buffer))
+            return false;
+
+        return impl::ParseCookedTexture(data, size, fallbackImage, fullSize);
+    }
+
+    if (!ReadFileContent(m_resourceInfos->GetCookedFilePath_utf8(), buffer))
+        return false;
+
+    return impl::ParseCookedTexture(buffer.data(), buffer.size(), fallbackImage, fullSize);
+}
+
+sf::Texture* Texture::CreateSFTexture(const sf::Image& image) const
+{
+    sf::Texture* texture = new sf::Texture;
+    if (!texture->loadFromImage(image))
+    {
+        SafeDelete(texture);
+        return nullptr;
+    }
+
+    texture->setSmooth(m_sfFallbackTexture ? m_sfFallbackTexture->isSmooth() : GetResources()->IsDefaultTextureSmooth());
+    texture->setRepeated(m_sfFallbackTexture ? m_sfFallbackTexture->isRepeated() : false);
+    return texture;
+}
+
+bool Texture::PrepareFullResolution()
+{
+    SafeDelete(m_preparedImage);
+
+    sf::Image* image = new sf::Image;
+    if (!DecodeImage(*image))
+    {
+        SafeDelete(image);
+        return false;
+    }
+
+    m_preparedImage = image;
+    return true;
+}
+
+void Texture::FinalizeFullResolution()
+{
+    if (!m_preparedImage)
+    {
+        GetLogEngine()->Print(ELog::Warning, ELogEngine::Resources, StringFormat("Texture full resolution could not be loaded : {0}", GetFileInfo().GetFilePath_utf8()));
+        return;
+    }
+
+    SafeDelete(m_sfTexture);
+    m_sfTexture = CreateSFTexture(*m_preparedImage);
+    SafeDelete(m_preparedImage);
+    ++m_residencyVersion;
+}
+
+void Texture::DropFullResolution()
+{
+    if (!m_sfTexture)
+        return;
+
+    SafeDelete(m_sfTexture);
+    ++m_residencyVersion;
+}
+
+bool Texture::CookTextureFile(const FileInfo& fileInfo, std::vector<uint8>& cookedData)
+{
+    sf::Image image;
+    if (!image.loadFromFile(fileInfo.GetFileSystemPath()))
+        return false;
+
+    Vector2u size = image.getSize();
+    if (size.x < resources::TextureCookMinSize && size.y < resources::TextureCookMinSize)
+        return false;
+
+    sf::Image fallbackImage;
+    impl::DownscaleImage(image, resources::TextureStreamingFallbackDivider, fallbackImage);
+
+    impl::CookedTextureHeader header;
+    header.magic = impl::CookedTextureMagic;
+    header.version = impl::CookedTextureVersion;
+    header.width = size.x;
+    header.height = size.y;
+    header.fallbackWidth = fallbackImage.getSize().x;
+    header.fallbackHeight = fallbackImage.getSize().y;
+
+    std::vector<uint8> compressedPixels;
+    CompressLZ(fallbackImage.getPixelsPtr(), static_cast<size_t>(header.fallbackWidth) * header.fallbackHeight * 4, compressedPixels);
 
+    cookedData.resize(sizeof(header) + compressedPixels.size());
+    std::memcpy(cookedData.data(), &header, sizeof(header));
+    std::memcpy(cookedData.data() + sizeof(header), compressedPixels.data(), compressedPixels.size());
     return true;
 }
 
@@ -8,28 +8,57 @@
 
 #include <SFML/Graphics/Rect.hpp>
 
+#include <vector>
+
 ////////////////////////////////////////////////////////////////
 // Forward Declarations
 
 namespace sf
 {
     class Texture;
+    class Image;
+    struct Vertex;
 }
 
 ////////////////////////////////////////////////////////////////
 // File Declarations
 
 namespace gugu {
+
+// Constants.
+namespace resources
+{
+    inline constexpr unsigned int TextureStreamingFallbackDivider = 4;  // Downscale factor of the streaming fallbacks.
+    inline constexpr unsigned int TextureCookMinSize = 512;             // Textures are only cooked (with their streaming fallback) from this size.
+}
     
 class Texture : public Resource
 {
+    friend class ManagerResources;
+
 public:
 
     Texture();
     virtual ~Texture();
 
     void SetSFTexture(sf::Texture* _pSFTexture);
-    sf::Texture* GetSFTexture() const;
+
+    // A streamed texture will stop being streamed, its full resolution is loaded and kept resident (the returned texture may be stored).
+    // - Elements rendering a texture (sprites, sprite groups, tilemaps, particles) use GetRenderSFTexture instead, to keep it streamed.
+    sf::Texture* GetSFTexture();
+
+    // Streamed textures only keep a downscaled fallback resident, until they are rendered at a scale requiring their full resolution.
+    // - The render scale is the amount of screen pixels per texel, the full resolution is requested when the fallback would be magnified.
+    // - The returned texture should not be stored, texture coordinates need to be scaled by GetResidentScale.
+    // - The residency version is incremented each time the resident texture changes.
+    sf::Texture* GetRenderSFTexture(float renderScale);
+    bool IsStreamed() const;
+    bool IsFullResolutionResident() const;
+    Vector2f GetResidentScale() const;
+    uint32 GetResidencyVersion() const;
+
+    // Copy vertices whose texture coordinates use the texture size, with their coordinates scaled to the resident texture.
+    void ComputeResidentVertices(const sf::Vertex* vertices, size_t count, std::vector<sf::Vertex>& residentVertices) const;
     
     void SetSmooth(bool smooth);
     bool IsSmooth() const;
@@ -41,16 +70,40 @@ public:
     sf::IntRect GetRect() const;
 
     virtual EResourceType::Type GetResourceType() const override;
+    virtual size_t GetMemorySize() const override;
 
     virtual bool LoadFromFile() override;
+    virtual bool PrepareLoadFromFile() override;
+    virtual bool FinalizeLoadFromFile() override;
+
+    // Build the cooked version of a texture file, containing its streaming fallback (textures below TextureCookMinSize are ignored).
+    static bool CookTextureFile(const FileInfo& fileInfo, std::vector<uint8>& cookedData);
 
 protected:
 
     virtual void Unload() override;
 
+    bool DecodeImage(sf::Image& image) const;
+    bool LoadCookedFallback(sf::Image& fallbackImage, Vector2u& fullSize) const;
+    sf::Texture* CreateSFTexture(const sf::Image& image) const;
+
+    // Full resolution of streamed textures, the preparation is done on a worker thread.
+    bool PrepareFullResolution();
+    void FinalizeFullResolution();
+    void DropFullResolution();
+
 protected:
 
-    sf::Texture* m_sfTexture;
+    sf::Texture* m_sfTexture;               // Null while a streamed texture only has its fallback resident.
+    sf::Texture* m_sfFallbackTexture;       // Only used by streamed textures.
+    sf::Image* m_preparedImage;
+    sf::Image* m_preparedFallbackImage;
+
+    Vector2u m_fullSize;                    // Only used by streamed textures.
+    uint32 m_residencyVersion;
+    bool m_streamed;
+    bool m_streamingRendered;               // Rendered since the last streaming update.
+    bool m_fullResolutionRequested;         // Rendered at a scale requiring the full resolution since the last streaming update.
 };
 
 }   // namespace gugu
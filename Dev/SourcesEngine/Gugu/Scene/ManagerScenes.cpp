@@ -8,7 +8,10 @@
 // Includes
 
 #include "Gugu/Engine.h"
+#include "Gugu/Resources/ManagerResources.h"
 #include "Gugu/Scene/Scene.h"
+#include "Gugu/Element/Element.h"
+#include "Gugu/System/Container.h"
 #include "Gugu/System/Memory.h"
 
 ////////////////////////////////////////////////////////////////
@@ -18,6 +21,7 @@ namespace gugu {
 
 ManagerScenes::ManagerScenes()
     : m_rootScene(nullptr)
+    , m_pendingRootScene(nullptr)
 {
 }
 
@@ -32,6 +36,7 @@ void ManagerScenes::Init(const EngineConfig& config)
 
 void ManagerScenes::Release()
 {
+    SafeDelete(m_pendingRootScene);
     SafeDelete(m_rootScene);
 }
 
@@ -47,6 +52,48 @@ Scene* ManagerScenes::GetRootScene() const
     return m_rootScene;
 }
 
+void ManagerScenes::SwitchRootScene(Scene* scene, const std::string& manifestId, const Callback& callbackSceneSwitched)
+{
+    SafeDelete(m_pendingRootScene);
+
+    m_pendingRootScene = scene;
+    m_callbackSceneSwitched = callbackSceneSwitched;
+    m_pendingScenePrefetch = manifestId.empty() ? Handle() : GetResources()->PrefetchManifest(manifestId);
+}
+
+bool ManagerScenes::IsSceneSwitchPending() const
+{
+    return m_pendingRootScene != nullptr;
+}
+
+float ManagerScenes::GetSceneSwitchProgress() const
+{
+    if (!m_pendingRootScene)
+        return 1.f;
+
+    return GetResources()->GetPrefetchProgress(m_pendingScenePrefetch);
+}
+
+void ManagerScenes::ApplyPendingSceneSwitch()
+{
+    if (!m_pendingRootScene || GetResources()->IsPrefetchPending(m_pendingScenePrefetch))
+        return;
+
+    SafeDelete(m_rootScene);
+
+    m_rootScene = m_pendingRootScene;
+    m_pendingRootScene = nullptr;
+    m_pendingScenePrefetch = Handle();
+
+    Callback callbackSceneSwitched = m_callbackSceneSwitched;
+    m_callbackSceneSwitched = nullptr;
+
+    if (callbackSceneSwitched)
+    {
+        callbackSceneSwitched();
+    }
+}
+
 void ManagerScenes::Step(const DeltaTime& dt)
 {
     if (m_rootScene)
@@ -57,6 +104,9 @@ void ManagerScenes::Step(const DeltaTime& dt)
 
 void ManagerScenes::Update(const DeltaTime& dt)
 {
+    // Pending scene switches are applied outside of the scenes update, once their resources are loaded.
+    ApplyPendingSceneSwitch();
+
     if (m_rootScene)
     {
         m_rootScene->Update(dt);
@@ -79,6 +129,27 @@ void ManagerScenes::UpdateImGui(const DeltaTime& dt)
     }
 }
 
+void ManagerScenes::RegisterInterpolatedElement(Element* element)
+{
+    if (!StdVectorContains(m_interpolatedElements, element))
+    {
+        m_interpolatedElements.push_back(element);
+    }
+}
+
+void ManagerScenes::UnregisterInterpolatedElement(Element* element)
+{
+    StdVectorRemove(m_interpolatedElements, element);
+}
+
+void ManagerScenes::SaveInterpolationStates()
+{
+    for (size_t i = 0; i < m_interpolatedElements.size(); ++i)
+    {
+        m_interpolatedElements[i]->SaveInterpolationState();
+    }
+}
+
 ManagerScenes* GetScenes()
 {
     return GetEngine()->GetManagerScenes();
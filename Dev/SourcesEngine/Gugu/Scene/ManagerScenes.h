@@ -3,6 +3,10 @@
 ////////////////////////////////////////////////////////////////
 // Includes
 
+#include "Gugu/System/Callback.h"
+#include "Gugu/System/Handle.h"
+
+#include <string>
 #include <vector>
 
 ////////////////////////////////////////////////////////////////
@@ -13,6 +17,7 @@ namespace gugu
     struct EngineConfig;
     class DeltaTime;
     class Scene;
+    class Element;
 }
 
 namespace sf
@@ -38,14 +43,36 @@ public:
     void ResetRootScene();
     Scene* GetRootScene() const;
 
+    // Replace the root scene once the resources listed in a preload manifest are loaded (the previous root scene is deleted).
+    // - The manifest resources are prefetched asynchronously, the switch is applied at the beginning of an Update.
+    // - An empty manifest ID will switch the scene on the next Update.
+    // - Requesting another switch while one is pending will replace (and delete) the pending scene.
+    void SwitchRootScene(Scene* scene, const std::string& manifestId, const Callback& callbackSceneSwitched = nullptr);
+    bool IsSceneSwitchPending() const;
+    float GetSceneSwitchProgress() const;
+
     void Step(const DeltaTime& dt);
     void Update(const DeltaTime& dt);
     void LateUpdate(const DeltaTime& dt);
     void UpdateImGui(const DeltaTime& dt);
 
+    // Elements using transform interpolation will store their previous step state before each step.
+    void RegisterInterpolatedElement(Element* element);
+    void UnregisterInterpolatedElement(Element* element);
+    void SaveInterpolationStates();
+
+protected:
+
+    void ApplyPendingSceneSwitch();
+
 protected:
 
     Scene* m_rootScene;
+
+    Scene* m_pendingRootScene;
+    Handle m_pendingScenePrefetch;
+    Callback m_callbackSceneSwitched;
+    std::vector<Element*> m_interpolatedElements;
 };
 
 ManagerScenes* GetScenes();
@@ -0,0 +1,202 @@
+////////////////////////////////////////////////////////////////
+// Header
+
+#include "Gugu/Common.h"
+#include "Gugu/System/Compression.h"
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include <cstring>
+
+////////////////////////////////////////////////////////////////
+// File Implementation
+
+namespace gugu {
+
+namespace impl {
+
+// Block layout is a list of sequences : token, [literal length], literals, offset, [match length].
+// - The token stores the literal length (high bits) and the match length minus MinMatchLength (low bits).
+// - A length nibble of 15 is followed by extra bytes, added until a byte differs from 255.
+// - The last sequence only contains literals, and has no offset.
+constexpr size_t MinMatchLength = 4;
+constexpr size_t MaxMatchOffset = 65535;
+constexpr size_t HashTableBits = 12;
+constexpr size_t HashTableSize = 1 << HashTableBits;
+
+inline uint32 ReadUInt32(const uint8* data)
+{
+    uint32 value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+inline size_t HashUInt32(uint32 value)
+{
+    return (value * 2654435761u) >> (32 - HashTableBits);
+}
+
+void WriteExtraLength(size_t length, std::vector<uint8>& result)
+{
+    while (length >= 255)
+    {
+        result.push_back(255);
+        length -= 255;
+    }
+
+    result.push_back(static_cast<uint8>(length));
+}
+
+void WriteSequence(const uint8* literals, size_t literalLength, size_t matchOffset, size_t matchLength, std::vector<uint8>& result)
+{
+    size_t matchCode = matchLength > 0 ? matchLength - MinMatchLength : 0;
+
+    uint8 token = static_cast<uint8>((literalLength < 15 ? literalLength : 15) << 4);
+    token |= static_cast<uint8>(matchCode < 15 ? matchCode : 15);
+    result.push_back(token);
+
+    if (literalLength >= 15)
+    {
+        WriteExtraLength(literalLength - 15, result);
+    }
+
+    result.insert(result.end(), literals, literals + literalLength);
+
+    if (matchLength > 0)
+    {
+        result.push_back(static_cast<uint8>(matchOffset & 0xFF));
+        result.push_back(static_cast<uint8>((matchOffset >> 8) & 0xFF));
+
+        if (matchCode >= 15)
+        {
+            WriteExtraLength(matchCode - 15, result);
+        }
+    }
+}
+
+bool ReadExtraLength(const uint8*& input, const uint8* inputEnd, size_t& length)
+{
+    uint8 value = 255;
+    while (value == 255)
+    {
+        if (input >= inputEnd)
+            return false;
+
+        value = *input++;
+        length += value;
+    }
+
+    return true;
+}
+
+}   // namespace impl
+
+void CompressLZ(const uint8* data, size_t size, std::vector<uint8>& result)
+{
+    result.clear();
+    result.reserve(size + size / 255 + 16);
+
+    // Positions are stored with a +1 offset, zero meaning an empty slot.
+    std::vector<size_t> hashTable(impl::HashTableSize, 0);
+
+    size_t anchor = 0;
+    size_t position = 0;
+
+    while (position + impl::MinMatchLength <= size)
+    {
+        uint32 sequence = impl::ReadUInt32(data + position);
+        size_t hash = impl::HashUInt32(sequence);
+        size_t candidate = hashTable[hash];
+        hashTable[hash] = position + 1;
+
+        if (candidate == 0
+            || position - (candidate - 1) > impl::MaxMatchOffset
+            || impl::ReadUInt32(data + candidate - 1) != sequence)
+        {
+            ++position;
+            continue;
+        }
+
+        size_t matchPosition = candidate - 1;
+        size_t matchLength = impl::MinMatchLength;
+        while (position + matchLength < size && data[matchPosition + matchLength] == data[position + matchLength])
+        {
+            ++matchLength;
+        }
+
+        impl::WriteSequence(data + anchor, position - anchor, position - matchPosition, matchLength, result);
+
+        position += matchLength;
+        anchor = position;
+    }
+
+    impl::WriteSequence(data + anchor, size - anchor, 0, 0, result);
+}
+
+bool DecompressLZ(const uint8* data, size_t size, uint8* result, size_t resultSize)
+{
+    const uint8* input = data;
+    const uint8* inputEnd = data + size;
+    size_t outputPosition = 0;
+
+    while (input < inputEnd)
+    {
+        uint8 token = *input++;
+
+        size_t literalLength = token >> 4;
+        if (literalLength == 15 && !impl::ReadExtraLength(input, inputEnd, literalLength))
+            return false;
+
+        if (literalLength > static_cast<size_t>(inputEnd - input) || literalLength > resultSize - outputPosition)
+            return false;
+
+        if (literalLength > 0)
+        {
+            std::memcpy(result + outputPosition, input, literalLength);
+        }
+
+        input += literalLength;
+        outputPosition += literalLength;
+
+        // The last sequence has no match.
+        if (input == inputEnd)
+            break;
+
+        if (inputEnd - input < 2)
+            return false;
+
+        size_t matchOffset = static_cast<size_t>(input[0]) | (static_cast<size_t>(input[1]) << 8);
+        input += 2;
+
+        size_t matchLength = token & 0x0F;
+        if (matchLength == 15 && !impl::ReadExtraLength(input, inputEnd, matchLength))
+            return false;
+
+        matchLength += impl::MinMatchLength;
+
+        if (matchOffset == 0 || matchOffset > outputPosition || matchLength > resultSize - outputPosition)
+            return false;
+
+        // Matches can overlap their own output, in which case we need to copy byte per byte.
+        uint8* matchSource = result + outputPosition - matchOffset;
+        uint8* matchTarget = result + outputPosition;
+        if (matchOffset >= matchLength)
+        {
+            std::memcpy(matchTarget, matchSource, matchLength);
+        }
+        else
+        {
+            for (size_t i = 0; i < matchLength; ++i)
+            {
+                matchTarget[i] = matchSource[i];
+            }
+        }
+
+        outputPosition += matchLength;
+    }
+
+    return outputPosition == resultSize;
+}
+
+}   // namespace gugu
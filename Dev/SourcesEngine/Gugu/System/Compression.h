@@ -0,0 +1,21 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/System/Types.h"
+
+#include <cstddef>
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// File Declarations
+
+namespace gugu {
+
+// Fast LZ77 byte-oriented compression (lz4-like block layout), favoring decompression speed over ratio.
+// - The compressed block does not store the original size, it needs to be provided to the decompression.
+void CompressLZ(const uint8* data, size_t size, std::vector<uint8>& result);
+bool DecompressLZ(const uint8* data, size_t size, uint8* result, size_t resultSize);
+
+}   // namespace gugu
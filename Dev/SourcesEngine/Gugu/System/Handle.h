@@ -25,6 +25,11 @@ public:
         return m_handleType != EHandleType::Invalid;
     }
 
+    uint64 GetUint64() const
+    {
+        return m_uint64;
+    }
+
     bool operator == (const Handle& right) const
     {
         return m_handleType == right.m_handleType && m_ptr == right.m_ptr && m_uint64 == right.m_uint64;
@@ -29,6 +29,11 @@ Hash::Hash(const char* value)
     m_value = HashString(value);
 }
 
+Hash::Hash(std::string_view value)
+{
+    m_value = HashString(value);
+}
+
 Hash::Hash(const Hash& right)
 {
     m_value = right.m_value;
@@ -38,10 +43,15 @@ Hash::~Hash()
 {
 }
 
-uint64 Hash::HashString(const std::string& value)
+uint64 Hash::HashString(std::string_view value)
 {
-    std::hash<std::string> hashFunction;
-    uint64 result = hashFunction(value);
+    uint64 result = 14695981039346656037ull;
+    for (char character : value)
+    {
+        result ^= static_cast<uint8>(character);
+        result *= 1099511628211ull;
+    }
+
     return result;
 }
 
@@ -6,6 +6,7 @@
 #include "Gugu/System/Types.h"
 
 #include <string>
+#include <string_view>
 
 ////////////////////////////////////////////////////////////////
 // File Declarations
@@ -19,10 +20,12 @@ public:
     Hash();
     Hash(const std::string& value);
     Hash(const char* value);
+    Hash(std::string_view value);
     Hash(const Hash& right);
     ~Hash();
 
-    static uint64 HashString(const std::string& value);
+    // FNV-1a 64 bits, stable across platforms and runs.
+    static uint64 HashString(std::string_view value);
 
     uint64 ToInt() const;
 
@@ -0,0 +1,105 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/System/Hash.h"
+#include "Gugu/System/Container.h"
+
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// File Declarations
+
+namespace gugu {
+
+// Open addressing hash map (linear probing), using pre-computed Hash keys.
+// - Entries are stored contiguously, removals use backward shifting (no tombstones).
+// - Inserting or removing entries invalidates iterators and pointers to values.
+// - Iteration order is not specified.
+template<typename TValue>
+class HashMap
+{
+public:
+
+    struct Entry
+    {
+        Hash key;
+        TValue value = TValue();
+    };
+
+    template<typename TMap, typename TEntry>
+    class IteratorBase
+    {
+    public:
+
+        IteratorBase(TMap* map, size_t index) : m_map(map), m_index(index) { SkipEmptySlots(); }
+
+        TEntry& operator * () const { return m_map->m_entries[m_index]; }
+        TEntry* operator -> () const { return &m_map->m_entries[m_index]; }
+
+        IteratorBase& operator ++ () { ++m_index; SkipEmptySlots(); return *this; }
+
+        bool operator == (const IteratorBase& right) const { return m_index == right.m_index; }
+        bool operator != (const IteratorBase& right) const { return m_index != right.m_index; }
+
+    private:
+
+        void SkipEmptySlots() { while (m_index < m_map->m_used.size() && !m_map->m_used[m_index]) ++m_index; }
+
+    private:
+
+        TMap* m_map;
+        size_t m_index;
+    };
+
+    using Iterator = IteratorBase<HashMap<TValue>, Entry>;
+    using ConstIterator = IteratorBase<const HashMap<TValue>, const Entry>;
+
+public:
+
+    HashMap();
+
+    size_t Size() const;
+    size_t Capacity() const;    // Allocated slots.
+    bool IsEmpty() const;
+
+    void Reserve(size_t count);
+    void Clear();
+
+    // Return nullptr if the key is not registered.
+    TValue* Find(const Hash& key);
+    const TValue* Find(const Hash& key) const;
+    bool Contains(const Hash& key) const;
+
+    // Return false if the key is already registered (the registered value is kept).
+    bool Insert(const Hash& key, const TValue& value);
+    bool Remove(const Hash& key);
+
+    Iterator begin();
+    Iterator end();
+    ConstIterator begin() const;
+    ConstIterator end() const;
+
+private:
+
+    size_t GetIdealSlot(const Hash& key) const;
+    size_t FindSlot(const Hash& key) const;   // Return the key slot, or InvalidIndex.
+    void Rehash(size_t capacity);
+
+private:
+
+    std::vector<Entry> m_entries;
+    std::vector<uint8> m_used;
+    size_t m_size;
+};
+
+template<typename TValue>
+void ClearHashMap(HashMap<TValue*>& container);
+
+}   // namespace gugu
+
+////////////////////////////////////////////////////////////////
+// Template Implementation
+
+#include "Gugu/System/HashMap.tpp"
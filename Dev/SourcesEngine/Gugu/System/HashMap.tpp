@@ -0,0 +1,224 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// File Implementation
+
+namespace gugu {
+
+template<typename TValue>
+HashMap<TValue>::HashMap()
+    : m_size(0)
+{
+}
+
+template<typename TValue>
+size_t HashMap<TValue>::Size() const
+{
+    return m_size;
+}
+
+template<typename TValue>
+size_t HashMap<TValue>::Capacity() const
+{
+    return m_entries.size();
+}
+
+template<typename TValue>
+bool HashMap<TValue>::IsEmpty() const
+{
+    return m_size == 0;
+}
+
+template<typename TValue>
+void HashMap<TValue>::Reserve(size_t count)
+{
+    // Keep the load factor under 70%, with a power of two capacity.
+    size_t capacity = 16;
+    while (capacity * 7 < count * 10)
+    {
+        capacity *= 2;
+    }
+
+    if (capacity > m_entries.size())
+    {
+        Rehash(capacity);
+    }
+}
+
+template<typename TValue>
+void HashMap<TValue>::Clear()
+{
+    m_entries.clear();
+    m_used.clear();
+    m_size = 0;
+}
+
+template<typename TValue>
+TValue* HashMap<TValue>::Find(const Hash& key)
+{
+    size_t slot = FindSlot(key);
+    return slot == system::InvalidIndex ? nullptr : &m_entries[slot].value;
+}
+
+template<typename TValue>
+const TValue* HashMap<TValue>::Find(const Hash& key) const
+{
+    size_t slot = FindSlot(key);
+    return slot == system::InvalidIndex ? nullptr : &m_entries[slot].value;
+}
+
+template<typename TValue>
+bool HashMap<TValue>::Contains(const Hash& key) const
+{
+    return FindSlot(key) != system::InvalidIndex;
+}
+
+template<typename TValue>
+bool HashMap<TValue>::Insert(const Hash& key, const TValue& value)
+{
+    // Only grow when this insertion would cross the 70% load factor.
+    if ((m_size + 1) * 10 > m_entries.size() * 7)
+    {
+        Rehash(m_entries.empty() ? 16 : m_entries.size() * 2);
+    }
+
+    size_t mask = m_entries.size() - 1;
+    size_t slot = GetIdealSlot(key);
+    while (m_used[slot])
+    {
+        if (m_entries[slot].key == key)
+            return false;
+
+        slot = (slot + 1) & mask;
+    }
+
+    m_entries[slot].key = key;
+    m_entries[slot].value = value;
+    m_used[slot] = 1;
+    ++m_size;
+    return true;
+}
+
+template<typename TValue>
+bool HashMap<TValue>::Remove(const Hash& key)
+{
+    size_t slot = FindSlot(key);
+    if (slot == system::InvalidIndex)
+        return false;
+
+    // Shift back the following entries of the probing chain, until an empty slot or an entry already at its ideal slot.
+    size_t mask = m_entries.size() - 1;
+    size_t emptySlot = slot;
+    size_t nextSlot = slot;
+
+    while (true)
+    {
+        nextSlot = (nextSlot + 1) & mask;
+        if (!m_used[nextSlot])
+            break;
+
+        // The entry can be moved if its ideal slot is not in the cyclic range ]emptySlot, nextSlot].
+        size_t idealSlot = GetIdealSlot(m_entries[nextSlot].key);
+        size_t distanceToIdeal = (nextSlot - idealSlot) & mask;
+        size_t distanceToEmpty = (nextSlot - emptySlot) & mask;
+        if (distanceToIdeal >= distanceToEmpty)
+        {
+            m_entries[emptySlot] = std::move(m_entries[nextSlot]);
+            emptySlot = nextSlot;
+        }
+    }
+
+    m_entries[emptySlot] = Entry();
+    m_used[emptySlot] = 0;
+    --m_size;
+    return true;
+}
+
+template<typename TValue>
+typename HashMap<TValue>::Iterator HashMap<TValue>::begin()
+{
+    return Iterator(this, 0);
+}
+
+template<typename TValue>
+typename HashMap<TValue>::Iterator HashMap<TValue>::end()
+{
+    return Iterator(this, m_entries.size());
+}
+
+template<typename TValue>
+typename HashMap<TValue>::ConstIterator HashMap<TValue>::begin() const
+{
+    return ConstIterator(this, 0);
+}
+
+template<typename TValue>
+typename HashMap<TValue>::ConstIterator HashMap<TValue>::end() const
+{
+    return ConstIterator(this, m_entries.size());
+}
+
+template<typename TValue>
+size_t HashMap<TValue>::GetIdealSlot(const Hash& key) const
+{
+    // Mix the hash bits, since only the lowest ones are used by the mask.
+    uint64 value = key.ToInt();
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdull;
+    value ^= value >> 33;
+
+    return static_cast<size_t>(value) & (m_entries.size() - 1);
+}
+
+template<typename TValue>
+size_t HashMap<TValue>::FindSlot(const Hash& key) const
+{
+    if (m_size == 0)
+        return system::InvalidIndex;
+
+    size_t mask = m_entries.size() - 1;
+    size_t slot = GetIdealSlot(key);
+    while (m_used[slot])
+    {
+        if (m_entries[slot].key == key)
+            return slot;
+
+        slot = (slot + 1) & mask;
+    }
+
+    return system::InvalidIndex;
+}
+
+template<typename TValue>
+void HashMap<TValue>::Rehash(size_t capacity)
+{
+    std::vector<Entry> previousEntries;
+    std::vector<uint8> previousUsed;
+    std::swap(previousEntries, m_entries);
+    std::swap(previousUsed, m_used);
+
+    m_entries.resize(capacity);
+    m_used.resize(capacity, 0);
+    m_size = 0;
+
+    for (size_t i = 0; i < previousEntries.size(); ++i)
+    {
+        if (previousUsed[i])
+        {
+            Insert(previousEntries[i].key, previousEntries[i].value);
+        }
+    }
+}
+
+template<typename TValue>
+void ClearHashMap(HashMap<TValue*>& container)
+{
+    for (auto& entry : container)
+    {
+        SafeDelete(entry.value);
+    }
+
+    container.Clear();
+}
+
+}   // namespace gugu
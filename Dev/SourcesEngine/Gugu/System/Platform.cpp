@@ -10,12 +10,17 @@
 #include "Gugu/System/String.h"
 #include "Gugu/System/Path.h"
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 
 #if defined(GUGU_OS_WINDOWS)
     #include <windows.h>
     #include <shellapi.h>
+#else
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <unistd.h>
 #endif
 
 namespace fs = std::filesystem;
@@ -181,6 +186,141 @@ bool FileExists(std::string_view path_utf8)
     return fs::is_regular_file(fs::u8path(path_utf8));
 }
 
+bool IsFileNewer(std::string_view path_utf8, std::string_view referencePath_utf8)
+{
+    std::error_code errorCode;
+    fs::file_time_type time = fs::last_write_time(fs::u8path(path_utf8), errorCode);
+    if (errorCode)
+        return false;
+
+    fs::file_time_type referenceTime = fs::last_write_time(fs::u8path(referencePath_utf8), errorCode);
+    if (errorCode)
+        return false;
+
+    return time > referenceTime;
+}
+
+bool GetFileStats(std::string_view path_utf8, int64& modificationTime, uint64& size)
+{
+    std::error_code errorCode;
+    fs::path path = fs::u8path(path_utf8);
+
+    fs::file_time_type time = fs::last_write_time(path, errorCode);
+    if (errorCode)
+        return false;
+
+    std::uintmax_t fileSize = fs::file_size(path, errorCode);
+    if (errorCode)
+        return false;
+
+    modificationTime = static_cast<int64>(time.time_since_epoch().count());
+    size = static_cast<uint64>(fileSize);
+    return true;
+}
+
+bool ReadFileContent(std::string_view path_utf8, std::vector<uint8>& content)
+{
+    std::ifstream file(fs::u8path(path_utf8), std::ios::in | std::ios::binary | std::ios::ate);
+    if (!file)
+        return false;
+
+    std::streamsize size = file.tellg();
+    file.seekg(0, std::ios::beg);
+
+    content.resize(static_cast<size_t>(size));
+    return size == 0 || file.read(reinterpret_cast<char*>(content.data()), size).good();
+}
+
+bool WriteFileContent(std::string_view path_utf8, const std::vector<uint8>& content)
+{
+    std::ofstream file(fs::u8path(path_utf8), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file)
+        return false;
+
+    file.write(reinterpret_cast<const char*>(content.data()), content.size());
+
+    // Buffered data is only written on close, which can fail too.
+    file.close();
+    return !file.fail();
+}
+
+bool ReplaceFileContent(std::string_view path_utf8, const std::vector<uint8>& content)
+{
+    std::string temporaryPath_utf8 = std::string(path_utf8) + ".tmp";
+
+#if defined(GUGU_OS_WINDOWS)
+
+    std::wstring temporaryPath = fs::u8path(temporaryPath_utf8).wstring();
+    std::wstring path = fs::u8path(path_utf8).wstring();
+
+    HANDLE file = CreateFileW(temporaryPath.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    bool success = true;
+    size_t position = 0;
+    while (success && position < content.size())
+    {
+        DWORD chunkSize = static_cast<DWORD>(std::min<size_t>(content.size() - position, 1 << 30));
+        DWORD writtenSize = 0;
+        success = WriteFile(file, content.data() + position, chunkSize, &writtenSize, NULL) && writtenSize > 0;
+        position += writtenSize;
+    }
+
+    success = success && FlushFileBuffers(file);
+    success = CloseHandle(file) && success;
+
+    // The write through flag returns once the rename is flushed to the disk.
+    success = success && MoveFileExW(temporaryPath.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+
+#else
+
+    int file = open(temporaryPath_utf8.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (file < 0)
+        return false;
+
+    bool success = true;
+    size_t position = 0;
+    while (success && position < content.size())
+    {
+        ssize_t writtenSize = write(file, content.data() + position, content.size() - position);
+        if (writtenSize > 0)
+        {
+            position += static_cast<size_t>(writtenSize);
+        }
+        else if (writtenSize < 0 && errno != EINTR)
+        {
+            success = false;
+        }
+    }
+
+    success = success && fsync(file) == 0;
+    success = close(file) == 0 && success;
+
+    success = success && rename(temporaryPath_utf8.c_str(), std::string(path_utf8).c_str()) == 0;
+
+    // The rename is only durable once the directory entry is flushed too.
+    if (success)
+    {
+        std::string directoryPath_utf8 = DirectoryPartFromPath(path_utf8);
+        int directory = open(directoryPath_utf8.empty() ? "." : directoryPath_utf8.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (directory >= 0)
+        {
+            success = fsync(directory) == 0;
+            close(directory);
+        }
+    }
+
+#endif
+
+    if (!success)
+    {
+        RemoveFile(temporaryPath_utf8);
+    }
+
+    return success;
+}
+
 bool EnsureDirectoryExists(std::string_view path_utf8)
 {
     if (path_utf8.empty())
@@ -209,7 +349,9 @@ bool EnsureDirectoryExists(std::string_view path_utf8)
 
 #else
 
-    return false;
+    std::error_code errorCode;
+    fs::create_directories(fs::u8path(path_utf8), errorCode);
+    return !errorCode;
 
 #endif
 }
@@ -226,6 +368,13 @@ bool RemoveFile(std::string_view path_utf8)
     return false;
 }
 
+bool RenameFile(std::string_view path_utf8, std::string_view newPath_utf8)
+{
+    std::error_code errorCode;
+    fs::rename(fs::u8path(path_utf8), fs::u8path(newPath_utf8), errorCode);
+    return !errorCode;
+}
+
 bool RemoveTargetDirectory(std::string_view path_utf8)
 {
     fs::path convertedPath = fs::u8path(path_utf8);
@@ -4,6 +4,7 @@
 // Includes
 
 #include "Gugu/System/FileInfo.h"
+#include "Gugu/System/Types.h"
 
 ////////////////////////////////////////////////////////////////
 // File Declarations
@@ -25,10 +26,20 @@ void GetDirectories(std::string_view rootPath_utf8, std::vector<std::string>& di
 
 bool DirectoryExists(std::string_view path_utf8);
 bool FileExists(std::string_view path_utf8);
+bool IsFileNewer(std::string_view path_utf8, std::string_view referencePath_utf8);   // Return true if the file has been modified after the reference file.
+bool GetFileStats(std::string_view path_utf8, int64& modificationTime, uint64& size);   // The modification time is only meant to be compared with other values from this function.
+
+bool ReadFileContent(std::string_view path_utf8, std::vector<uint8>& content);
+bool WriteFileContent(std::string_view path_utf8, const std::vector<uint8>& content);
+
+// Write the content in a temporary file flushed to the disk, then rename it over the target path.
+// - An interrupted write keeps the previous content intact, the temporary path is the target path with a ".tmp" suffix.
+bool ReplaceFileContent(std::string_view path_utf8, const std::vector<uint8>& content);
 
 bool EnsureDirectoryExists(std::string_view path_utf8);
 
 bool RemoveFile(std::string_view path_utf8);
+bool RenameFile(std::string_view path_utf8, std::string_view newPath_utf8);    // An existing file at the new path will be replaced.
 bool RemoveTargetDirectory(std::string_view path_utf8);
 bool RemoveDirectoryTree(std::string_view path_utf8);
 
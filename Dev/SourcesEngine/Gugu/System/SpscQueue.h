@@ -0,0 +1,50 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/System/Types.h"
+
+#include <atomic>
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// File Declarations
+
+namespace gugu {
+
+// Fixed capacity ring buffer, for a single producer thread and a single consumer thread.
+// - Push and pop never lock nor allocate, they return false when the queue is full or empty.
+// - The capacity is rounded up to a power of two.
+template<typename T>
+class SpscQueue
+{
+public:
+
+    explicit SpscQueue(size_t capacity);
+
+    size_t Capacity() const;
+    bool IsEmpty() const;       // Only reliable from the producer or consumer thread.
+
+    // Producer thread.
+    bool TryPush(const T& value);
+
+    // Consumer thread.
+    bool TryPop(T& value);
+
+private:
+
+    std::vector<T> m_slots;
+    size_t m_mask;
+
+    // Positions are never wrapped, the slot index is masked on access.
+    alignas(64) std::atomic<size_t> m_head;     // Next slot to pop, written by the consumer.
+    alignas(64) std::atomic<size_t> m_tail;     // Next slot to push, written by the producer.
+};
+
+}   // namespace gugu
+
+////////////////////////////////////////////////////////////////
+// Template Implementation
+
+#include "Gugu/System/SpscQueue.tpp"
@@ -0,0 +1,59 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// File Implementation
+
+namespace gugu {
+
+template<typename T>
+SpscQueue<T>::SpscQueue(size_t capacity)
+    : m_head(0)
+    , m_tail(0)
+{
+    size_t slotCount = 2;
+    while (slotCount < capacity)
+    {
+        slotCount *= 2;
+    }
+
+    m_slots.resize(slotCount);
+    m_mask = slotCount - 1;
+}
+
+template<typename T>
+size_t SpscQueue<T>::Capacity() const
+{
+    return m_slots.size();
+}
+
+template<typename T>
+bool SpscQueue<T>::IsEmpty() const
+{
+    return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+}
+
+template<typename T>
+bool SpscQueue<T>::TryPush(const T& value)
+{
+    size_t tail = m_tail.load(std::memory_order_relaxed);
+    if (tail - m_head.load(std::memory_order_acquire) == m_slots.size())
+        return false;
+
+    m_slots[tail & m_mask] = value;
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+template<typename T>
+bool SpscQueue<T>::TryPop(T& value)
+{
+    size_t head = m_head.load(std::memory_order_relaxed);
+    if (head == m_tail.load(std::memory_order_acquire))
+        return false;
+
+    value = m_slots[head & m_mask];
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+}   // namespace gugu
@@ -0,0 +1,245 @@
+////////////////////////////////////////////////////////////////
+// Header
+
+#include "Gugu/Common.h"
+#include "Gugu/System/StringTable.h"
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include <cassert>
+#include <cstring>
+
+////////////////////////////////////////////////////////////////
+// File Implementation
+
+namespace gugu {
+
+StringTable::StringTable()
+    : m_entryCount(0)
+    , m_currentBlock(nullptr)
+    , m_currentBlockUsedSize(0)
+    , m_storageSize(0)
+{
+    for (size_t i = 0; i < MaxPageCount; ++i)
+    {
+        m_pages[i] = nullptr;
+    }
+
+    // Reserve the 0 id for the empty string.
+    Intern(std::string_view());
+}
+
+StringTable::~StringTable()
+{
+    for (size_t i = 0; i < MaxPageCount; ++i)
+    {
+        delete[] m_pages[i];
+    }
+
+    for (char* block : m_blocks)
+    {
+        delete[] block;
+    }
+}
+
+uint32 StringTable::Intern(std::string_view value)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_lookup.find(value);
+    if (it != m_lookup.end())
+        return it->second;
+
+    assert(m_entryCount < PageEntryCount * MaxPageCount);
+
+    size_t pageIndex = m_entryCount / PageEntryCount;
+    if (!m_pages[pageIndex])
+    {
+        m_pages[pageIndex] = new Entry[PageEntryCount];
+    }
+
+    Entry& entry = m_pages[pageIndex][m_entryCount % PageEntryCount];
+    entry.data = StoreString(value);
+    entry.size = (uint32)value.size();
+
+    uint32 id = (uint32)m_entryCount;
+    ++m_entryCount;
+
+    m_lookup.insert(std::make_pair(std::string_view(entry.data, entry.size), id));
+    return id;
+}
+
+bool StringTable::TryFind(std::string_view value, uint32& id) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_lookup.find(value);
+    if (it == m_lookup.end())
+        return false;
+
+    id = it->second;
+    return true;
+}
+
+std::string_view StringTable::GetString(uint32 id) const
+{
+    const Entry& entry = m_pages[id / PageEntryCount][id % PageEntryCount];
+    return std::string_view(entry.data, entry.size);
+}
+
+const char* StringTable::GetCString(uint32 id) const
+{
+    return m_pages[id / PageEntryCount][id % PageEntryCount].data;
+}
+
+size_t StringTable::GetStringCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entryCount;
+}
+
+size_t StringTable::GetMemorySize() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    size_t pageCount = (m_entryCount + PageEntryCount - 1) / PageEntryCount;
+
+    // The lookup size is an approximation of a node based hash map (one node per entry, one pointer per bucket).
+    size_t lookupNodeSize = sizeof(std::pair<const std::string_view, uint32>) + sizeof(void*) + sizeof(size_t);
+
+    return sizeof(StringTable)
+        + m_storageSize
+        + pageCount * PageEntryCount * sizeof(Entry)
+        + m_lookup.bucket_count() * sizeof(void*)
+        + m_lookup.size() * lookupNodeSize;
+}
+
+const char* StringTable::StoreString(std::string_view value)
+{
+    size_t size = value.size() + 1;
+
+    char* data = nullptr;
+    if (size > BlockSize / 4)
+    {
+        // Large strings get their own block, to avoid wasting the end of the current block.
+        data = new char[size];
+        m_blocks.push_back(data);
+        m_storageSize += size;
+    }
+    else
+    {
+        if (!m_currentBlock || m_currentBlockUsedSize + size > BlockSize)
+        {
+            m_currentBlock = new char[BlockSize];
+            m_currentBlockUsedSize = 0;
+            m_blocks.push_back(m_currentBlock);
+            m_storageSize += BlockSize;
+        }
+
+        data = m_currentBlock + m_currentBlockUsedSize;
+        m_currentBlockUsedSize += size;
+    }
+
+    if (!value.empty())
+    {
+        std::memcpy(data, value.data(), value.size());
+    }
+
+    data[value.size()] = '\0';
+    return data;
+}
+
+StringTable* GetStringTable()
+{
+    static StringTable stringTable;
+    return &stringTable;
+}
+
+InternedString::InternedString()
+    : m_id(0)
+{
+}
+
+InternedString::InternedString(std::string_view value)
+    : m_id(value.empty() ? 0 : GetStringTable()->Intern(value))
+{
+}
+
+InternedString& InternedString::operator = (std::string_view value)
+{
+    m_id = value.empty() ? 0 : GetStringTable()->Intern(value);
+    return *this;
+}
+
+bool InternedString::TryFind(std::string_view value, InternedString& result)
+{
+    uint32 id = 0;
+    if (!GetStringTable()->TryFind(value, id))
+        return false;
+
+    result.m_id = id;
+    return true;
+}
+
+uint32 InternedString::GetId() const
+{
+    return m_id;
+}
+
+bool InternedString::IsEmpty() const
+{
+    return m_id == 0;
+}
+
+std::string_view InternedString::GetView() const
+{
+    return GetStringTable()->GetString(m_id);
+}
+
+const char* InternedString::GetCString() const
+{
+    return GetStringTable()->GetCString(m_id);
+}
+
+bool InternedString::operator == (const InternedString& right) const
+{
+    return m_id == right.m_id;
+}
+
+bool InternedString::operator != (const InternedString& right) const
+{
+    return m_id != right.m_id;
+}
+
+bool InternedString::operator < (const InternedString& right) const
+{
+    return m_id != right.m_id && GetView() < right.GetView();
+}
+
+bool operator == (const InternedString& left, std::string_view right)
+{
+    return left.GetView() == right;
+}
+
+bool operator == (std::string_view left, const InternedString& right)
+{
+    return left == right.GetView();
+}
+
+bool operator != (const InternedString& left, std::string_view right)
+{
+    return left.GetView() != right;
+}
+
+bool operator != (std::string_view left, const InternedString& right)
+{
+    return left != right.GetView();
+}
+
+std::ostream& operator << (std::ostream& stream, const InternedString& value)
+{
+    return stream << value.GetView();
+}
+
+}   // namespace gugu
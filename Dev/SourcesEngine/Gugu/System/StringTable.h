@@ -0,0 +1,111 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/System/Types.h"
+
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// File Declarations
+
+namespace gugu {
+
+// Storage for interned strings, shared by the whole application (see GetStringTable).
+// - Each distinct string is stored once, and receives a stable id (the 0 id is reserved for the empty string).
+// - Stored strings are null-terminated, and are never moved : ids and views stay valid until the end of the application.
+// - Registration is thread-safe, id resolution does not lock (ids are shared between threads through the usual synchronizations).
+class StringTable
+{
+public:
+
+    StringTable();
+    ~StringTable();
+
+    // Return the id of the string, registering it if needed.
+    uint32 Intern(std::string_view value);
+
+    // Return false if the string has never been registered.
+    bool TryFind(std::string_view value, uint32& id) const;
+
+    std::string_view GetString(uint32 id) const;
+    const char* GetCString(uint32 id) const;
+
+    size_t GetStringCount() const;
+    size_t GetMemorySize() const;       // Storage, ids and lookup table.
+
+private:
+
+    struct Entry
+    {
+        const char* data;
+        uint32 size;
+    };
+
+    const char* StoreString(std::string_view value);
+
+private:
+
+    static constexpr size_t PageEntryCount = 4096;
+    static constexpr size_t MaxPageCount = 4096;
+    static constexpr size_t BlockSize = 64 * 1024;
+
+    // Entries are stored in fixed pages, to allow resolving ids without locking while new strings are registered.
+    Entry* m_pages[MaxPageCount];
+    size_t m_entryCount;
+
+    std::vector<char*> m_blocks;
+    char* m_currentBlock;
+    size_t m_currentBlockUsedSize;
+    size_t m_storageSize;
+
+    std::unordered_map<std::string_view, uint32> m_lookup;
+    mutable std::mutex m_mutex;
+};
+
+StringTable* GetStringTable();
+
+// Handle on a string stored in the StringTable, with constant time copies and equality checks.
+// - Construction from a string registers it in the StringTable.
+// - Comparisons with regular strings do not register them.
+class InternedString
+{
+public:
+
+    InternedString();
+    explicit InternedString(std::string_view value);
+
+    InternedString& operator = (std::string_view value);
+
+    // Return false if the string has never been registered (the StringTable is left untouched).
+    static bool TryFind(std::string_view value, InternedString& result);
+
+    uint32 GetId() const;
+    bool IsEmpty() const;
+
+    std::string_view GetView() const;
+    const char* GetCString() const;
+
+    bool operator == (const InternedString& right) const;
+    bool operator != (const InternedString& right) const;
+    bool operator < (const InternedString& right) const;    // Lexicographic order, stable across runs (used by sorted containers).
+
+private:
+
+    uint32 m_id;
+};
+
+bool operator == (const InternedString& left, std::string_view right);
+bool operator == (std::string_view left, const InternedString& right);
+bool operator != (const InternedString& left, std::string_view right);
+bool operator != (std::string_view left, const InternedString& right);
+
+std::ostream& operator << (std::ostream& stream, const InternedString& value); // Used by toString
+
+}   // namespace gugu
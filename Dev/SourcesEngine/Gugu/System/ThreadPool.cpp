@@ -0,0 +1,201 @@
+////////////////////////////////////////////////////////////////
+// Header
+
+#include "Gugu/Common.h"
+#include "Gugu/System/ThreadPool.h"
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+////////////////////////////////////////////////////////////////
+// File Implementation
+
+namespace gugu {
+
+ThreadPool::ThreadPool()
+    : m_runningTaskCount(0)
+    , m_stopRequested(false)
+{
+}
+
+ThreadPool::~ThreadPool()
+{
+    Stop();
+}
+
+void ThreadPool::Start(size_t threadCount)
+{
+    if (IsRunning())
+        return;
+
+    if (threadCount == 0)
+    {
+        unsigned int hardwareThreadCount = std::thread::hardware_concurrency();
+        threadCount = hardwareThreadCount > 1 ? hardwareThreadCount - 1 : 1;
+    }
+
+    m_stopRequested = false;
+
+    m_threads.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i)
+    {
+        m_threads.push_back(std::thread(&ThreadPool::WorkerLoop, this));
+    }
+}
+
+void ThreadPool::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopRequested = true;
+    }
+
+    m_conditionTaskAvailable.notify_all();
+
+    for (size_t i = 0; i < m_threads.size(); ++i)
+    {
+        if (m_threads[i].joinable())
+        {
+            m_threads[i].join();
+        }
+    }
+
+    m_threads.clear();
+}
+
+bool ThreadPool::IsRunning() const
+{
+    return !m_threads.empty();
+}
+
+size_t ThreadPool::GetThreadCount() const
+{
+    return m_threads.size();
+}
+
+void ThreadPool::PushTask(const Callback& task)
+{
+    if (!task)
+        return;
+
+    if (!IsRunning())
+    {
+        // Without worker threads, the task is executed immediately.
+        task();
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tasks.push_back(task);
+    }
+
+    m_conditionTaskAvailable.notify_one();
+}
+
+void ThreadPool::WaitAllTasks()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_conditionTasksDone.wait(lock, [this]() { return m_tasks.empty() && m_runningTaskCount == 0; });
+}
+
+void ThreadPool::ParallelFor(size_t count, const std::function<void(size_t)>& body)
+{
+    if (count == 0)
+        return;
+
+    if (!IsRunning() || count == 1)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            body(i);
+        }
+
+        return;
+    }
+
+    // Each participant consumes indices until the range is exhausted.
+    // - The shared state is ref-counted, since helper tasks may start after this method has returned (they will find no index left).
+    struct ParallelForState
+    {
+        std::atomic<size_t> nextIndex { 0 };
+        std::atomic<size_t> processedCount { 0 };
+        std::mutex mutexDone;
+        std::condition_variable conditionDone;
+    };
+
+    std::shared_ptr<ParallelForState> state = std::make_shared<ParallelForState>();
+    const std::function<void(size_t)>* bodyPtr = &body;
+
+    auto processIndices = [state, bodyPtr, count]()
+    {
+        size_t localCount = 0;
+
+        size_t index = state->nextIndex.fetch_add(1);
+        while (index < count)
+        {
+            (*bodyPtr)(index);
+            ++localCount;
+
+            index = state->nextIndex.fetch_add(1);
+        }
+
+        if (localCount > 0 && state->processedCount.fetch_add(localCount) + localCount == count)
+        {
+            std::lock_guard<std::mutex> lock(state->mutexDone);
+            state->conditionDone.notify_all();
+        }
+    };
+
+    size_t helperCount = std::min(m_threads.size(), count - 1);
+    for (size_t i = 0; i < helperCount; ++i)
+    {
+        PushTask(processIndices);
+    }
+
+    processIndices();
+
+    std::unique_lock<std::mutex> lock(state->mutexDone);
+    state->conditionDone.wait(lock, [&state, count]() { return state->processedCount.load() == count; });
+}
+
+void ThreadPool::WorkerLoop()
+{
+    while (true)
+    {
+        Callback task;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_conditionTaskAvailable.wait(lock, [this]() { return m_stopRequested || !m_tasks.empty(); });
+
+            if (m_tasks.empty())
+            {
+                // Stop has been requested and there is no task left.
+                return;
+            }
+
+            task = m_tasks.front();
+            m_tasks.pop_front();
+            ++m_runningTaskCount;
+        }
+
+        task();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            --m_runningTaskCount;
+
+            if (m_tasks.empty() && m_runningTaskCount == 0)
+            {
+                m_conditionTasksDone.notify_all();
+            }
+        }
+    }
+}
+
+}   // namespace gugu
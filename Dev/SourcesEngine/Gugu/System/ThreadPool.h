@@ -0,0 +1,57 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Includes
+
+#include "Gugu/System/Callback.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// File Declarations
+
+namespace gugu {
+
+class ThreadPool
+{
+public:
+
+    ThreadPool();
+    ~ThreadPool();
+
+    // A thread count of zero will use the hardware concurrency (minus the main thread).
+    void Start(size_t threadCount);
+    void Stop();    // Pending tasks will be executed before the threads are joined.
+
+    bool IsRunning() const;
+    size_t GetThreadCount() const;
+
+    // Tasks are executed in submission order, on any worker thread.
+    void PushTask(const Callback& task);
+    void WaitAllTasks();
+
+    // Execute the body for each index in [0, count[, and return once every index has been processed.
+    // - The calling thread will also process indices, this should not be called from a worker thread.
+    void ParallelFor(size_t count, const std::function<void(size_t)>& body);
+
+private:
+
+    void WorkerLoop();
+
+private:
+
+    std::vector<std::thread> m_threads;
+    std::deque<Callback> m_tasks;
+    size_t m_runningTaskCount;
+    bool m_stopRequested;
+
+    std::mutex m_mutex;
+    std::condition_variable m_conditionTaskAvailable;
+    std::condition_variable m_conditionTasksDone;
+};
+
+}   // namespace gugu
@@ -32,6 +32,13 @@ float GetElapsedSeconds()
     return ms.count() * 0.001f;
 }
 
+int64 GetElapsedMicroseconds()
+{
+    static const std::chrono::time_point epoch = impl::elapsed_clock::now();
+    std::chrono::microseconds us = std::chrono::duration_cast<std::chrono::microseconds>(impl::elapsed_clock::now() - epoch);
+    return us.count();
+}
+
 int64 GetUtcTimestampAsMilliseconds()
 {
     // Note : system_clock::now() should return utc time.
@@ -22,6 +22,9 @@ namespace timeformat
 // Get elapsed seconds since an arbitrary epoch (probably system boot).
 float GetElapsedSeconds();
 
+// Get elapsed microseconds since an arbitrary epoch, from a monotonic clock (used for timers and round trip measures).
+int64 GetElapsedMicroseconds();
+
 // Get UTC timestamp as raw milliseconds since epoch.
 int64 GetUtcTimestampAsMilliseconds();
 
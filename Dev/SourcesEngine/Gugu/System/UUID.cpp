@@ -45,7 +45,7 @@ UUID UUID::Generate()
     return uuid;
 }
 
-UUID UUID::FromString(const std::string& value)
+UUID UUID::FromString(std::string_view value)
 {
     if (value.size() == 32)
     {
@@ -6,6 +6,7 @@
 #include "Gugu/System/Types.h"
 
 #include <string>
+#include <string_view>
 
 ////////////////////////////////////////////////////////////////
 // File Declarations
@@ -17,7 +18,7 @@ class UUID
 public:
 
     static UUID Generate();
-    static UUID FromString(const std::string& value);
+    static UUID FromString(std::string_view value);
 
     bool IsZero() const;
     std::string ToString() const;
@@ -132,11 +132,11 @@ void ParticleSystem::Init(const ParticleSystemSettings& settings)
     if (m_settings.imageSet && m_settings.imageSet->GetSubImageCount() > 0 && m_settings.imageSet->GetTexture())
     {
         m_imageSet = m_settings.imageSet;
-        m_texture = m_imageSet->GetTexture()->GetSFTexture();
+        m_texture = m_imageSet->GetTexture();
     }
     else if (m_settings.texture)
     {
-        m_texture = m_settings.texture->GetSFTexture();
+        m_texture = m_settings.texture;
     }
 }
 
@@ -367,8 +367,8 @@ void ParticleSystem::EmitParticle(size_t particleIndex)
     {
         float fLeft = 0.f;
         float fTop = 0.f;
-        float fRight = (float)m_texture->getSize().x;
-        float fBottom = (float)m_texture->getSize().y;
+        float fRight = (float)m_texture->GetSize().x;
+        float fBottom = (float)m_texture->GetSize().y;
 
         sf::Vertex* vertices = &m_dataVertices[particleIndex * 6];
         vertices->texCoords = Vector2f(fLeft, fTop); ++vertices;
@@ -625,7 +625,6 @@ void ParticleSystem::Render(RenderPass& _kRenderPass, const sf::Transform& _kTra
         return;
 
     sf::RenderStates states;
-    states.texture = m_texture;
     states.blendMode = m_blendMode;
 
     if (m_settings.localSpace)
@@ -633,6 +632,24 @@ void ParticleSystem::Render(RenderPass& _kRenderPass, const sf::Transform& _kTra
         states.transform = _kTransformSelf;
     }
 
+    if (m_texture)
+    {
+        // Streamed textures use the render scale to select their resident resolution (particles are expected to use one texel per unit).
+        float renderScale = 1.f;
+        if (m_texture->IsStreamed())
+        {
+            sf::FloatRect unitTransformed = states.transform.transformRect(sf::FloatRect(Vector2::Zero_f, Vector2f(1.f, 1.f)));
+            renderScale = Renderer::ComputeTextureRenderScale(_kRenderPass, unitTransformed, Vector2f(1.f, 1.f));
+        }
+
+        states.texture = m_texture->GetRenderSFTexture(renderScale);
+        if (!states.texture)
+            return;
+    }
+
+    // Particles vertices are rewritten each frame, the vertices scaled to a streaming fallback are not cached.
+    bool useResidentBuffer = m_texture && m_texture->GetResidentScale() != Vector2f(1.f, 1.f);
+
     if (m_settings.useSortBuffer)
     {
         if (m_nextEmitIndex == 0)
@@ -648,7 +665,20 @@ void ParticleSystem::Render(RenderPass& _kRenderPass, const sf::Transform& _kTra
             std::copy(m_dataVertices.begin(), m_dataVertices.begin() + sliceIndex, m_sortBuffer.begin() + sliceSize);
         }
 
-        _kRenderPass.target->draw(&m_sortBuffer[0], m_sortBuffer.size(), m_primitiveType, states);
+        if (useResidentBuffer)
+        {
+            m_texture->ComputeResidentVertices(&m_sortBuffer[0], m_sortBuffer.size(), m_residentBuffer);
+            _kRenderPass.target->draw(&m_residentBuffer[0], m_residentBuffer.size(), m_primitiveType, states);
+        }
+        else
+        {
+            _kRenderPass.target->draw(&m_sortBuffer[0], m_sortBuffer.size(), m_primitiveType, states);
+        }
+    }
+    else if (useResidentBuffer)
+    {
+        m_texture->ComputeResidentVertices(&m_dataVertices[0], m_dataVertices.size(), m_residentBuffer);
+        _kRenderPass.target->draw(&m_residentBuffer[0], m_residentBuffer.size(), m_primitiveType, states);
     }
     else
     {
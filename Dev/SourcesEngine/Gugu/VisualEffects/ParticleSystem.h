@@ -16,6 +16,7 @@ namespace gugu
     class Element;
     class ParticleEffect;
     class ImageSet;
+    class Texture;
     struct RenderPass;
 }
 
@@ -79,7 +80,7 @@ private:
     size_t m_maxParticleCount;
     size_t m_verticesPerParticle;
     sf::PrimitiveType m_primitiveType;
-    sf::Texture* m_texture;
+    Texture* m_texture;
     sf::BlendMode m_blendMode;      // TODO: Move this to ParticleSystemSettings ?
     ImageSet* m_imageSet;
     Element* m_element;
@@ -99,6 +100,7 @@ private:
     // Particles data
     std::vector<sf::Vertex> m_dataVertices;
     std::vector<sf::Vertex> m_sortBuffer;
+    std::vector<sf::Vertex> m_residentBuffer;   // Vertices scaled to the resident texture, while a streamed texture only has its fallback resident.
     std::vector<float> m_dataLifetime;
     std::vector<float> m_dataRemainingTime;
     std::vector<Vector2f> m_dataPosition;
@@ -7,14 +7,18 @@
 ////////////////////////////////////////////////////////////////
 // Includes
 
+#include "Gugu/Engine.h"
 #include "Gugu/Element/Element.h"
 #include "Gugu/Window/Window.h"
 #include "Gugu/Window/Camera.h"
 #include "Gugu/Scene/Scene.h"
+#include "Gugu/Math/MathUtility.h"
 
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 
+#include <cmath>
+
 ////////////////////////////////////////////////////////////////
 // File Implementation
 
@@ -39,6 +43,7 @@ void Renderer::DefaultRenderScene(FrameInfos* frameInfos, Window* window, Scene*
     renderPass.pass = GUGU_RENDERPASS_DEFAULT;
     renderPass.target = window->GetSFRenderWindow();
     renderPass.frameInfos = frameInfos;
+    renderPass.stepInterpolation = GetEngine()->GetStepInterpolation();
 
     RenderElementHierarchy(renderPass, scene->GetRootNode(), camera);
 }
@@ -52,6 +57,7 @@ void Renderer::DefaultRenderWindow(FrameInfos* frameInfos, Window* window, Camer
     renderPass.pass = GUGU_RENDERPASS_DEFAULT;
     renderPass.target = window->GetSFRenderWindow();
     renderPass.frameInfos = frameInfos;
+    renderPass.stepInterpolation = GetEngine()->GetStepInterpolation();
 
     RenderElementHierarchy(renderPass, window->GetUINode(), camera);
     RenderElementHierarchy(renderPass, window->GetMouseNode(), camera);
@@ -70,6 +76,17 @@ sf::FloatRect Renderer::ComputeViewport(const sf::View& view)
     return viewport;
 }
 
+float Renderer::ComputeTextureRenderScale(const RenderPass& renderPass, const sf::FloatRect& globalRect, const Vector2f& texelSize)
+{
+    if (texelSize.x == 0.f || texelSize.y == 0.f || renderPass.rectViewport.size.x <= 0.f || renderPass.rectViewport.size.y <= 0.f)
+        return 1.f;
+
+    Vector2u targetSize = renderPass.target->getSize();
+    float scaleX = globalRect.size.x * targetSize.x / (renderPass.rectViewport.size.x * std::abs(texelSize.x));
+    float scaleY = globalRect.size.y * targetSize.y / (renderPass.rectViewport.size.y * std::abs(texelSize.y));
+    return Min(scaleX, scaleY);
+}
+
 void Renderer::RenderElementHierarchy(RenderPass& renderPass, Element* root, Camera* camera)
 {
     if (!root)
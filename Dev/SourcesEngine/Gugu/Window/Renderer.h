@@ -3,6 +3,8 @@
 ////////////////////////////////////////////////////////////////
 // Includes
 
+#include "Gugu/Math/Vector2.h"
+
 #include "SFML/Graphics/Rect.hpp"
 #include "SFML/Graphics/RectangleShape.hpp"
 
@@ -49,6 +51,7 @@ struct RenderPass
     sf::RenderTarget* target = nullptr;
     int pass = GUGU_RENDERPASS_DEFAULT;
     sf::FloatRect rectViewport;  // Pre-computed viewport   //TODO: rename to express the culling usage.
+    float stepInterpolation = 1.f;  // Used by Elements with transform interpolation.
 
     int statRenderedSprites = 0;
     int statRenderedTexts = 0;
@@ -67,6 +70,9 @@ public:
 
     static sf::FloatRect ComputeViewport(const sf::View& view);
 
+    // Amount of screen pixels per texel, on the least magnified axis, used by streamed textures to select their resident resolution.
+    static float ComputeTextureRenderScale(const RenderPass& renderPass, const sf::FloatRect& globalRect, const Vector2f& texelSize);
+
 protected:
 
     void DefaultRenderScene(FrameInfos* frameInfos, Window* window, Scene* scene, Camera* camera);